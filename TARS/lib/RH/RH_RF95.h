@@ -706,8 +706,9 @@ class RH_RF95 : public RHSPIDriver {
    protected:
     /// This is a low level function to handle the interrupts for one instance
     /// of RH_RF95. Called automatically by isr*() Should not need to be called
-    /// by user code.
-    void handleInterrupt();
+    /// by user code. Virtual so that a subclass can wake whatever is waiting
+    /// on the radio once the base class has handled the interrupt.
+    virtual void handleInterrupt();
 
     /// Examine the revceive buffer to determine whether the message is for this
     /// node
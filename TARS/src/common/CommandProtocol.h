@@ -0,0 +1,215 @@
+/**
+ * @file CommandProtocol.h
+ *
+ * @brief Reliable delivery of the ground station's commands to TARS, several at a time.
+ *
+ * The ground station numbers its commands and keeps up to COMMAND_WINDOW of them outstanding. Its answer in each
+ * listening window, a CommandUplink, carries every one TARS has not acknowledged yet, so a lost uplink costs a window
+ * rather than a command, and all of them can complete in one. TARS runs a command when its id first arrives, in
+ * whatever order they do, and never again. Every frame and event message acknowledges them in command_ack, the lowest
+ * id TARS has not received, and command_sack, bit i of which is set if it has received command_ack + 1 + i.
+ *
+ * Retransmissions follow the radio schedule: a command goes out again in each window until a frame acknowledges it,
+ * and the ground station gives up on it after COMMAND_MAX_SENDS windows. The uplink's base, the oldest id still
+ * outstanding, then moves past it, and TARS stops waiting on that id. The ground station starts numbering at the
+ * command_ack of the first frame it hears, so that it can be restarted in flight.
+ *
+ * Header only, with no dependencies beyond the C library, for the ground station to include as well.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/LinkAdaptation.h"
+
+// Commands outstanding at once, which every uplink has room for
+#define COMMAND_WINDOW 4
+// Windows a command is sent in before the ground station gives up on it
+#define COMMAND_MAX_SENDS 5
+
+static_assert(COMMAND_WINDOW >= 1 && COMMAND_WINDOW <= 8, "command_sack holds the acknowledgements of the window");
+
+// Commands transmitted from ground station to rocket
+enum CommandType : uint8_t { SET_FREQ, SET_CALLSIGN, ABORT, TEST_FLAPS };
+
+struct telemetry_command {
+    uint16_t id;
+    CommandType command;
+    union {
+        char callsign[8];
+        float freq;
+        bool do_abort;
+    };
+};
+
+// Sent by the ground station in every listening window, with only as many commands as count
+struct CommandUplink {
+    char verify[6] = {'A', 'Y', 'B', 'E', 'R', 'K'};
+    // How the ground station has been hearing TARS
+    LinkReport link;
+    // Id of the next event the ground station is waiting for
+    uint8_t event_ack = 0;
+    uint8_t count = 0;
+    // Oldest id the ground station still waits on, the ones before it are done with
+    uint16_t base = 0;
+    telemetry_command commands[COMMAND_WINDOW];
+};
+
+// Bytes of an uplink carrying count commands
+constexpr size_t commandUplinkSize(size_t count) {
+    return offsetof(CommandUplink, commands) + count * sizeof(telemetry_command);
+}
+
+/**
+ * @brief The TARS end, which decides which commands are new and acknowledges them.
+ */
+class CommandReceiver {
+   public:
+    uint16_t ack() const { return next_; }
+    uint8_t sack() const { return (uint8_t)(received_ >> 1); }
+
+    // Whether the uplink is from the ground station
+    static bool verify(const CommandUplink& uplink) {
+        static const char key[6] = {'A', 'Y', 'B', 'E', 'R', 'K'};
+        return memcmp(uplink.verify, key, sizeof(key)) == 0;
+    }
+
+    // Moves past the ids before the uplink's base, which the ground station has given up on
+    void setBase(uint16_t base) {
+        uint16_t offset = (uint16_t)(base - next_);
+        if (offset == 0 || offset >= 0x8000) {
+            return;
+        }
+        received_ = offset < 16 ? received_ >> offset : 0;
+        next_ = base;
+        advance();
+    }
+
+    /**
+     * @brief Call for each command of an uplink, after setBase.
+     *
+     * @return true if the command is to be run, false if it was received before or is outside the window
+     */
+    bool receive(uint16_t id) {
+        uint16_t offset = (uint16_t)(id - next_);
+        if (offset >= COMMAND_WINDOW || (received_ & (1u << offset))) {
+            return false;
+        }
+        received_ |= 1u << offset;
+        advance();
+        return true;
+    }
+
+   private:
+    void advance() {
+        while (received_ & 1) {
+            received_ >>= 1;
+            next_++;
+        }
+    }
+
+    uint16_t next_ = 0;
+    // Bit i set if next_ + i has been received, so never bit 0
+    uint16_t received_ = 0;
+};
+
+/**
+ * @brief The ground station end, which numbers the commands and sends them until they are acknowledged.
+ */
+class CommandSender {
+   public:
+    // TARS only takes ids less than a window past the oldest outstanding one
+    bool full() const { return (uint16_t)(next_id_ - base()) >= COMMAND_WINDOW; }
+    bool empty() const { return count_ == 0; }
+
+    // Numbers the commands from the command_ack of the first frame heard, those queued before it included
+    void sync(uint16_t ack) {
+        if (synced_) {
+            return;
+        }
+        synced_ = true;
+        next_id_ = ack;
+        for (size_t i = 0; i < count_; i++) {
+            outstanding_[i].command.id = next_id_++;
+        }
+    }
+
+    // Queues a command, numbering it. Returns false if the window is full.
+    bool push(const telemetry_command& command) {
+        if (full()) {
+            return false;
+        }
+        Entry& entry = outstanding_[count_++];
+        entry.command = command;
+        entry.command.id = next_id_++;
+        entry.sends = 0;
+        return true;
+    }
+
+    /**
+     * @brief Puts every outstanding command in the uplink, giving up on those sent COMMAND_MAX_SENDS times already.
+     * Sends none until synced, their ids not being known yet.
+     *
+     * @param on_failed called with (const telemetry_command& command) for each given up on
+     */
+    template <typename F>
+    void fill(CommandUplink& uplink, F&& on_failed) {
+        if (!synced_) {
+            uplink.count = 0;
+            uplink.base = base();
+            return;
+        }
+        size_t kept = 0;
+        for (size_t i = 0; i < count_; i++) {
+            if (outstanding_[i].sends >= COMMAND_MAX_SENDS) {
+                on_failed(outstanding_[i].command);
+            } else {
+                outstanding_[kept++] = outstanding_[i];
+            }
+        }
+        count_ = kept;
+        uplink.count = (uint8_t)count_;
+        uplink.base = base();
+        for (size_t i = 0; i < count_; i++) {
+            outstanding_[i].sends++;
+            uplink.commands[i] = outstanding_[i].command;
+        }
+    }
+
+    /**
+     * @brief Takes the command_ack and command_sack of a frame or event message.
+     *
+     * @param on_done called with (const telemetry_command& command) for each newly acknowledged
+     */
+    template <typename F>
+    void acknowledge(uint16_t ack, uint8_t sack, F&& on_done) {
+        size_t kept = 0;
+        for (size_t i = 0; i < count_; i++) {
+            uint16_t offset = (uint16_t)(outstanding_[i].command.id - ack);
+            if (offset >= 0x8000 || (offset >= 1 && offset <= 8 && (sack & (1 << (offset - 1))))) {
+                on_done(outstanding_[i].command);
+            } else {
+                outstanding_[kept++] = outstanding_[i];
+            }
+        }
+        count_ = kept;
+    }
+
+    // Oldest id still outstanding, or the next to be given out
+    uint16_t base() const { return count_ > 0 ? outstanding_[0].command.id : next_id_; }
+
+   private:
+    struct Entry {
+        telemetry_command command;
+        uint8_t sends;
+    };
+
+    // Oldest first
+    Entry outstanding_[COMMAND_WINDOW];
+    size_t count_ = 0;
+    uint16_t next_id_ = 0;
+    bool synced_ = false;
+};
@@ -0,0 +1,335 @@
+/**
+ * @file LinkAdaptation.h
+ *
+ * @brief Picks the LoRa modem profile of the telemetry link from the ground station's reports, and keeps the two ends
+ * on the same one.
+ *
+ * TARS decides. The ground station answers every frame TARS listens after with a LinkReport: the mean RSSI and SNR of
+ * the frames it got since its last report, and how many it missed going by their RadioHead header ids. TARS pools the
+ * reports until they cover LINK_REPORT_FRAMES frames, then moves to the fastest profile with enough margin for that
+ * SNR, stepping down at once when the link gets bad and up one profile at a time once it has been good for a few
+ * pools. A window with no report at all steps down straight away, without waiting for a pool. A switch is announced
+ * in the link_next and link_countdown fields of the LINK_ANNOUNCE_FRAMES frames before it, and both ends change profile
+ * after the frame that counts down to 1, once done with its listening window.
+ *
+ * Neither end can count on hearing the other when the link goes quiet, so both step down one profile at a time on
+ * their own: TARS, announcing it, after every LINK_MISSED_WINDOWS windows with no report, the ground station every
+ * linkLostMs with no frame. Both boot on the most robust profile.
+ *
+ * Header only and free of Arduino calls, for the ground station and tools/link_sim to include as well.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#include "common/LoRa.h"
+
+#define LINK_PROFILE_COUNT 4
+#define LINK_FALLBACK_PROFILE (LINK_PROFILE_COUNT - 1)
+// Frames that announce a switch, unless set otherwise
+#define LINK_ANNOUNCE_FRAMES 3
+// Most frames a switch can be announced over, one less than a power of two for the range of the link_countdown field
+#define LINK_MAX_ANNOUNCE_FRAMES 15
+// Listening windows in a row with no report before TARS steps down a profile
+#define LINK_MISSED_WINDOWS 2
+// Frames the reports TARS pools must cover, as one report covers only two frames on the slow profiles
+#define LINK_REPORT_FRAMES 10
+// Pools in a row with room for the next faster profile before TARS moves up to it
+#define LINK_UP_REPORTS 2
+
+// Margins above the SNR a profile needs, with a gap between them so that the link does not flap
+#define LINK_MARGIN_DOWN_DB 3.0f
+#define LINK_MARGIN_UP_DB 6.0f
+// Margin of the profile TARS steps down to
+#define LINK_MARGIN_TARGET_DB 5.0f
+// Share of frames lost over a pool above which TARS steps down, and at most which it may step up
+#define LINK_LOSS_DOWN 0.4f
+#define LINK_LOSS_UP 0.1f
+// The SX1276 SNR reading saturates around +10 dB, so above this the RSSI is the better measure
+#define LINK_SNR_SATURATION_DB 5.0f
+#define LINK_NOISE_FIGURE_DB 6.0f
+
+struct LoRaProfile {
+    LoRaModulation modulation;
+    // Longest frame sent with it, keeping the slow profiles to a bounded airtime
+    uint8_t max_frame;
+};
+
+// Fastest first, the last is the fallback. The second is the RadioHead default the link used to be fixed at.
+static const LoRaProfile link_profiles[LINK_PROFILE_COUNT] = {
+    {{7, 250000, 5, 8}, 190},
+    {{7, 125000, 5, 8}, 190},
+    {{9, 125000, 6, 8}, 128},
+    {{10, 125000, 8, 8}, 96},
+};
+
+// Sent by the ground station with every uplink
+struct LinkReport {
+    // Means over the frames received since the last report, SNR in quarter dB as the SX1276 gives it
+    int16_t rssi = 0;
+    int8_t snr = 0;
+    // Profile the ground station received them on
+    uint8_t profile = 0;
+    uint16_t received = 0;
+    uint16_t lost = 0;
+};
+
+// SNR below which the SX1276 stops demodulating a spreading factor
+inline float loraRequiredSnrDb(uint8_t spreading_factor) { return -2.5f * (spreading_factor - 4); }
+
+inline float loraNoiseFloorDbm(uint32_t bandwidth_hz) {
+    return -174.0f + 10.0f * log10f((float)bandwidth_hz) + LINK_NOISE_FIGURE_DB;
+}
+
+// Longest a frame of the profile can take, in ms
+inline uint32_t linkFrameMs(uint8_t profile) {
+    const LoRaProfile& p = link_profiles[profile];
+    return loraAirtimeUs(p.modulation, p.max_frame + 4) / 1000;
+}
+
+// How long the ground station waits for a frame before stepping down, two frames and a couple of listening windows, to
+// go about when TARS steps down after missing its reports
+inline uint32_t linkLostMs(uint8_t profile) { return 2 * linkFrameMs(profile) + 2000; }
+
+/**
+ * @brief The TARS end, which decides on the profile.
+ */
+class LinkAdapter {
+   public:
+    // Profile the link is on, and the one it is switching to
+    uint8_t profile() const { return profile_; }
+    uint8_t next() const { return next_; }
+    // Frames left on profile() including the last one started, 0 when not switching
+    uint8_t countdown() const { return countdown_; }
+    uint32_t switches() const { return switches_; }
+    uint32_t fallbacks() const { return fallbacks_; }
+
+    // Announces switches over more frames, for the ground station to get one in time when frames arrive late
+    void setAnnounceFrames(uint8_t frames) {
+        announce_frames_ = frames < LINK_MAX_ANNOUNCE_FRAMES ? frames : LINK_MAX_ANNOUNCE_FRAMES;
+    }
+
+    /**
+     * @brief Call before sending each frame.
+     *
+     * @return true if the frame goes out on a new profile, which the radio must be set to first
+     */
+    bool startFrame() {
+        bool changed = false;
+        if (next_ != profile_ && frames_left_ == 0) {
+            profile_ = next_;
+            switches_++;
+            missed_windows_ = 0;
+            changed = true;
+        }
+        countdown_ = frames_left_;
+        if (frames_left_ > 0) {
+            frames_left_--;
+        }
+        return changed;
+    }
+
+    void onReport(const LinkReport& report) {
+        // Reports from before a switch say nothing about this profile
+        if (report.profile != profile_ || report.received == 0) {
+            return;
+        }
+        missed_windows_ = 0;
+        if (next_ != profile_) {
+            return;
+        }
+        received_ += report.received;
+        lost_ += report.lost;
+        rssi_sum_ += (int32_t)report.rssi * report.received;
+        snr_sum_ += (int32_t)report.snr * report.received;
+
+        bool pool_full = received_ + lost_ >= LINK_REPORT_FRAMES || lost_ >= LINK_LOSS_DOWN * LINK_REPORT_FRAMES;
+        if (pool_full) {
+            float loss = (float)lost_ / (float)(received_ + lost_);
+            float snr = snrDb((float)snr_sum_ / received_, (float)rssi_sum_ / received_);
+            clearPool();
+            if (loss > LINK_LOSS_DOWN || margin(snr, profile_) < LINK_MARGIN_DOWN_DB) {
+                uint8_t target = profile_ + 1;
+                while (target < LINK_FALLBACK_PROFILE && margin(snr, target) < LINK_MARGIN_TARGET_DB) {
+                    target++;
+                }
+                good_reports_ = 0;
+                if (target <= LINK_FALLBACK_PROFILE) {
+                    announce(target);
+                }
+                return;
+            }
+            if (profile_ > 0 && loss <= LINK_LOSS_UP && margin(snr, profile_ - 1) >= LINK_MARGIN_UP_DB) {
+                if (++good_reports_ >= LINK_UP_REPORTS) {
+                    good_reports_ = 0;
+                    announce(profile_ - 1);
+                }
+            } else {
+                good_reports_ = 0;
+            }
+        }
+    }
+
+    // Call when a listening window closes with no report
+    void onWindowMissed() {
+        good_reports_ = 0;
+        if (++missed_windows_ < LINK_MISSED_WINDOWS || next_ != profile_ || profile_ == LINK_FALLBACK_PROFILE) {
+            return;
+        }
+        missed_windows_ = 0;
+        fallbacks_++;
+        // Announced all the same, as the ground station often still hears TARS when TARS no longer hears it
+        announce(profile_ + 1);
+    }
+
+   private:
+    // SNR in dB from a mean SNR reading in quarter dB and mean RSSI
+    float snrDb(float snr_quarter_db, float rssi) const {
+        float snr = snr_quarter_db / 4.0f;
+        if (snr >= LINK_SNR_SATURATION_DB) {
+            float from_rssi = rssi - loraNoiseFloorDbm(link_profiles[profile_].modulation.bandwidth_hz);
+            snr = from_rssi > snr ? from_rssi : snr;
+        }
+        return snr;
+    }
+
+    // Margin profile would have, given the SNR measured on the current one
+    float margin(float snr, uint8_t profile) const {
+        const LoRaModulation& current = link_profiles[profile_].modulation;
+        const LoRaModulation& other = link_profiles[profile].modulation;
+        float bandwidth_db = 10.0f * log10f((float)current.bandwidth_hz / (float)other.bandwidth_hz);
+        return snr + bandwidth_db - loraRequiredSnrDb(other.spreading_factor);
+    }
+
+    void announce(uint8_t profile) {
+        next_ = profile;
+        frames_left_ = announce_frames_;
+        clearPool();
+    }
+
+    void clearPool() {
+        received_ = 0;
+        lost_ = 0;
+        rssi_sum_ = 0;
+        snr_sum_ = 0;
+    }
+
+    uint8_t profile_ = LINK_FALLBACK_PROFILE;
+    uint8_t next_ = LINK_FALLBACK_PROFILE;
+    uint8_t announce_frames_ = LINK_ANNOUNCE_FRAMES;
+    uint8_t frames_left_ = 0;
+    uint8_t countdown_ = 0;
+    uint8_t missed_windows_ = 0;
+    uint8_t good_reports_ = 0;
+    // Pooled reports on profile_
+    uint16_t received_ = 0;
+    uint16_t lost_ = 0;
+    int32_t rssi_sum_ = 0;
+    int32_t snr_sum_ = 0;
+    uint32_t switches_ = 0;
+    uint32_t fallbacks_ = 0;
+};
+
+/**
+ * @brief The ground station end, which follows the announcements and measures the link for its reports.
+ */
+class LinkFollower {
+   public:
+    uint8_t profile() const { return profile_; }
+
+    /**
+     * @brief Call for every frame decoded.
+     *
+     * @param sequence RadioHead header id of the frame
+     * @param snr in quarter dB
+     * @param next, countdown the frame's link_next and link_countdown
+     */
+    void onFrame(uint8_t sequence, int16_t rssi, int8_t snr, uint8_t next, uint8_t countdown, uint32_t now_ms) {
+        if (have_sequence_) {
+            lost_ += (uint8_t)(sequence - last_sequence_ - 1);
+        }
+        have_sequence_ = true;
+        last_sequence_ = sequence;
+        received_++;
+        rssi_sum_ += rssi;
+        snr_sum_ += snr;
+        last_frame_ms_ = now_ms;
+
+        if (next != profile_ && next < LINK_PROFILE_COUNT) {
+            pending_ = next;
+            // Switches straight after the last frame, or when it should have come if that one is missed. Leaving out a
+            // listening window in between rather errs early, missing an old frame, than late, missing a new and often
+            // longer one when stepping down.
+            switch_ms_ = now_ms + (countdown > 1 ? (countdown - 1) * linkFrameMs(profile_) : 0);
+        } else {
+            pending_ = profile_;
+        }
+    }
+
+    // Call for packets that complete no frame yet, for the link not to be taken for lost while frames arrive late
+    void onPacket(uint32_t now_ms) { last_frame_ms_ = now_ms; }
+
+    /**
+     * @brief Call after handling each frame and regularly in between.
+     *
+     * @return true if profile() changed, and the radio must be set to it
+     */
+    bool update(uint32_t now_ms) {
+        if (pending_ != profile_ && (int32_t)(now_ms - switch_ms_) >= 0) {
+            switchTo(pending_, now_ms);
+            return true;
+        }
+        if (profile_ != LINK_FALLBACK_PROFILE && now_ms - last_frame_ms_ > linkLostMs(profile_)) {
+            switchTo(profile_ + 1, now_ms);
+            fallbacks_++;
+            return true;
+        }
+        return false;
+    }
+
+    // What the link was like since the last report
+    LinkReport report() {
+        LinkReport report;
+        report.profile = profile_;
+        report.received = received_;
+        report.lost = lost_;
+        if (received_ > 0) {
+            report.rssi = (int16_t)(rssi_sum_ / received_);
+            report.snr = (int8_t)(snr_sum_ / received_);
+        }
+        received_ = 0;
+        lost_ = 0;
+        rssi_sum_ = 0;
+        snr_sum_ = 0;
+        return report;
+    }
+
+    uint32_t fallbacks() const { return fallbacks_; }
+
+   private:
+    void switchTo(uint8_t profile, uint32_t now_ms) {
+        profile_ = profile;
+        pending_ = profile;
+        last_frame_ms_ = now_ms;
+        // Frames missed while on another profile than TARS are not the new profile's losses
+        have_sequence_ = false;
+        received_ = 0;
+        lost_ = 0;
+        rssi_sum_ = 0;
+        snr_sum_ = 0;
+    }
+
+    uint8_t profile_ = LINK_FALLBACK_PROFILE;
+    uint8_t pending_ = LINK_FALLBACK_PROFILE;
+    uint32_t switch_ms_ = 0;
+    uint32_t last_frame_ms_ = 0;
+    bool have_sequence_ = false;
+    uint8_t last_sequence_ = 0;
+    uint16_t received_ = 0;
+    uint16_t lost_ = 0;
+    int32_t rssi_sum_ = 0;
+    int32_t snr_sum_ = 0;
+    uint32_t fallbacks_ = 0;
+};
@@ -0,0 +1,70 @@
+/**
+ * @file LoRa.h
+ *
+ * @brief LoRa modulation settings, the SX1276 registers that select them and the time a packet takes on air with them.
+ *
+ * The airtime follows the SX1276 data sheet (section 4.1.1.7): the preamble plus the 4.25 symbols of sync word, then the
+ * payload in blocks of 4 * (SF - 2 * low data rate optimization) bits, each block taking 4 + coding rate symbols. The
+ * explicit header and the payload CRC are always on, as RadioHead sets them.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct LoRaModulation {
+    uint8_t spreading_factor = 7;
+    uint32_t bandwidth_hz = 125000;
+    // Denominator of the coding rate, 5 to 8 for 4/5 to 4/8
+    uint8_t coding_rate = 5;
+    uint16_t preamble = 8;
+};
+
+// Length of one symbol
+inline uint32_t loraSymbolUs(const LoRaModulation& modulation) {
+    return (uint32_t)(((uint64_t)1000000 << modulation.spreading_factor) / modulation.bandwidth_hz);
+}
+
+/**
+ * @brief Time on air of a packet of length bytes, including the RadioHead header.
+ */
+inline uint32_t loraAirtimeUs(const LoRaModulation& modulation, size_t length) {
+    uint32_t symbol_us = loraSymbolUs(modulation);
+    int sf = modulation.spreading_factor;
+    // The chip has to use low data rate optimization once symbols are longer than 16 ms
+    int low_rate = symbol_us > 16000 ? 1 : 0;
+    int bits = 8 * (int)length - 4 * sf + 28 + 16;
+    int block = 4 * (sf - 2 * low_rate);
+    int blocks = bits > 0 ? (bits + block - 1) / block : 0;
+    uint32_t symbols = 8 + blocks * modulation.coding_rate;
+    // The preamble is followed by 4.25 symbols of sync word
+    return (uint32_t)((modulation.preamble + 4) * symbol_us + symbol_us / 4 + symbols * symbol_us);
+}
+
+// Bandwidths the SX1276 supports, indexed by the code it takes in RegModemConfig1
+static const uint32_t lora_bandwidths_hz[10] = {7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000, 500000};
+
+// Values of RegModemConfig1, RegModemConfig2 and RegModemConfig3, as RadioHead's ModemConfig takes them
+struct LoRaModemRegisters {
+    uint8_t reg_1d;
+    uint8_t reg_1e;
+    uint8_t reg_26;
+};
+
+/**
+ * @brief The modem registers for a modulation, with the explicit header and the AGC on, and the payload CRC unless the
+ * frames are protected otherwise.
+ */
+inline LoRaModemRegisters loraModemRegisters(const LoRaModulation& modulation, bool crc = true) {
+    uint8_t bandwidth = 0;
+    while (bandwidth < 9 && lora_bandwidths_hz[bandwidth] < modulation.bandwidth_hz) {
+        bandwidth++;
+    }
+    LoRaModemRegisters registers;
+    registers.reg_1d = (uint8_t)((bandwidth << 4) | ((modulation.coding_rate - 4) << 1));
+    registers.reg_1e = (uint8_t)((modulation.spreading_factor << 4) | (crc ? 0x04 : 0));
+    // Low data rate optimization, then AGC auto on
+    registers.reg_26 = (uint8_t)((loraSymbolUs(modulation) > 16000 ? 0x08 : 0) | 0x04);
+    return registers;
+}
@@ -0,0 +1,267 @@
+/**
+ * @file ReedSolomon.h
+ *
+ * @brief Systematic Reed-Solomon code over GF(256), shortened to any codeword length up to 255 bytes.
+ *
+ * A codeword is the data followed by parity bytes, the first byte being the highest power of x. The generator has the
+ * roots a^0 to a^(parity - 1), a = 2 in the field of x^8 + x^4 + x^3 + x^2 + 1. The decoder corrects e unknown errors
+ * and f erasures, bytes known to be missing, as long as 2e + f <= parity: Berlekamp-Massey started from the erasure
+ * locator, a Chien search for the errata and Forney's formula for their values.
+ *
+ * Header only, with no dependencies beyond the C library, for the ground station to include as well.
+ * REED_SOLOMON_COUNT(n) is called with the field multiplications done, for tools to count them.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef REED_SOLOMON_COUNT
+#define REED_SOLOMON_COUNT(n)
+#endif
+
+#define REED_SOLOMON_MAX_PARITY 64
+
+namespace reed_solomon {
+
+struct Tables {
+    // Doubled so that the sum of two logs needs no reduction
+    uint8_t exp[512];
+    uint8_t log[256];
+
+    Tables() {
+        unsigned x = 1;
+        for (unsigned i = 0; i < 255; i++) {
+            exp[i] = (uint8_t)x;
+            log[x] = (uint8_t)i;
+            x <<= 1;
+            if (x & 0x100) {
+                x ^= 0x11d;
+            }
+        }
+        for (unsigned i = 255; i < 512; i++) {
+            exp[i] = exp[i - 255];
+        }
+        log[0] = 0;
+    }
+};
+
+inline const Tables& tables() {
+    static const Tables t;
+    return t;
+}
+
+inline uint8_t multiply(uint8_t a, uint8_t b) {
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+    const Tables& t = tables();
+    return t.exp[t.log[a] + t.log[b]];
+}
+
+inline uint8_t divide(uint8_t a, uint8_t b) {
+    if (a == 0) {
+        return 0;
+    }
+    const Tables& t = tables();
+    return t.exp[t.log[a] + 255 - t.log[b]];
+}
+
+// a^power
+inline uint8_t pow2(unsigned power) { return tables().exp[power % 255]; }
+
+// Evaluates the polynomial with coefficients lowest power first
+inline uint8_t evaluate(const uint8_t* poly, size_t length, uint8_t x) {
+    uint8_t y = 0;
+    for (size_t i = length; i-- > 0;) {
+        y = multiply(y, x) ^ poly[i];
+    }
+    REED_SOLOMON_COUNT(length);
+    return y;
+}
+
+}  // namespace reed_solomon
+
+class ReedSolomon {
+   public:
+    explicit ReedSolomon(uint8_t parity = 0) : parity_(parity > REED_SOLOMON_MAX_PARITY ? 0 : parity) {
+        using namespace reed_solomon;
+        // generator_[i] is the coefficient of x^i, the product of (x - a^j)
+        memset(generator_, 0, sizeof(generator_));
+        generator_[0] = 1;
+        for (unsigned j = 0; j < parity_; j++) {
+            uint8_t root = pow2(j);
+            for (unsigned i = j + 1; i > 0; i--) {
+                generator_[i] = generator_[i - 1] ^ multiply(generator_[i], root);
+            }
+            generator_[0] = multiply(generator_[0], root);
+        }
+    }
+
+    uint8_t parity() const { return parity_; }
+
+    /**
+     * @brief Computes the parity bytes that follow length bytes of data in a codeword.
+     */
+    void encode(const uint8_t* data, size_t length, uint8_t* parity) const {
+        using namespace reed_solomon;
+        // Remainder of data * x^parity divided by the generator, highest power first
+        memset(parity, 0, parity_);
+        for (size_t i = 0; i < length; i++) {
+            uint8_t feedback = data[i] ^ parity[0];
+            memmove(parity, parity + 1, parity_ - 1);
+            parity[parity_ - 1] = 0;
+            if (feedback != 0) {
+                for (unsigned j = 0; j < parity_; j++) {
+                    parity[j] ^= multiply(feedback, generator_[parity_ - 1 - j]);
+                }
+            }
+        }
+        REED_SOLOMON_COUNT(length * parity_);
+    }
+
+    /**
+     * @brief Corrects a codeword in place.
+     *
+     * @param length of the whole codeword, data and parity, at most 255
+     * @param erasures indices of the bytes known to be wrong, in any order
+     *
+     * @return the number of bytes corrected, or -1 if there were too many errors to correct, in which case the
+     *         codeword is left as it was
+     */
+    int decode(uint8_t* codeword, size_t length, const uint8_t* erasures, size_t erasure_count) const {
+        using namespace reed_solomon;
+        if (length > 255 || length <= parity_ || erasure_count > parity_) {
+            return -1;
+        }
+        uint8_t syndromes[REED_SOLOMON_MAX_PARITY];
+        if (!computeSyndromes(codeword, length, syndromes)) {
+            return 0;
+        }
+
+        // Errata locator, lowest power first, starting as the erasure locator: the product of (1 - X x)
+        uint8_t locator[REED_SOLOMON_MAX_PARITY + 1] = {1};
+        size_t degree = 0;
+        for (size_t k = 0; k < erasure_count; k++) {
+            uint8_t x = pow2(length - 1 - erasures[k]);
+            for (size_t i = ++degree; i > 0; i--) {
+                locator[i] ^= multiply(locator[i - 1], x);
+            }
+        }
+
+        // Berlekamp-Massey over the syndromes the erasures leave
+        uint8_t previous[REED_SOLOMON_MAX_PARITY + 1];
+        memcpy(previous, locator, sizeof(previous));
+        size_t errata = erasure_count;
+        uint8_t previous_discrepancy = 1;
+        unsigned shift = 1;
+        for (size_t n = erasure_count; n < parity_; n++) {
+            uint8_t discrepancy = 0;
+            for (size_t i = 0; i <= errata && i <= n; i++) {
+                discrepancy ^= multiply(locator[i], syndromes[n - i]);
+            }
+            REED_SOLOMON_COUNT(errata + 1);
+            if (discrepancy == 0) {
+                shift++;
+                continue;
+            }
+            uint8_t scale = divide(discrepancy, previous_discrepancy);
+            if (2 * errata <= n + erasure_count) {
+                uint8_t saved[REED_SOLOMON_MAX_PARITY + 1];
+                memcpy(saved, locator, sizeof(saved));
+                for (size_t i = shift; i <= parity_; i++) {
+                    locator[i] ^= multiply(scale, previous[i - shift]);
+                }
+                errata = n + 1 + erasure_count - errata;
+                memcpy(previous, saved, sizeof(previous));
+                previous_discrepancy = discrepancy;
+                shift = 1;
+            } else {
+                for (size_t i = shift; i <= parity_; i++) {
+                    locator[i] ^= multiply(scale, previous[i - shift]);
+                }
+                shift++;
+            }
+            REED_SOLOMON_COUNT(parity_);
+        }
+        if (errata > parity_) {
+            return -1;
+        }
+
+        // Chien search, which must find as many errata as the locator has roots
+        uint8_t positions[REED_SOLOMON_MAX_PARITY];
+        size_t found = 0;
+        for (size_t i = 0; i < length; i++) {
+            if (evaluate(locator, errata + 1, pow2(255 - (length - 1 - i) % 255)) == 0) {
+                if (found == errata) {
+                    return -1;
+                }
+                positions[found++] = (uint8_t)i;
+            }
+        }
+        if (found != errata) {
+            return -1;
+        }
+
+        // Forney: the value at X is X * evaluator(1/X) / locator'(1/X), the evaluator being syndromes * locator
+        uint8_t evaluator[REED_SOLOMON_MAX_PARITY] = {};
+        for (size_t i = 0; i < parity_; i++) {
+            for (size_t j = 0; j <= i && j <= errata; j++) {
+                evaluator[i] ^= multiply(syndromes[i - j], locator[j]);
+            }
+        }
+        REED_SOLOMON_COUNT(parity_ * (errata + 1));
+        uint8_t derivative[REED_SOLOMON_MAX_PARITY] = {};
+        for (size_t i = 1; i <= errata; i += 2) {
+            derivative[i - 1] = locator[i];
+        }
+        uint8_t values[REED_SOLOMON_MAX_PARITY];
+        for (size_t k = 0; k < found; k++) {
+            uint8_t x = pow2(length - 1 - positions[k]);
+            uint8_t x_inverse = divide(1, x);
+            uint8_t denominator = evaluate(derivative, errata, x_inverse);
+            if (denominator == 0) {
+                return -1;
+            }
+            values[k] = multiply(x, divide(evaluate(evaluator, parity_, x_inverse), denominator));
+        }
+
+        for (size_t k = 0; k < found; k++) {
+            codeword[positions[k]] ^= values[k];
+        }
+        if (computeSyndromes(codeword, length, syndromes)) {
+            for (size_t k = 0; k < found; k++) {
+                codeword[positions[k]] ^= values[k];
+            }
+            return -1;
+        }
+        int corrected = 0;
+        for (size_t k = 0; k < found; k++) {
+            corrected += values[k] != 0;
+        }
+        return corrected;
+    }
+
+   private:
+    // Evaluates the codeword at each root of the generator, returns true if any is not zero
+    bool computeSyndromes(const uint8_t* codeword, size_t length, uint8_t* syndromes) const {
+        using namespace reed_solomon;
+        bool any = false;
+        for (unsigned j = 0; j < parity_; j++) {
+            uint8_t root = pow2(j);
+            uint8_t s = 0;
+            for (size_t i = 0; i < length; i++) {
+                s = multiply(s, root) ^ codeword[i];
+            }
+            syndromes[j] = s;
+            any |= s != 0;
+        }
+        REED_SOLOMON_COUNT(length * parity_);
+        return any;
+    }
+
+    uint8_t parity_;
+    uint8_t generator_[REED_SOLOMON_MAX_PARITY + 1];
+};
@@ -65,6 +65,7 @@ void ServoControl::servoActuation(float length) {
     int servo_angle = roundOffAngle(angle);
 
     servo_->write(servo_angle);
+    this->angle = servo_angle;
 
     // 130 is max
 #ifdef SERVO_DEBUG
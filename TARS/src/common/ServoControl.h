@@ -12,6 +12,9 @@ class ServoControl {
     int min_angle = 27;
     int max_angle = 70;
 
+    // Angle last written to the servo in degrees
+    int angle = 0;
+
    private:
     PWMServo* servo_;
     int roundOffAngle(float value);
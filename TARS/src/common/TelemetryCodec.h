@@ -0,0 +1,370 @@
+/**
+ * @file TelemetryCodec.h
+ *
+ * @brief Bit packed telemetry frames, generated from the field lists in TelemetrySchema.h.
+ *
+ * A frame is, least significant bit first:
+ *
+ *     type (8 bits) | version (4 bits) | datapoint count (5 bits) | status fields | datapoint columns
+ *
+ * Every field is the number of resolution steps above its min, in the fewest bits that hold its range. Datapoints go
+ * column by column: a field's first value, then a 6 bit width and the zigzag encoded difference of each following value
+ * from the one before in that width, which is the narrowest all the differences fit in. Samples a few tens of ms apart
+ * change little, so a datapoint after the first takes a few bytes where the struct it replaces took 24.
+ *
+ * The type is TELEMETRY_MESSAGE_FRAME. An event message is the same header with TELEMETRY_MESSAGE_EVENTS and an event
+ * count, its own fields, and then each event's fields in full, oldest first. One event makes a message of 13 bytes,
+ * TELEMETRY_MAX_EVENTS of them 64.
+ *
+ * Header only, with no dependencies beyond the C library, for the ground station to include as well.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/TelemetrySchema.h"
+
+#define TELEMETRY_MEMBER(type, name, min, max, resolution) type name{};
+
+// Latest values of the slow or derived fields
+struct TelemetryStatus {
+    TELEMETRY_STATUS_FIELDS(TELEMETRY_MEMBER)
+};
+
+struct TelemetryDatapoint {
+    TELEMETRY_DATAPOINT_FIELDS(TELEMETRY_MEMBER)
+};
+
+struct TelemetryFrame {
+    TelemetryStatus status;
+    uint8_t datapoint_count = 0;
+    // Oldest first
+    TelemetryDatapoint datapoints[TELEMETRY_MAX_DATAPOINTS];
+};
+
+struct TelemetryEvent {
+    TELEMETRY_EVENT_FIELDS(TELEMETRY_MEMBER)
+};
+
+struct TelemetryEventMessage {
+    TELEMETRY_EVENT_MESSAGE_FIELDS(TELEMETRY_MEMBER)
+    uint8_t event_count = 0;
+    // Oldest first
+    TelemetryEvent events[TELEMETRY_MAX_EVENTS];
+};
+
+#undef TELEMETRY_MEMBER
+
+namespace telemetry_codec {
+
+constexpr unsigned bitWidth(uint64_t n) { return n ? 1 + bitWidth(n >> 1) : 0; }
+
+// Bits of a field holding [min, max) in steps of resolution
+constexpr unsigned fieldBits(double min, double max, double resolution) {
+    return bitWidth((uint64_t)((max - min) / resolution + 0.5) - 1);
+}
+
+constexpr unsigned type_bits = 8;
+constexpr unsigned version_bits = 4;
+constexpr unsigned count_bits = bitWidth(TELEMETRY_MAX_DATAPOINTS);
+constexpr unsigned event_count_bits = bitWidth(TELEMETRY_MAX_EVENTS);
+// Holds the width of a difference, up to 33 bits for a 32 bit field
+constexpr unsigned width_bits = 6;
+
+static_assert(TELEMETRY_CODEC_VERSION < (1 << version_bits), "version does not fit its field");
+
+// The steps above min nearest to value, clamped to the field. NaN is sent as min.
+inline uint32_t quantize(double value, double min, double resolution, unsigned bits) {
+    double steps = floor((value - min) / resolution + 0.5);
+    double top = (double)((1ull << bits) - 1);
+    if (!(steps > 0)) {
+        return 0;
+    }
+    return steps >= top ? (uint32_t)top : (uint32_t)steps;
+}
+
+template <typename T>
+T dequantize(uint32_t steps, double min, double resolution) {
+    return (T)(min + steps * resolution);
+}
+
+inline uint64_t zigzag(int64_t value) { return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63); }
+inline int64_t unzigzag(uint64_t value) { return (int64_t)(value >> 1) ^ -(int64_t)(value & 1); }
+
+class BitWriter {
+   public:
+    BitWriter(uint8_t* buffer, size_t capacity) : buffer_(buffer) { memset(buffer, 0, capacity); }
+
+    void write(uint64_t value, unsigned bits) {
+        while (bits > 0) {
+            unsigned offset = position_ & 7;
+            unsigned count = 8 - offset < bits ? 8 - offset : bits;
+            buffer_[position_ >> 3] |= (uint8_t)((value & ((1u << count) - 1)) << offset);
+            value >>= count;
+            bits -= count;
+            position_ += count;
+        }
+    }
+
+    size_t size() const { return (position_ + 7) / 8; }
+
+   private:
+    uint8_t* buffer_;
+    size_t position_ = 0;
+};
+
+class BitReader {
+   public:
+    BitReader(const uint8_t* buffer, size_t size) : buffer_(buffer), size_bits_(size * 8) {}
+
+    // Reads past the end give zeros and set overrun
+    uint64_t read(unsigned bits) {
+        if (position_ + bits > size_bits_) {
+            overrun_ = true;
+            position_ = size_bits_;
+            return 0;
+        }
+        uint64_t value = 0;
+        unsigned done = 0;
+        while (done < bits) {
+            unsigned offset = position_ & 7;
+            unsigned count = 8 - offset < bits - done ? 8 - offset : bits - done;
+            value |= (uint64_t)((buffer_[position_ >> 3] >> offset) & ((1u << count) - 1)) << done;
+            done += count;
+            position_ += count;
+        }
+        return value;
+    }
+
+    bool overrun() const { return overrun_; }
+
+   private:
+    const uint8_t* buffer_;
+    size_t size_bits_;
+    size_t position_ = 0;
+    bool overrun_ = false;
+};
+
+// How to get a field of a record as steps and set it from them
+template <typename Record>
+struct Field {
+    unsigned bits;
+    uint32_t (*get)(const Record& record);
+    void (*set)(Record& record, uint32_t steps);
+};
+
+#define TELEMETRY_FIELD(Record, type, name, min, max, resolution)                                      \
+    {fieldBits(min, max, resolution),                                                                  \
+     [](const Record& record) { return quantize(record.name, min, resolution, fieldBits(min, max, resolution)); }, \
+     [](Record& record, uint32_t steps) { record.name = dequantize<type>(steps, min, resolution); }},
+#define TELEMETRY_STATUS_FIELD(...) TELEMETRY_FIELD(TelemetryStatus, __VA_ARGS__)
+#define TELEMETRY_DATAPOINT_FIELD(...) TELEMETRY_FIELD(TelemetryDatapoint, __VA_ARGS__)
+#define TELEMETRY_EVENT_MESSAGE_FIELD(...) TELEMETRY_FIELD(TelemetryEventMessage, __VA_ARGS__)
+#define TELEMETRY_EVENT_FIELD(...) TELEMETRY_FIELD(TelemetryEvent, __VA_ARGS__)
+
+const Field<TelemetryStatus> status_fields[] = {TELEMETRY_STATUS_FIELDS(TELEMETRY_STATUS_FIELD)};
+const Field<TelemetryDatapoint> datapoint_fields[] = {TELEMETRY_DATAPOINT_FIELDS(TELEMETRY_DATAPOINT_FIELD)};
+constexpr size_t status_field_count = sizeof(status_fields) / sizeof(status_fields[0]);
+constexpr size_t datapoint_field_count = sizeof(datapoint_fields) / sizeof(datapoint_fields[0]);
+const Field<TelemetryEventMessage> event_message_fields[] = {
+    TELEMETRY_EVENT_MESSAGE_FIELDS(TELEMETRY_EVENT_MESSAGE_FIELD)};
+const Field<TelemetryEvent> event_fields[] = {TELEMETRY_EVENT_FIELDS(TELEMETRY_EVENT_FIELD)};
+
+#undef TELEMETRY_FIELD
+#undef TELEMETRY_STATUS_FIELD
+#undef TELEMETRY_DATAPOINT_FIELD
+#undef TELEMETRY_EVENT_MESSAGE_FIELD
+#undef TELEMETRY_EVENT_FIELD
+
+inline unsigned statusBits() {
+    unsigned bits = type_bits + version_bits + count_bits;
+    for (const Field<TelemetryStatus>& field : status_fields) {
+        bits += field.bits;
+    }
+    return bits;
+}
+
+inline unsigned eventBits() {
+    unsigned bits = 0;
+    for (const Field<TelemetryEvent>& field : event_fields) {
+        bits += field.bits;
+    }
+    return bits;
+}
+
+}  // namespace telemetry_codec
+
+/**
+ * @brief Encodes the status and as many of the newest datapoints as fit in capacity bytes.
+ *
+ * @param buffer at least capacity bytes, capacity is usually TELEMETRY_MAX_FRAME_SIZE
+ * @param oldest if given, set to the index of the oldest datapoint encoded, or of the end if none was
+ *
+ * @return bytes of the frame, 0 if not even the status fits
+ */
+inline size_t encodeTelemetryFrame(const TelemetryFrame& frame, uint8_t* buffer, size_t capacity,
+                                   size_t* oldest = nullptr) {
+    using namespace telemetry_codec;
+    size_t count = frame.datapoint_count < TELEMETRY_MAX_DATAPOINTS ? frame.datapoint_count : TELEMETRY_MAX_DATAPOINTS;
+    uint32_t steps[datapoint_field_count][TELEMETRY_MAX_DATAPOINTS];
+    for (size_t f = 0; f < datapoint_field_count; f++) {
+        for (size_t i = 0; i < count; i++) {
+            steps[f][i] = datapoint_fields[f].get(frame.datapoints[i]);
+        }
+    }
+
+    // Takes in older datapoints while the frame fits, widening the columns for their differences
+    const size_t status_bits = statusBits();
+    size_t first = count;
+    if (oldest) {
+        *oldest = first;
+    }
+    if (status_bits > capacity * 8) {
+        return 0;
+    }
+    unsigned widths[datapoint_field_count] = {};
+    while (first > 0) {
+        size_t candidate = first - 1;
+        size_t candidate_bits = status_bits;
+        unsigned candidate_widths[datapoint_field_count];
+        for (size_t f = 0; f < datapoint_field_count; f++) {
+            candidate_widths[f] = widths[f];
+            if (candidate + 1 < count) {
+                int64_t difference = (int64_t)steps[f][candidate + 1] - steps[f][candidate];
+                unsigned width = bitWidth(zigzag(difference));
+                candidate_widths[f] = width > widths[f] ? width : widths[f];
+            }
+            candidate_bits += datapoint_fields[f].bits;
+            if (count - candidate > 1) {
+                candidate_bits += width_bits + (count - candidate - 1) * candidate_widths[f];
+            }
+        }
+        if (candidate_bits > capacity * 8) {
+            break;
+        }
+        first = candidate;
+        memcpy(widths, candidate_widths, sizeof(widths));
+    }
+    if (oldest) {
+        *oldest = first;
+    }
+
+    BitWriter writer(buffer, capacity);
+    writer.write(TELEMETRY_MESSAGE_FRAME, type_bits);
+    writer.write(TELEMETRY_CODEC_VERSION, version_bits);
+    writer.write(count - first, count_bits);
+    for (const Field<TelemetryStatus>& field : status_fields) {
+        writer.write(field.get(frame.status), field.bits);
+    }
+    for (size_t f = 0; f < datapoint_field_count && first < count; f++) {
+        writer.write(steps[f][first], datapoint_fields[f].bits);
+        if (count - first > 1) {
+            writer.write(widths[f], width_bits);
+        }
+        for (size_t i = first + 1; i < count; i++) {
+            writer.write(zigzag((int64_t)steps[f][i] - steps[f][i - 1]), widths[f]);
+        }
+    }
+    return writer.size();
+}
+
+/**
+ * @brief Decodes a frame made by encodeTelemetryFrame.
+ *
+ * @return false if the message is not a frame, is of another version, is cut short or holds values outside their fields
+ */
+inline bool decodeTelemetryFrame(const uint8_t* buffer, size_t size, TelemetryFrame& frame) {
+    using namespace telemetry_codec;
+    BitReader reader(buffer, size);
+    if (reader.read(type_bits) != TELEMETRY_MESSAGE_FRAME || reader.read(version_bits) != TELEMETRY_CODEC_VERSION) {
+        return false;
+    }
+    size_t count = reader.read(count_bits);
+    if (count > TELEMETRY_MAX_DATAPOINTS) {
+        return false;
+    }
+    frame.datapoint_count = (uint8_t)count;
+    for (const Field<TelemetryStatus>& field : status_fields) {
+        field.set(frame.status, (uint32_t)reader.read(field.bits));
+    }
+    for (size_t f = 0; f < datapoint_field_count && count > 0; f++) {
+        const Field<TelemetryDatapoint>& field = datapoint_fields[f];
+        int64_t value = (int64_t)reader.read(field.bits);
+        field.set(frame.datapoints[0], (uint32_t)value);
+        unsigned width = count > 1 ? (unsigned)reader.read(width_bits) : 0;
+        for (size_t i = 1; i < count; i++) {
+            value += unzigzag(reader.read(width));
+            if (value < 0 || value >= (int64_t)(1ull << field.bits)) {
+                return false;
+            }
+            field.set(frame.datapoints[i], (uint32_t)value);
+        }
+    }
+    return !reader.overrun();
+}
+
+// The type byte of a message, 0 if it is empty
+inline uint8_t telemetryMessageType(const uint8_t* buffer, size_t size) { return size > 0 ? buffer[0] : 0; }
+
+/**
+ * @brief Encodes the fields of an event message and as many of its oldest events as fit in capacity bytes.
+ *
+ * @return bytes of the message, 0 if not even its fields fit
+ */
+inline size_t encodeTelemetryEvents(const TelemetryEventMessage& message, uint8_t* buffer, size_t capacity) {
+    using namespace telemetry_codec;
+    size_t bits = type_bits + version_bits + event_count_bits;
+    for (const Field<TelemetryEventMessage>& field : event_message_fields) {
+        bits += field.bits;
+    }
+    if (bits > capacity * 8) {
+        return 0;
+    }
+    size_t count = message.event_count < TELEMETRY_MAX_EVENTS ? message.event_count : TELEMETRY_MAX_EVENTS;
+    count = count < (capacity * 8 - bits) / eventBits() ? count : (capacity * 8 - bits) / eventBits();
+
+    BitWriter writer(buffer, capacity);
+    writer.write(TELEMETRY_MESSAGE_EVENTS, type_bits);
+    writer.write(TELEMETRY_CODEC_VERSION, version_bits);
+    writer.write(count, event_count_bits);
+    for (const Field<TelemetryEventMessage>& field : event_message_fields) {
+        writer.write(field.get(message), field.bits);
+    }
+    for (size_t i = 0; i < count; i++) {
+        for (const Field<TelemetryEvent>& field : event_fields) {
+            writer.write(field.get(message.events[i]), field.bits);
+        }
+    }
+    return writer.size();
+}
+
+/**
+ * @brief Decodes an event message made by encodeTelemetryEvents.
+ *
+ * @return false if the message is not an event message, is of another version or is cut short
+ */
+inline bool decodeTelemetryEvents(const uint8_t* buffer, size_t size, TelemetryEventMessage& message) {
+    using namespace telemetry_codec;
+    BitReader reader(buffer, size);
+    if (reader.read(type_bits) != TELEMETRY_MESSAGE_EVENTS || reader.read(version_bits) != TELEMETRY_CODEC_VERSION) {
+        return false;
+    }
+    size_t count = reader.read(event_count_bits);
+    if (count > TELEMETRY_MAX_EVENTS) {
+        return false;
+    }
+    message.event_count = (uint8_t)count;
+    for (const Field<TelemetryEventMessage>& field : event_message_fields) {
+        field.set(message, (uint32_t)reader.read(field.bits));
+    }
+    for (size_t i = 0; i < count; i++) {
+        for (const Field<TelemetryEvent>& field : event_fields) {
+            field.set(message.events[i], (uint32_t)reader.read(field.bits));
+        }
+    }
+    return !reader.overrun();
+}
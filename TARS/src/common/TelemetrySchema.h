@@ -0,0 +1,119 @@
+/**
+ * @file TelemetrySchema.h
+ *
+ * @brief The fields of a telemetry frame, with the type, range and resolution of each.
+ *
+ * TelemetryCodec.h generates the frame structs, the encoder and the decoder from these lists, and both TARS and the
+ * ground station include it, so the two always agree on the layout. A field holds [min, max) in steps of resolution,
+ * taking as many bits as that needs; values outside are clamped. Change TELEMETRY_CODEC_VERSION with any list.
+ *
+ * Every message starts with a type byte. Frames carry the status and datapoints, event messages the urgent events that
+ * TARS repeats ahead of the frames until the ground station acknowledges them.
+ */
+
+#pragma once
+
+#include "common/CommandProtocol.h"
+#include "common/LinkAdaptation.h"
+
+#define TELEMETRY_CODEC_VERSION 6
+
+// Datapoints a frame can carry, and the most bytes a frame may take, the size of the struct the codec replaced
+#define TELEMETRY_MAX_DATAPOINTS 24
+#define TELEMETRY_MAX_FRAME_SIZE 190
+// Events an event message can carry
+#define TELEMETRY_MAX_EVENTS 8
+
+// First byte of every message, which kind it is
+#define TELEMETRY_MESSAGE_FRAME 0x01
+#define TELEMETRY_MESSAGE_EVENTS 0x02
+
+// In the RadioHead header flags of a frame after which TARS listens for a command, the only time the ground station
+// should send one
+#define TELEMETRY_FLAG_LISTENING 0x01
+
+// What happened, with what the value of the event holds
+enum TelemetryEventKind : uint8_t {
+    // The new FSM_State
+    EVENT_STATE_CHANGE,
+    // The id of the abort command, once TARS has acted on it
+    EVENT_ABORT,
+    // An ErrorCode
+    EVENT_ERROR,
+};
+
+// Sent once per frame, the latest values and the range and mean of the high rate channels since the last frame, which
+// the datapoints only sample. FIELD(type, name, min, max, resolution)
+#define TELEMETRY_STATUS_FIELDS(FIELD)                                 \
+    FIELD(float, gps_lat, -90, 90, 1e-6)                               \
+    FIELD(float, gps_long, -180, 180, 1e-6)                            \
+    FIELD(float, gps_alt, -1024, 31744, 0.5)                           \
+    FIELD(float, gnc_state_x, -1024, 31744, 0.5)                       \
+    FIELD(float, gnc_state_vx, -1024, 1024, 1.0 / 32)                  \
+    FIELD(float, gnc_state_ax, -512, 512, 1.0 / 64)                    \
+    FIELD(float, gnc_state_y, -8192, 8192, 0.5)                        \
+    FIELD(float, gnc_state_vy, -512, 512, 1.0 / 32)                    \
+    FIELD(float, gnc_state_ay, -256, 256, 1.0 / 64)                    \
+    FIELD(float, gnc_state_z, -8192, 8192, 0.5)                        \
+    FIELD(float, gnc_state_vz, -512, 512, 1.0 / 32)                    \
+    FIELD(float, gnc_state_az, -256, 256, 1.0 / 64)                    \
+    FIELD(float, gnc_state_apo, -1024, 31744, 0.5)                     \
+    FIELD(float, gnc_state_apo_var, 0, 65536, 1)                       \
+    FIELD(float, mag_x, -4, 4, 1.0 / 8192)                             \
+    FIELD(float, mag_y, -4, 4, 1.0 / 8192)                             \
+    FIELD(float, mag_z, -4, 4, 1.0 / 8192)                             \
+    FIELD(float, gyro_x, -4096, 4096, 1.0 / 8)                         \
+    FIELD(float, gyro_y, -4096, 4096, 1.0 / 8)                         \
+    FIELD(float, gyro_z, -4096, 4096, 1.0 / 8)                         \
+    FIELD(int16_t, response_ID, -32768, 32768, 1)                      \
+    FIELD(uint16_t, command_ack, 0, 65536, 1)                          \
+    FIELD(uint8_t, command_sack, 0, 1 << (COMMAND_WINDOW - 1), 1)      \
+    FIELD(int8_t, rssi, -128, 128, 1)                                  \
+    FIELD(float, voltage_battery, 0, 16, 1.0 / 16)                     \
+    FIELD(uint8_t, FSM_State, 0, 32, 1)                                \
+    FIELD(float, barometer_temp, -128, 128, 1.0 / 256)                 \
+    FIELD(float, highG_ax_min, -128, 128, 1.0 / 16)                    \
+    FIELD(float, highG_ax_max, -128, 128, 1.0 / 16)                    \
+    FIELD(float, highG_ax_mean, -128, 128, 1.0 / 16)                   \
+    FIELD(float, highG_ay_min, -128, 128, 1.0 / 16)                    \
+    FIELD(float, highG_ay_max, -128, 128, 1.0 / 16)                    \
+    FIELD(float, highG_ay_mean, -128, 128, 1.0 / 16)                   \
+    FIELD(float, highG_az_min, -128, 128, 1.0 / 16)                    \
+    FIELD(float, highG_az_max, -128, 128, 1.0 / 16)                    \
+    FIELD(float, highG_az_mean, -128, 128, 1.0 / 16)                   \
+    FIELD(float, flap_extension_min, 0, 64, 1.0 / 16)                  \
+    FIELD(float, flap_extension_max, 0, 64, 1.0 / 16)                  \
+    FIELD(float, flap_extension_mean, 0, 64, 1.0 / 16)                 \
+    FIELD(uint8_t, task_id, 0, 256, 1)                                 \
+    FIELD(uint8_t, task_overruns, 0, 256, 1)                           \
+    FIELD(uint16_t, task_wcet_us, 0, 65536, 1)                         \
+    FIELD(uint16_t, task_jitter_us_max, 0, 65536, 1)                   \
+    FIELD(uint8_t, link_next, 0, LINK_PROFILE_COUNT, 1)                \
+    FIELD(uint8_t, link_countdown, 0, LINK_MAX_ANNOUNCE_FRAMES + 1, 1)
+
+// Sampled between frames, sent as the first value and the differences between consecutive ones
+#define TELEMETRY_DATAPOINT_FIELDS(FIELD)                 \
+    FIELD(uint32_t, timestamp, 0, 4294967296.0, 1)        \
+    FIELD(float, barometer_pressure, 0, 4096, 1.0 / 16)   \
+    FIELD(float, highG_ax, -128, 128, 1.0 / 256)          \
+    FIELD(float, highG_ay, -128, 128, 1.0 / 256)          \
+    FIELD(float, highG_az, -128, 128, 1.0 / 256)          \
+    FIELD(float, bno_roll, -4, 4, 1.0 / 8192)             \
+    FIELD(float, bno_pitch, -4, 4, 1.0 / 8192)            \
+    FIELD(float, bno_yaw, -4, 4, 1.0 / 8192)              \
+    FIELD(float, flap_extension, 0, 64, 1.0 / 64)
+
+// Sent once per event message, the command acknowledgements and link fields of the status, for the ground station to
+// act on as it does on frames
+#define TELEMETRY_EVENT_MESSAGE_FIELDS(FIELD)                          \
+    FIELD(uint16_t, command_ack, 0, 65536, 1)                          \
+    FIELD(uint8_t, command_sack, 0, 1 << (COMMAND_WINDOW - 1), 1)      \
+    FIELD(uint8_t, link_next, 0, LINK_PROFILE_COUNT, 1)                \
+    FIELD(uint8_t, link_countdown, 0, LINK_MAX_ANNOUNCE_FRAMES + 1, 1)
+
+// Each event, the id counting up by one per event for the ground station to acknowledge and drop repeats by
+#define TELEMETRY_EVENT_FIELDS(FIELD)              \
+    FIELD(uint8_t, id, 0, 256, 1)                  \
+    FIELD(uint8_t, kind, 0, 4, 1)                  \
+    FIELD(uint32_t, timestamp, 0, 4294967296.0, 1) \
+    FIELD(int16_t, value, -32768, 32768, 1)
@@ -0,0 +1,59 @@
+/**
+ * @file TripleBuffer.h
+ *
+ * @brief Lock-free single-producer single-consumer slot holding the latest published value.
+ *
+ * The writer fills a private back buffer and then atomically swaps it with the shared middle buffer. The reader
+ * atomically swaps the middle buffer into its private front buffer whenever a new value is available. Neither side
+ * ever waits on the other, so a high priority reader can never be blocked by a low priority writer it preempted
+ * (which would happen with a mutex or a seqlock on a single core).
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class TripleBuffer {
+   public:
+    TripleBuffer() = default;
+
+    /**
+     * @brief Publishes a new value, replacing any value the reader has not picked up yet. Writer side only.
+     */
+    void write(T const& value) {
+        buffers_[back_] = value;
+        uint8_t prev = middle_.exchange(back_ | fresh_flag, std::memory_order_acq_rel);
+        back_ = prev & index_mask;
+    }
+
+    /**
+     * @brief Reads the most recently published value. Reader side only.
+     *
+     * @param value written with the latest value, left untouched if nothing has been published yet
+     * @return true if a value has ever been published
+     */
+    bool read(T& value) {
+        if (middle_.load(std::memory_order_relaxed) & fresh_flag) {
+            uint8_t prev = middle_.exchange(front_, std::memory_order_acq_rel);
+            front_ = prev & index_mask;
+            has_value_ = true;
+        }
+        if (!has_value_) {
+            return false;
+        }
+        value = buffers_[front_];
+        return true;
+    }
+
+   private:
+    static constexpr uint8_t index_mask = 0x3;
+    static constexpr uint8_t fresh_flag = 0x4;
+
+    T buffers_[3] = {};
+    uint8_t back_ = 0;
+    std::atomic<uint8_t> middle_{1};
+    uint8_t front_ = 2;
+    bool has_value_ = false;
+};
@@ -0,0 +1,40 @@
+/**
+ * @file WindowStats.h
+ *
+ * @brief Min, max, mean and last value of a signal over a window of samples, in constant time and space per sample.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct WindowStats {
+    float min = 0;
+    float max = 0;
+    float sum = 0;
+    float last = 0;
+    uint32_t count = 0;
+
+    void add(float value) {
+        if (count == 0 || value < min) {
+            min = value;
+        }
+        if (count == 0 || value > max) {
+            max = value;
+        }
+        sum += value;
+        last = value;
+        count++;
+    }
+
+    // The last value if the window has no samples
+    float mean() const { return count > 0 ? sum / (float)count : last; }
+
+    // Starts the next window, which holds the last value until a sample arrives
+    void reset() {
+        min = last;
+        max = last;
+        sum = 0;
+        count = 0;
+    }
+};
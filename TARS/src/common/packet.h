@@ -58,6 +58,9 @@ template <size_t count>
 struct rocketStateData {
     FSM_State rocketStates[count];
     systime_t timestamp = 0;
+    // Authoritative state from the FSMArbiter and the VoteReason it was entered with
+    FSM_State arbiter_state = FSM_State::STATE_INIT;
+    uint8_t arbiter_reason = 0;
 
     rocketStateData() : rocketStates() {
         for (size_t i = 0; i < count; i++) {
@@ -148,6 +151,7 @@ struct KalmanData {
     float kalman_vel_z = 0;
     float kalman_acc_z = 0;
     float kalman_apo = 0;
+    float kalman_apo_var = 0;
 
     systime_t timeStamp_state = 0;
 };
@@ -0,0 +1,117 @@
+/**
+ * @file PeriodicTask.cpp
+ *
+ * @brief Deadline scheduling and timing stats of the periodic threads.
+ */
+
+#include "mcu_main/PeriodicTask.h"
+
+#include <Arduino.h>
+
+#include "mcu_main/Trace.h"
+
+PeriodicTask* PeriodicTask::first_ = nullptr;
+uint8_t PeriodicTask::count_ = 0;
+
+/**
+ * @param name name the stats are reported under
+ * @param period time between two releases of the loop
+ */
+PeriodicTask::PeriodicTask(const char* name, sysinterval_t period)
+    : name_(name), period_(period), id_(count_++), next_(first_) {
+    first_ = this;
+}
+
+/**
+ * @brief Releases the first cycle. Has to be called from the task's thread right before its loop.
+ */
+void PeriodicTask::start() {
+    deadline_ = chVTGetSystemTime();
+    release_us_ = micros();
+}
+
+/**
+ * @brief Ends the current cycle and sleeps until the next deadline.
+ *
+ * If the work ran past the next deadline the cycle counts as an overrun and the missed releases are dropped, so the
+ * loop starts again right away instead of running several cycles back to back to catch up.
+ */
+void PeriodicTask::waitNext() {
+    finishCycle();
+
+    systime_t previous = deadline_;
+    deadline_ = chTimeAddX(previous, period_);
+    systime_t now = chVTGetSystemTime();
+    if (chTimeIsInRangeX(now, previous, deadline_)) {
+        TRACE_EVENT(Wait, 0);
+        chThdSleepUntilWindowed(previous, deadline_);
+        TRACE_EVENT(Run, 0);
+    } else {
+        stats_.overruns++;
+        deadline_ = now;
+    }
+    release();
+}
+
+/**
+ * @brief Ends the current cycle and sleeps until one of events is signalled, for a task woken by events rather than
+ * its period. Its cycles are never late, so only their execution times are recorded.
+ *
+ * @param events the events to wake on, which are cleared
+ * @param timeout longest time to wait
+ */
+void PeriodicTask::waitEvents(eventmask_t events, sysinterval_t timeout) {
+    finishCycle();
+    TRACE_EVENT(Wait, 0);
+    chEvtWaitAnyTimeout(events, timeout);
+    TRACE_EVENT(Run, 0);
+    release_us_ = micros();
+    stats_.cycles++;
+}
+
+void PeriodicTask::finishCycle() {
+    stats_.exec_us = micros() - release_us_;
+    if (stats_.exec_us > stats_.wcet_us) {
+        stats_.wcet_us = stats_.exec_us;
+    }
+}
+
+void PeriodicTask::release() {
+    uint32_t now_us = micros();
+    int32_t late_us = (int32_t)(now_us - release_us_) - (int32_t)TIME_I2US(period_);
+    release_us_ = now_us;
+
+    stats_.jitter_us = late_us < 0 ? -late_us : late_us;
+    if (stats_.jitter_us > stats_.jitter_us_max) {
+        stats_.jitter_us_max = stats_.jitter_us;
+    }
+    stats_.cycles++;
+}
+
+/**
+ * @brief Prints the stats of every task over serial as one JSON line.
+ */
+void printTaskStats() {
+    Serial.print(R"({"type": "task_stats", "value": {)");
+    for (PeriodicTask* task = PeriodicTask::first(); task; task = task->next()) {
+        const TaskStats& stats = task->stats();
+        Serial.print('"');
+        Serial.print(task->name());
+        Serial.print(R"(": {"id":)");
+        Serial.print(task->id());
+        Serial.print(R"(,"period_ms":)");
+        Serial.print(TIME_I2MS(task->period()));
+        Serial.print(R"(,"cycles":)");
+        Serial.print(stats.cycles);
+        Serial.print(R"(,"overruns":)");
+        Serial.print(stats.overruns);
+        Serial.print(R"(,"wcet_us":)");
+        Serial.print(stats.wcet_us);
+        Serial.print(R"(,"jitter_us":)");
+        Serial.print(stats.jitter_us);
+        Serial.print(R"(,"jitter_us_max":)");
+        Serial.print(stats.jitter_us_max);
+        Serial.print(task->next() ? "}," : "}");
+    }
+    Serial.println("}}");
+}
@@ -0,0 +1,79 @@
+/**
+ * @file PeriodicTask.h
+ *
+ * @brief Runs a thread loop on absolute deadlines and records how well it keeps to them.
+ *
+ * Sleeping for a fixed time after the work makes the real period the sleep plus the execution time, so it drifts with
+ * the load. A PeriodicTask instead releases the loop every period from the time it started, using
+ * chThdSleepUntilWindowed, and keeps timing stats for the loop that can be printed over serial (TASK_STATS) or
+ * downlinked in the telemetry packet.
+ *
+ *     PeriodicTask kalman_task("kalman", TIME_MS2I(50));
+ *
+ *     kalman_task.start();
+ *     while (true) {
+ *         ...
+ *         kalman_task.waitNext();
+ *     }
+ *
+ * A thread woken by events rather than a period ends each cycle with waitEvents instead, which keeps the same stats
+ * other than the overruns and jitter a period would give.
+ */
+
+#pragma once
+
+#include <ChRt.h>
+
+#include <cstdint>
+
+/**
+ * @brief Timing of a PeriodicTask. Execution times and jitter are measured with micros().
+ */
+struct TaskStats {
+    uint32_t cycles = 0;
+    // Cycles whose work was still running at the next deadline
+    uint32_t overruns = 0;
+    // Time from the release of the last cycle to the end of its work
+    uint32_t exec_us = 0;
+    // Worst case execution time
+    uint32_t wcet_us = 0;
+    // Difference between the last time between two releases and the period
+    uint32_t jitter_us = 0;
+    uint32_t jitter_us_max = 0;
+};
+
+class PeriodicTask {
+   public:
+    PeriodicTask(const char* name, sysinterval_t period);
+
+    void start();
+    void waitNext();
+    void waitEvents(eventmask_t events, sysinterval_t timeout);
+
+    const char* name() const { return name_; }
+    uint8_t id() const { return id_; }
+    sysinterval_t period() const { return period_; }
+    const TaskStats& stats() const { return stats_; }
+
+    // Every constructed task, for reporting
+    static PeriodicTask* first() { return first_; }
+    PeriodicTask* next() const { return next_; }
+
+   private:
+    void finishCycle();
+    void release();
+
+    const char* name_;
+    sysinterval_t period_;
+    uint8_t id_;
+
+    systime_t deadline_ = 0;
+    uint32_t release_us_ = 0;
+    TaskStats stats_;
+
+    PeriodicTask* next_;
+    static PeriodicTask* first_;
+    static uint8_t count_;
+};
+
+void printTaskStats();
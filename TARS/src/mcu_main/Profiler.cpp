@@ -0,0 +1,76 @@
+/**
+ * @file Profiler.cpp
+ *
+ * @brief Recording and summary of the PROFILE_SCOPE sites.
+ */
+
+#include "mcu_main/Profiler.h"
+
+#if defined(ENABLE_PROFILING) && defined(ARDUINO)
+
+#include <ChRt.h>
+
+ProfileSite* ProfileSite::first_ = nullptr;
+
+/**
+ * @brief Adds one sample. Can be called from any thread, interrupt or critical section.
+ */
+void ProfileSite::record(uint32_t cycles) {
+    syssts_t status = chSysGetStatusAndLockX();
+    if (count_ == 0) {
+        next_ = first_;
+        first_ = this;
+    }
+    count_++;
+    total_ += cycles;
+    if (cycles < min_) min_ = cycles;
+    if (cycles > max_) max_ = cycles;
+    histogram_[31 - __builtin_clz(cycles | 1)]++;
+    chSysRestoreStatusX(status);
+}
+
+/**
+ * @brief Prints every site as one JSON line, with times in microseconds.
+ *
+ * Only the histogram buckets from the first to the last non-empty one are printed, hist_from is the log2 of the
+ * cycle count at the start of the first bucket.
+ *
+ * @param out Serial or an SD card file
+ */
+void ProfileSite::printSummary(Print& out) {
+    const float us_per_cycle = 1e6f / F_CPU_ACTUAL;
+    out.print(R"({"type": "profile", "value": {)");
+    for (ProfileSite* site = first_; site; site = site->next_) {
+        // Copy so the sample is consistent, printing takes far too long to do with the system locked
+        chSysLock();
+        ProfileSite copy = *site;
+        chSysUnlock();
+
+        int first_bucket = 0;
+        while (first_bucket < PROFILE_BUCKETS - 1 && copy.histogram_[first_bucket] == 0) first_bucket++;
+        int last_bucket = PROFILE_BUCKETS - 1;
+        while (last_bucket > first_bucket && copy.histogram_[last_bucket] == 0) last_bucket--;
+
+        out.print('"');
+        out.print(copy.name_);
+        out.print(R"(": {"n":)");
+        out.print(copy.count_);
+        out.print(R"(,"min_us":)");
+        out.print(copy.min_ * us_per_cycle, 2);
+        out.print(R"(,"mean_us":)");
+        out.print((float)copy.total_ / copy.count_ * us_per_cycle, 2);
+        out.print(R"(,"max_us":)");
+        out.print(copy.max_ * us_per_cycle, 2);
+        out.print(R"(,"hist_from":)");
+        out.print(first_bucket);
+        out.print(R"(,"hist":[)");
+        for (int i = first_bucket; i <= last_bucket; i++) {
+            out.print(copy.histogram_[i]);
+            if (i < last_bucket) out.print(',');
+        }
+        out.print(site->next_ ? "]}," : "]}");
+    }
+    out.println("}}");
+}
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file Profiler.h
+ *
+ * @brief Scoped timers for the hot paths, measured with the DWT cycle counter.
+ *
+ * PROFILE_SCOPE("name") at the top of a block times the rest of the block every time it runs and adds it to that
+ * site's count, min, max, total and log2 histogram. Recording is a handful of instructions and takes the same time
+ * however many samples there are. The summary of every site is printed over serial and written to the SD card once a
+ * second.
+ *
+ * Without ENABLE_PROFILING, and always on host builds, which have no cycle counter, PROFILE_SCOPE compiles to nothing.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "mcu_main/debug.h"
+
+#if defined(ENABLE_PROFILING) && defined(ARDUINO)
+
+#include <Arduino.h>
+
+// Bucket i counts the samples that took [2^i, 2^(i+1)) cycles
+#define PROFILE_BUCKETS 32
+
+class ProfileSite {
+   public:
+    // constexpr so that a site declared as a function static is initialized before any thread can reach it
+    constexpr explicit ProfileSite(const char* name) : name_(name) {}
+
+    void record(uint32_t cycles);
+
+    static void printSummary(Print& out);
+
+   private:
+    const char* name_;
+    uint32_t count_ = 0;
+    uint32_t min_ = UINT32_MAX;
+    uint32_t max_ = 0;
+    uint64_t total_ = 0;
+    uint32_t histogram_[PROFILE_BUCKETS] = {};
+
+    // Sites are added to the summary the first time they are recorded
+    ProfileSite* next_ = nullptr;
+    static ProfileSite* first_;
+};
+
+class ScopedProfile {
+   public:
+    explicit ScopedProfile(ProfileSite& site) : site_(site), start_(ARM_DWT_CYCCNT) {}
+    ~ScopedProfile() { site_.record(ARM_DWT_CYCCNT - start_); }
+
+   private:
+    ProfileSite& site_;
+    uint32_t start_;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(name)                                                  \
+    static ProfileSite PROFILE_CONCAT(profile_site_, __LINE__)(name);        \
+    ScopedProfile PROFILE_CONCAT(profile_scope_, __LINE__)(PROFILE_CONCAT(profile_site_, __LINE__))
+
+#else
+
+#define PROFILE_SCOPE(name) \
+    do {                    \
+    } while (false)
+
+#endif
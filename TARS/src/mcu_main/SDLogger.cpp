@@ -1,6 +1,7 @@
 #include "mcu_main/SDLogger.h"
 
 #include "FS.h"
+#include "mcu_main/Profiler.h"
 #include "mcu_main/debug.h"
 #include "mcu_main/pins.h"
 
@@ -81,6 +82,21 @@ ErrorCode SDLogger::init() {
         sd_file.flush();
 
         Serial.println(sd_file.name());
+
+#ifdef ENABLE_TRACE
+        char trace_extension[8] = ".trace";
+        char trace_name[16] = "trace";
+        sdFileNamer(trace_name, trace_extension);
+        trace_file = SD.open(trace_name, FILE_WRITE_BEGIN);
+        Serial.println(trace_file.name());
+#endif
+#ifdef ENABLE_PROFILING
+        char profile_extension[8] = ".json";
+        char profile_name[16] = "profile";
+        sdFileNamer(profile_name, profile_extension);
+        profile_file = SD.open(profile_name, FILE_WRITE_BEGIN);
+        Serial.println(profile_file.name());
+#endif
     } else {
         return ErrorCode::SD_BEGIN_FAILED;
     }
@@ -90,6 +106,18 @@ ErrorCode SDLogger::init() {
 
 void SDLogger::update() {
 #ifdef ENABLE_SD
+#ifdef ENABLE_PROFILING
+    if (chVTGetSystemTime() - last_profile_summary >= TIME_MS2I(1000)) {
+        ProfileSite::printSummary(profile_file);
+        profile_file.flush();
+        last_profile_summary = chVTGetSystemTime();
+    }
+#endif
+    PROFILE_SCOPE("SDLogger::update");
+#ifdef ENABLE_TRACE
+    logTrace();
+#endif
+
     sensorDataStruct_t current_data = queue.next();
     if (!current_data.hasData()) {
         return;
@@ -114,4 +142,31 @@ void SDLogger::logData(T* data) {
     }
 }
 
+#ifdef ENABLE_TRACE
+/**
+ * @brief Moves the events recorded since the last call from the trace ring to the trace file.
+ *
+ * The header is written on the first call rather than in init, once the threads have started and been named.
+ */
+void SDLogger::logTrace() {
+    if (!trace_header_written) {
+        TraceHeader header = traceHeader();
+        trace_file.write((const uint8_t*)&header, sizeof(header));
+        trace_header_written = true;
+    }
+
+    size_t count = traceRead(trace_events, sizeof(trace_events) / sizeof(trace_events[0]));
+    if (count == 0) {
+        return;
+    }
+    trace_file.write((const uint8_t*)trace_events, count * sizeof(TraceEvent));
+    if (trace_writes_since_flush >= 50) {
+        trace_file.flush();
+        trace_writes_since_flush = 0;
+    } else {
+        trace_writes_since_flush++;
+    }
+}
+#endif
+
 #undef MAX_FILES
@@ -3,6 +3,8 @@
 #include <ChRt.h>
 #include <SD.h>
 
+#include "mcu_main/Trace.h"
+#include "mcu_main/debug.h"
 #include "mcu_main/dataLog.h"
 #include "mcu_main/error.h"
 
@@ -22,4 +24,19 @@ class SDLogger {
     DataLogQueue queue;
     File sd_file;
     size_t writes_since_flush = 0;
+
+#ifdef ENABLE_PROFILING
+    // One ProfileSite summary line per second
+    File profile_file;
+    systime_t last_profile_summary = 0;
+#endif
+
+#ifdef ENABLE_TRACE
+    void logTrace();
+
+    File trace_file;
+    bool trace_header_written = false;
+    size_t trace_writes_since_flush = 0;
+    TraceEvent trace_events[64];
+#endif
 };
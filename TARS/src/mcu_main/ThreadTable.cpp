@@ -0,0 +1,99 @@
+/**
+ * @file ThreadTable.cpp
+ *
+ * @brief Priority assignment, stack painting and the stack usage report of the thread table.
+ */
+
+#include "mcu_main/ThreadTable.h"
+
+#include <Arduino.h>
+
+#include <cstring>
+
+#include "mcu_main/Trace.h"
+
+/**
+ * @brief Gives every thread without an explicit priority one rate monotonically.
+ *
+ * The threads are numbered upwards from lowest, starting with the longest period. Threads with the same period keep
+ * their table order, the first one getting the higher priority.
+ *
+ * @param threads thread table
+ * @param count number of rows
+ * @param lowest priority of the slowest thread
+ */
+void assignPriorities(ThreadConfig* threads, size_t count, tprio_t lowest) {
+    tprio_t next = lowest;
+    while (true) {
+        ThreadConfig* slowest = nullptr;
+        for (size_t i = 0; i < count; i++) {
+            if (threads[i].priority == 0 && (!slowest || threads[i].period >= slowest->period)) {
+                slowest = &threads[i];
+            }
+        }
+        if (!slowest) {
+            return;
+        }
+        slowest->priority = next++;
+    }
+}
+
+/**
+ * @brief Paints the stack of every thread and starts them in table order.
+ */
+void startThreads(const ThreadConfig* threads, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const ThreadConfig& thread = threads[i];
+        memset(thread.working_area, STACK_PAINT, thread.stack_size);
+        thread_t* created =
+            chThdCreateStatic(thread.working_area, thread.stack_size, thread.priority, thread.function, nullptr);
+        chRegSetThreadNameX(created, thread.name);
+#ifdef ENABLE_TRACE
+        traceRegisterThread(created, thread.name);
+#endif
+    }
+}
+
+/**
+ * @brief Deepest the thread's stack has been, in bytes.
+ *
+ * The stack grows down from the top of the working area, so the paint left at the bottom is what has never been used.
+ * The thread structure and the initial context at the top of the working area are counted as used.
+ */
+size_t stackHighWaterMark(const ThreadConfig& thread) {
+    const uint8_t* stack = (const uint8_t*)thread.working_area;
+    size_t unused = 0;
+    while (unused < thread.stack_size && stack[unused] == STACK_PAINT) {
+        unused++;
+    }
+    return thread.stack_size - unused;
+}
+
+/**
+ * @brief Prints the priority and stack usage of every thread over serial as one JSON line.
+ *
+ * The suggested size is the high water mark with a quarter extra, rounded up to 256 bytes. It is only meaningful once
+ * the threads have been through a whole flight, e.g. a THREAD_PROFILING build running a HILSIM flight.
+ */
+void printStackReport(const ThreadConfig* threads, size_t count) {
+    Serial.print(R"({"type": "stack_report", "value": {)");
+    for (size_t i = 0; i < count; i++) {
+        const ThreadConfig& thread = threads[i];
+        size_t used = stackHighWaterMark(thread);
+        size_t suggested = (used + used / 4 + 255) / 256 * 256;
+        Serial.print('"');
+        Serial.print(thread.name);
+        Serial.print(R"(": {"priority":)");
+        Serial.print(thread.priority);
+        Serial.print(R"(,"period_ms":)");
+        Serial.print(TIME_I2MS(thread.period));
+        Serial.print(R"(,"stack_size":)");
+        Serial.print(thread.stack_size);
+        Serial.print(R"(,"stack_used":)");
+        Serial.print(used);
+        Serial.print(R"(,"stack_suggested":)");
+        Serial.print(suggested);
+        Serial.print(i + 1 < count ? "}," : "}");
+    }
+    Serial.println("}}");
+}
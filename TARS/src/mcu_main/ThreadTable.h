@@ -0,0 +1,41 @@
+/**
+ * @file ThreadTable.h
+ *
+ * @brief Starts the threads from a declarative table and reports how much of each stack they use.
+ *
+ * Each row gives a thread's period and either an explicit priority or 0, in which case priorities are assigned rate
+ * monotonically: the shorter the period the higher the priority, with ties going to the row listed first. Every stack
+ * is painted before the thread starts, so the deepest point each thread has reached can be read back at any time.
+ */
+
+#pragma once
+
+#include <ChRt.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Byte written over every stack before its thread starts
+#define STACK_PAINT 0x55
+
+struct ThreadConfig {
+    const char* name;
+    // Name printed by the start check
+    const char* short_name;
+    tfunc_t function;
+    void* working_area;
+    size_t stack_size;
+    // Time between runs, for event driven threads the rate of the data that wakes them
+    sysinterval_t period;
+    // 0 to assign rate monotonically
+    tprio_t priority;
+    bool* started;
+};
+
+void assignPriorities(ThreadConfig* threads, size_t count, tprio_t lowest);
+
+void startThreads(const ThreadConfig* threads, size_t count);
+
+size_t stackHighWaterMark(const ThreadConfig& thread);
+
+void printStackReport(const ThreadConfig* threads, size_t count);
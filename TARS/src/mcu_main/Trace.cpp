@@ -0,0 +1,141 @@
+/**
+ * @file Trace.cpp
+ *
+ * @brief Trace ring, thread registry and serial dump.
+ */
+
+#include "mcu_main/Trace.h"
+
+#ifdef ENABLE_TRACE
+
+#include <Arduino.h>
+
+#include <cstring>
+
+static TraceEvent ring[TRACE_EVENTS];
+// Total events written and read, the ring holds the ones in between
+static uint32_t head = 0;
+static uint32_t tail = 0;
+
+static thread_t* threads[TRACE_MAX_THREADS];
+static TraceHeader header = {{trace_magic[0], trace_magic[1], trace_magic[2], trace_magic[3]}, 0, {}};
+static uint8_t thread_count = 0;
+
+static uint8_t threadId(thread_t* thread) {
+    for (uint8_t i = 0; i < thread_count; i++) {
+        if (threads[i] == thread) {
+            return i;
+        }
+    }
+    return trace_no_thread;
+}
+
+/**
+ * @brief Names a thread in the trace. Threads that are not registered show up as trace_no_thread.
+ *
+ * @return the thread's id in the trace
+ */
+uint8_t traceRegisterThread(thread_t* thread, const char* name) {
+    if (thread_count == TRACE_MAX_THREADS) {
+        return trace_no_thread;
+    }
+    threads[thread_count] = thread;
+    strncpy(header.thread_names[thread_count], name, TRACE_NAME_LENGTH - 1);
+    return thread_count++;
+}
+
+/**
+ * @brief Records an event. The system has to be locked.
+ */
+void traceRecordI(TraceType type, uint8_t thread, uint16_t arg) {
+    ring[head % TRACE_EVENTS] = {ARM_DWT_CYCCNT, type, thread, arg};
+    head++;
+}
+
+/**
+ * @brief Records an event on the calling thread. Can be called from threads, interrupts and critical sections.
+ */
+void traceRecord(TraceType type, uint16_t arg) {
+    syssts_t status = chSysGetStatusAndLockX();
+    traceRecordI(type, threadId(chThdGetSelfX()), arg);
+    chSysRestoreStatusX(status);
+}
+
+/**
+ * @brief Records a context switch. Meant to be called from CH_CFG_CONTEXT_SWITCH_HOOK, with the system locked.
+ */
+void traceContextSwitch(thread_t* next, thread_t* previous) {
+    traceRecordI(TraceType::Switch, threadId(next), threadId(previous));
+}
+
+/**
+ * @brief Locks a mutex, recording the time spent blocked if another thread holds it.
+ */
+void traceMtxLock(mutex_t* mutex) {
+    // Mutexes are identified by their address, which is word aligned
+    uint16_t id = (uint16_t)((uintptr_t)mutex >> 2);
+    bool contended = mutex->owner != nullptr;
+    if (contended) {
+        traceRecord(TraceType::MutexWait, id);
+    }
+    chMtxLock(mutex);
+    if (contended) {
+        traceRecord(TraceType::MutexAcquired, id);
+    }
+}
+
+TraceHeader traceHeader() {
+    header.cpu_hz = F_CPU_ACTUAL;
+    return header;
+}
+
+/**
+ * @brief Moves the oldest unread events out of the ring. Only one thread may read.
+ *
+ * If the reader fell behind and events were overwritten, the first event returned is a Dropped event with the number
+ * that were lost.
+ *
+ * @return number of events written to events
+ */
+size_t traceRead(TraceEvent* events, size_t max) {
+    size_t count = 0;
+    chSysLock();
+    if (head - tail > TRACE_EVENTS) {
+        uint32_t dropped = head - tail - TRACE_EVENTS;
+        tail = head - TRACE_EVENTS;
+        events[count++] = {ARM_DWT_CYCCNT, TraceType::Dropped, trace_no_thread,
+                           (uint16_t)(dropped > UINT16_MAX ? UINT16_MAX : dropped)};
+    }
+    while (count < max && tail != head) {
+        events[count++] = ring[tail % TRACE_EVENTS];
+        tail++;
+    }
+    chSysUnlock();
+    return count;
+}
+
+/**
+ * @brief Writes the events still in the ring over serial without consuming them.
+ *
+ * A JSON line giving the size comes first, followed by the TraceHeader and the events as raw bytes.
+ */
+void traceDumpSerial() {
+    chSysLock();
+    uint32_t end = head;
+    chSysUnlock();
+    uint32_t start = end > TRACE_EVENTS ? end - TRACE_EVENTS : 0;
+
+    TraceHeader dump_header = traceHeader();
+    Serial.print(R"({"type": "trace", "value": {"bytes":)");
+    Serial.print(sizeof(dump_header) + (end - start) * sizeof(TraceEvent));
+    Serial.println("}}");
+    Serial.write((const uint8_t*)&dump_header, sizeof(dump_header));
+    for (uint32_t i = start; i < end; i++) {
+        // Events older than the ring may be overwritten while dumping, which only garbles the start of the dump
+        TraceEvent event = ring[i % TRACE_EVENTS];
+        Serial.write((const uint8_t*)&event, sizeof(event));
+    }
+    Serial.flush();
+}
+
+#endif
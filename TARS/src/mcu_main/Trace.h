@@ -0,0 +1,50 @@
+/**
+ * @file Trace.h
+ *
+ * @brief Low overhead execution trace of the threads, interrupts, mutexes and user markers.
+ *
+ * Events are 8 byte records stamped with the cycle counter and written into a RAM ring, which costs a few dozen cycles
+ * and no I/O on the thread being traced. The ring is drained into a trace file by the SD logger and can be dumped over
+ * USB serial by sending 't'. src/tools/trace_convert turns either into Chrome/Perfetto trace JSON.
+ *
+ * Threads are traced when they run and wait at their PeriodicTask or DataSubscriber. To also see preemptions, call
+ * traceContextSwitch from CH_CFG_CONTEXT_SWITCH_HOOK in the ChibiOS configuration. Everything compiles to nothing
+ * without ENABLE_TRACE.
+ */
+
+#pragma once
+
+#include <ChRt.h>
+
+#include "mcu_main/TraceFormat.h"
+#include "mcu_main/debug.h"
+
+// Ring size, 8 bytes each
+#define TRACE_EVENTS 4096
+
+#ifdef ENABLE_TRACE
+
+uint8_t traceRegisterThread(thread_t* thread, const char* name);
+
+void traceRecord(TraceType type, uint16_t arg);
+void traceRecordI(TraceType type, uint8_t thread, uint16_t arg);
+void traceContextSwitch(thread_t* next, thread_t* previous);
+void traceMtxLock(mutex_t* mutex);
+
+TraceHeader traceHeader();
+size_t traceRead(TraceEvent* events, size_t max);
+void traceDumpSerial();
+
+// Records an event on the calling thread, e.g. TRACE_EVENT(MarkBegin, TRACE_FSM_TICK)
+#define TRACE_EVENT(type, arg) traceRecord(TraceType::type, arg)
+// chMtxLock that records how long the thread was blocked
+#define TRACE_MTX_LOCK(mutex) traceMtxLock(mutex)
+
+#else
+
+#define TRACE_EVENT(type, arg) \
+    do {                       \
+    } while (false)
+#define TRACE_MTX_LOCK(mutex) chMtxLock(mutex)
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file TraceFormat.h
+ *
+ * @brief Binary format of the execution trace written by Trace.cpp and read by src/tools/trace_convert.
+ *
+ * A trace is a TraceHeader followed by TraceEvents, oldest first. The same layout is used for the trace file on the SD
+ * card and for a dump over USB serial, where it follows a JSON line announcing it.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#define TRACE_MAX_THREADS 16
+#define TRACE_NAME_LENGTH 16
+
+// Thread id of a thread that is not registered, e.g. the idle thread
+static constexpr uint8_t trace_no_thread = 0xFF;
+
+enum class TraceType : uint8_t {
+    // thread starts running, arg is the thread that stopped
+    Switch,
+    // thread resumes after waiting for its period or its data
+    Run,
+    // thread is about to wait for its period or its data
+    Wait,
+    // arg is the interrupt number
+    IsrEnter,
+    IsrExit,
+    // thread is blocked on a mutex held by another thread, arg identifies the mutex
+    MutexWait,
+    MutexAcquired,
+    // arg is a TraceMarker
+    MarkBegin,
+    MarkEnd,
+    Instant,
+    // arg events were overwritten before they could be read
+    Dropped,
+};
+
+// User markers, keep trace_marker_names in the same order
+enum TraceMarker : uint16_t {
+    TRACE_SENSOR_READ,
+    TRACE_FSM_TICK,
+    TRACE_KALMAN_UPDATE,
+    TRACE_APOGEE_PREDICTION,
+    TRACE_SERVO_TICK,
+    TRACE_SD_WRITE,
+    TRACE_TELEMETRY_SEND,
+    trace_marker_count,
+};
+
+static const char* const trace_marker_names[trace_marker_count] = {
+    "sensor read", "FSM tick", "Kalman update", "apogee prediction", "servo tick", "SD write", "telemetry send",
+};
+
+struct TraceEvent {
+    // Cycle counter, wraps every few seconds
+    uint32_t cycles;
+    TraceType type;
+    // Thread the event happened on
+    uint8_t thread;
+    uint16_t arg;
+};
+
+struct TraceHeader {
+    char magic[4];
+    // Cycle counter frequency
+    uint32_t cpu_hz;
+    char thread_names[TRACE_MAX_THREADS][TRACE_NAME_LENGTH];
+};
+
+static_assert(sizeof(TraceEvent) == 8, "trace events are written as raw bytes");
+
+static constexpr char trace_magic[4] = {'T', 'R', 'C', '1'};
@@ -8,6 +8,8 @@
 
 #include "mcu_main/dataLog.h"
 
+#include "mcu_main/Trace.h"
+
 DataLogBuffer dataLogger;
 
 // sensorDataStruct_t DataLogView::read() {
@@ -57,60 +59,108 @@ sensorDataStruct_t DataLogBuffer::read() {
 void DataLogBuffer::pushLowGFifo(LowGData const& lowG_Data) {
     lowGFifo.push(lowG_Data);
     UPDATE_QUEUE(lowGQueue, lowG_Data);
+    publish(DATA_LOW_G);
 }
 
 void DataLogBuffer::pushHighGFifo(HighGData const& highG_Data) {
     highGFifo.push(highG_Data);
     UPDATE_QUEUE(highGQueue, highG_Data);
+    publish(DATA_HIGH_G);
 }
 
 void DataLogBuffer::pushGpsFifo(GpsData const& gps_Data) {
     gpsFifo.push(gps_Data);
     UPDATE_QUEUE(gpsQueue, gps_Data);
+    publish(DATA_GPS);
 }
 
 void DataLogBuffer::pushKalmanFifo(KalmanData const& state_data) {
     kalmanFifo.push(state_data);
     UPDATE_QUEUE(kalmanQueue, state_data);
+    publish(DATA_KALMAN);
 }
 
 void DataLogBuffer::pushBarometerFifo(BarometerData const& barometer_data) {
     barometerFifo.push(barometer_data);
     UPDATE_QUEUE(barometerQueue, barometer_data);
+    publish(DATA_BAROMETER);
 }
 
 void DataLogBuffer::pushRocketStateFifo(rocketStateData<4> const& rocket_data) {
     rocketStateFifo.push(rocket_data);
     UPDATE_QUEUE(rocketStateQueue, rocket_data);
+    publish(DATA_ROCKET_STATE);
 }
 
 void DataLogBuffer::pushFlapsFifo(FlapData const& flap_data) {
     flapFifo.push(flap_data);
     UPDATE_QUEUE(flapQueue, flap_data);
+    publish(DATA_FLAPS);
 }
 
 void DataLogBuffer::pushVoltageFifo(VoltageData const& voltage_data) {
     voltageFifo.push(voltage_data);
     UPDATE_QUEUE(voltageQueue, voltage_data);
+    publish(DATA_VOLTAGE);
 }
 
 void DataLogBuffer::pushOrientationFifo(OrientationData const& orientation_data) {
     orientationFifo.push(orientation_data);
     UPDATE_QUEUE(orientationQueue, orientation_data);
+    publish(DATA_ORIENTATION);
 }
 
 void DataLogBuffer::pushGasFifo(const GasData& gas_data) {
     gasFifo.push(gas_data);
     UPDATE_QUEUE(gasQueue, gas_data);
+    publish(DATA_GAS);
 }
 
 void DataLogBuffer::pushMagnetometerFifo(const MagnetometerData& magnetometer_data) {
     magnetometerFifo.push(magnetometer_data);
     UPDATE_QUEUE(magnetometerQueue, magnetometer_data);
+    publish(DATA_MAGNETOMETER);
 }
 
 #undef UPDATE_QUEUE
 
+/**
+ * @brief Wakes the subscribers of the given streams.
+ *
+ * Some sensors push from inside a critical section, so this works both with and without the system locked.
+ */
+void DataLogBuffer::publish(eventflags_t streams) {
+    syssts_t status = chSysGetStatusAndLockX();
+    chEvtBroadcastFlagsI(&published, streams);
+    chSysRestoreStatusX(status);
+}
+
+/**
+ * @brief Registers the calling thread for the given streams. Has to be called from the consuming thread.
+ *
+ * @param buffer buffer the streams are pushed to
+ * @param streams DataLogFlags of the streams the thread depends on
+ */
+void DataSubscriber::subscribe(DataLogBuffer& buffer, eventflags_t streams) {
+    chEvtRegisterMaskWithFlags(&buffer.published, &listener_, EVENT_MASK(0), streams);
+}
+
+/**
+ * @brief Sleeps until one of the subscribed streams is pushed to, or for at most timeout.
+ *
+ * @param timeout longest time to wait, so the consumer still runs if its data stops arriving
+ * @return the streams pushed to since the last wait, 0 on timeout
+ */
+eventflags_t DataSubscriber::wait(sysinterval_t timeout) {
+    TRACE_EVENT(Wait, 0);
+    eventmask_t events = chEvtWaitAnyTimeout(EVENT_MASK(0), timeout);
+    TRACE_EVENT(Run, 0);
+    if (events == 0) {
+        return 0;
+    }
+    return chEvtGetAndClearFlags(&listener_);
+}
+
 void DataLogQueue::attach(DataLogBuffer& buffer) {
     next_queue = buffer.first_queue;
     buffer.first_queue = this;
@@ -1,15 +1,35 @@
 #pragma once
 
+#include <ChRt.h>
+
 #include "common/FifoBuffer.h"
 #include "common/MessageQueue.h"
 #include "common/packet.h"
 
 #define FIFO_SIZE 200
-#define QUEUE_SIZE 5
+// Two 30 ms telemetry buffering periods of 6 ms samples, for a consumer that takes in every one
+#define QUEUE_SIZE 10
 
 class DataLogBuffer;
 extern DataLogBuffer dataLogger;
 
+/**
+ * @brief Event flags broadcast on DataLogBuffer::published, one for each stream.
+ */
+enum DataLogFlags : eventflags_t {
+    DATA_LOW_G = 1 << 0,
+    DATA_HIGH_G = 1 << 1,
+    DATA_GPS = 1 << 2,
+    DATA_KALMAN = 1 << 3,
+    DATA_ROCKET_STATE = 1 << 4,
+    DATA_BAROMETER = 1 << 5,
+    DATA_GAS = 1 << 6,
+    DATA_MAGNETOMETER = 1 << 7,
+    DATA_FLAPS = 1 << 8,
+    DATA_VOLTAGE = 1 << 9,
+    DATA_ORIENTATION = 1 << 10,
+};
+
 class DataLogQueue {
    public:
     friend class DataLogBuffer;
@@ -44,6 +64,9 @@ class DataLogBuffer {
     DataLogQueue* first_queue = nullptr;
 
    public:
+    // Broadcasts the DataLogFlags of every stream pushed to, see DataSubscriber
+    EVENTSOURCE_DECL(published);
+
     FifoBuffer<LowGData, FIFO_SIZE> lowGFifo;
     FifoBuffer<HighGData, FIFO_SIZE> highGFifo;
     FifoBuffer<GpsData, FIFO_SIZE> gpsFifo;
@@ -79,6 +102,40 @@ class DataLogBuffer {
     void pushOrientationFifo(OrientationData const& orientation_data);
 
     sensorDataStruct_t read();
+
+   private:
+    void publish(eventflags_t streams);
+};
+
+/**
+ * @brief Lets a thread sleep until the data it consumes has been pushed to a DataLogBuffer.
+ *
+ * A consumer subscribes to the streams it depends on and waits on them instead of polling on a fixed period, so it runs
+ * as soon as a new sample arrives and is not woken by the streams it does not use. Samples pushed while the consumer is
+ * busy are remembered, so none are missed between two waits.
+ */
+class DataSubscriber {
+   public:
+    void subscribe(DataLogBuffer& buffer, eventflags_t streams);
+    eventflags_t wait(sysinterval_t timeout);
+
+   private:
+    event_listener_t listener_;
+};
+
+/**
+ * @brief Time from a sensor sample being taken until a consumer has acted on it.
+ */
+struct DataLatency {
+    sysinterval_t last = 0;
+    sysinterval_t max = 0;
+
+    void record(systime_t sample_time) {
+        last = chVTGetSystemTime() - sample_time;
+        if (last > max) {
+            max = last;
+        }
+    }
 };
 
 #undef FIFO_SIZE
@@ -8,6 +8,29 @@
 // #define SERIAL_PLOTTING
 // #define WAIT_SERIAL
 // #define FSM_DEBUG
+// Print the period jitter, overruns and worst case execution time of every PeriodicTask once a second
+// #define TASK_STATS
+// Give every thread an 8 KB stack and print the stack usage report once a second, to size the stacks in main.cpp
+// #define THREAD_PROFILING
+// Record the thread, interrupt, mutex and marker trace from Trace.h to the SD card, 't' over serial dumps it
+// #define ENABLE_TRACE
+// Time the PROFILE_SCOPE sites from Profiler.h and print their summary over serial and to the SD card once a second
+// #define ENABLE_PROFILING
+
+// Predict apogee from the precomputed table in gnc/apogee_table_data.h instead of running rk4 every control tick
+// #define ENABLE_APOGEE_TABLE
+// Run both the table and rk4 every control tick, control on rk4 and print the discrepancy between them
+// #define APOGEE_TABLE_VALIDATE
+// Propagate a batch of samples drawn from the Kalman covariance and publish its variance with the nominal apogee
+// #define ENABLE_APOGEE_DISPERSION
+// Command the flap extension solved for the target apogee instead of the proportional control law
+// #define ENABLE_PREDICTIVE_CONTROL
+// Run the table-driven versions of the Timer, HistoryBuffer and Kalman FSMs from FSMTables.h
+// #define ENABLE_TABLE_FSMS
+// Gate the Kalman filter and active control on the state voted by fsmArbiter instead of the TimerFSM alone
+// #define ENABLE_FSM_VOTING
+// Send telemetry Reed-Solomon coded with the CRC off, interleaved if TELEMETRY_FEC_DEPTH is set, see common/TelemetryFec.h
+// #define ENABLE_TELEMETRY_FEC
 
 // Enable or disable peripherals here
 #define ENABLE_ORIENTATION
@@ -11,7 +11,9 @@ enum __attribute__((warn_unused)) ErrorCode {
     CANNOT_INIT_BNO,
     SD_BEGIN_FAILED,
     RADIO_INIT_FAILED,
-    RADIO_SET_FREQUENCY_FAILED
+    RADIO_SET_FREQUENCY_FAILED,
+    // Found in flight and sent down as telemetry events rather than handled
+    RADIO_TX_TIMEOUT
 };
 
 void handleError(ErrorCode);
\ No newline at end of file
@@ -0,0 +1,195 @@
+/**
+ * @file FSMArbiter.h
+ *
+ * @brief Combines the states of every FSM in the FSMCollection into a single authoritative state.
+ *
+ * The arbiter only moves through a configured list of states in flight order (e.g. IDLE, BOOST, COAST_GNC, APOGEE,
+ * ...). An FSM votes for one of those states once its own state has reached it, so the detect states and FSMs that
+ * have already moved further ahead still count. Each state has its own voting rule:
+ *
+ *  - FirstToAgree: the first FSM to reach the state is enough
+ *  - Majority: more than half of the FSMs have to reach it
+ *  - Weighted: the FSMs that reached it have to hold more than a fraction of the total weight
+ *
+ * A vote that is tied (exactly half, or exactly the weight fraction) is accepted once the state has had support for
+ * tie_timeout, so an even split cannot hold the arbiter back forever. The reason for every transition is recorded.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/packet.h"
+
+enum class VoteMode : uint8_t { FirstToAgree, Majority, Weighted };
+
+// Why the arbiter entered a state
+enum class VoteReason : uint8_t { None, FirstToAgree, Majority, Weighted, TieTimeout };
+
+/**
+ * @brief Voting rule for entering one arbitrated state.
+ */
+struct VotePolicy {
+    FSM_State state;
+    VoteMode mode;
+    // Weighted only, fraction of the total weight that has to agree
+    float threshold;
+    // Accept a tied vote after the state has had support for this long, 0 to never break ties
+    sysinterval_t tie_timeout;
+};
+
+/**
+ * @brief Record of one arbitrated transition.
+ */
+struct VoteRecord {
+    FSM_State from = FSM_State::STATE_INIT;
+    FSM_State to = FSM_State::STATE_INIT;
+    systime_t time = 0;
+    VoteReason reason = VoteReason::None;
+    // Bit i is set if FSM i voted for the state
+    uint8_t voters = 0;
+    // Fraction of the total weight that voted for the state
+    float support = 0;
+};
+
+template <size_t count, size_t policy_count>
+class FSMArbiter {
+    static_assert(count <= 8, "voters are recorded in a uint8_t mask");
+
+   public:
+    /**
+     * @param weights vote weight of each FSM, in FSMCollection order
+     * @param policies voting rule of each arbitrated state, in flight order
+     */
+    FSMArbiter(const float (&weights)[count], const VotePolicy (&policies)[policy_count]) {
+        for (size_t i = 0; i < count; i++) {
+            weights_[i] = weights[i];
+            total_weight_ += weights[i];
+        }
+        for (size_t p = 0; p < policy_count; p++) {
+            policies_[p] = policies[p];
+        }
+    }
+
+    /**
+     * @brief Counts the votes for every state ahead of the current one and moves to the furthest state that wins.
+     *
+     * @param states latest states of the FSMs, the arbitrated state and reason are written back into it
+     * @return the authoritative state
+     */
+    FSM_State update(rocketStateData<count>& states) {
+        systime_t now = states.timestamp;
+
+        for (size_t p = policy_count; p-- > current_ + 1;) {
+            const VotePolicy& policy = policies_[p];
+
+            uint8_t voters = 0;
+            size_t yes_count = 0;
+            float yes_weight = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (votesFor(states.rocketStates[i], policy.state)) {
+                    voters |= 1 << i;
+                    yes_count++;
+                    yes_weight += weights_[i];
+                }
+            }
+
+            if (yes_count == 0) {
+                supported_[p] = false;
+                continue;
+            }
+            if (!supported_[p]) {
+                supported_[p] = true;
+                support_since_[p] = now;
+            }
+
+            VoteReason reason = decide(policy, yes_count, yes_weight, now - support_since_[p]);
+            if (reason != VoteReason::None) {
+                VoteRecord& record = records_[p];
+                record.from = state_;
+                record.to = policy.state;
+                record.time = now;
+                record.reason = reason;
+                record.voters = voters;
+                record.support = total_weight_ > 0 ? yes_weight / total_weight_ : 0;
+
+                state_ = policy.state;
+                reason_ = reason;
+                current_ = p;
+                break;
+            }
+        }
+
+        states.arbiter_state = state_;
+        states.arbiter_reason = (uint8_t)reason_;
+        return state_;
+    }
+
+    FSM_State getState() const { return state_; }
+
+    // Reason for entering the current state
+    VoteReason getReason() const { return reason_; }
+
+    /**
+     * @brief Looks up how an arbitrated state was entered.
+     *
+     * @return the record, or nullptr if the state has not been entered or is not arbitrated
+     */
+    const VoteRecord* getRecord(FSM_State state) const {
+        for (size_t p = 0; p < policy_count; p++) {
+            if (policies_[p].state == state && records_[p].reason != VoteReason::None) {
+                return &records_[p];
+            }
+        }
+        return nullptr;
+    }
+
+   private:
+    /**
+     * @brief An FSM votes for a state once it has reached it. Aborted FSMs only vote for the abort state.
+     */
+    static bool votesFor(FSM_State fsm_state, FSM_State state) {
+        if (state == FSM_State::STATE_ABORT || fsm_state == FSM_State::STATE_ABORT) {
+            return fsm_state == state;
+        }
+        return fsm_state >= state;
+    }
+
+    VoteReason decide(const VotePolicy& policy, size_t yes_count, float yes_weight, sysinterval_t supported_for) const {
+        bool tie = false;
+        switch (policy.mode) {
+            case VoteMode::FirstToAgree:
+                return VoteReason::FirstToAgree;
+            case VoteMode::Majority:
+                if (2 * yes_count > count) {
+                    return VoteReason::Majority;
+                }
+                tie = 2 * yes_count == count;
+                break;
+            case VoteMode::Weighted:
+                if (yes_weight > policy.threshold * total_weight_) {
+                    return VoteReason::Weighted;
+                }
+                tie = yes_weight == policy.threshold * total_weight_;
+                break;
+        }
+        if (tie && policy.tie_timeout > 0 && supported_for >= policy.tie_timeout) {
+            return VoteReason::TieTimeout;
+        }
+        return VoteReason::None;
+    }
+
+    float weights_[count] = {};
+    float total_weight_ = 0;
+    VotePolicy policies_[policy_count] = {};
+
+    systime_t support_since_[policy_count] = {};
+    bool supported_[policy_count] = {};
+    VoteRecord records_[policy_count] = {};
+
+    // Index of the current state in policies_, SIZE_MAX before the first transition
+    size_t current_ = (size_t)-1;
+    FSM_State state_ = FSM_State::STATE_INIT;
+    VoteReason reason_ = VoteReason::None;
+};
@@ -3,6 +3,8 @@
 #include <initializer_list>  // this is here to make initializing the FSMCollection a lot more convenient
 
 #include "ChRt.h"
+#include "mcu_main/Profiler.h"
+#include "mcu_main/finite-state-machines/FlightFeatures.h"
 #include "mcu_main/finite-state-machines/RocketFSMBase.h"
 
 /**
@@ -26,12 +28,16 @@ class FSMCollection {
     }
 
     void tick() {
-        // tick all FSMs
+        PROFILE_SCOPE("FSMCollection::tick");
+        // read the sensors and history once and tick all FSMs on the same snapshot
+        features_ = extractor_.extract();
         for (size_t i = 0; i < count; i++) {
-            FSMs_[i]->tickFSM();
+            FSMs_[i]->tickFSM(features_);
         }
     }
 
+    const FlightFeatures& getFeatures() const { return features_; }
+
     rocketStateData<count> getStates() {
         rocketStateData<count> states;
         // refresh FSM states and timestamps
@@ -45,4 +51,6 @@ class FSMCollection {
 
    private:
     RocketFSMBase* FSMs_[count];
+    FeatureExtractor extractor_;
+    FlightFeatures features_{};
 };
@@ -0,0 +1,231 @@
+/**
+ * @file FSMTables.h
+ *
+ * @brief Transition tables of the existing FSMs for TableFSM.
+ *
+ * Each table takes the same transitions on the same ticks as the switch statement of the hand-written FSM it is named
+ * after, which src/tools/fsm_bench checks over a whole flight, so a change to either must be made to both. See
+ * TimerFSM.cpp, HistoryBufferFSM.h and KalmanFSM.cpp for the reasoning behind each transition. ModularFSM has no
+ * table since its checks depend on altitudes it records during the flight and on the state it came from, which are
+ * not part of the feature snapshot.
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include "mcu_main/finite-state-machines/TableFSM.h"
+#include "mcu_main/finite-state-machines/thresholds.h"
+
+struct TimerFSMTable {
+    enum Guard : uint8_t { above_launch_accel, below_launch_accel, above_coast_accel, below_coast_accel };
+    enum Timer : uint8_t { launch, burnout, apogee, drogue, main_deploy, timer_count };
+
+    static bool aboveLaunchAccel(const FlightFeatures& f) { return f.highg_az > launch_linear_acceleration_thresh; }
+    static bool belowLaunchAccel(const FlightFeatures& f) { return f.highg_az < launch_linear_acceleration_thresh; }
+    static bool aboveCoastAccel(const FlightFeatures& f) { return f.highg_az > coast_thresh; }
+    static bool belowCoastAccel(const FlightFeatures& f) { return f.highg_az < coast_thresh; }
+
+    static constexpr FSMGuard guards[] = {aboveLaunchAccel, belowLaunchAccel, aboveCoastAccel, belowCoastAccel};
+
+    static constexpr FSMTransition transitions[] = {
+        transition(FSM_State::STATE_INIT, FSM_State::STATE_IDLE),
+
+        transition(FSM_State::STATE_IDLE, FSM_State::STATE_LAUNCH_DETECT).when(above_launch_accel).restarts(launch),
+
+        transition(FSM_State::STATE_LAUNCH_DETECT, FSM_State::STATE_IDLE).when(below_launch_accel),
+        transition(FSM_State::STATE_LAUNCH_DETECT, FSM_State::STATE_BOOST).after(launch, launch_time_thresh),
+
+        transition(FSM_State::STATE_BOOST, FSM_State::STATE_BURNOUT_DETECT).when(below_coast_accel).restarts(burnout),
+        transition(FSM_State::STATE_BOOST, FSM_State::STATE_COAST_PREGNC)
+            .atLeast(launch, burn_time_thresh_ms)
+            .restarts(burnout),
+
+        transition(FSM_State::STATE_BURNOUT_DETECT, FSM_State::STATE_BOOST).when(above_coast_accel),
+        transition(FSM_State::STATE_BURNOUT_DETECT, FSM_State::STATE_COAST_PREGNC).after(burnout, coast_time_thresh),
+
+        transition(FSM_State::STATE_COAST_PREGNC, FSM_State::STATE_COAST_GNC).after(burnout, coast_ac_delay_thresh),
+
+        transition(FSM_State::STATE_COAST_GNC, FSM_State::STATE_APOGEE_DETECT)
+            .after(burnout, coast_to_apogee_time_thresh)
+            .restarts(apogee),
+
+        transition(FSM_State::STATE_APOGEE_DETECT, FSM_State::STATE_APOGEE),
+
+        transition(FSM_State::STATE_APOGEE, FSM_State::STATE_DROGUE_DETECT)
+            .after(apogee, apogee_time_thresh)
+            .restarts(drogue),
+
+        transition(FSM_State::STATE_DROGUE_DETECT, FSM_State::STATE_DROGUE),
+
+        transition(FSM_State::STATE_DROGUE, FSM_State::STATE_MAIN_DETECT)
+            .after(drogue, drogue_deploy_time_since_apogee_threshold)
+            .restarts(main_deploy),
+
+        transition(FSM_State::STATE_MAIN_DETECT, FSM_State::STATE_MAIN),
+
+        transition(FSM_State::STATE_MAIN, FSM_State::STATE_LANDED_DETECT)
+            .after(main_deploy, main_deploy_time_since_drogue_threshold),
+
+        transition(FSM_State::STATE_LANDED_DETECT, FSM_State::STATE_LANDED),
+    };
+};
+
+/**
+ * @brief Shared shape of HistoryBufferFSM and KalmanFSM, which only differ in where their guards get their data.
+ *
+ * Sensors provides the guards as static functions of the same names.
+ */
+template <typename Sensors>
+struct DetectFSMTable {
+    enum Guard : uint8_t {
+        above_launch_accel,
+        below_launch_accel,
+        above_coast_accel,
+        below_coast_accel,
+        apogee_still,
+        apogee_moving,
+        drogue_accel_change,
+        drogue_altitude_change,
+        main_accel_change,
+        main_altitude_change,
+        landed_still,
+        landed_moving,
+    };
+    enum Timer : uint8_t { launch, burnout, apogee, drogue, main_deploy, landing, timer_count };
+
+    static constexpr FSMGuard guards[] = {
+        Sensors::aboveLaunchAccel,   Sensors::belowLaunchAccel,     Sensors::aboveCoastAccel,
+        Sensors::belowCoastAccel,    Sensors::apogeeStill,          Sensors::apogeeMoving,
+        Sensors::drogueAccelChange,  Sensors::drogueAltitudeChange, Sensors::mainAccelChange,
+        Sensors::mainAltitudeChange, Sensors::landedStill,          Sensors::landedMoving,
+    };
+
+    static constexpr FSMTransition transitions[] = {
+        transition(FSM_State::STATE_INIT, FSM_State::STATE_IDLE),
+
+        transition(FSM_State::STATE_IDLE, FSM_State::STATE_LAUNCH_DETECT).when(above_launch_accel).restarts(launch),
+
+        transition(FSM_State::STATE_LAUNCH_DETECT, FSM_State::STATE_IDLE).when(below_launch_accel),
+        transition(FSM_State::STATE_LAUNCH_DETECT, FSM_State::STATE_BOOST).after(launch, launch_time_thresh),
+
+        transition(FSM_State::STATE_BOOST, FSM_State::STATE_BURNOUT_DETECT).when(below_coast_accel).restarts(burnout),
+        transition(FSM_State::STATE_BOOST, FSM_State::STATE_COAST_PREGNC)
+            .atLeast(launch, burn_time_thresh_ms)
+            .restarts(burnout),
+
+        transition(FSM_State::STATE_BURNOUT_DETECT, FSM_State::STATE_BOOST).when(above_coast_accel),
+        transition(FSM_State::STATE_BURNOUT_DETECT, FSM_State::STATE_COAST_PREGNC).after(burnout, coast_time_thresh),
+
+        transition(FSM_State::STATE_COAST_PREGNC, FSM_State::STATE_COAST_GNC).after(burnout, coast_ac_delay_thresh),
+
+        transition(FSM_State::STATE_COAST_GNC, FSM_State::STATE_APOGEE_DETECT).when(apogee_still).restarts(apogee),
+        transition(FSM_State::STATE_COAST_GNC, FSM_State::STATE_APOGEE)
+            .atLeast(burnout, coast_to_apogee_time_thresh)
+            .restarts(apogee),
+
+        transition(FSM_State::STATE_APOGEE_DETECT, FSM_State::STATE_COAST_GNC).when(apogee_moving),
+        transition(FSM_State::STATE_APOGEE_DETECT, FSM_State::STATE_APOGEE).after(apogee, apogee_time_thresh),
+
+        transition(FSM_State::STATE_APOGEE, FSM_State::STATE_DROGUE_DETECT).when(drogue_accel_change),
+        transition(FSM_State::STATE_APOGEE, FSM_State::STATE_DROGUE)
+            .atLeast(apogee, drogue_deploy_time_since_apogee_threshold)
+            .restarts(drogue),
+
+        transition(FSM_State::STATE_DROGUE_DETECT, FSM_State::STATE_DROGUE)
+            .when(drogue_altitude_change)
+            .restarts(drogue),
+        transition(FSM_State::STATE_DROGUE_DETECT, FSM_State::STATE_APOGEE),
+
+        transition(FSM_State::STATE_DROGUE, FSM_State::STATE_MAIN_DETECT)
+            .when(main_accel_change)
+            .after(drogue, refresh_timer),
+        transition(FSM_State::STATE_DROGUE, FSM_State::STATE_MAIN)
+            .atLeast(drogue, main_deploy_time_since_drogue_threshold)
+            .restarts(main_deploy),
+
+        transition(FSM_State::STATE_MAIN_DETECT, FSM_State::STATE_MAIN)
+            .when(main_altitude_change)
+            .restarts(main_deploy),
+        transition(FSM_State::STATE_MAIN_DETECT, FSM_State::STATE_DROGUE),
+
+        transition(FSM_State::STATE_MAIN, FSM_State::STATE_LANDED_DETECT).when(landed_still).restarts(landing),
+        transition(FSM_State::STATE_MAIN, FSM_State::STATE_LANDED)
+            .atLeast(main_deploy, main_deploy_time_since_drogue_threshold)
+            .restarts(landing),
+
+        transition(FSM_State::STATE_LANDED_DETECT, FSM_State::STATE_MAIN).when(landed_moving),
+        transition(FSM_State::STATE_LANDED_DETECT, FSM_State::STATE_LANDED).after(landing, landing_time_thresh),
+    };
+};
+
+// Guards of HistoryBufferFSM, from the barometer and high-G history windows
+struct HistoryBufferGuards {
+    static float altitudeChange(const FlightFeatures& f) {
+        return std::fabs(f.baro_altitude_window0 - f.baro_altitude_window1);
+    }
+    static float accelChange(const FlightFeatures& f) { return std::fabs(f.accel_window0 - f.accel_window1); }
+    static float altitudeAccelChange(const FlightFeatures& f) {
+        return std::fabs(f.baro_accel_window0 - f.baro_accel_window1);
+    }
+
+    static bool aboveLaunchAccel(const FlightFeatures& f) { return f.highg_az > launch_linear_acceleration_thresh; }
+    static bool belowLaunchAccel(const FlightFeatures& f) { return f.highg_az < launch_linear_acceleration_thresh; }
+    static bool aboveCoastAccel(const FlightFeatures& f) { return f.highg_az > coast_thresh; }
+    static bool belowCoastAccel(const FlightFeatures& f) { return f.highg_az < coast_thresh; }
+    static bool apogeeStill(const FlightFeatures& f) { return altitudeChange(f) < apogee_altimeter_threshold; }
+    static bool apogeeMoving(const FlightFeatures& f) { return altitudeChange(f) > apogee_altimeter_threshold; }
+    static bool drogueAccelChange(const FlightFeatures& f) {
+        return accelChange(f) > drogue_acceleration_change_threshold_imu;
+    }
+    static bool drogueAltitudeChange(const FlightFeatures& f) {
+        return altitudeAccelChange(f) > drogue_acceleration_change_threshold_altimeter;
+    }
+    static bool mainAccelChange(const FlightFeatures& f) {
+        return accelChange(f) > main_acceleration_change_threshold_imu;
+    }
+    static bool mainAltitudeChange(const FlightFeatures& f) {
+        return altitudeAccelChange(f) > main_acceleration_change_threshold_altimeter;
+    }
+    static bool landedStill(const FlightFeatures& f) { return altitudeChange(f) < landing_altimeter_threshold; }
+    static bool landedMoving(const FlightFeatures& f) { return altitudeChange(f) > landing_altimeter_threshold; }
+};
+
+// Guards of KalmanFSM, from the Kalman filter state and history windows
+struct KalmanGuards {
+    static float altitudeChange(const FlightFeatures& f) {
+        return std::fabs(f.kalman_altitude_window0 - f.kalman_altitude_window1);
+    }
+    static float accelChange(const FlightFeatures& f) {
+        return std::fabs(f.kalman_accel_window0 - f.kalman_accel_window1);
+    }
+    static float altitudeAccelChange(const FlightFeatures& f) {
+        return std::fabs(f.kalman_altitude_accel_window0 - f.kalman_altitude_accel_window1);
+    }
+
+    static bool aboveLaunchAccel(const FlightFeatures& f) { return f.kalman_accel > launch_linear_acceleration_thresh; }
+    static bool belowLaunchAccel(const FlightFeatures& f) { return f.kalman_accel < launch_linear_acceleration_thresh; }
+    static bool aboveCoastAccel(const FlightFeatures& f) { return f.kalman_accel > coast_thresh; }
+    static bool belowCoastAccel(const FlightFeatures& f) { return f.kalman_accel < coast_thresh; }
+    static bool apogeeStill(const FlightFeatures& f) {
+        return std::fabs(f.kalman_vel) * 0.02 < apogee_altimeter_threshold;
+    }
+    static bool apogeeMoving(const FlightFeatures& f) { return altitudeChange(f) > apogee_altimeter_threshold; }
+    static bool drogueAccelChange(const FlightFeatures& f) {
+        return accelChange(f) > drogue_acceleration_change_threshold_imu;
+    }
+    static bool drogueAltitudeChange(const FlightFeatures& f) {
+        return altitudeAccelChange(f) > drogue_acceleration_change_threshold_altimeter;
+    }
+    static bool mainAccelChange(const FlightFeatures& f) {
+        return accelChange(f) > main_acceleration_change_threshold_imu;
+    }
+    static bool mainAltitudeChange(const FlightFeatures& f) {
+        return altitudeAccelChange(f) > main_acceleration_change_threshold_altimeter;
+    }
+    static bool landedStill(const FlightFeatures& f) { return altitudeChange(f) < landing_altimeter_threshold; }
+    static bool landedMoving(const FlightFeatures& f) { return altitudeChange(f) > landing_altimeter_threshold; }
+};
+
+using HistoryBufferFSMTable = DetectFSMTable<HistoryBufferGuards>;
+using KalmanFSMTable = DetectFSMTable<KalmanGuards>;
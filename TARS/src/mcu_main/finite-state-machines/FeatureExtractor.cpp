@@ -0,0 +1,54 @@
+/**
+ * @file FeatureExtractor.cpp
+ *
+ * @brief Takes the per-tick FlightFeatures snapshot from the sensors, the data logger and the Kalman filter.
+ */
+
+#include "mcu_main/finite-state-machines/FlightFeatures.h"
+
+#include "mcu_main/Abort.h"
+#include "mcu_main/Trace.h"
+#include "mcu_main/dataLog.h"
+#include "mcu_main/gnc/kalmanFilter.h"
+#include "mcu_main/sensors/sensors.h"
+
+/**
+ * @brief Takes a snapshot of the sensors, the data logger history and the Kalman filter.
+ *
+ * Each sensor mutex is held only while its reading is copied.
+ *
+ * @return the features for this tick
+ */
+FlightFeatures FeatureExtractor::extract() {
+    FlightFeatures features{};
+    features.now = chVTGetSystemTime();
+    features.aborted = isAborted();
+
+    TRACE_MTX_LOCK(&highG.mutex);
+    features.highg_az = highG.getAccel().az;
+    chMtxUnlock(&highG.mutex);
+
+    TRACE_MTX_LOCK(&barometer.mutex);
+    features.altitude = barometer.getAltitude();
+    chMtxUnlock(&barometer.mutex);
+
+    TRACE_MTX_LOCK(&orientation.mutex);
+    features.euler = orientation.getEuler();
+    chMtxUnlock(&orientation.mutex);
+
+    TRACE_MTX_LOCK(&kalmanFilter.mutex);
+    KalmanState kalman_state = kalmanFilter.getState();
+    chMtxUnlock(&kalmanFilter.mutex);
+    features.kalman_accel = kalman_state.state_est_accel_x;
+    features.kalman_vel = kalman_state.state_est_vel_x;
+
+    BarometerData baro[2 * FEATURE_WINDOW];
+    dataLogger.barometerFifo.readSlice(baro, 0, 2 * FEATURE_WINDOW);
+    HighGData high_g[2 * FEATURE_WINDOW];
+    dataLogger.highGFifo.readSlice(high_g, 0, 2 * FEATURE_WINDOW);
+    KalmanData kalman[2 * FEATURE_WINDOW];
+    dataLogger.kalmanFifo.readSlice(kalman, 0, 2 * FEATURE_WINDOW);
+
+    derive(features, baro, high_g, kalman);
+    return features;
+}
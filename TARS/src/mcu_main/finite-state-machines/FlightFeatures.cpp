@@ -0,0 +1,115 @@
+/**
+ * @file FlightFeatures.cpp
+ *
+ * @brief Computes the history and derived FlightFeatures from raw samples. Has no sensor access so that it also builds
+ * on the host, see FeatureExtractor.cpp for the on-board snapshot.
+ */
+
+#include "mcu_main/finite-state-machines/FlightFeatures.h"
+
+#include "mcu_main/finite-state-machines/thresholds.h"
+
+/**
+ * @brief Averages one window of a history slice.
+ */
+template <typename T>
+static float windowAverage(T (&items)[2 * FEATURE_WINDOW], size_t start, float (*access_value)(T&)) {
+    float sum = 0;
+    for (size_t i = start; i < start + FEATURE_WINDOW; i++) {
+        sum += access_value(items[i]);
+    }
+    return sum / FEATURE_WINDOW;
+}
+
+/**
+ * @brief Averages the second derivative of a value over one window of a history slice.
+ *
+ * @return the average second derivative in units of the value per second squared
+ */
+template <typename T>
+static float windowSecondDerivative(T (&items)[2 * FEATURE_WINDOW], size_t start, float (*access_value)(T&),
+                                    systime_t (*access_time)(T&)) {
+    float derivatives[FEATURE_WINDOW - 1];
+    float times[FEATURE_WINDOW - 1];
+    for (size_t i = 0; i < FEATURE_WINDOW - 1; i++) {
+        T& a = items[start + i];
+        T& b = items[start + i + 1];
+        float dt = TIME_I2MS(access_time(b) - access_time(a)) / 1000.0f;
+        derivatives[i] = dt > 0 ? (access_value(b) - access_value(a)) / dt : 0;
+        times[i] = TIME_I2MS(access_time(a)) / 1000.0f + dt / 2;
+    }
+
+    float sum = 0;
+    for (size_t i = 0; i < FEATURE_WINDOW - 2; i++) {
+        float dt = times[i + 1] - times[i];
+        sum += dt > 0 ? (derivatives[i + 1] - derivatives[i]) / dt : 0;
+    }
+    return sum / (FEATURE_WINDOW - 2);
+}
+
+/**
+ * @brief Tracks how long a condition has held continuously.
+ *
+ * @param condition whether the condition holds at this tick
+ * @param now time of this tick
+ * @param since time the condition started holding, 0 if it does not hold
+ * @return time the condition has held for, 0 if it does not hold
+ */
+sysinterval_t FeatureExtractor::timeSince(bool condition, systime_t now, systime_t& since) {
+    if (!condition) {
+        since = 0;
+        return 0;
+    }
+    if (since == 0) {
+        since = now;
+    }
+    return now - since;
+}
+
+/**
+ * @brief Fills in the history windows and the condition timers.
+ *
+ * The latest readings (now, highg_az, kalman_accel, kalman_vel, ...) have to be set before calling this.
+ *
+ * @param features snapshot being built
+ * @param baro last 2 * FEATURE_WINDOW barometer samples, oldest first
+ * @param high_g last 2 * FEATURE_WINDOW high-G samples, oldest first
+ * @param kalman last 2 * FEATURE_WINDOW Kalman filter samples, oldest first
+ */
+void FeatureExtractor::derive(FlightFeatures& features, BarometerData (&baro)[2 * FEATURE_WINDOW],
+                              HighGData (&high_g)[2 * FEATURE_WINDOW], KalmanData (&kalman)[2 * FEATURE_WINDOW]) {
+    auto baro_altitude = +[](BarometerData& b) { return b.altitude; };
+    auto baro_time = +[](BarometerData& b) { return b.timeStamp_barometer; };
+    features.baro_altitude_window0 = windowAverage(baro, 0, baro_altitude);
+    features.baro_altitude_window1 = windowAverage(baro, FEATURE_WINDOW, baro_altitude);
+    features.baro_altitude_delta = features.baro_altitude_window0 - features.baro_altitude_window1;
+    features.baro_accel_window0 = windowSecondDerivative(baro, 0, baro_altitude, baro_time);
+    features.baro_accel_window1 = windowSecondDerivative(baro, FEATURE_WINDOW, baro_altitude, baro_time);
+
+    float baro_window_dt =
+        TIME_I2MS(baro[FEATURE_WINDOW].timeStamp_barometer - baro[0].timeStamp_barometer) / 1000.0f;
+    features.baro_velocity = baro_window_dt > 0 ? -features.baro_altitude_delta / baro_window_dt : 0;
+
+    auto high_g_az = +[](HighGData& g) { return g.hg_az; };
+    features.accel_window0 = windowAverage(high_g, 0, high_g_az);
+    features.accel_window1 = windowAverage(high_g, FEATURE_WINDOW, high_g_az);
+    features.accel_average = (features.accel_window0 + features.accel_window1) / 2;
+    features.sample_time = high_g[2 * FEATURE_WINDOW - 1].timeStamp_highG;
+
+    auto kalman_altitude = +[](KalmanData& k) { return k.kalman_pos_x; };
+    auto kalman_accel = +[](KalmanData& k) { return k.kalman_acc_x; };
+    auto kalman_time = +[](KalmanData& k) { return k.timeStamp_state; };
+    features.kalman_altitude_window0 = windowAverage(kalman, 0, kalman_altitude);
+    features.kalman_altitude_window1 = windowAverage(kalman, FEATURE_WINDOW, kalman_altitude);
+    features.kalman_accel_window0 = windowAverage(kalman, 0, kalman_accel);
+    features.kalman_accel_window1 = windowAverage(kalman, FEATURE_WINDOW, kalman_accel);
+    features.kalman_altitude_accel_window0 = windowSecondDerivative(kalman, 0, kalman_altitude, kalman_time);
+    features.kalman_altitude_accel_window1 =
+        windowSecondDerivative(kalman, FEATURE_WINDOW, kalman_altitude, kalman_time);
+
+    features.time_above_launch_accel = timeSince(features.highg_az > launch_linear_acceleration_thresh,
+                                                 features.now, above_launch_accel_since_);
+    features.time_below_coast_accel =
+        timeSince(features.highg_az < coast_thresh, features.now, below_coast_accel_since_);
+    features.time_descending = timeSince(features.kalman_vel < 0, features.now, descending_since_);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file FlightFeatures.h
+ *
+ * @brief Per-tick snapshot of everything the FSMs look at.
+ *
+ * FSMCollection extracts the features once per tick and passes the same snapshot to every FSM. Sensor mutexes are
+ * only held while the snapshot is taken and the history buffer averages are computed once, so adding more FSMs does
+ * not add more sensor or buffer reads.
+ */
+
+#pragma once
+
+#include <ChRt.h>
+
+#include "common/packet.h"
+
+// Number of samples in each of the two history windows compared by the FSMs
+#define FEATURE_WINDOW 3
+
+struct FlightFeatures {
+    // Time the snapshot was taken, used by the FSMs instead of reading the clock themselves
+    systime_t now;
+    // Time the newest high-G sample was taken, for measuring the sensor to FSM latency
+    systime_t sample_time;
+    bool aborted;
+
+    // Latest sensor readings
+    float highg_az;
+    float altitude;
+    euler_t euler;
+
+    /*
+     * History windows are the slices [0, FEATURE_WINDOW) (window0) and [FEATURE_WINDOW, 2 * FEATURE_WINDOW) (window1)
+     * of the data logger FIFOs as returned by FifoBuffer::readSlice, the same slices the FSMs used to average
+     * themselves.
+     */
+
+    // Barometer history
+    float baro_altitude_window0;
+    float baro_altitude_window1;
+    // window0 - window1, which is what the FSM velocity thresholds are tuned against
+    float baro_altitude_delta;
+    // Vertical velocity (m/s) between the two windows, from the barometer timestamps
+    float baro_velocity;
+    // Second derivative of altitude (m/s^2) averaged over each window
+    float baro_accel_window0;
+    float baro_accel_window1;
+
+    // High-G z acceleration history
+    float accel_average;  // over both windows
+    float accel_window0;
+    float accel_window1;
+
+    // Kalman filter state and history
+    float kalman_accel;
+    float kalman_vel;
+    float kalman_altitude_window0;
+    float kalman_altitude_window1;
+    float kalman_accel_window0;
+    float kalman_accel_window1;
+    float kalman_altitude_accel_window0;
+    float kalman_altitude_accel_window1;
+
+    // How long each condition has held continuously, 0 if it does not hold right now
+    sysinterval_t time_above_launch_accel;
+    sysinterval_t time_below_coast_accel;
+    sysinterval_t time_descending;
+};
+
+/**
+ * @brief Builds a FlightFeatures snapshot from the sensors, the data logger history and the Kalman filter.
+ */
+class FeatureExtractor {
+   public:
+    FlightFeatures extract();
+
+    void derive(FlightFeatures& features, BarometerData (&baro)[2 * FEATURE_WINDOW],
+                HighGData (&high_g)[2 * FEATURE_WINDOW], KalmanData (&kalman)[2 * FEATURE_WINDOW]);
+
+   private:
+    static sysinterval_t timeSince(bool condition, systime_t now, systime_t& since);
+
+    systime_t above_launch_accel_since_ = 0;
+    systime_t below_coast_accel_since_ = 0;
+    systime_t descending_since_ = 0;
+};
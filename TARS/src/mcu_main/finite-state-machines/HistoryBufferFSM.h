@@ -1,13 +1,13 @@
 #pragma once
 
-#include "mcu_main/Abort.h"
-#include "mcu_main/dataLog.h"
 #include "mcu_main/finite-state-machines/RocketFSMBase.h"
 #include "mcu_main/finite-state-machines/thresholds.h"
-#include "mcu_main/sensors/sensors.h"
 
+// The history windows are computed once per tick in FlightFeatures, view only selects their combined size
 template <size_t view>
 class HistoryBufferFSM : public RocketFSMBase {
+    static_assert(view == 2 * FEATURE_WINDOW, "HistoryBufferFSM view must match FEATURE_WINDOW");
+
    public:
     HistoryBufferFSM() = default;
 
@@ -29,37 +29,20 @@ class HistoryBufferFSM : public RocketFSMBase {
     systime_t landing_time_ = 0;
     sysinterval_t landing_timer = 0;
 
-    double getAltitudeAverage(size_t start, size_t len) {
-        return HistoryBufferFSM::getAverage(
-            dataLogger.barometerFifo, +[](BarometerData& b) { return (double)b.altitude; }, start, len);
-    }
-
-    double getSecondDerivativeAltitudeAverage(size_t start, size_t len) {
-        return HistoryBufferFSM::getSecondDerivativeAverage(
-            dataLogger.barometerFifo, +[](BarometerData& b) { return (double)b.altitude; },
-            +[](BarometerData& b) { return b.timeStamp_barometer; }, start, len);
-    }
-
-    double getAccelerationAverage(size_t start, size_t len) {
-        return HistoryBufferFSM::getAverage(
-            dataLogger.highGFifo, +[](HighGData& g) { return (double)g.hg_az; }, start, len);
-    }
-
    public:
     /**
      * @brief HistoryBufferFSM50 tick function
      *
      * Uses a combination of linear acceleration and timers to govern FSM state
      * changes for each timestep of the rocket's flight.
+     *
+     * @param features snapshot of the sensors and history for this tick
      */
-    void tickFSM() override {
-        // Lock mutexes for data used in switch
-        chMtxLock(&highG.mutex);
-
+    void tickFSM(const FlightFeatures& features) override {
         // Serial.println(state_map[(int)rocket_state_]);
 
         // Links to abort for other states
-        if (isAborted()) {
+        if (features.aborted) {
             rocket_state_ = FSM_State::STATE_ABORT;
         }
 
@@ -76,8 +59,8 @@ class HistoryBufferFSM : public RocketFSMBase {
 
             case FSM_State::STATE_IDLE:
                 // If high acceleration is observed in z direction...
-                if (highG.getAccel().az > launch_linear_acceleration_thresh) {
-                    launch_time_ = chVTGetSystemTime();
+                if (features.highg_az > launch_linear_acceleration_thresh) {
+                    launch_time_ = features.now;
                     rocket_state_ = FSM_State::STATE_LAUNCH_DETECT;
                 }
 
@@ -85,13 +68,13 @@ class HistoryBufferFSM : public RocketFSMBase {
 
             case FSM_State::STATE_LAUNCH_DETECT:
                 // If the acceleration was too brief, go back to IDLE
-                if (highG.getAccel().az < launch_linear_acceleration_thresh) {
+                if (features.highg_az < launch_linear_acceleration_thresh) {
                     rocket_state_ = FSM_State::STATE_IDLE;
                     break;
                 }
 
                 // Measure the length of the burn time (for hysteresis)
-                burn_timer_ = chVTGetSystemTime() - launch_time_;
+                burn_timer_ = features.now - launch_time_;
 
                 // If the acceleration lasts long enough, boost is detected
                 if (TIME_I2MS(burn_timer_) > launch_time_thresh) {
@@ -101,11 +84,11 @@ class HistoryBufferFSM : public RocketFSMBase {
                 break;
 
             case FSM_State::STATE_BOOST:
-                burn_timer_ = chVTGetSystemTime() - launch_time_;
+                burn_timer_ = features.now - launch_time_;
                 // If low acceleration in the Z direction...
-                if (highG.getAccel().az < coast_thresh) {
+                if (features.highg_az < coast_thresh) {
                     // Serial.println("Acceleration below thresh");
-                    burnout_time_ = chVTGetSystemTime();
+                    burnout_time_ = features.now;
                     rocket_state_ = FSM_State::STATE_BURNOUT_DETECT;
                     break;
                 }
@@ -116,20 +99,20 @@ class HistoryBufferFSM : public RocketFSMBase {
                 } else {  // Forcing rocket to go to FSM_State::STATE_COAST if threshold crossed
                     rocket_state_ = FSM_State::STATE_COAST_PREGNC;
                     // Setting burnout time because we don't otherwise
-                    burnout_time_ = chVTGetSystemTime();
+                    burnout_time_ = features.now;
                 }
 
                 break;
 
             case FSM_State::STATE_BURNOUT_DETECT:
                 // If the 0 acceleration was too brief, go back to BOOST
-                if (highG.getAccel().az > coast_thresh) {
+                if (features.highg_az > coast_thresh) {
                     rocket_state_ = FSM_State::STATE_BOOST;
                     break;
                 }
 
                 // Measure the length of the coast time (for hysteresis)
-                coast_timer_ = chVTGetSystemTime() - burnout_time_;
+                coast_timer_ = features.now - burnout_time_;
 
                 // If the low acceleration lasts long enough, coast is detected
                 if (TIME_I2MS(coast_timer_) > coast_time_thresh) {
@@ -139,7 +122,7 @@ class HistoryBufferFSM : public RocketFSMBase {
                 break;
 
             case FSM_State::STATE_COAST_PREGNC:
-                coast_timer_ = chVTGetSystemTime() - burnout_time_;
+                coast_timer_ = features.now - burnout_time_;
                 if (TIME_I2MS(coast_timer_) > coast_ac_delay_thresh) {
                     rocket_state_ = FSM_State::STATE_COAST_GNC;
                 }
@@ -147,12 +130,12 @@ class HistoryBufferFSM : public RocketFSMBase {
                 break;
 
             case FSM_State::STATE_COAST_GNC:
-                coast_timer_ = chVTGetSystemTime() - burnout_time_;
+                coast_timer_ = features.now - burnout_time_;
 
-                if (fabs(getAltitudeAverage(0, view / 2) - getAltitudeAverage(view / 2, view / 2)) <
+                if (fabs(features.baro_altitude_window0 - features.baro_altitude_window1) <
                     apogee_altimeter_threshold) {
                     rocket_state_ = FSM_State::STATE_APOGEE_DETECT;
-                    apogee_time_ = chVTGetSystemTime();
+                    apogee_time_ = features.now;
                     break;
                 }
 
@@ -160,21 +143,21 @@ class HistoryBufferFSM : public RocketFSMBase {
                     rocket_state_ = FSM_State::STATE_COAST_GNC;
                 } else {
                     rocket_state_ = FSM_State::STATE_APOGEE;
-                    apogee_time_ = chVTGetSystemTime();
+                    apogee_time_ = features.now;
                 }
 
                 break;
 
             case FSM_State::STATE_APOGEE_DETECT:
                 // If the 0 velocity was too brief, go back to coast
-                if (fabs(getAltitudeAverage(0, view / 2) - getAltitudeAverage(view / 2, view / 2)) >
+                if (fabs(features.baro_altitude_window0 - features.baro_altitude_window1) >
                     apogee_altimeter_threshold) {
                     rocket_state_ = FSM_State::STATE_COAST_GNC;
                     break;
                 }
 
                 // Measure the length of the apogee time (for hysteresis)
-                apogee_timer_ = chVTGetSystemTime() - apogee_time_;
+                apogee_timer_ = features.now - apogee_time_;
 
                 // If the low velocity lasts long enough, apogee is detected
                 if (TIME_I2MS(apogee_timer_) > apogee_time_thresh) {
@@ -184,7 +167,10 @@ class HistoryBufferFSM : public RocketFSMBase {
                 break;
 
             case FSM_State::STATE_APOGEE:
-                if (fabs(getAccelerationAverage(0, view / 2) - getAccelerationAverage(view / 2, view / 2)) >
+                // Kept running here, so the drogue timeout counts from apogee however APOGEE was reached
+                apogee_timer_ = features.now - apogee_time_;
+
+                if (fabs(features.accel_window0 - features.accel_window1) >
                     drogue_acceleration_change_threshold_imu) {
                     rocket_state_ = FSM_State::STATE_DROGUE_DETECT;
                     break;
@@ -195,16 +181,15 @@ class HistoryBufferFSM : public RocketFSMBase {
                     rocket_state_ = FSM_State::STATE_APOGEE;
                 } else {
                     rocket_state_ = FSM_State::STATE_DROGUE;
-                    drogue_time_ = chVTGetSystemTime();
+                    drogue_time_ = features.now;
                 }
                 break;
 
             case FSM_State::STATE_DROGUE_DETECT:
-                if (fabs(getSecondDerivativeAltitudeAverage(0, view / 2) -
-                         getSecondDerivativeAltitudeAverage(view / 2, view / 2)) >
+                if (fabs(features.baro_accel_window0 - features.baro_accel_window1) >
                     drogue_acceleration_change_threshold_altimeter) {
                     rocket_state_ = FSM_State::STATE_DROGUE;
-                    drogue_time_ = chVTGetSystemTime();
+                    drogue_time_ = features.now;
                     break;
                 } else {
                     rocket_state_ = FSM_State::STATE_APOGEE;
@@ -212,9 +197,9 @@ class HistoryBufferFSM : public RocketFSMBase {
                 break;
 
             case FSM_State::STATE_DROGUE:
-                drogue_timer_ = chVTGetSystemTime() - drogue_time_;
+                drogue_timer_ = features.now - drogue_time_;
                 if (TIME_I2MS(drogue_timer_) > refresh_timer) {
-                    if (fabs(getAccelerationAverage(0, view / 2) - getAccelerationAverage(view / 2, view / 2)) >
+                    if (fabs(features.accel_window0 - features.accel_window1) >
                         main_acceleration_change_threshold_imu) {
                         rocket_state_ = FSM_State::STATE_MAIN_DETECT;
                         break;
@@ -226,16 +211,15 @@ class HistoryBufferFSM : public RocketFSMBase {
 
                 } else {
                     rocket_state_ = FSM_State::STATE_MAIN;
-                    main_time_ = chVTGetSystemTime();
+                    main_time_ = features.now;
                 }
                 break;
 
             case FSM_State::STATE_MAIN_DETECT:
-                if (fabs(getSecondDerivativeAltitudeAverage(0, view / 2) -
-                         getSecondDerivativeAltitudeAverage(view / 2, view / 2)) >
+                if (fabs(features.baro_accel_window0 - features.baro_accel_window1) >
                     main_acceleration_change_threshold_altimeter) {
                     rocket_state_ = FSM_State::STATE_MAIN;
-                    main_time_ = chVTGetSystemTime();
+                    main_time_ = features.now;
                     break;
                 } else {
                     rocket_state_ = FSM_State::STATE_DROGUE;
@@ -243,12 +227,12 @@ class HistoryBufferFSM : public RocketFSMBase {
                 break;
 
             case FSM_State::STATE_MAIN:
-                main_timer_ = chVTGetSystemTime() - main_time_;
+                main_timer_ = features.now - main_time_;
 
-                if (fabs(getAltitudeAverage(0, view / 2) - getAltitudeAverage(view / 2, view / 2)) <
+                if (fabs(features.baro_altitude_window0 - features.baro_altitude_window1) <
                     landing_altimeter_threshold) {
                     rocket_state_ = FSM_State::STATE_LANDED_DETECT;
-                    landing_time_ = chVTGetSystemTime();
+                    landing_time_ = features.now;
                     break;
                 }
 
@@ -256,20 +240,20 @@ class HistoryBufferFSM : public RocketFSMBase {
                     rocket_state_ = FSM_State::STATE_MAIN;
                 } else {
                     rocket_state_ = FSM_State::STATE_LANDED;
-                    landing_time_ = chVTGetSystemTime();
+                    landing_time_ = features.now;
                 }
                 break;
 
             case FSM_State::STATE_LANDED_DETECT:
                 // If the 0 velocity was too brief, go back to main
-                if (fabs(getAltitudeAverage(0, view / 2) - getAltitudeAverage(view / 2, view / 2)) >
+                if (fabs(features.baro_altitude_window0 - features.baro_altitude_window1) >
                     landing_altimeter_threshold) {
                     rocket_state_ = FSM_State::STATE_MAIN;
                     break;
                 }
 
                 // Measure the length of the landed time (for hysteresis)
-                landing_timer = chVTGetSystemTime() - landing_time_;
+                landing_timer = features.now - landing_time_;
 
                 // If the low velocity lasts long enough, landing is detected
                 if (TIME_I2MS(landing_timer) > landing_time_thresh) {
@@ -282,8 +266,5 @@ class HistoryBufferFSM : public RocketFSMBase {
             default:
                 break;
         }
-
-        // Unlock mutexes used during the switch statement
-        chMtxUnlock(&highG.mutex);
     }
 };
@@ -30,40 +30,19 @@
 
 #include <cmath>
 
-#include "mcu_main/Abort.h"
-#include "mcu_main/dataLog.h"
 #include "mcu_main/finite-state-machines/thresholds.h"
-#include "mcu_main/gnc/kalmanFilter.h"
-#include "mcu_main/sensors/sensors.h"
-
-double KalmanFSM::getAltitudeAverage(size_t start, size_t len) {
-    return KalmanFSM::getAverage(
-        dataLogger.kalmanFifo, +[](KalmanData& k) { return (double)k.kalman_pos_x; }, start, len);
-}
-
-double KalmanFSM::getSecondDerivativeAltitudeAverage(size_t start, size_t len) {
-    return KalmanFSM::getSecondDerivativeAverage(
-        dataLogger.kalmanFifo, +[](KalmanData& k) { return (double)k.kalman_pos_x; },
-        +[](KalmanData& k) { return k.timeStamp_state; }, start, len);
-}
-
-double KalmanFSM::getAccelerationAverage(size_t start, size_t len) {
-    return KalmanFSM::getAverage(
-        dataLogger.kalmanFifo, +[](KalmanData& k) { return (double)k.kalman_acc_x; }, start, len);
-}
 
 /**
  * @brief KalmanFSM tick function
  *
  * Uses a combination of linear acceleration and timers to govern FSM state
  * changes for each timestep of the rocket's flight.
+ *
+ * @param features snapshot of the sensors and history for this tick
  */
-void KalmanFSM::tickFSM() {
-    // Lock mutexes for data used in switch
-    chMtxLock(&highG.mutex);
-
+void KalmanFSM::tickFSM(const FlightFeatures& features) {
     // Links to abort for other states
-    if (isAborted()) {
+    if (features.aborted) {
         rocket_state_ = FSM_State::STATE_ABORT;
     }
 
@@ -80,8 +59,8 @@ void KalmanFSM::tickFSM() {
 
         case FSM_State::STATE_IDLE:
             // If high acceleration is observed in z direction...
-            if (kalmanFilter.getState().state_est_accel_x > launch_linear_acceleration_thresh) {
-                launch_time_ = chVTGetSystemTime();
+            if (features.kalman_accel > launch_linear_acceleration_thresh) {
+                launch_time_ = features.now;
                 rocket_state_ = FSM_State::STATE_LAUNCH_DETECT;
             }
 
@@ -89,13 +68,13 @@ void KalmanFSM::tickFSM() {
 
         case FSM_State::STATE_LAUNCH_DETECT:
             // If the acceleration was too brief, go back to IDLE
-            if (kalmanFilter.getState().state_est_accel_x < launch_linear_acceleration_thresh) {
+            if (features.kalman_accel < launch_linear_acceleration_thresh) {
                 rocket_state_ = FSM_State::STATE_IDLE;
                 break;
             }
 
             // Measure the length of the burn time (for hysteresis)
-            burn_timer_ = chVTGetSystemTime() - launch_time_;
+            burn_timer_ = features.now - launch_time_;
 
             // If the acceleration lasts long enough, boost is detected
             if (TIME_I2MS(burn_timer_) > launch_time_thresh) {
@@ -105,11 +84,11 @@ void KalmanFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_BOOST:
-            burn_timer_ = chVTGetSystemTime() - launch_time_;
+            burn_timer_ = features.now - launch_time_;
             // If low acceleration in the Z direction...
-            if (kalmanFilter.getState().state_est_accel_x < coast_thresh) {
+            if (features.kalman_accel < coast_thresh) {
                 // Serial.println("Acceleration below thresh");
-                burnout_time_ = chVTGetSystemTime();
+                burnout_time_ = features.now;
                 rocket_state_ = FSM_State::STATE_BURNOUT_DETECT;
                 break;
             }
@@ -120,20 +99,20 @@ void KalmanFSM::tickFSM() {
             } else {  // Forcing rocket to go to FSM_State::STATE_COAST if threshold crossed
                 rocket_state_ = FSM_State::STATE_COAST_PREGNC;
                 // Setting burnout time because we don't otherwise
-                burnout_time_ = chVTGetSystemTime();
+                burnout_time_ = features.now;
             }
 
             break;
 
         case FSM_State::STATE_BURNOUT_DETECT:
             // If the 0 acceleration was too brief, go back to BOOST
-            if (kalmanFilter.getState().state_est_accel_x > coast_thresh) {
+            if (features.kalman_accel > coast_thresh) {
                 rocket_state_ = FSM_State::STATE_BOOST;
                 break;
             }
 
             // Measure the length of the coast time (for hysteresis)
-            coast_timer_ = chVTGetSystemTime() - burnout_time_;
+            coast_timer_ = features.now - burnout_time_;
 
             // If the low acceleration lasts long enough, coast is detected
             if (TIME_I2MS(coast_timer_) > coast_time_thresh) {
@@ -143,7 +122,7 @@ void KalmanFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_COAST_PREGNC:
-            coast_timer_ = chVTGetSystemTime() - burnout_time_;
+            coast_timer_ = features.now - burnout_time_;
             if (TIME_I2MS(coast_timer_) > coast_ac_delay_thresh) {
                 rocket_state_ = FSM_State::STATE_COAST_GNC;
             }
@@ -151,11 +130,11 @@ void KalmanFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_COAST_GNC:
-            coast_timer_ = chVTGetSystemTime() - burnout_time_;
+            coast_timer_ = features.now - burnout_time_;
 
-            if (fabs(kalmanFilter.getState().state_est_vel_x) * 0.02 < apogee_altimeter_threshold) {
+            if (fabs(features.kalman_vel) * 0.02 < apogee_altimeter_threshold) {
                 rocket_state_ = FSM_State::STATE_APOGEE_DETECT;
-                apogee_time_ = chVTGetSystemTime();
+                apogee_time_ = features.now;
                 break;
             }
 
@@ -163,20 +142,21 @@ void KalmanFSM::tickFSM() {
                 rocket_state_ = FSM_State::STATE_COAST_GNC;
             } else {
                 rocket_state_ = FSM_State::STATE_APOGEE;
-                apogee_time_ = chVTGetSystemTime();
+                apogee_time_ = features.now;
             }
 
             break;
 
         case FSM_State::STATE_APOGEE_DETECT:
             // If the 0 velocity was too brief, go back to coast
-            if (fabs(getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3)) > apogee_altimeter_threshold) {
+            if (fabs(features.kalman_altitude_window0 - features.kalman_altitude_window1) >
+                apogee_altimeter_threshold) {
                 rocket_state_ = FSM_State::STATE_COAST_GNC;
                 break;
             }
 
             // Measure the length of the apogee time (for hysteresis)
-            apogee_timer_ = chVTGetSystemTime() - apogee_time_;
+            apogee_timer_ = features.now - apogee_time_;
 
             // If the low velocity lasts long enough, apogee is detected
             if (TIME_I2MS(apogee_timer_) > apogee_time_thresh) {
@@ -186,7 +166,10 @@ void KalmanFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_APOGEE:
-            if (fabs(getAccelerationAverage(0, 3) - getAccelerationAverage(3, 3)) >
+            // Kept running here, so the drogue timeout counts from apogee however APOGEE was reached
+            apogee_timer_ = features.now - apogee_time_;
+
+            if (fabs(features.kalman_accel_window0 - features.kalman_accel_window1) >
                 drogue_acceleration_change_threshold_imu) {
                 rocket_state_ = FSM_State::STATE_DROGUE_DETECT;
                 break;
@@ -197,15 +180,15 @@ void KalmanFSM::tickFSM() {
                 rocket_state_ = FSM_State::STATE_APOGEE;
             } else {
                 rocket_state_ = FSM_State::STATE_DROGUE;
-                drogue_time_ = chVTGetSystemTime();
+                drogue_time_ = features.now;
             }
             break;
 
         case FSM_State::STATE_DROGUE_DETECT:
-            if (fabs(getSecondDerivativeAltitudeAverage(0, 3) - getSecondDerivativeAltitudeAverage(3, 3)) >
+            if (fabs(features.kalman_altitude_accel_window0 - features.kalman_altitude_accel_window1) >
                 drogue_acceleration_change_threshold_altimeter) {
                 rocket_state_ = FSM_State::STATE_DROGUE;
-                drogue_time_ = chVTGetSystemTime();
+                drogue_time_ = features.now;
                 break;
             } else {
                 rocket_state_ = FSM_State::STATE_APOGEE;
@@ -213,9 +196,9 @@ void KalmanFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_DROGUE:
-            drogue_timer_ = chVTGetSystemTime() - drogue_time_;
+            drogue_timer_ = features.now - drogue_time_;
             if (TIME_I2MS(drogue_timer_) > refresh_timer) {
-                if (fabs(getAccelerationAverage(0, 3) - getAccelerationAverage(3, 3)) >
+                if (fabs(features.kalman_accel_window0 - features.kalman_accel_window1) >
                     main_acceleration_change_threshold_imu) {
                     rocket_state_ = FSM_State::STATE_MAIN_DETECT;
                     break;
@@ -226,15 +209,15 @@ void KalmanFSM::tickFSM() {
                 rocket_state_ = FSM_State::STATE_DROGUE;
             } else {
                 rocket_state_ = FSM_State::STATE_MAIN;
-                main_time_ = chVTGetSystemTime();
+                main_time_ = features.now;
             }
             break;
 
         case FSM_State::STATE_MAIN_DETECT:
-            if (fabs(getSecondDerivativeAltitudeAverage(0, 3) - getSecondDerivativeAltitudeAverage(3, 3)) >
+            if (fabs(features.kalman_altitude_accel_window0 - features.kalman_altitude_accel_window1) >
                 main_acceleration_change_threshold_altimeter) {
                 rocket_state_ = FSM_State::STATE_MAIN;
-                main_time_ = chVTGetSystemTime();
+                main_time_ = features.now;
                 break;
             } else {
                 rocket_state_ = FSM_State::STATE_DROGUE;
@@ -242,12 +225,13 @@ void KalmanFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_MAIN:
-            main_timer_ = chVTGetSystemTime() - main_time_;
+            main_timer_ = features.now - main_time_;
 
             // if(TIME_I2MS(main_timer_) > refresh_timer){
-            if (fabs(getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3)) < landing_altimeter_threshold) {
+            if (fabs(features.kalman_altitude_window0 - features.kalman_altitude_window1) <
+                landing_altimeter_threshold) {
                 rocket_state_ = FSM_State::STATE_LANDED_DETECT;
-                landing_time_ = chVTGetSystemTime();
+                landing_time_ = features.now;
                 break;
             }
             // }
@@ -256,19 +240,20 @@ void KalmanFSM::tickFSM() {
                 rocket_state_ = FSM_State::STATE_MAIN;
             } else {
                 rocket_state_ = FSM_State::STATE_LANDED;
-                landing_time_ = chVTGetSystemTime();
+                landing_time_ = features.now;
             }
             break;
 
         case FSM_State::STATE_LANDED_DETECT:
             // If the 0 velocity was too brief, go back to main
-            if (fabs(getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3)) > landing_altimeter_threshold) {
+            if (fabs(features.kalman_altitude_window0 - features.kalman_altitude_window1) >
+                landing_altimeter_threshold) {
                 rocket_state_ = FSM_State::STATE_MAIN;
                 break;
             }
 
             // Measure the length of the landed time (for hysteresis)
-            landing_timer = chVTGetSystemTime() - landing_time_;
+            landing_timer = features.now - landing_time_;
 
             // If the low velocity lasts long enough, landing is detected
             if (TIME_I2MS(landing_timer) > landing_time_thresh) {
@@ -283,7 +268,4 @@ void KalmanFSM::tickFSM() {
         default:
             break;
     }
-
-    // Unlock mutexes used during the switch statement
-    chMtxUnlock(&highG.mutex);
 }
@@ -6,7 +6,7 @@ class KalmanFSM : public RocketFSMBase {
    public:
     KalmanFSM() = default;
 
-    void tickFSM() override;
+    void tickFSM(const FlightFeatures& features) override;
 
    private:
     systime_t launch_time_ = 0;
@@ -25,8 +25,4 @@ class KalmanFSM : public RocketFSMBase {
 
     systime_t landing_time_ = 0;
     sysinterval_t landing_timer = 0;
-
-    double getAltitudeAverage(size_t start, size_t len);
-    double getSecondDerivativeAltitudeAverage(size_t start, size_t len);
-    double getAccelerationAverage(size_t start, size_t len);
 };
@@ -1,22 +1,14 @@
 #include "mcu_main/finite-state-machines/ModularFSM.h"
 
-#include "mcu_main/dataLog.h"
 #include "mcu_main/debug.h"
 #include "mcu_main/finite-state-machines/thresholds.h"
-#include "mcu_main/sensors/sensors.h"
 
-double ModularFSM::getAltitudeAverage(size_t start, size_t len) {
-    return ModularFSM::getAverage(
-        dataLogger.barometerFifo, +[](BarometerData& b) { return (double)b.altitude; }, start, len);
-}
-
-double ModularFSM::getAccelerationAverage(size_t start, size_t len) {
-    return ModularFSM::getAverage(
-        dataLogger.highGFifo, +[](HighGData& g) { return (double)g.hg_az; }, start, len);
-}
+#ifdef FSM_DEBUG
+#include <Arduino.h>
+#endif
 
-bool ModularFSM::idleEventCheck() {
-    if (highG.getAccel().az > launch_linear_acceleration_thresh) {
+bool ModularFSM::idleEventCheck(const FlightFeatures& features) {
+    if (features.highg_az > launch_linear_acceleration_thresh) {
         last_state_ = rocket_state_;
         rocket_state_ = FSM_State::STATE_BOOST;
         return true;
@@ -24,17 +16,17 @@ bool ModularFSM::idleEventCheck() {
     return false;
 }
 
-bool ModularFSM::idleStateCheck() {
+bool ModularFSM::idleStateCheck(const FlightFeatures& features) {
     // vel subject to change pending derivative calculations
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+    float vel = features.baro_altitude_delta;
 
-    bool altitude_in_range = (launch_site_altitude_ - alt_error) <= barometer.getAltitude() &&
-                             barometer.getAltitude() <= (launch_site_altitude_ + alt_error);
-    bool acc_in_range = (1 - acc_error) <= highG.getAccel().az && highG.getAccel().az <= (1 + acc_error);
-    bool ang_in_range_pitch = (ang_start - ang_error) <= orientation.getEuler().pitch &&
-                              orientation.getEuler().pitch <= (ang_start + ang_error);
+    bool altitude_in_range = (launch_site_altitude_ - alt_error) <= features.altitude &&
+                             features.altitude <= (launch_site_altitude_ + alt_error);
+    bool acc_in_range = (1 - acc_error) <= features.highg_az && features.highg_az <= (1 + acc_error);
+    bool ang_in_range_pitch = (ang_start - ang_error) <= features.euler.pitch &&
+                              features.euler.pitch <= (ang_start + ang_error);
     bool ang_in_range_yaw =
-        (ang_start - ang_error) <= orientation.getEuler().yaw && orientation.getEuler().yaw <= (ang_start + ang_error);
+        (ang_start - ang_error) <= features.euler.yaw && features.euler.yaw <= (ang_start + ang_error);
     bool vel_in_range = -vel_error <= vel && vel <= vel_error;
 
     if (altitude_in_range && acc_in_range && ang_in_range_pitch && ang_in_range_yaw && vel_in_range) {
@@ -48,8 +40,8 @@ bool ModularFSM::idleStateCheck() {
     return false;
 }
 
-bool ModularFSM::boostEventCheck() {
-    if (highG.getAccel().az < boost_to_coast_acceleration) {
+bool ModularFSM::boostEventCheck(const FlightFeatures& features) {
+    if (features.highg_az < boost_to_coast_acceleration) {
         last_state_ = rocket_state_;
         rocket_state_ = FSM_State::STATE_COAST_PREGNC;
         return true;
@@ -57,15 +49,15 @@ bool ModularFSM::boostEventCheck() {
     return false;
 }
 
-bool ModularFSM::boostStateCheck() {
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::boostStateCheck(const FlightFeatures& features) {
+    float vel = features.baro_altitude_delta;
 
-    bool altitude_in_range = barometer.getAltitude() > launch_site_altitude_ + alt_error;
-    bool acc_in_range = getAccelerationAverage(0, 6) > boost_acc_thresh;
+    bool altitude_in_range = features.altitude > launch_site_altitude_ + alt_error;
+    bool acc_in_range = features.accel_average > boost_acc_thresh;
     bool ang_in_range_pitch =
-        -boost_ang_thresh <= orientation.getEuler().pitch && orientation.getEuler().pitch <= boost_ang_thresh;
+        -boost_ang_thresh <= features.euler.pitch && features.euler.pitch <= boost_ang_thresh;
     bool ang_in_range_yaw =
-        -boost_ang_thresh <= orientation.getEuler().yaw && orientation.getEuler().yaw <= boost_ang_thresh;
+        -boost_ang_thresh <= features.euler.yaw && features.euler.yaw <= boost_ang_thresh;
     bool vel_in_range = vel > vel_error;
 
     if (altitude_in_range && acc_in_range && ang_in_range_pitch && ang_in_range_yaw && vel_in_range) {
@@ -79,8 +71,8 @@ bool ModularFSM::boostStateCheck() {
     return false;
 }
 
-bool ModularFSM::coastPreGNCEventCheck() {
-    if ((chVTGetSystemTime() - coast_time_) > coast_ac_delay_thresh) {
+bool ModularFSM::coastPreGNCEventCheck(const FlightFeatures& features) {
+    if ((features.now - coast_time_) > coast_ac_delay_thresh) {
         last_state_ = rocket_state_;
         rocket_state_ = FSM_State::STATE_COAST_GNC;
         return true;
@@ -88,15 +80,15 @@ bool ModularFSM::coastPreGNCEventCheck() {
     return false;
 }
 
-bool ModularFSM::coastPreGNCStateCheck() {
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::coastPreGNCStateCheck(const FlightFeatures& features) {
+    float vel = features.baro_altitude_delta;
 
-    bool altitude_in_range = barometer.getAltitude() > launch_site_altitude_ + alt_error;
-    bool acc_in_range = -4 < getAccelerationAverage(0, 6) && getAccelerationAverage(0, 6) < acc_error;
+    bool altitude_in_range = features.altitude > launch_site_altitude_ + alt_error;
+    bool acc_in_range = -4 < features.accel_average && features.accel_average < acc_error;
     bool ang_in_range_pitch =
-        -boost_ang_thresh <= orientation.getEuler().pitch && orientation.getEuler().pitch <= boost_ang_thresh;
+        -boost_ang_thresh <= features.euler.pitch && features.euler.pitch <= boost_ang_thresh;
     bool ang_in_range_yaw =
-        -boost_ang_thresh <= orientation.getEuler().yaw && orientation.getEuler().yaw <= -boost_ang_thresh;
+        -boost_ang_thresh <= features.euler.yaw && features.euler.yaw <= -boost_ang_thresh;
     bool vel_in_range = vel > 0 + vel_error;
 
     if (altitude_in_range && acc_in_range && ang_in_range_pitch && ang_in_range_yaw && vel_in_range) {
@@ -109,8 +101,8 @@ bool ModularFSM::coastPreGNCStateCheck() {
     return false;
 }
 
-bool ModularFSM::coastGNCEventCheck() {
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::coastGNCEventCheck(const FlightFeatures& features) {
+    float vel = features.baro_altitude_delta;
 
     if (vel < 0 + vel_error) {
         last_state_ = rocket_state_;
@@ -121,15 +113,15 @@ bool ModularFSM::coastGNCEventCheck() {
     return false;
 }
 
-bool ModularFSM::coastGNCStateCheck() {
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::coastGNCStateCheck(const FlightFeatures& features) {
+    float vel = features.baro_altitude_delta;
 
-    bool altitude_in_range = barometer.getAltitude() > launch_site_altitude_ + alt_error;
-    bool acc_in_range = -4 < getAccelerationAverage(0, 6) && getAccelerationAverage(0, 6) < acc_error;
+    bool altitude_in_range = features.altitude > launch_site_altitude_ + alt_error;
+    bool acc_in_range = -4 < features.accel_average && features.accel_average < acc_error;
     bool ang_in_range_pitch =
-        -coast_gnc_thresh <= orientation.getEuler().pitch && orientation.getEuler().pitch <= coast_gnc_thresh;
+        -coast_gnc_thresh <= features.euler.pitch && features.euler.pitch <= coast_gnc_thresh;
     bool ang_in_range_yaw =
-        -coast_gnc_thresh <= orientation.getEuler().yaw && orientation.getEuler().yaw <= coast_gnc_thresh;
+        -coast_gnc_thresh <= features.euler.yaw && features.euler.yaw <= coast_gnc_thresh;
     bool vel_in_range = vel > 0 + vel_error;
 
     if (altitude_in_range && acc_in_range && ang_in_range_pitch && ang_in_range_yaw && vel_in_range) {
@@ -143,8 +135,8 @@ bool ModularFSM::coastGNCStateCheck() {
     return false;
 }
 
-bool ModularFSM::apogeeEventCheck() {
-    if (highG.getAccel().az > apogee_to_separation_acceleration) {
+bool ModularFSM::apogeeEventCheck(const FlightFeatures& features) {
+    if (features.highg_az > apogee_to_separation_acceleration) {
         last_state_ = rocket_state_;
         rocket_state_ = FSM_State::STATE_SEPARATION;
         return true;
@@ -152,11 +144,11 @@ bool ModularFSM::apogeeEventCheck() {
     return false;
 }
 
-bool ModularFSM::apogeeStateCheck() {
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::apogeeStateCheck(const FlightFeatures& features) {
+    float vel = features.baro_altitude_delta;
 
-    bool altitude_in_range = barometer.getAltitude() > launch_site_altitude_ + alt_error;
-    bool acc_in_range = -acc_error < getAccelerationAverage(0, 6) && getAccelerationAverage(0, 6) < acc_error;
+    bool altitude_in_range = features.altitude > launch_site_altitude_ + alt_error;
+    bool acc_in_range = -acc_error < features.accel_average && features.accel_average < acc_error;
     bool vel_in_range = -vel_error < vel && vel < vel_error;
 
     if (altitude_in_range && acc_in_range && vel_in_range) {
@@ -170,8 +162,8 @@ bool ModularFSM::apogeeStateCheck() {
     return false;
 }
 
-bool ModularFSM::separationEventCheck() {
-    if (highG.getAccel().az < separation_to_drogue_acceleration) {
+bool ModularFSM::separationEventCheck(const FlightFeatures& features) {
+    if (features.highg_az < separation_to_drogue_acceleration) {
         last_state_ = rocket_state_;
         rocket_state_ = FSM_State::STATE_DROGUE;
         return true;
@@ -179,11 +171,11 @@ bool ModularFSM::separationEventCheck() {
     return false;
 }
 
-bool ModularFSM::separationStateCheck() {
-    float vel = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::separationStateCheck(const FlightFeatures& features) {
+    float vel = features.baro_altitude_delta;
 
-    bool altitude_in_range = barometer.getAltitude() > launch_site_altitude_ + alt_error;
-    bool acc_in_range = separation_acc_thresh < getAccelerationAverage(0, 6);
+    bool altitude_in_range = features.altitude > launch_site_altitude_ + alt_error;
+    bool acc_in_range = separation_acc_thresh < features.accel_average;
     bool vel_in_range = -vel_error < vel && vel < vel_error;
 
     if (altitude_in_range && acc_in_range && vel_in_range) {
@@ -197,8 +189,8 @@ bool ModularFSM::separationStateCheck() {
     return false;
 }
 
-bool ModularFSM::drogueEventCheck() {
-    if (highG.getAccel().az < drogue_to_main_acceleration) {
+bool ModularFSM::drogueEventCheck(const FlightFeatures& features) {
+    if (features.highg_az < drogue_to_main_acceleration) {
         last_state_ = rocket_state_;
         rocket_state_ = FSM_State::STATE_MAIN;
         return true;
@@ -206,18 +198,18 @@ bool ModularFSM::drogueEventCheck() {
     return false;
 }
 
-bool ModularFSM::drogueStateCheck() {
-    float velocity = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::drogueStateCheck(const FlightFeatures& features) {
+    float velocity = features.baro_altitude_delta;
 
     bool altitude_in_range =
-        (launch_site_altitude_ < barometer.getAltitude()) && (barometer.getAltitude() < apogee_altitude_);
+        (launch_site_altitude_ < features.altitude) && (features.altitude < apogee_altitude_);
     bool acceleration_in_range =
-        (drogue_acc_bottom < getAccelerationAverage(0, 6)) && (getAccelerationAverage(0, 6) < drogue_acc_top);
+        (drogue_acc_bottom < features.accel_average) && (features.accel_average < drogue_acc_top);
     bool velocity_in_range = velocity < vel_error;
-    bool ang_in_range_pitch = drogue_ang_thresh_bottom <= orientation.getEuler().pitch &&
-                              orientation.getEuler().pitch <= drogue_ang_thresh_top;
+    bool ang_in_range_pitch = drogue_ang_thresh_bottom <= features.euler.pitch &&
+                              features.euler.pitch <= drogue_ang_thresh_top;
     bool ang_in_range_yaw =
-        drogue_ang_thresh_bottom <= orientation.getEuler().yaw && orientation.getEuler().yaw <= drogue_ang_thresh_top;
+        drogue_ang_thresh_bottom <= features.euler.yaw && features.euler.yaw <= drogue_ang_thresh_top;
 
     if (altitude_in_range && acceleration_in_range && velocity_in_range && ang_in_range_pitch && ang_in_range_yaw) {
         last_state_ = rocket_state_;
@@ -230,8 +222,8 @@ bool ModularFSM::drogueStateCheck() {
     return false;
 }
 
-bool ModularFSM::mainEventCheck() {
-    float velocity = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::mainEventCheck(const FlightFeatures& features) {
+    float velocity = features.baro_altitude_delta;
 
     if (-vel_error < velocity && velocity < vel_error) {
         last_state_ = FSM_State::STATE_LANDED;
@@ -240,17 +232,17 @@ bool ModularFSM::mainEventCheck() {
     return false;
 }
 
-bool ModularFSM::mainStateCheck() {
-    float velocity = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::mainStateCheck(const FlightFeatures& features) {
+    float velocity = features.baro_altitude_delta;
 
     bool altitude_in_range =
-        (launch_site_altitude_ < barometer.getAltitude()) && (barometer.getAltitude() < apogee_altitude_);
-    bool acceleration_in_range = (getAccelerationAverage(0, 6) < main_acc_top);
+        (launch_site_altitude_ < features.altitude) && (features.altitude < apogee_altitude_);
+    bool acceleration_in_range = (features.accel_average < main_acc_top);
     bool velocity_in_range = velocity < vel_error;
     bool ang_in_range_pitch =
-        main_ang_thresh_bottom <= orientation.getEuler().pitch && orientation.getEuler().pitch <= main_ang_thresh_top;
+        main_ang_thresh_bottom <= features.euler.pitch && features.euler.pitch <= main_ang_thresh_top;
     bool ang_in_range_yaw =
-        main_ang_thresh_bottom <= orientation.getEuler().yaw && orientation.getEuler().yaw <= main_ang_thresh_top;
+        main_ang_thresh_bottom <= features.euler.yaw && features.euler.yaw <= main_ang_thresh_top;
 
     if (altitude_in_range && acceleration_in_range && velocity_in_range && ang_in_range_yaw && ang_in_range_pitch) {
         last_state_ = rocket_state_;
@@ -263,13 +255,13 @@ bool ModularFSM::mainStateCheck() {
     return false;
 }
 
-bool ModularFSM::landedStateCheck() {
-    float velocity = getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3);
+bool ModularFSM::landedStateCheck(const FlightFeatures& features) {
+    float velocity = features.baro_altitude_delta;
 
-    bool altitude_in_range = (launch_site_altitude_ - alt_error < barometer.getAltitude()) &&
-                             (barometer.getAltitude() < alt_error + launch_site_altitude_);
+    bool altitude_in_range = (launch_site_altitude_ - alt_error < features.altitude) &&
+                             (features.altitude < alt_error + launch_site_altitude_);
     bool acceleration_in_range =
-        (1 - acc_error < getAccelerationAverage(0, 6)) && (getAccelerationAverage(0, 6) < 1 + acc_error);
+        (1 - acc_error < features.accel_average) && (features.accel_average < 1 + acc_error);
     bool velocity_in_range = (-vel_error < velocity) && (velocity < vel_error);
 
     if (altitude_in_range && acceleration_in_range && velocity_in_range) {
@@ -283,27 +275,23 @@ bool ModularFSM::landedStateCheck() {
     return false;
 }
 
-void ModularFSM::tickFSM() {
-    chMtxLock(&orientation.mutex);
-    chMtxLock(&highG.mutex);
-    chMtxLock(&barometer.mutex);
+void ModularFSM::tickFSM(const FlightFeatures& features) {
 #ifdef FSM_DEBUG
     Serial.print("Current State: ");
     Serial.println((int)rocket_state_);
     Serial.print("Last State: ");
     Serial.println((int)last_state_);
-    // lock mutexes
 
     Serial.print("altitude: ");
-    Serial.println(barometer.getAltitude());
+    Serial.println(features.altitude);
     Serial.print("acceleration: ");
-    Serial.println(highG.getAccel().az);
+    Serial.println(features.highg_az);
     Serial.print("pitch: ");
-    Serial.println(orientation.getEuler().pitch);
+    Serial.println(features.euler.pitch);
     Serial.print("yaw: ");
-    Serial.println(orientation.getEuler().yaw);
+    Serial.println(features.euler.yaw);
     Serial.print("velocity: ");
-    Serial.println(getAltitudeAverage(0, 3) - getAltitudeAverage(3, 3));
+    Serial.println(features.baro_altitude_delta);
 
     Serial.print("launch site altitude: ");
     Serial.println(launch_site_altitude_);
@@ -314,8 +302,8 @@ void ModularFSM::tickFSM() {
             // cheeky bloke init
 
         case FSM_State::STATE_INIT:
-            if (barometer.getAltitude() != 0.00) {
-                launch_site_altitude_ = barometer.getAltitude();
+            if (features.altitude != 0.00) {
+                launch_site_altitude_ = features.altitude;
                 rocket_state_ = FSM_State::STATE_IDLE;
             }
             break;
@@ -323,12 +311,12 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_IDLE:
 
             if (last_state_ == FSM_State::STATE_IDLE) {
-                if (!idleEventCheck()) {
-                    idleStateCheck();
+                if (!idleEventCheck(features)) {
+                    idleStateCheck(features);
                 }
             } else {
-                if (idleStateCheck()) {
-                    idleEventCheck();
+                if (idleStateCheck(features)) {
+                    idleEventCheck(features);
                 }
             }
             break;
@@ -336,12 +324,12 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_BOOST:
 
             if (last_state_ == FSM_State::STATE_BOOST) {
-                if (!boostEventCheck()) {
-                    boostStateCheck();
+                if (!boostEventCheck(features)) {
+                    boostStateCheck(features);
                 }
             } else {
-                if (boostStateCheck()) {
-                    boostEventCheck();
+                if (boostStateCheck(features)) {
+                    boostEventCheck(features);
                 }
             }
             break;
@@ -349,15 +337,15 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_COAST_PREGNC:
 
             if (last_state_ == FSM_State::STATE_COAST_PREGNC) {
-                if (!coastPreGNCEventCheck()) {
-                    coastPreGNCStateCheck();
+                if (!coastPreGNCEventCheck(features)) {
+                    coastPreGNCStateCheck(features);
                 }
             } else {
                 // log time at which we enter coast
-                coast_time_ = chVTGetSystemTime();
+                coast_time_ = features.now;
 
-                if (coastPreGNCStateCheck()) {
-                    coastPreGNCEventCheck();
+                if (coastPreGNCStateCheck(features)) {
+                    coastPreGNCEventCheck(features);
                 }
             }
             break;
@@ -365,12 +353,12 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_COAST_GNC:
 
             if (last_state_ == FSM_State::STATE_COAST_GNC) {
-                if (!coastGNCEventCheck()) {
-                    coastGNCStateCheck();
+                if (!coastGNCEventCheck(features)) {
+                    coastGNCStateCheck(features);
                 }
             } else {
-                if (coastGNCStateCheck()) {
-                    coastGNCEventCheck();
+                if (coastGNCStateCheck(features)) {
+                    coastGNCEventCheck(features);
                 }
             }
             break;
@@ -379,14 +367,14 @@ void ModularFSM::tickFSM() {
 
             if (last_state_ == FSM_State::STATE_APOGEE) {
                 // record our apogee
-                apogee_altitude_ = barometer.getAltitude();
+                apogee_altitude_ = features.altitude;
 
-                if (!apogeeEventCheck()) {
-                    apogeeStateCheck();
+                if (!apogeeEventCheck(features)) {
+                    apogeeStateCheck(features);
                 }
             } else {
-                if (apogeeStateCheck()) {
-                    apogeeEventCheck();
+                if (apogeeStateCheck(features)) {
+                    apogeeEventCheck(features);
                 }
             }
             break;
@@ -394,12 +382,12 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_SEPARATION:
 
             if (last_state_ == FSM_State::STATE_SEPARATION) {
-                if (!separationEventCheck()) {
-                    separationStateCheck();
+                if (!separationEventCheck(features)) {
+                    separationStateCheck(features);
                 }
             } else {
-                if (separationStateCheck()) {
-                    separationEventCheck();
+                if (separationStateCheck(features)) {
+                    separationEventCheck(features);
                 }
             }
             break;
@@ -407,12 +395,12 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_DROGUE:
 
             if (last_state_ == FSM_State::STATE_DROGUE) {
-                if (!drogueEventCheck()) {
-                    drogueStateCheck();
+                if (!drogueEventCheck(features)) {
+                    drogueStateCheck(features);
                 }
             } else {
-                if (drogueStateCheck()) {
-                    drogueEventCheck();
+                if (drogueStateCheck(features)) {
+                    drogueEventCheck(features);
                 }
             }
             break;
@@ -420,44 +408,40 @@ void ModularFSM::tickFSM() {
         case FSM_State::STATE_MAIN:
 
             if (last_state_ == FSM_State::STATE_MAIN) {
-                if (!mainEventCheck()) {
-                    mainStateCheck();
+                if (!mainEventCheck(features)) {
+                    mainStateCheck(features);
                 }
             } else {
-                if (mainStateCheck()) {
-                    mainEventCheck();
+                if (mainStateCheck(features)) {
+                    mainEventCheck(features);
                 }
             }
             break;
 
         case FSM_State::STATE_LANDED:
 
-            landedStateCheck();
+            landedStateCheck(features);
             break;
 
         case FSM_State::STATE_UNKNOWN:
 
             if (last_state_ == FSM_State::STATE_IDLE || last_state_ == FSM_State::STATE_BOOST) {
-                if (idleStateCheck()) {
+                if (idleStateCheck(features)) {
                     break;
                 }
             }
 
             else {
-                if (separationStateCheck() || landedStateCheck()) {
+                if (separationStateCheck(features) || landedStateCheck(features)) {
                     break;
                 }
             }
 
-            boostStateCheck() || coastGNCStateCheck() || apogeeStateCheck() || drogueStateCheck() || mainStateCheck();
+            boostStateCheck(features) || coastGNCStateCheck(features) || apogeeStateCheck(features) ||
+                drogueStateCheck(features) || mainStateCheck(features);
             break;
 
         default:
             break;
     }
-
-    // unlock mutexes used
-    chMtxUnlock(&barometer.mutex);
-    chMtxUnlock(&highG.mutex);
-    chMtxUnlock(&orientation.mutex);
 }
@@ -6,7 +6,7 @@ class ModularFSM : public RocketFSMBase {
    public:
     ModularFSM() = default;
 
-    void tickFSM() override;
+    void tickFSM(const FlightFeatures& features) override;
 
    private:
     // coast time should always be set before we look at it
@@ -20,25 +20,21 @@ class ModularFSM : public RocketFSMBase {
     // helps determine which checks to run
     FSM_State last_state_ = FSM_State::STATE_IDLE;
 
-    // used to average data
-    double getAltitudeAverage(size_t start, size_t len);
-    double getAccelerationAverage(size_t start, size_t len);
-
-    bool idleEventCheck();
-    bool idleStateCheck();
-    bool boostEventCheck();
-    bool boostStateCheck();
-    bool coastPreGNCEventCheck();
-    bool coastPreGNCStateCheck();
-    bool coastGNCEventCheck();
-    bool coastGNCStateCheck();
-    bool apogeeEventCheck();
-    bool apogeeStateCheck();
-    bool separationEventCheck();
-    bool separationStateCheck();
-    bool drogueEventCheck();
-    bool drogueStateCheck();
-    bool mainEventCheck();
-    bool mainStateCheck();
-    bool landedStateCheck();
+    bool idleEventCheck(const FlightFeatures& features);
+    bool idleStateCheck(const FlightFeatures& features);
+    bool boostEventCheck(const FlightFeatures& features);
+    bool boostStateCheck(const FlightFeatures& features);
+    bool coastPreGNCEventCheck(const FlightFeatures& features);
+    bool coastPreGNCStateCheck(const FlightFeatures& features);
+    bool coastGNCEventCheck(const FlightFeatures& features);
+    bool coastGNCStateCheck(const FlightFeatures& features);
+    bool apogeeEventCheck(const FlightFeatures& features);
+    bool apogeeStateCheck(const FlightFeatures& features);
+    bool separationEventCheck(const FlightFeatures& features);
+    bool separationStateCheck(const FlightFeatures& features);
+    bool drogueEventCheck(const FlightFeatures& features);
+    bool drogueStateCheck(const FlightFeatures& features);
+    bool mainEventCheck(const FlightFeatures& features);
+    bool mainStateCheck(const FlightFeatures& features);
+    bool landedStateCheck(const FlightFeatures& features);
 };
@@ -0,0 +1,238 @@
+/**
+ * @file TableFSM.h
+ *
+ * @brief FSM engine driven by a transition table declared at compile time.
+ *
+ * A table is a type with the following static members:
+ *
+ *  - guards: constexpr array of predicates over a FlightFeatures snapshot
+ *  - transitions: constexpr array of FSMTransition, grouped by source state
+ *  - timer_count: number of named timers the transitions can restart and compare against
+ *
+ * Each tick only the transitions leaving the current state are walked, in table order, and the first one whose
+ * conditions all hold is taken. Each guard is evaluated at most once per tick no matter how many transitions use it,
+ * and the per-state ranges of the table are computed at compile time, so a tick is a short loop over a flat array with
+ * no virtual calls and no switch statement to maintain. Abort requests always move the FSM to STATE_ABORT, which has
+ * no outgoing transitions.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mcu_main/finite-state-machines/RocketFSMBase.h"
+
+using FSMGuard = bool (*)(const FlightFeatures&);
+
+// Guard index of a transition that does not depend on the features
+static constexpr uint8_t fsm_always = 0xFF;
+// Timer index of the time spent in the current state
+static constexpr uint8_t fsm_state_timer = 0xFE;
+// Timer index meaning no timer
+static constexpr uint8_t fsm_no_timer = 0xFF;
+
+/**
+ * @brief One row of an FSM transition table.
+ *
+ * The transition is taken when the guard holds, has held for at least dwell_ms and the timer has been running for
+ * more than after_ms, or at least after_ms if the row was built with atLeast. Rows are built with transition() and
+ * the chained modifiers so that the tables read like the state descriptions, e.g.
+ *
+ *     transition(STATE_BOOST, STATE_COAST_PREGNC).after(launch, burn_time_thresh_ms).restarts(burnout)
+ */
+struct FSMTransition {
+    FSM_State from;
+    FSM_State to;
+    uint8_t guard = fsm_always;
+    uint8_t timer = fsm_no_timer;
+    float after_ms = 0;
+    // Taken when the timer reaches after_ms rather than once it is past it
+    bool inclusive = false;
+    float dwell_ms = 0;
+    uint8_t restart = fsm_no_timer;
+
+    constexpr FSMTransition when(uint8_t guard_index) const {
+        FSMTransition t = *this;
+        t.guard = guard_index;
+        return t;
+    }
+
+    constexpr FSMTransition after(uint8_t timer_index, float ms) const {
+        FSMTransition t = *this;
+        t.timer = timer_index;
+        t.after_ms = ms;
+        return t;
+    }
+
+    // For the hand-written FSMs' "stay while the timer is below the threshold" checks
+    constexpr FSMTransition atLeast(uint8_t timer_index, float ms) const {
+        FSMTransition t = after(timer_index, ms);
+        t.inclusive = true;
+        return t;
+    }
+
+    constexpr FSMTransition heldFor(float ms) const {
+        FSMTransition t = *this;
+        t.dwell_ms = ms;
+        return t;
+    }
+
+    constexpr FSMTransition restarts(uint8_t timer_index) const {
+        FSMTransition t = *this;
+        t.restart = timer_index;
+        return t;
+    }
+};
+
+constexpr FSMTransition transition(FSM_State from, FSM_State to) { return FSMTransition{from, to}; }
+
+static constexpr size_t fsm_state_count = (size_t)FSM_State::STATE_ABORT + 1;
+
+// Index range of each state's transitions in a table
+struct FSMStateRanges {
+    uint8_t begin[fsm_state_count];
+    uint8_t end[fsm_state_count];
+};
+
+template <typename Table>
+constexpr size_t fsmGuardCount() {
+    return sizeof(Table::guards) / sizeof(Table::guards[0]);
+}
+
+template <typename Table>
+constexpr size_t fsmTransitionCount() {
+    return sizeof(Table::transitions) / sizeof(Table::transitions[0]);
+}
+
+template <typename Table>
+constexpr FSMStateRanges fsmStateRanges() {
+    FSMStateRanges ranges{};
+    for (size_t i = 0; i < fsmTransitionCount<Table>(); i++) {
+        size_t state = (size_t)Table::transitions[i].from;
+        if (ranges.end[state] == 0) {
+            ranges.begin[state] = i;
+        }
+        ranges.end[state] = i + 1;
+    }
+    return ranges;
+}
+
+/**
+ * @brief Checks that every index in a table is in range and that each state's transitions are contiguous.
+ */
+template <typename Table>
+constexpr bool fsmTableIsValid() {
+    for (size_t i = 0; i < fsmTransitionCount<Table>(); i++) {
+        const FSMTransition& t = Table::transitions[i];
+        if (t.guard != fsm_always && t.guard >= fsmGuardCount<Table>()) {
+            return false;
+        }
+        if (t.timer != fsm_no_timer && t.timer != fsm_state_timer && t.timer >= Table::timer_count) {
+            return false;
+        }
+        if (t.restart != fsm_no_timer && t.restart >= Table::timer_count) {
+            return false;
+        }
+        if (t.from == FSM_State::STATE_ABORT) {
+            return false;
+        }
+        if (i > 0 && t.from != Table::transitions[i - 1].from) {
+            for (size_t j = 0; j + 1 < i; j++) {
+                if (Table::transitions[j].from == t.from) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template <typename Table>
+class TableFSM : public RocketFSMBase {
+    static constexpr size_t guard_count = fsmGuardCount<Table>();
+    static constexpr size_t transition_count = fsmTransitionCount<Table>();
+
+    static_assert(guard_count <= 32, "guard results are cached in a 32 bit mask");
+    static_assert(transition_count < 0xFF, "transition indices must fit in a uint8_t");
+    static_assert(fsmTableIsValid<Table>(), "transition table has an out of range index or non-contiguous states");
+
+    static constexpr FSMStateRanges ranges_ = fsmStateRanges<Table>();
+
+   public:
+    TableFSM() = default;
+
+    /**
+     * @brief Takes the first transition out of the current state whose conditions hold.
+     *
+     * @param features snapshot of the sensors and history for this tick
+     */
+    void tickFSM(const FlightFeatures& features) override {
+        if (features.aborted) {
+            if (rocket_state_ != FSM_State::STATE_ABORT) {
+                enter(FSM_State::STATE_ABORT, features.now);
+            }
+            return;
+        }
+
+        uint32_t evaluated = 0;
+        uint32_t held = 0;
+
+        size_t state = (size_t)rocket_state_;
+        for (size_t i = ranges_.begin[state]; i < ranges_.end[state]; i++) {
+            const FSMTransition& t = Table::transitions[i];
+
+            if (t.guard != fsm_always) {
+                uint32_t bit = 1u << t.guard;
+                if (!(evaluated & bit)) {
+                    evaluated |= bit;
+                    if (Table::guards[t.guard](features)) {
+                        held |= bit;
+                    }
+                }
+                if (!(held & bit)) {
+                    holding_[i] = false;
+                    continue;
+                }
+            }
+
+            if (t.dwell_ms > 0) {
+                if (!holding_[i]) {
+                    holding_[i] = true;
+                    held_since_[i] = features.now;
+                }
+                if (TIME_I2MS(features.now - held_since_[i]) < t.dwell_ms) {
+                    continue;
+                }
+            }
+
+            if (t.timer != fsm_no_timer) {
+                systime_t start = t.timer == fsm_state_timer ? entered_ : timers_[t.timer];
+                auto elapsed = TIME_I2MS(features.now - start);
+                if (t.inclusive ? elapsed < t.after_ms : !(elapsed > t.after_ms)) {
+                    continue;
+                }
+            }
+
+            if (t.restart != fsm_no_timer) {
+                timers_[t.restart] = features.now;
+            }
+            enter(t.to, features.now);
+            return;
+        }
+    }
+
+   private:
+    void enter(FSM_State state, systime_t now) {
+        rocket_state_ = state;
+        entered_ = now;
+        for (size_t i = 0; i < transition_count; i++) {
+            holding_[i] = false;
+        }
+    }
+
+    systime_t entered_ = 0;
+    systime_t timers_[Table::timer_count > 0 ? Table::timer_count : 1] = {};
+    systime_t held_since_[transition_count] = {};
+    bool holding_[transition_count] = {};
+};
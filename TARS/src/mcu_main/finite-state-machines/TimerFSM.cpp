@@ -28,20 +28,18 @@
 
 #include "mcu_main/Abort.h"
 #include "mcu_main/finite-state-machines/thresholds.h"
-#include "mcu_main/sensors/sensors.h"
 
 /**
  * @brief TimerFSM tick function
  *
  * Uses a combination of linear acceleration and timers to govern FSM state
  * changes for each timestep of the rocket's flight.
+ *
+ * @param features snapshot of the sensors and history for this tick
  */
-void TimerFSM::tickFSM() {
-    // Lock mutexes for data used in switch
-    chMtxLock(&highG.mutex);
-
+void TimerFSM::tickFSM(const FlightFeatures& features) {
     // Links to abort for other states
-    if (isAborted()) {
+    if (features.aborted) {
         rocket_state_ = FSM_State::STATE_ABORT;
         return;
     }
@@ -58,21 +56,21 @@ void TimerFSM::tickFSM() {
 
         case FSM_State::STATE_IDLE:
             // If high acceleration is observed in z direction...
-            if (highG.getAccel().az > launch_linear_acceleration_thresh) {
-                launch_time_ = chVTGetSystemTime();
+            if (features.highg_az > launch_linear_acceleration_thresh) {
+                launch_time_ = features.now;
                 rocket_state_ = FSM_State::STATE_LAUNCH_DETECT;
             }
             break;
 
         case FSM_State::STATE_LAUNCH_DETECT:
             // If the acceleration was too brief, go back to IDLE
-            if (highG.getAccel().az < launch_linear_acceleration_thresh) {
+            if (features.highg_az < launch_linear_acceleration_thresh) {
                 rocket_state_ = FSM_State::STATE_IDLE;
                 break;
             }
 
             // Measure the length of the burn time (for hysteresis)
-            burn_timer_ = chVTGetSystemTime() - launch_time_;
+            burn_timer_ = features.now - launch_time_;
 
             // If the acceleration lasts long enough, boost is detected
             if (TIME_I2MS(burn_timer_) > launch_time_thresh) {
@@ -82,11 +80,11 @@ void TimerFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_BOOST:
-            burn_timer_ = chVTGetSystemTime() - launch_time_;
+            burn_timer_ = features.now - launch_time_;
             // If low acceleration in the Z direction...
-            if (highG.getAccel().az < coast_thresh) {
+            if (features.highg_az < coast_thresh) {
                 // Serial.println("Acceleration below thresh");
-                burnout_time_ = chVTGetSystemTime();
+                burnout_time_ = features.now;
                 rocket_state_ = FSM_State::STATE_BURNOUT_DETECT;
                 break;
             }
@@ -100,20 +98,20 @@ void TimerFSM::tickFSM() {
             else {
                 rocket_state_ = FSM_State::STATE_COAST_PREGNC;
                 // Setting burnout time because we don't otherwise
-                burnout_time_ = chVTGetSystemTime();
+                burnout_time_ = features.now;
             }
 
             break;
 
         case FSM_State::STATE_BURNOUT_DETECT:
             // If the 0 acceleration was too brief, go back to BOOST
-            if (highG.getAccel().az > coast_thresh) {
+            if (features.highg_az > coast_thresh) {
                 rocket_state_ = FSM_State::STATE_BOOST;
                 break;
             }
 
             // Measure the length of the coast time (for hysteresis)
-            coast_timer_ = chVTGetSystemTime() - burnout_time_;
+            coast_timer_ = features.now - burnout_time_;
 
             // If the low acceleration lasts long enough, coast is detected
             if (TIME_I2MS(coast_timer_) > coast_time_thresh) {
@@ -123,7 +121,7 @@ void TimerFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_COAST_PREGNC:
-            coast_timer_ = chVTGetSystemTime() - burnout_time_;
+            coast_timer_ = features.now - burnout_time_;
             if (TIME_I2MS(coast_timer_) > coast_ac_delay_thresh) {
                 rocket_state_ = FSM_State::STATE_COAST_GNC;
             }
@@ -131,11 +129,11 @@ void TimerFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_COAST_GNC:
-            coast_timer_ = chVTGetSystemTime() - burnout_time_;
+            coast_timer_ = features.now - burnout_time_;
 
             if (TIME_I2MS(coast_timer_) > coast_to_apogee_time_thresh) {
                 rocket_state_ = FSM_State::STATE_APOGEE_DETECT;
-                apogee_time_ = chVTGetSystemTime();
+                apogee_time_ = features.now;
             }
 
             break;
@@ -145,10 +143,10 @@ void TimerFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_APOGEE:
-            apogee_timer_ = chVTGetSystemTime() - apogee_time_;
+            apogee_timer_ = features.now - apogee_time_;
             if (TIME_I2MS(apogee_timer_) > apogee_time_thresh) {
                 rocket_state_ = FSM_State::STATE_DROGUE_DETECT;
-                drogue_time_ = chVTGetSystemTime();
+                drogue_time_ = features.now;
             }
 
             break;
@@ -158,10 +156,10 @@ void TimerFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_DROGUE:
-            drogue_timer_ = chVTGetSystemTime() - drogue_time_;
+            drogue_timer_ = features.now - drogue_time_;
             if (TIME_I2MS(drogue_timer_) > drogue_deploy_time_since_apogee_threshold) {
                 rocket_state_ = FSM_State::STATE_MAIN_DETECT;
-                main_time_ = chVTGetSystemTime();
+                main_time_ = features.now;
             }
             break;
 
@@ -170,7 +168,7 @@ void TimerFSM::tickFSM() {
             break;
 
         case FSM_State::STATE_MAIN:
-            main_timer_ = chVTGetSystemTime() - main_time_;
+            main_timer_ = features.now - main_time_;
             if (TIME_I2MS(main_timer_) > main_deploy_time_since_drogue_threshold) {
                 rocket_state_ = FSM_State::STATE_LANDED_DETECT;
             }
@@ -186,7 +184,4 @@ void TimerFSM::tickFSM() {
         default:
             break;
     }
-
-    // Unlock mutexes used during the switch statement
-    chMtxUnlock(&highG.mutex);
 }
@@ -6,7 +6,7 @@ class TimerFSM : public RocketFSMBase {
    public:
     TimerFSM() = default;
 
-    void tickFSM() override;
+    void tickFSM(const FlightFeatures& features) override;
 
    private:
     systime_t launch_time_ = 0;
@@ -1,10 +1,26 @@
 #include "mcu_main/finite-state-machines/rocketFSM.h"
 
+#ifdef ENABLE_TABLE_FSMS
+TableFSM<TimerFSMTable> timer_fsm;
+ModularFSM modular_fsm;
+TableFSM<HistoryBufferFSMTable> history_buffer_fsm_6;
+TableFSM<KalmanFSMTable> kalman_fsm;
+#else
 TimerFSM timer_fsm;
 ModularFSM modular_fsm;
 HistoryBufferFSM<6> history_buffer_fsm_6;
 KalmanFSM kalman_fsm;
+#endif
 
 FSMCollection<4> fsmCollection{&timer_fsm, &modular_fsm, &history_buffer_fsm_6, &kalman_fsm};
 
-RocketFSMBase& getActiveFSM() { return timer_fsm; }
+FSMArbiter<4, sizeof(fsm_vote_policies) / sizeof(fsm_vote_policies[0])> fsmArbiter{fsm_vote_weights,
+                                                                                  fsm_vote_policies};
+
+FSM_State getActiveFSMState() {
+#ifdef ENABLE_FSM_VOTING
+    return fsmArbiter.getState();
+#else
+    return timer_fsm.getFSMState();
+#endif
+}
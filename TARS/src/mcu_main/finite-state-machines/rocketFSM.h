@@ -1,17 +1,49 @@
 #pragma once
 
+#include "mcu_main/debug.h"
+#include "mcu_main/finite-state-machines/FSMArbiter.h"
 #include "mcu_main/finite-state-machines/FSMCollection.h"
+#include "mcu_main/finite-state-machines/FSMTables.h"
 #include "mcu_main/finite-state-machines/HistoryBufferFSM.h"
 #include "mcu_main/finite-state-machines/KalmanFSM.h"
 #include "mcu_main/finite-state-machines/ModularFSM.h"
 #include "mcu_main/finite-state-machines/TimerFSM.h"
 
+#ifdef ENABLE_TABLE_FSMS
+extern TableFSM<TimerFSMTable> timer_fsm;
+extern ModularFSM modular_fsm;
+extern TableFSM<HistoryBufferFSMTable> history_buffer_fsm_6;
+extern TableFSM<KalmanFSMTable> kalman_fsm;
+#else
 extern TimerFSM timer_fsm;
 extern ModularFSM modular_fsm;
 extern HistoryBufferFSM<6> history_buffer_fsm_6;
 extern KalmanFSM kalman_fsm;
+#endif
 
 // Pass array of FSMs to FSMCollection along with number of FSMs in use
 extern FSMCollection<4> fsmCollection;
 
-RocketFSMBase& getActiveFSM();
+// Vote weights in fsmCollection order. TimerFSM has flown the most, ModularFSM drops to UNKNOWN on noisy data.
+static constexpr float fsm_vote_weights[4] = {2, 0.5, 1, 1.5};
+
+static constexpr VotePolicy fsm_vote_policies[] = {
+    {FSM_State::STATE_IDLE, VoteMode::FirstToAgree, 0, 0},
+    {FSM_State::STATE_BOOST, VoteMode::Majority, 0, TIME_MS2I(100)},
+    {FSM_State::STATE_COAST_PREGNC, VoteMode::Majority, 0, TIME_MS2I(200)},
+    {FSM_State::STATE_COAST_GNC, VoteMode::Weighted, 0.5, TIME_MS2I(200)},
+    {FSM_State::STATE_APOGEE, VoteMode::Weighted, 0.5, TIME_MS2I(500)},
+    {FSM_State::STATE_DROGUE, VoteMode::Majority, 0, TIME_MS2I(1000)},
+    {FSM_State::STATE_MAIN, VoteMode::Majority, 0, TIME_MS2I(1000)},
+    {FSM_State::STATE_LANDED, VoteMode::Majority, 0, TIME_MS2I(2000)},
+    {FSM_State::STATE_ABORT, VoteMode::FirstToAgree, 0, 0},
+};
+
+extern FSMArbiter<4, sizeof(fsm_vote_policies) / sizeof(fsm_vote_policies[0])> fsmArbiter;
+
+/**
+ * @brief State that gates the Kalman filter and active control.
+ *
+ * The arbitrated state with ENABLE_FSM_VOTING, otherwise the TimerFSM state.
+ */
+FSM_State getActiveFSMState();
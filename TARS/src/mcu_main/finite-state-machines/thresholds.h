@@ -39,13 +39,17 @@ static constexpr float apogee_altimeter_threshold = 0.5;
 // being detected to put us into drogue:
 static constexpr float drogue_acceleration_change_threshold_imu = 0.15;
 
-static constexpr float drogue_acceleration_change_threshold_altimeter = 10.01;
+// The altimeter thresholds compare the change in the second derivative of the barometer or Kalman altitude between
+// the two history windows, in m/s^2. They were tuned as 10.01 and 25.02 m/tick^2 at the 1 kHz system tick, hence the
+// factor of 1e6. Replayed with fsm_replay, the descent in hilsim/flight_computer.csv peaks at about 7.5e5 m/s^2 on
+// the barometer and 8e3 m/s^2 on the Kalman altitude, so the check still rejects noise and the deploy timeouts govern.
+static constexpr float drogue_acceleration_change_threshold_altimeter = 10.01e6;
 
 // some number greater than 0 to represent a drastic change in acceleration
 // being detected to put us into main:
 static constexpr float main_acceleration_change_threshold_imu = 1.53;
 
-static constexpr float main_acceleration_change_threshold_altimeter = 25.02;
+static constexpr float main_acceleration_change_threshold_altimeter = 25.02e6;
 
 // how long before we force drogue deploy
 static constexpr float drogue_deploy_time_since_apogee_threshold = 10000;
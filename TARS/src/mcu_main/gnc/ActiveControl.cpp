@@ -8,8 +8,10 @@
 
 #include "mcu_main/gnc/ActiveControl.h"
 
+#include "mcu_main/dataLog.h"
 #include "mcu_main/finite-state-machines/rocketFSM.h"
-#include "mcu_main/gnc/kalmanFilter.h"
+#include "mcu_main/gnc/ApogeePredictor.h"
+#include "mcu_main/sensors/sensors.h"
 
 Controller activeController;
 
@@ -20,41 +22,62 @@ Controller activeController;
  */
 Controller::Controller() : activeControlServos(&controller_servo_) {}
 
+/**
+ * @brief Applies the control law to the latest cached apogee estimate.
+ *
+ * The estimate is produced asynchronously by apogeePredictor, so this only
+ * reads the cached value, computes and rate limits the flap extension and
+ * commands the servo. If no estimate is available or the Kalman state it
+ * was computed from is older than max_estimate_age the flaps are retracted,
+ * no faster than the rate limit allows.
+ */
 void Controller::ctrlTickFunction() {
-    chMtxLock(&kalmanFilter.mutex);
-    array<float, 2> init = {kalmanFilter.getState().state_est_pos_x, kalmanFilter.getState().state_est_vel_x};
-    chMtxUnlock(&kalmanFilter.mutex);
-
-    float apogee_est = rk4_.sim_apogee(init, 0.3)[0];
-
-    chMtxLock(&kalmanFilter.mutex);
-    kalmanFilter.updateApogee(apogee_est);
-    chMtxUnlock(&kalmanFilter.mutex);
+    uint32_t start = micros();
 
-    float u = kp * (apogee_est - apogee_des_msl) * 1000;
-
-    // Limit rate of the servo so that it does not command a large change in a
-    // short period of time
-    float min = abs(u - prev_u) / dt;
-
-    if (du_max < min) {
-        min = du_max;
+    ApogeePrediction prediction;
+    bool fresh = apogeePredictor.latest(prediction);
+    if (fresh) {
+        estimate_age = chVTGetSystemTime() - prediction.timeStamp_state;
+        fresh = estimate_age <= max_estimate_age;
     }
 
-    // Update servo input with rate limited value
-    float sign = 1;
-
-    if (u - prev_u < 0) {
-        sign = -1;
-    }
-    u = u + sign * min * dt;
-    prev_u = u;
-
-    // Set flap extension limits
-    if (u < min_extension) {
-        u = min_extension;
-    } else if (u > max_extension) {
-        u = max_extension;
+    float u;
+    if (!fresh) {
+        // Retract no faster than the rate limit, leaving prev_u at the extension commanded
+        u = rateLimit(min_extension);
+    } else {
+#ifdef ENABLE_PREDICTIVE_CONTROL
+        // Move towards the extension solved by the predictor
+        u = rateLimit(prediction.extension);
+#else
+        float apogee_est = prediction.apogee;
+        u = kp * (apogee_est - apogee_des_msl) * 1000;
+
+        // Limit rate of the servo so that it does not command a large change in a
+        // short period of time
+        float min = abs(u - prev_u) / dt;
+
+        if (du_max < min) {
+            min = du_max;
+        }
+
+        // Update servo input with rate limited value
+        float sign = 1;
+
+        if (u - prev_u < 0) {
+            sign = -1;
+        }
+        u = u + sign * min * dt;
+        prev_u = u;
+
+        // Set flap extension limits
+        if (u < min_extension) {
+            u = min_extension;
+        } else if (u > max_extension) {
+            u = max_extension;
+        }
+#endif
+        sensor_latency.record(prediction.timeStamp_sample);
     }
 
     /*
@@ -66,12 +89,48 @@ void Controller::ctrlTickFunction() {
      * airframe with ease on the ground
      */
     if (ActiveControl_ON()) {
-        activeControlServos.servoActuation(u);
+        actuate(u);
         dataLogger.pushFlapsFifo((FlapData){u, chVTGetSystemTime()});
     } else {
-        activeControlServos.servoActuation(min_extension);
+        actuate(min_extension);
         // controller_servo_.write(activeControlServos.min_angle);
     }
+
+    actuation_us = micros() - start;
+    if (actuation_us > actuation_us_max) {
+        actuation_us_max = actuation_us;
+    }
+}
+
+/**
+ * @brief Commands the servo to a flap extension in mm and remembers it.
+ */
+void Controller::actuate(float u) {
+    extension = u;
+    activeControlServos.servoActuation(u);
+}
+
+/**
+ * @brief Moves from the last commanded extension towards a flap extension by at most max_flap_rate over one tick of
+ * dt, within the flap limits, and remembers the result in prev_u.
+ *
+ * Starts from the extension actually commanded rather than prev_u, which the proportional law leaves outside the flap
+ * limits, so the flaps continue from where they are, retracted whenever control was off.
+ */
+float Controller::rateLimit(float u) {
+    float step = max_flap_rate * dt;
+    if (u < min_extension) {
+        u = min_extension;
+    } else if (u > max_extension) {
+        u = max_extension;
+    }
+    if (u - extension > step) {
+        u = extension + step;
+    } else if (extension - u > step) {
+        u = extension - step;
+    }
+    prev_u = u;
+    return u;
 }
 
 /**
@@ -79,7 +138,7 @@ void Controller::ctrlTickFunction() {
  * based on FSM state
  * @returns boolean depending on whether flaps should actuate or not
  */
-bool Controller::ActiveControl_ON() { return getActiveFSM().getFSMState() == FSM_State::STATE_COAST_GNC; }
+bool Controller::ActiveControl_ON() { return getActiveFSMState() == FSM_State::STATE_COAST_GNC; }
 
 /**
  * @brief Initializes launchpad elevation through barometer measurement.
@@ -1,7 +1,10 @@
+#pragma once
+
 #include <PWMServo.h>
-#include <mcu_main/gnc/rk4.h>
+#include <ChRt.h>
 
 #include "common/ServoControl.h"
+#include "mcu_main/dataLog.h"
 
 class Controller;
 
@@ -15,9 +18,10 @@ class Controller {
     void init();
 
     void setLaunchPadElevation();
+    void actuate(float u);
+    float rateLimit(float u);
 
     PWMServo controller_servo_;
-    rk4 rk4_;
     float kp = 0.0002;
 
     float min_extension = 0.0;
@@ -25,10 +29,27 @@ class Controller {
     float dt = .006;
     float prev_u = 0;
     float du_max = 0.01;
+    // Fastest the predictive law and a retraction on a stale estimate move the flaps in mm/s, under the servo's own
+    // rate so it keeps up
+    float max_flap_rate = 50;
 
     float launch_pad_alt = 0.0;
     float apogee_des_msl = 0.0;
     float apogee_des_agl = 9144;
 
     ServoControl activeControlServos;
+
+    // Flap extension last commanded in mm
+    float extension = 0.0;
+
+    // Estimates older than this are not acted on and the flaps are retracted, through the rate limit
+    sysinterval_t max_estimate_age = TIME_MS2I(250);
+
+    // Age of the apogee estimate and time from reading it to commanding the servo, for the last tick
+    sysinterval_t estimate_age = 0;
+    uint32_t actuation_us = 0;
+    uint32_t actuation_us_max = 0;
+
+    // Time from the sensor sample behind the apogee estimate until the servo was commanded
+    DataLatency sensor_latency;
 };
@@ -0,0 +1,151 @@
+/**
+ * @file ApogeeDispersion.h
+ *
+ * @brief Batched Monte Carlo apogee prediction.
+ *
+ * Draws N samples of (altitude, velocity) from the Kalman filter covariance, perturbs drag coefficient and mass for
+ * each sample, and propagates all of them together with the model and rk4 scheme of rk4::sim_apogee, scaling its
+ * aerodynamic acceleration by each sample's perturbation. With no perturbation and no covariance every sample reaches
+ * the nominal apogee, see src/tools/apogee_dispersion_bench. The samples are kept in a structure-of-arrays layout and
+ * finished samples are masked rather than branched on, so the whole batch takes the same steps.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "mcu_main/gnc/rk4.h"
+
+struct ApogeeDistribution {
+    float mean;
+    float variance;
+};
+
+template <size_t N>
+class ApogeeDispersion {
+   public:
+    /**
+     * @brief Draws a new batch of samples around the current state estimate.
+     *
+     * @param pos estimated altitude
+     * @param vel estimated vertical velocity
+     * @param var_pos altitude variance from the Kalman covariance
+     * @param cov_pos_vel altitude/velocity covariance
+     * @param var_vel velocity variance
+     */
+    void sample(float pos, float vel, float var_pos, float cov_pos_vel, float var_vel) {
+        // Cholesky factor of the 2x2 covariance
+        float l11 = std::sqrt(std::fmax(var_pos, 0.0f));
+        float l21 = l11 > 0 ? cov_pos_vel / l11 : 0;
+        float l22 = std::sqrt(std::fmax(var_vel - l21 * l21, 0.0f));
+
+        for (size_t i = 0; i < N; i++) {
+            float z_pos = gaussian();
+            float z_vel = gaussian();
+            pos_[i] = pos + l11 * z_pos;
+            vel_[i] = vel + l21 * z_pos + l22 * z_vel;
+            drag_[i] = (1 + cd_sd * gaussian()) / (1 + mass_sd * gaussian());
+        }
+    }
+
+    /**
+     * @brief Propagates every sample to apogee.
+     *
+     * @param model the rocket whose drag the samples fly with
+     * @param dt rk4 time step, same meaning as in rk4::sim_apogee
+     * @param extension flap extension in mm, held constant until apogee
+     * @return mean and variance of the sampled apogees
+     */
+    ApogeeDistribution propagate(rk4& model, float dt, float extension = 0) {
+        for (int iters = 0; iters < max_iters; iters++) {
+            bool any_rising = false;
+            for (size_t i = 0; i < N; i++) {
+                any_rising |= vel_[i] > 0;
+            }
+            if (!any_rising) {
+                break;
+            }
+
+            for (size_t i = 0; i < N; i++) {
+                float alive = vel_[i] > 0 ? 1.0f : 0.0f;
+                float x = pos_[i];
+                float v = vel_[i];
+                float rho = Atmosphere::getDensity(x);
+
+                // The stages of rk4::rk4_step
+                float a1 = accel(model, x, v, rho, extension, drag_[i]);
+                float x2 = x + 0.5f * dt * v;
+                float v2 = v + 0.5f * dt * a1;
+                float a2 = accel(model, x2, v2, rho, extension, drag_[i]);
+                float x3 = x + 0.5f * dt * v2;
+                float v3 = v + 0.5f * dt * a2;
+                float a3 = accel(model, x3, v3, rho, extension, drag_[i]);
+                float x4 = x + dt * v3;
+                float v4 = v + dt * a3;
+                float a4 = accel(model, x4, v4, rho, extension, drag_[i]);
+
+                pos_[i] = x + alive * dt * (v + 2 * v2 + 2 * v3 + v4) / 6;
+                vel_[i] = v + alive * dt * (a1 + 2 * a2 + 2 * a3 + a4) / 6;
+            }
+        }
+
+        float sum = 0;
+        for (size_t i = 0; i < N; i++) {
+            sum += pos_[i];
+        }
+        float mean = sum / N;
+
+        float sum_sq = 0;
+        for (size_t i = 0; i < N; i++) {
+            float d = pos_[i] - mean;
+            sum_sq += d * d;
+        }
+        return {mean, N > 1 ? sum_sq / (N - 1) : 0};
+    }
+
+    // 1-sigma relative perturbations of Cd and mass
+    float cd_sd = 0.05;
+    float mass_sd = 0.02;
+
+   private:
+    static constexpr int max_iters = 120;
+
+    // rk4::accel with the aerodynamic part scaled by a sample's drag perturbation
+    static float accel(rk4& model, float x, float v, float rho, float extension, float drag) {
+        return drag * model.dragAccel({x, v}, rho, extension) - 9.81f;
+    }
+
+    /**
+     * @brief Standard normal sample from a xorshift32 generator and the Box-Muller transform.
+     */
+    float gaussian() {
+        if (has_spare_) {
+            has_spare_ = false;
+            return spare_;
+        }
+        float u1 = (next() >> 8) * (1.0f / 16777216.0f) + (0.5f / 16777216.0f);
+        float u2 = (next() >> 8) * (1.0f / 16777216.0f);
+        float r = std::sqrt(-2 * std::log(u1));
+        spare_ = r * std::sin(6.2831853f * u2);
+        has_spare_ = true;
+        return r * std::cos(6.2831853f * u2);
+    }
+
+    uint32_t next() {
+        rng_state_ ^= rng_state_ << 13;
+        rng_state_ ^= rng_state_ >> 17;
+        rng_state_ ^= rng_state_ << 5;
+        return rng_state_;
+    }
+
+    float pos_[N] = {};
+    float vel_[N] = {};
+    // Relative drag of each sample, the Cd perturbation over the mass perturbation
+    float drag_[N] = {};
+
+    uint32_t rng_state_ = 0x2545F491;
+    float spare_ = 0;
+    bool has_spare_ = false;
+};
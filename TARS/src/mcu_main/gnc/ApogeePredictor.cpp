@@ -0,0 +1,120 @@
+/**
+ * @file ApogeePredictor.cpp
+ *
+ * @brief Background apogee prediction service.
+ */
+
+#include "mcu_main/gnc/ApogeePredictor.h"
+
+#include <Arduino.h>
+
+#include "mcu_main/Trace.h"
+#include "mcu_main/gnc/ActiveControl.h"
+#include "mcu_main/gnc/ApogeeTable.h"
+#include "mcu_main/gnc/kalmanFilter.h"
+
+ApogeePredictor apogeePredictor;
+
+/**
+ * @brief Predicts apogee from the latest Kalman state and publishes it for the controller.
+ *
+ * The published apogee is always the single nominal prediction the controller
+ * is tuned on. With ENABLE_APOGEE_DISPERSION its variance is that of a batch of
+ * samples drawn from the Kalman covariance and flown with the same model,
+ * otherwise zero. With
+ * ENABLE_PREDICTIVE_CONTROL it also solves for the flap extension that reaches
+ * the controller's target apogee.
+ */
+void ApogeePredictor::tick() {
+    TRACE_MTX_LOCK(&kalmanFilter.mutex);
+    KalmanState state = kalmanFilter.getState();
+    systime_t sample_time = kalmanFilter.getSampleTime();
+    systime_t timeStamp = kalmanFilter.getStateTime();
+#ifdef ENABLE_APOGEE_DISPERSION
+    Eigen::Matrix<float, 2, 2> cov = kalmanFilter.getAltitudeCovariance();
+#endif
+    chMtxUnlock(&kalmanFilter.mutex);
+
+    array<float, 2> init = {state.state_est_pos_x, state.state_est_vel_x};
+
+    uint32_t start = micros();
+#ifdef ENABLE_PREDICTIVE_CONTROL
+    // The controller holds the flaps retracted until it is on, and starts moving them from there
+    if (!activeController.ActiveControl_ON()) {
+        solver_.solution = activeController.min_extension;
+    }
+    // The flaps track the previous solution, so that is the extension the rocket is flying with now, and the solve's
+    // first prediction, made there, is the nominal apogee
+    float extension = solver_.solution;
+    float extension_cmd = solver_.solve([&](float u) { return predictApogee(init, u); }, activeController.apogee_des_msl,
+                                        activeController.min_extension, activeController.max_extension);
+    ApogeeDistribution apogee = {solver_.apogee_at_start, 0};
+#else
+    float extension = 0;
+    float extension_cmd = 0;
+    ApogeeDistribution apogee = {predictApogee(init, extension), 0};
+#endif
+#ifdef ENABLE_APOGEE_DISPERSION
+    // The batch flies rk4's model, so its spread is that of the nominal prediction, which stays the published apogee
+    // and leaves the controller's input the same with the flag on or off
+    dispersion_.sample(init[0], init[1], cov(0, 0), cov(0, 1), cov(1, 1));
+    apogee.variance = dispersion_.propagate(rk4_, 0.3, extension).variance;
+#else
+    (void)extension;
+#endif
+    uint32_t compute_us = micros() - start;
+
+    TRACE_MTX_LOCK(&kalmanFilter.mutex);
+    kalmanFilter.updateApogee(apogee.mean, apogee.variance);
+    chMtxUnlock(&kalmanFilter.mutex);
+
+    slot_.write((ApogeePrediction){apogee.mean, apogee.variance, extension_cmd, init[0], init[1], timeStamp, sample_time,
+                                   compute_us});
+}
+
+/**
+ * @brief Reads the most recently published prediction. Only the servo thread may call this.
+ *
+ * @param prediction written with the latest prediction
+ * @returns false if no prediction has been published yet
+ */
+bool ApogeePredictor::latest(ApogeePrediction& prediction) { return slot_.read(prediction); }
+
+/**
+ * @brief Predicts apogee from the current Kalman state with the flaps held at a fixed extension.
+ *
+ * Uses the precomputed apogee table when ENABLE_APOGEE_TABLE is defined and
+ * falls back to integrating the rk4 model otherwise. With APOGEE_TABLE_VALIDATE
+ * both are evaluated, the rk4 result is returned and the absolute error of the
+ * table is printed once every 500 predictions.
+ *
+ * @param init current altitude and vertical velocity
+ * @param extension flap extension in mm
+ * @returns the predicted apogee altitude
+ */
+float ApogeePredictor::predictApogee(array<float, 2> init, float extension) {
+#if defined(APOGEE_TABLE_VALIDATE)
+    float apogee_sim = rk4_.sim_apogee(init, 0.3, extension)[0];
+    float err = abs(apogeeTable.lookup(init[0], init[1], extension) - apogee_sim);
+
+    table_err_sum += err;
+    table_err_count++;
+    if (err > table_err_max) {
+        table_err_max = err;
+    }
+    if (table_err_count == 500) {
+        Serial.print("Apogee table error mean: ");
+        Serial.print(table_err_sum / table_err_count);
+        Serial.print(" max: ");
+        Serial.println(table_err_max);
+        table_err_max = 0;
+        table_err_sum = 0;
+        table_err_count = 0;
+    }
+    return apogee_sim;
+#elif defined(ENABLE_APOGEE_TABLE)
+    return apogeeTable.lookup(init[0], init[1], extension);
+#else
+    return rk4_.sim_apogee(init, 0.3, extension)[0];
+#endif
+}
@@ -0,0 +1,62 @@
+/**
+ * @file ApogeePredictor.h
+ *
+ * @brief Background apogee prediction service.
+ *
+ * Runs the apogee model in its own low priority thread and publishes the latest estimate through a lock-free slot so
+ * that the servo loop never waits on the prediction.
+ */
+
+#pragma once
+
+#include <ChRt.h>
+
+#include "common/TripleBuffer.h"
+#include "mcu_main/debug.h"
+#include "mcu_main/gnc/ApogeeDispersion.h"
+#include "mcu_main/gnc/FlapSolver.h"
+#include "mcu_main/gnc/rk4.h"
+
+// Batch size for ENABLE_APOGEE_DISPERSION, see src/tools/apogee_dispersion_bench for timings
+#define APOGEE_DISPERSION_SAMPLES 64
+
+struct ApogeePrediction {
+    float apogee;
+    float apogee_var;
+    float extension;
+    float pos_x;
+    float vel_x;
+    // Time the Kalman state the prediction started from was estimated
+    systime_t timeStamp_state;
+    // Time the sensor data behind the Kalman state was measured
+    systime_t timeStamp_sample;
+    uint32_t compute_us;
+};
+
+class ApogeePredictor;
+
+extern ApogeePredictor apogeePredictor;
+
+class ApogeePredictor {
+   public:
+    void tick();
+    bool latest(ApogeePrediction& prediction);
+
+   private:
+    float predictApogee(array<float, 2> init, float extension);
+
+    rk4 rk4_;
+#ifdef ENABLE_APOGEE_DISPERSION
+    ApogeeDispersion<APOGEE_DISPERSION_SAMPLES> dispersion_;
+#endif
+#ifdef ENABLE_PREDICTIVE_CONTROL
+    FlapSolver solver_;
+#endif
+    TripleBuffer<ApogeePrediction> slot_;
+
+#ifdef APOGEE_TABLE_VALIDATE
+    float table_err_max = 0;
+    float table_err_sum = 0;
+    uint32_t table_err_count = 0;
+#endif
+};
@@ -0,0 +1,95 @@
+/**
+ * @file ApogeeTable.cpp
+ *
+ * @brief Bilinear interpolation over the precomputed apogee table, with a linear blend between extension slices.
+ */
+
+#include "mcu_main/gnc/ApogeeTable.h"
+
+#include "mcu_main/gnc/apogee_table_data.h"
+
+static_assert(apogee_table_data::n_alt >= 2 && apogee_table_data::n_vel >= 2, "apogee table needs at least 2x2 points");
+
+const ApogeeTable apogeeTable(apogee_table_data::climb, apogee_table_data::n_ext, apogee_table_data::n_alt,
+                              apogee_table_data::n_vel, apogee_table_data::ext_min, apogee_table_data::ext_step,
+                              apogee_table_data::alt_min, apogee_table_data::alt_step, apogee_table_data::vel_min,
+                              apogee_table_data::vel_step);
+
+/**
+ * @brief Finds the grid cell containing a coordinate, clamping to the edges of the table.
+ *
+ * @param x coordinate to locate
+ * @param min coordinate of the first grid point
+ * @param step spacing between grid points
+ * @param n number of grid points
+ * @param idx index of the lower grid point of the cell
+ * @return the fractional position of x inside the cell, in [0, 1]
+ */
+static float locate(float x, float min, float step, size_t n, size_t& idx) {
+    float pos = (x - min) / step;
+    if (n < 2 || pos <= 0) {
+        idx = 0;
+        return 0;
+    }
+    if (pos >= (float)(n - 1)) {
+        idx = n - 2;
+        return 1;
+    }
+    idx = (size_t)pos;
+    return pos - (float)idx;
+}
+
+ApogeeTable::ApogeeTable(const float* data, size_t n_ext, size_t n_alt, size_t n_vel, float ext_min, float ext_step,
+                         float alt_min, float alt_step, float vel_min, float vel_step)
+    : data_(data),
+      n_ext_(n_ext),
+      n_alt_(n_alt),
+      n_vel_(n_vel),
+      ext_min_(ext_min),
+      ext_step_(ext_step),
+      alt_min_(alt_min),
+      alt_step_(alt_step),
+      vel_min_(vel_min),
+      vel_step_(vel_step) {}
+
+/**
+ * @brief Bilinearly interpolates the remaining climb inside one extension slice of the table.
+ */
+float ApogeeTable::climb(size_t ext_idx, float alt, float vel) const {
+    size_t i;
+    size_t j;
+    float ta = locate(alt, alt_min_, alt_step_, n_alt_, i);
+    float tv = locate(vel, vel_min_, vel_step_, n_vel_, j);
+
+    const float* row0 = data_ + (ext_idx * n_alt_ + i) * n_vel_;
+    const float* row1 = row0 + n_vel_;
+
+    float c0 = row0[j] + (row0[j + 1] - row0[j]) * tv;
+    float c1 = row1[j] + (row1[j + 1] - row1[j]) * tv;
+    return c0 + (c1 - c0) * ta;
+}
+
+/**
+ * @brief Looks up the predicted apogee for a given state.
+ *
+ * @param alt current altitude (MSL, same frame as the Kalman filter)
+ * @param vel current vertical velocity
+ * @param extension current flap extension; ignored if the table has a single extension slice
+ * @return the predicted apogee altitude
+ */
+float ApogeeTable::lookup(float alt, float vel, float extension) const {
+    // sim_apogee stops immediately once the rocket is descending
+    if (vel <= 0) {
+        return alt;
+    }
+
+    if (n_ext_ < 2) {
+        return alt + climb(0, alt, vel);
+    }
+
+    size_t k;
+    float te = locate(extension, ext_min_, ext_step_, n_ext_, k);
+    float c0 = climb(k, alt, vel);
+    float c1 = climb(k + 1, alt, vel);
+    return alt + c0 + (c1 - c0) * te;
+}
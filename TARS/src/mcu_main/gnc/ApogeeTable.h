@@ -0,0 +1,37 @@
+/**
+ * @file ApogeeTable.h
+ *
+ * @brief Constant-time apogee lookup from a table precomputed with the rk4 model.
+ *
+ * The table is generated offline by the host tool in src/tools/apogee_table by sweeping rk4::sim_apogee over the
+ * flight envelope. It stores the remaining climb (apogee - altitude) on a regular (extension, altitude, velocity) grid
+ * so that values just outside the altitude range still extrapolate sensibly when clamped.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+class ApogeeTable {
+   public:
+    ApogeeTable(const float* data, size_t n_ext, size_t n_alt, size_t n_vel, float ext_min, float ext_step,
+                float alt_min, float alt_step, float vel_min, float vel_step);
+
+    float lookup(float alt, float vel, float extension = 0) const;
+
+   private:
+    float climb(size_t ext_idx, float alt, float vel) const;
+
+    const float* data_;
+    size_t n_ext_;
+    size_t n_alt_;
+    size_t n_vel_;
+    float ext_min_;
+    float ext_step_;
+    float alt_min_;
+    float alt_step_;
+    float vel_min_;
+    float vel_step_;
+};
+
+extern const ApogeeTable apogeeTable;
@@ -0,0 +1,92 @@
+/**
+ * @file FlapSolver.h
+ *
+ * @brief Solves for the flap extension whose predicted apogee hits the target.
+ *
+ * Predicted apogee decreases monotonically with flap extension, so the root of apogee(u) - target is found by
+ * bracketing outwards from the previous solution and then bisecting. Warm starting from the previous solution keeps
+ * the bracket small, so the solve normally finishes in a handful of apogee predictions.
+ */
+
+#pragma once
+
+class FlapSolver {
+   public:
+    /**
+     * @brief Finds the extension in [lo, hi] that reaches the target apogee.
+     *
+     * If the target cannot be reached within the limits the nearest limit is returned.
+     *
+     * @param apogee callable mapping a flap extension (mm) to a predicted apogee
+     * @param target desired apogee, same frame as the prediction
+     * @param lo minimum flap extension
+     * @param hi maximum flap extension
+     * @return the solved flap extension
+     */
+    template <typename ApogeeFn>
+    float solve(ApogeeFn apogee, float target, float lo, float hi) {
+        evaluations = 0;
+
+        float a = clamp(solution, lo, hi);
+        float fa = apogee(a) - target;
+        evaluations++;
+        apogee_at_start = fa + target;
+
+        // Too high means more drag is needed
+        float dir = fa > 0 ? 1 : -1;
+
+        float b = a;
+        float fb = fa;
+        float step = warm_step;
+        while (true) {
+            b = clamp(a + dir * step, lo, hi);
+            fb = apogee(b) - target;
+            evaluations++;
+            if ((fb > 0) != (fa > 0)) {
+                break;
+            }
+            if (b == lo || b == hi || evaluations >= max_evaluations) {
+                solution = b;
+                return solution;
+            }
+            a = b;
+            fa = fb;
+            step *= 2;
+        }
+
+        while ((a - b > tolerance || b - a > tolerance) && evaluations < max_evaluations) {
+            float m = (a + b) / 2;
+            float fm = apogee(m) - target;
+            evaluations++;
+            if ((fm > 0) == (fa > 0)) {
+                a = m;
+                fa = fm;
+            } else {
+                b = m;
+                fb = fm;
+            }
+        }
+
+        // Interpolate inside the final bracket
+        solution = fa == fb ? a : a - fa * (b - a) / (fb - fa);
+        return solution;
+    }
+
+    // Previous solution, used as the starting point of the next solve and taken as the extension flown with. Set it
+    // to the retracted extension while the flaps are held there.
+    float solution = 0;
+    // Predicted apogee at the starting extension of the last solve
+    float apogee_at_start = 0;
+    // Number of apogee predictions used by the last solve
+    int evaluations = 0;
+
+    // Bracket width (mm) at which bisection stops
+    float tolerance = 0.05;
+    // Initial bracketing step (mm) away from the previous solution
+    float warm_step = 0.5;
+    // Upper bound on apogee predictions per solve, so a solve fits in the control period
+    int max_evaluations = 10;
+
+   private:
+    static float clamp(float u, float lo, float hi) { return u < lo ? lo : (u > hi ? hi : u); }
+};
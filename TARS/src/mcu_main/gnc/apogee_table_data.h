@@ -0,0 +1,1076 @@
+/**
+ * @file apogee_table_data.h
+ *
+ * @brief Generated by src/tools/apogee_table. Do not edit by hand.
+ *
+ * Remaining climb (apogee - altitude) predicted by rk4::sim_apogee, indexed as
+ * climb[(ext * n_alt + alt) * n_vel + vel].
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace apogee_table_data {
+
+static constexpr size_t n_ext = 5;
+static constexpr size_t n_alt = 51;
+static constexpr size_t n_vel = 41;
+
+static constexpr float ext_min = 0;
+static constexpr float ext_step = 3.1759071;
+static constexpr float alt_min = -500;
+static constexpr float alt_step = 250;
+static constexpr float vel_min = 0;
+static constexpr float vel_step = 15;
+
+static constexpr float climb[n_ext * n_alt * n_vel] = {
+    0.00, 11.08, 45.25, 101.43, 178.61, 276.00, 391.09, 522.52, 669.44, 829.36,
+    1000.74, 1181.90, 1371.32, 1568.22, 1769.88, 1975.82, 2184.36, 2395.98, 2610.39, 2822.88,
+    3033.98, 3240.17, 3436.32, 3623.39, 3811.12, 3992.45, 4169.99, 4350.83, 4534.83, 4718.28,
+    4907.17, 5092.27, 5282.64, 5474.58, 5670.80, 5866.74, 6063.35, 6264.09, 6465.23, 6667.29,
+    6869.47, 0.00, 11.08, 45.26, 101.46, 178.72, 276.25, 391.58, 523.39, 670.82,
+    831.42, 1003.69, 1185.96, 1376.70, 1575.03, 1778.51, 1986.33, 2196.97, 2411.05, 2627.37,
+    2842.48, 3056.81, 3263.81, 3462.13, 3653.14, 3844.06, 4029.03, 4210.13, 4396.09, 4581.08,
+    4771.58, 4958.93, 5151.40, 5347.02, 5543.06, 5742.09, 5944.15, 6145.54, 6350.67, 6555.06,
+    6765.06, 6972.14, 0.00, 11.08, 45.27, 101.50, 178.83, 276.48, 392.06, 524.25,
+    672.18, 833.47, 1006.60, 1189.96, 1382.01, 1581.77, 1787.05, 1996.60, 2209.32, 2425.71,
+    2644.88, 2862.17, 3078.51, 3288.98, 3490.71, 3686.63, 3876.28, 4063.29, 4250.18, 4437.64,
+    4626.59, 4819.72, 5014.65, 5212.19, 5411.01, 5611.35, 5815.67, 6021.30, 6226.02, 6437.59,
+    6650.08, 6862.83, 7077.24, 0.00, 11.08, 45.27, 101.54, 178.94, 276.72, 392.53,
+    525.09, 673.53, 835.48, 1009.47, 1193.90, 1387.28, 1588.12, 1795.50, 2006.90, 2221.26,
+    2439.97, 2661.99, 2882.21, 3100.90, 3314.25, 3518.23, 3716.70, 3909.22, 4100.97, 4292.91,
+    4481.74, 4676.00, 4872.37, 5070.85, 5272.39, 5473.13, 5681.11, 5889.20, 6101.00, 6311.25,
+    6526.50, 6744.54, 6961.58, 7179.97, 0.00, 11.09, 45.28, 101.57, 179.04, 276.95,
+    392.99, 525.93, 674.85, 837.45, 1012.30, 1197.80, 1392.46, 1594.85, 1803.73, 2016.74,
+    2233.98, 2455.01, 2678.87, 2901.60, 3123.91, 3337.74, 3544.65, 3745.72, 3945.57, 4136.12,
+    4330.32, 4525.35, 4723.07, 4922.34, 5126.37, 5330.65, 5539.92, 5749.80, 5964.18, 6179.18,
+    6397.71, 6615.00, 6838.95, 7063.43, 7287.41, 0.00, 11.09, 45.29, 101.60, 179.14,
+    277.17, 393.45, 526.74, 676.15, 839.41, 1014.67, 1201.64, 1397.58, 1601.50, 1812.00,
+    2026.97, 2246.32, 2469.67, 2696.07, 2920.70, 3145.92, 3362.32, 3572.10, 3775.84, 3976.92,
+    4173.01, 4371.83, 4571.05, 4771.35, 4977.71, 5182.66, 5392.65, 5604.72, 5821.75, 6039.92,
+    6260.46, 6481.69, 6709.45, 6936.70, 7164.73, 7395.32, 0.00, 11.09, 45.30, 101.64,
+    179.24, 277.39, 393.89, 527.55, 677.43, 841.33, 1017.49, 1205.07, 1402.64, 1608.06,
+    1819.87, 2037.14, 2258.55, 2484.08, 2713.06, 2940.83, 3168.34, 3388.04, 3599.71, 3807.55,
+    4010.42, 4211.63, 4411.18, 4613.94, 4821.36, 5030.21, 5240.72, 5454.23, 5672.97, 5892.61,
+    6117.04, 6341.25, 6569.54, 6800.40, 7034.43, 7269.61, 7507.84, 0.00, 11.09, 45.30,
+    101.67, 179.34, 277.61, 394.33, 528.34, 678.70, 842.81, 1020.28, 1208.90, 1407.24,
+    1614.56, 1828.05, 2047.21, 2270.25, 2498.32, 2729.86, 2959.55, 3190.23, 3411.87, 3626.80,
+    3837.62, 4044.62, 4248.37, 4453.51, 4659.51, 4869.36, 5084.77, 5298.65, 5518.40, 5739.50,
+    5966.55, 6193.00, 6423.92, 6657.78, 6894.63, 7134.29, 7375.98, 7619.25, 0.00, 11.09,
+    45.31, 101.70, 179.43, 277.83, 394.77, 529.12, 679.94, 844.73, 1023.04, 1212.69,
+    1412.30, 1620.96, 1836.20, 2057.05, 2282.44, 2512.78, 2746.89, 2979.58, 3212.21, 3437.26,
+    3654.07, 3867.25, 4077.36, 4285.37, 4493.41, 4705.92, 4917.94, 5136.60, 5358.36, 5580.78,
+    5809.27, 6038.26, 6271.46, 6511.21, 6748.00, 6992.22, 7235.89, 7483.49, 7731.51, 0.00,
+    11.09, 45.32, 101.73, 179.53, 278.04, 395.19, 529.89, 681.16, 846.62, 1025.74,
+    1216.41, 1417.27, 1626.93, 1844.25, 2066.59, 2294.46, 2527.41, 2763.13, 2999.27, 3234.42,
+    3461.28, 3680.49, 3900.08, 4109.58, 4321.40, 4536.08, 4749.67, 4969.54, 5191.18, 5415.00,
+    5645.69, 5875.88, 6112.59, 6353.70, 6593.77, 6839.88, 7086.13, 7339.83, 7594.10, 7848.07,
+    0.00, 11.09, 45.32, 101.77, 179.62, 278.24, 395.61, 530.64, 682.36, 848.50,
+    1028.40, 1220.08, 1422.17, 1633.31, 1852.09, 2076.46, 2306.66, 2541.55, 2779.41, 3018.05,
+    3256.48, 3485.35, 3707.99, 3930.05, 4146.37, 4361.78, 4575.45, 4795.50, 5018.61, 5246.29,
+    5474.58, 5709.17, 5946.41, 6187.35, 6432.80, 6680.30, 6931.99, 7186.25, 7443.77, 7704.56,
+    7963.69, 0.00, 11.09, 45.33, 101.80, 179.71, 278.44, 396.02, 531.38, 683.54,
+    850.33, 1031.03, 1223.71, 1427.02, 1639.61, 1859.55, 2086.26, 2318.38, 2555.39, 2796.45,
+    3037.29, 3277.65, 3510.12, 3735.10, 3959.46, 4178.87, 4397.82, 4618.86, 4839.76, 5068.91,
+    5300.87, 5534.76, 5775.24, 6016.58, 6264.07, 6514.05, 6767.29, 7023.61, 7285.89, 7548.76,
+    7814.52, 8080.70, 0.00, 11.09, 45.34, 101.83, 179.80, 278.21, 396.43, 532.11,
+    684.71, 852.13, 1033.62, 1227.28, 1431.79, 1645.82, 1867.46, 2095.95, 2329.77, 2569.64,
+    2812.70, 3056.43, 3300.08, 3534.95, 3762.30, 3990.92, 4212.46, 4435.09, 4658.64, 4888.37,
+    5121.12, 5355.19, 5595.22, 5839.84, 6088.02, 6340.70, 6594.79, 6854.46, 7118.97, 7387.15,
+    7657.86, 7927.93, 8198.36, 0.00, 11.09, 45.34, 101.85, 179.89, 278.41, 396.82,
+    532.83, 685.85, 853.91, 1036.16, 1230.79, 1436.50, 1651.95, 1875.22, 2105.42, 2341.60,
+    2583.69, 2829.45, 3075.91, 3320.41, 3558.63, 3790.12, 4020.43, 4245.76, 4472.81, 4700.80,
+    4933.70, 5171.38, 5411.36, 5656.91, 5905.99, 6157.94, 6416.56, 6679.63, 6944.02, 7215.12,
+    7489.35, 7764.47, 8039.88, 8314.04, 0.00, 11.09, 45.35, 101.88, 179.97, 278.61,
+    397.21, 533.53, 686.56, 855.66, 1038.67, 1234.27, 1441.14, 1658.01, 1882.93, 2114.57,
+    2353.23, 2597.73, 2845.61, 3094.83, 3342.36, 3583.43, 3816.69, 4050.31, 4281.85, 4512.32,
+    4745.44, 4979.92, 5221.47, 5467.45, 5717.36, 5972.33, 6232.40, 6495.29, 6762.76, 7035.12,
+    7312.04, 7592.01, 7873.49, 8154.47, 8431.99, 0.00, 11.09, 45.35, 101.91, 180.06,
+    278.81, 397.59, 534.22, 687.70, 857.38, 1041.15, 1237.68, 1445.31, 1663.97, 1890.55,
+    2124.03, 2364.63, 2611.24, 2861.36, 3113.35, 3363.69, 3606.43, 3843.58, 4082.65, 4315.53,
+    4548.24, 4785.25, 5027.09, 5273.84, 5525.10, 5779.98, 6040.88, 6305.67, 6575.16, 6848.77,
+    7125.18, 7409.30, 7696.21, 7982.18, 8269.73, 8552.06, 0.00, 11.09, 45.36, 101.94,
+    180.14, 279.01, 397.97, 534.90, 688.83, 859.07, 1043.57, 1240.67, 1449.92, 1669.50,
+    1897.96, 2133.43, 2375.84, 2625.13, 2877.63, 3132.32, 3384.87, 3630.86, 3872.87, 4112.03,
+    4348.97, 4586.73, 4828.33, 5074.86, 5325.55, 5581.38, 5841.37, 6106.96, 6378.68, 6654.18,
+    6932.85, 7217.54, 7508.67, 7801.07, 8092.70, 8383.62, 8670.03, 0.00, 11.09, 45.37,
+    101.97, 180.22, 279.20, 398.34, 535.57, 689.93, 860.73, 1045.96, 1244.07, 1454.46,
+    1675.42, 1904.98, 2142.70, 2387.21, 2638.71, 2893.24, 3150.72, 3406.08, 3654.77, 3900.32,
+    4142.94, 4382.18, 4624.05, 4871.17, 5122.04, 5378.62, 5639.15, 5904.48, 6176.19, 6453.13,
+    6733.79, 7020.11, 7312.04, 7608.82, 7905.48, 8201.50, 8498.10, 8791.00, 0.00, 11.09,
+    45.37, 101.99, 180.30, 279.39, 398.70, 536.22, 691.02, 862.37, 1047.90, 1247.40,
+    1458.93, 1681.23, 1912.42, 2151.77, 2398.59, 2652.43, 2909.46, 3169.75, 3427.84, 3678.44,
+    3925.45, 4172.52, 4415.17, 4663.89, 4913.49, 5168.30, 5431.23, 5696.06, 5967.85, 6243.67,
+    6529.00, 6816.89, 7107.63, 7406.52, 7708.01, 8012.01, 8311.81, 8613.34, 8913.25, 0.00,
+    11.09, 45.38, 102.02, 180.38, 279.57, 399.06, 536.87, 692.08, 863.98, 1050.28,
+    1250.68, 1463.34, 1686.99, 1919.73, 2160.45, 2409.65, 2665.51, 2925.56, 3187.66, 3447.48,
+    3702.83, 3953.26, 4201.86, 4451.29, 4702.47, 4956.43, 5215.71, 5483.55, 5755.00, 6031.25,
+    6314.30, 6602.93, 6896.68, 7196.73, 7501.92, 7808.56, 8117.08, 8423.10, 8731.93, 9032.64,
+    0.00, 11.09, 45.38, 102.04, 180.46, 279.75, 399.40, 537.50, 693.13, 865.56,
+    1052.61, 1253.92, 1467.67, 1692.65, 1926.97, 2169.49, 2420.64, 2678.92, 2940.72, 3206.04,
+    3468.70, 3724.98, 3980.28, 4233.53, 4485.00, 4738.94, 5000.65, 5264.59, 5536.31, 5812.83,
+    6094.72, 6385.67, 6678.93, 6979.89, 7285.95, 7597.30, 7910.06, 8222.73, 8534.56, 8847.41,
+    9154.69, 0.00, 11.09, 45.39, 102.07, 180.53, 279.93, 399.74, 538.12, 694.15,
+    867.10, 1054.90, 1257.10, 1471.94, 1698.16, 1934.03, 2178.43, 2431.35, 2692.18, 2956.28,
+    3224.19, 3489.19, 3748.87, 4005.26, 4263.29, 4518.11, 4779.11, 5041.99, 5312.96, 5590.58,
+    5871.44, 6159.99, 6454.38, 6756.71, 7063.67, 7376.26, 7691.77, 8010.75, 8328.24, 8646.52,
+    8962.56, 9276.60, 0.00, 11.09, 45.39, 102.09, 180.60, 280.10, 400.08, 538.72,
+    695.16, 868.63, 1057.17, 1260.22, 1476.15, 1703.65, 1941.06, 2187.24, 2442.25, 2705.24,
+    2971.63, 3242.64, 3510.35, 3772.25, 4034.45, 4293.71, 4554.55, 4816.39, 5084.90, 5361.43,
+    5643.38, 5929.98, 6225.01, 6525.50, 6833.77, 7147.41, 7466.96, 7787.87, 8112.28, 8435.07,
+    8759.57, 9080.93, 9401.07, 0.00, 11.09, 45.40, 102.12, 180.68, 280.27, 400.41,
+    539.32, 696.15, 870.13, 1059.38, 1263.30, 1480.28, 1708.65, 1948.00, 2195.94, 2453.02,
+    2718.07, 2987.30, 3259.86, 3529.29, 3795.12, 4059.60, 4322.59, 4587.07, 4854.67, 5129.21,
+    5409.02, 5698.10, 5989.28, 6289.87, 6597.48, 6912.90, 7231.79, 7557.10, 7884.79, 8213.73,
+    8542.82, 8872.35, 9198.39, 9524.74, 0.00, 11.09, 45.40, 102.14, 180.75, 280.44,
+    400.73, 539.91, 697.13, 871.60, 1061.56, 1266.32, 1483.93, 1714.04, 1954.46, 2204.23,
+    2463.63, 2730.78, 3002.17, 3277.98, 3550.00, 3817.59, 4087.53, 4353.47, 4621.59, 4894.15,
+    5171.73, 5459.33, 5750.79, 6049.20, 6355.37, 6668.77, 6991.23, 7318.11, 7648.69, 7981.01,
+    8316.16, 8649.00, 8985.56, 9318.77, 9650.82, 0.00, 11.09, 45.41, 102.16, 180.82,
+    280.60, 401.05, 540.48, 698.08, 872.62, 1063.70, 1269.29, 1488.02, 1719.40, 1961.31,
+    2212.83, 2474.24, 2743.66, 3017.04, 3295.66, 3570.79, 3841.14, 4112.75, 4382.28, 4656.34,
+    4932.43, 5217.03, 5507.24, 5804.85, 6109.83, 6422.55, 6742.94, 7071.42, 7404.07, 7740.40,
+    8078.57, 8418.19, 8759.20, 9100.76, 9439.97, 9777.28, 0.00, 11.10, 45.41, 102.19,
+    180.88, 280.76, 400.93, 541.04, 699.02, 874.09, 1065.80, 1272.22, 1492.03, 1724.66,
+    1967.98, 2221.23, 2484.26, 2756.41, 3032.04, 3313.29, 3589.78, 3863.12, 4139.95, 4412.13,
+    4689.01, 4969.73, 5258.44, 5555.75, 5859.40, 6169.81, 6488.25, 6815.87, 7150.76, 7489.59,
+    7831.70, 8175.27, 8521.41, 8868.20, 9215.50, 9558.20, 9904.32, 0.00, 11.10, 45.42,
+    102.21, 180.95, 280.92, 401.25, 541.60, 699.94, 875.52, 1067.87, 1274.67, 1495.99,
+    1729.78, 1974.63, 2229.67, 2494.54, 2767.83, 3047.03, 3329.87, 3609.96, 3886.16, 4165.88,
+    4443.48, 4722.77, 5009.29, 5302.48, 5604.89, 5913.72, 6230.14, 6555.54, 6890.75, 7231.82,
+    7576.30, 7924.56, 8273.71, 8626.86, 8978.07, 9331.79, 9680.43, 10028.41, 0.00, 11.10,
+    45.42, 102.23, 181.01, 281.07, 401.56, 542.14, 700.84, 876.92, 1069.89, 1277.55,
+    1499.87, 1734.88, 1981.16, 2237.85, 2504.81, 2780.39, 3061.65, 3347.15, 3629.30, 3908.71,
+    4191.50, 4471.87, 4758.35, 5047.93, 5346.54, 5654.29, 5968.33, 6291.38, 6624.34, 6964.15,
+    7313.15, 7663.07, 8016.69, 8371.99, 8730.04, 9087.61, 9447.49, 9800.59, 10154.09, 0.00,
+    11.10, 45.43, 102.25, 181.08, 281.22, 401.86, 542.67, 701.72, 878.30, 1071.89,
+    1280.39, 1503.70, 1739.89, 1987.56, 2246.10, 2514.83, 2792.37, 3075.80, 3363.61, 3648.35,
+    3930.21, 4216.58, 4501.51, 4790.88, 5086.91, 5389.45, 5703.82, 6024.00, 6354.09, 6691.83,
+    7040.69, 7394.00, 7750.55, 8110.02, 8472.22, 8835.69, 9198.58, 9560.07, 9918.39, 10281.18,
+    0.00, 11.10, 45.43, 102.27, 181.14, 281.37, 402.16, 543.19, 702.59, 879.65,
+    1073.84, 1283.17, 1507.45, 1744.78, 1993.88, 2253.56, 2524.82, 2804.64, 3090.12, 3379.78,
+    3667.55, 3954.83, 4244.09, 4530.65, 4824.95, 5126.00, 5434.46, 5753.58, 6079.20, 6415.33,
+    6761.48, 7116.24, 7476.46, 7838.30, 8202.73, 8571.62, 8939.35, 9308.15, 9674.70, 10038.14,
+    10403.94, 0.00, 11.10, 45.44, 102.29, 181.20, 281.51, 402.46, 543.70, 703.44,
+    880.98, 1075.75, 1285.91, 1511.13, 1749.63, 1999.70, 2261.54, 2534.23, 2816.00, 3104.63,
+    3396.38, 3687.25, 3975.86, 4267.74, 4560.27, 4859.15, 5163.35, 5478.66, 5803.00, 6135.16,
+    6477.76, 6830.57, 7194.01, 7558.61, 7925.63, 8297.09, 8670.29, 9044.32, 9416.74, 9787.75,
+    10156.29, 10527.66, 0.00, 11.10, 45.44, 102.31, 181.26, 281.66, 402.74, 544.20,
+    704.27, 882.28, 1077.63, 1288.59, 1514.75, 1753.95, 2005.93, 2269.43, 2544.03, 2827.55,
+    3118.38, 3413.03, 3705.34, 3998.16, 4293.70, 4590.56, 4892.90, 5202.81, 5523.53, 5853.79,
+    6193.00, 6542.45, 6901.97, 7271.05, 7640.74, 8014.14, 8391.61, 8769.63, 9147.19, 9525.86,
+    9898.83, 10272.34, 10648.84, 0.00, 11.10, 45.44, 102.33, 181.32, 281.79, 403.02,
+    544.69, 705.09, 883.55, 1079.48, 1291.22, 1518.30, 1758.72, 2012.03, 2277.15, 2553.63,
+    2839.34, 3132.07, 3428.34, 3723.70, 4020.28, 4317.83, 4618.68, 4926.28, 5242.22, 5568.32,
+    5903.90, 6248.66, 6604.97, 6972.87, 7347.41, 7723.71, 8102.40, 8484.56, 8867.76, 9249.81,
+    9633.78, 10012.39, 10389.73, 10772.47, 0.00, 11.10, 45.45, 102.35, 181.38, 281.93,
+    403.30, 545.17, 705.88, 884.81, 1080.86, 1293.81, 1521.79, 1763.40, 2018.04, 2284.83,
+    2563.16, 2850.77, 3145.88, 3444.31, 3742.88, 4041.07, 4344.43, 4649.17, 4961.15, 5282.19,
+    5613.60, 5954.90, 6306.74, 6670.17, 7045.41, 7425.96, 7806.49, 8190.73, 8577.32, 8965.32,
+    9352.59, 9738.99, 10122.49, 10505.29, 10892.23, 0.00, 11.10, 45.45, 102.37, 181.43,
+    282.06, 403.57, 545.64, 706.67, 886.03, 1082.69, 1296.34, 1524.81, 1767.97, 2023.91,
+    2292.28, 2572.46, 2862.24, 3159.69, 3460.20, 3760.62, 4063.85, 4369.04, 4678.42, 4995.22,
+    5321.40, 5657.92, 6005.74, 6365.68, 6736.32, 7117.24, 7502.68, 7889.03, 8278.23, 8669.57,
+    9062.30, 9452.83, 9845.28, 10233.18, 10618.94, 11011.39, 0.00, 11.10, 45.46, 102.39,
+    181.48, 282.19, 403.83, 545.66, 707.43, 887.23, 1084.47, 1298.82, 1528.25, 1772.49,
+    2029.71, 2299.65, 2581.21, 2872.58, 3172.85, 3476.46, 3779.02, 4086.21, 4394.37, 4707.75,
+    5030.48, 5361.93, 5704.21, 6059.00, 6423.88, 6802.12, 7190.14, 7580.43, 7971.47, 8364.57,
+    8760.62, 9157.06, 9553.64, 9948.71, 10340.81, 10733.93, 11130.54, 0.00, 11.10, 45.46,
+    102.40, 181.54, 282.32, 404.09, 546.13, 708.19, 888.41, 1086.22, 1301.26, 1531.61,
+    1776.87, 2035.41, 2306.48, 2590.44, 2883.95, 3186.05, 3491.48, 3797.62, 4107.15, 4420.56,
+    4738.32, 5064.97, 5401.48, 5749.98, 6111.92, 6485.38, 6869.30, 7262.17, 7657.10, 8052.49,
+    8450.78, 8851.74, 9251.99, 9653.39, 10052.97, 10448.30, 10844.98, 11246.67, 0.00, 11.10,
+    45.46, 102.42, 181.59, 282.44, 404.34, 546.58, 708.92, 889.56, 1087.93, 1303.65,
+    1534.92, 1781.22, 2040.55, 2313.78, 2599.47, 2894.89, 3199.44, 3506.91, 3815.43, 4129.98,
+    4445.16, 4768.17, 5098.75, 5443.11, 5798.18, 6164.76, 6544.62, 6936.67, 7334.07, 7732.80,
+    8133.13, 8536.35, 8941.22, 9346.18, 9751.24, 10154.52, 10553.64, 10956.32, 11362.06, 0.00,
+    11.10, 45.47, 102.44, 181.64, 282.56, 404.59, 547.03, 709.64, 890.68, 1089.61,
+    1305.99, 1538.15, 1785.46, 2046.15, 2320.90, 2608.47, 2905.64, 3212.47, 3522.74, 3833.60,
+    4151.43, 4471.18, 4799.25, 5134.66, 5483.10, 5845.07, 6218.95, 6604.74, 7003.12, 7404.98,
+    7808.17, 8212.71, 8619.78, 9030.36, 9438.85, 9848.61, 10254.24, 10658.20, 11066.77, 11475.89,
+    0.00, 11.10, 45.47, 102.46, 181.69, 282.68, 404.83, 547.47, 710.34, 891.79,
+    1091.25, 1308.28, 1541.33, 1789.65, 2051.64, 2328.00, 2617.37, 2916.77, 3225.98, 3538.51,
+    3851.85, 4173.26, 4497.28, 4828.36, 5170.46, 5526.20, 5894.31, 6273.77, 6666.40, 7069.29,
+    7475.62, 7882.89, 8291.57, 8703.73, 9117.50, 9530.53, 9944.79, 10354.71, 10762.95, 11175.09,
+    11588.19, 0.00, 11.10, 45.48, 102.47, 181.74, 282.80, 405.07, 547.89, 711.03,
+    892.87, 1092.86, 1310.53, 1544.44, 1793.78, 2057.15, 2335.04, 2626.31, 2927.60, 3238.79,
+    3553.69, 3870.09, 4194.38, 4522.43, 4859.31, 5207.92, 5568.01, 5942.20, 6327.74, 6726.51,
+    7134.35, 7545.03, 7956.33, 8370.08, 8786.24, 9203.99, 9620.97, 10038.92, 10452.49, 10865.00,
+    11281.86, 11701.33, 0.00, 11.10, 45.48, 102.49, 181.79, 282.91, 405.30, 548.31,
+    711.71, 893.92, 1094.43, 1312.34, 1547.51, 1797.51, 2062.65, 2342.13, 2634.68, 2938.38,
+    3251.83, 3568.70, 3889.20, 4217.07, 4548.85, 4891.80, 5243.87, 5610.82, 5990.14, 6381.93,
+    6786.44, 7199.27, 7614.01, 8029.25, 8447.22, 8867.44, 9289.72, 9710.48, 10131.86, 10548.71,
+    10966.70, 11388.88, 11811.08, 0.00, 11.10, 45.48, 102.50, 181.83, 283.02, 405.52,
+    548.72, 712.37, 894.96, 1095.99, 1314.60, 1550.61, 1801.72, 2068.15, 2349.18, 2643.75,
+    2949.24, 3265.39, 3584.89, 3907.38, 4239.97, 4576.51, 4922.72, 5281.56, 5652.99, 6038.06,
+    6436.57, 6846.60, 7263.35, 7682.07, 8101.65, 8523.32, 8947.82, 9373.30, 9798.96, 10223.78,
+    10644.28, 11066.94, 11494.06, 11916.44, 0.00, 11.10, 45.48, 102.52, 181.88, 283.13,
+    405.74, 549.12, 712.57, 895.99, 1097.55, 1316.88, 1553.73, 1805.96, 2073.77, 2355.96,
+    2652.49, 2960.49, 3278.35, 3600.48, 3928.02, 4262.28, 4604.11, 4955.46, 5318.34, 5696.86,
+    6086.50, 6489.64, 6905.62, 7325.87, 7749.05, 8172.68, 8598.22, 9027.50, 9456.53, 9885.43,
+    10313.76, 10738.11, 11165.99, 11596.49, 12024.52, 0.00, 11.10, 45.49, 102.53, 181.92,
+    283.24, 405.96, 549.52, 713.25, 897.04, 1099.15, 1319.19, 1556.87, 1810.28, 2079.38,
+    2363.24, 2661.65, 2971.65, 3291.85, 3616.79, 3947.19, 4286.85, 4631.16, 4987.72, 5355.75,
+    5738.45, 6134.70, 6542.90, 6964.29, 7388.49, 7814.97, 8242.99, 8673.13, 9105.03, 9537.87,
+    9971.11, 10402.74, 10831.50, 11264.32, 11698.86, 12127.54, 0.00, 11.10, 45.49, 102.54,
+    181.97, 283.35, 406.19, 549.94, 713.97, 898.15, 1100.81, 1321.59, 1560.13, 1814.68,
+    2085.08, 2370.63, 2670.76, 2982.92, 3304.96, 3633.12, 3966.92, 4310.38, 4658.98, 5019.81,
+    5394.10, 5780.55, 6181.46, 6596.32, 7022.02, 7449.88, 7880.41, 8311.60, 8746.07, 9181.92,
+    9619.21, 10055.73, 10491.37, 10923.71, 11359.75, 11798.86, 12231.53, 0.00, 11.10, 45.50,
+    102.56, 182.02, 283.47, 406.44, 550.40, 714.72, 899.29, 1102.50, 1324.02, 1562.97,
+    1819.11, 2090.47, 2377.99, 2679.91, 2993.90, 3318.90, 3649.89, 3987.29, 4333.84, 4687.31,
+    5051.66, 5430.09, 5822.00, 6229.01, 6648.95, 7077.98, 7510.58, 7944.36, 8380.09, 8817.53,
+    9257.77, 9697.86, 10138.60, 10578.00, 11014.55, 11454.07, 11895.71, 12332.66, 0.00, 11.10,
+    45.50, 102.58, 182.07, 283.59, 406.68, 550.83, 715.45, 900.38, 1104.14, 1326.35,
+    1566.21, 1823.38, 2096.10, 2385.11, 2688.34, 3004.97, 3332.40, 3666.29, 4007.00, 4356.94,
+    4714.23, 5084.16, 5466.46, 5863.01, 6274.26, 6699.76, 7133.59, 7569.01, 8007.23, 8446.02,
+    8887.54, 9331.02, 9775.17, 10219.40, 10661.95, 11102.64, 11545.89, 11991.07, 12432.28, 0.00,
+    11.10, 45.50, 102.60, 182.12, 283.70, 406.91, 551.25, 716.14, 901.44, 1105.72,
+    1328.61, 1569.33, 1827.50, 2101.54, 2391.98, 2697.04, 3015.67, 3345.48, 3681.95, 4025.95,
+    4379.58, 4740.35, 5114.48, 5501.07, 5903.18, 6319.87, 6750.51, 7186.93, 7626.83, 8067.91,
+    8510.71, 8955.24, 9402.73, 9850.17, 10297.83, 10744.29, 11188.47, 11635.04, 12083.19, 12527.42,
+    0.00, 11.10, 45.50, 102.61, 182.16, 283.81, 407.13, 551.65, 716.81, 902.02,
+    1107.24, 1330.79, 1572.34, 1831.49, 2106.79, 2398.62, 2705.45, 3026.02, 3357.69, 3697.03,
+    4044.22, 4400.66, 4765.79, 5144.40, 5535.53, 5941.91, 6362.97, 6799.12, 7239.78, 7682.37,
+    8127.47, 8573.16, 9021.46, 9472.15, 9923.10, 10374.21, 10824.16, 11270.77, 11721.98, 12173.27,
+    12619.86, 0.00, 11.08, 45.21, 101.23, 178.03, 274.69, 388.46, 518.42, 661.98,
+    818.23, 984.89, 1160.80, 1343.54, 1532.53, 1725.47, 1921.67, 2120.06, 2320.41, 2522.05,
+    2722.16, 2920.50, 3113.64, 3297.12, 3473.83, 3649.26, 3818.47, 3987.93, 4153.78, 4322.90,
+    4497.13, 4667.74, 4840.60, 5014.49, 5190.69, 5371.00, 5548.16, 5726.72, 5905.24, 6087.56,
+    6271.86, 6453.28, 0.00, 11.08, 45.22, 101.27, 178.15, 274.96, 389.00, 519.35,
+    663.52, 820.51, 988.14, 1165.12, 1349.28, 1539.78, 1734.57, 1932.71, 2132.83, 2335.43,
+    2540.09, 2742.52, 2943.58, 3138.53, 3325.50, 3503.81, 3682.84, 3853.02, 4026.15, 4197.36,
+    4373.22, 4546.02, 4721.83, 4897.99, 5079.23, 5258.48, 5439.02, 5622.18, 5804.55, 5989.89,
+    6176.91, 6364.09, 6551.23, 0.00, 11.08, 45.23, 101.31, 178.27, 275.23, 389.53,
+    520.27, 665.03, 822.76, 991.34, 1169.02, 1354.95, 1546.65, 1743.63, 1943.72, 2146.01,
+    2351.08, 2557.80, 2762.87, 2966.43, 3164.53, 3353.41, 3537.70, 3717.29, 3893.91, 4067.71,
+    4240.72, 4418.88, 4596.43, 4775.79, 4958.51, 5140.15, 5324.89, 5509.84, 5700.26, 5885.81,
+    6075.31, 6266.68, 6457.70, 6647.95, 0.00, 11.08, 45.24, 101.35, 178.38, 275.49,
+    390.06, 521.17, 666.52, 824.98, 994.50, 1173.36, 1360.55, 1553.89, 1752.60, 1954.62,
+    2159.07, 2366.54, 2575.89, 2783.53, 2990.31, 3189.75, 3381.31, 3569.40, 3749.86, 3929.09,
+    4107.29, 4286.45, 4465.96, 4647.34, 4832.99, 5017.54, 5202.70, 5395.19, 5583.21, 5774.76,
+    5966.62, 6162.98, 6357.46, 6554.93, 6751.43, 0.00, 11.08, 45.24, 101.39, 178.50,
+    275.74, 390.57, 522.07, 667.98, 827.17, 997.61, 1177.63, 1366.09, 1561.06, 1761.36,
+    1964.89, 2171.80, 2381.88, 2593.94, 2804.06, 3012.73, 3215.56, 3409.85, 3598.86, 3783.68,
+    3966.23, 4146.15, 4328.92, 4513.40, 4701.61, 4888.26, 5076.13, 5268.35, 5462.05, 5656.50,
+    5853.16, 6049.58, 6249.79, 6449.36, 6652.53, 6854.04, 0.00, 11.08, 45.25, 101.43,
+    178.61, 276.00, 391.08, 522.51, 669.43, 829.33, 1000.69, 1181.84, 1371.25, 1568.15,
+    1769.75, 1975.80, 2184.85, 2397.01, 2611.07, 2823.73, 3035.80, 3240.27, 3437.18, 3630.73,
+    3819.90, 4003.69, 4189.57, 4374.34, 4564.25, 4753.40, 4943.63, 5138.03, 5334.31, 5532.09,
+    5731.70, 5931.95, 6132.81, 6339.26, 6546.12, 6750.23, 6956.47, 0.00, 11.08, 45.26,
+    101.47, 178.73, 276.24, 391.58, 523.41, 670.85, 831.46, 1003.72, 1186.00, 1376.78,
+    1575.15, 1778.62, 1986.54, 2197.75, 2412.36, 2629.29, 2844.03, 3059.11, 3266.45, 3465.70,
+    3661.69, 3853.67, 4040.86, 4229.87, 4417.91, 4610.62, 4805.14, 5001.83, 5199.70, 5400.30,
+    5601.77, 5805.75, 6013.01, 6220.23, 6427.93, 6640.44, 6850.60, 7063.73, 0.00, 11.08,
+    45.27, 101.51, 178.84, 276.49, 392.07, 524.29, 672.25, 833.55, 1006.71, 1190.11,
+    1382.25, 1581.65, 1787.41, 1997.24, 2210.72, 2427.53, 2647.11, 2864.68, 3082.43, 3291.47,
+    3493.93, 3692.61, 3887.09, 4081.13, 4271.68, 4465.00, 4660.68, 4859.85, 5059.44, 5262.14,
+    5466.80, 5671.75, 5881.63, 6092.14, 6306.01, 6519.45, 6736.66, 6954.69, 7172.57, 0.00,
+    11.08, 45.28, 101.54, 178.94, 276.73, 392.56, 525.16, 673.63, 835.62, 1009.66,
+    1194.16, 1387.65, 1588.64, 1796.04, 2007.83, 2223.05, 2442.39, 2664.84, 2885.03, 3105.06,
+    3317.01, 3522.38, 3723.37, 3922.21, 4117.01, 4312.35, 4509.78, 4710.84, 4913.59, 5118.50,
+    5324.93, 5535.23, 5746.10, 5958.44, 6175.16, 6393.46, 6613.68, 6835.25, 7056.90, 7281.42,
+    0.00, 11.09, 45.28, 101.58, 179.05, 276.96, 393.03, 526.01, 674.98, 837.65,
+    1012.57, 1198.17, 1392.97, 1595.56, 1804.63, 2017.88, 2235.76, 2457.51, 2681.37, 2905.10,
+    3127.96, 3342.59, 3550.64, 3754.86, 3956.09, 4154.92, 4355.25, 4556.41, 4760.60, 4966.22,
+    5175.81, 5386.64, 5602.92, 5817.40, 6037.04, 6257.10, 6481.34, 6707.25, 6935.39, 7163.78,
+    7394.08, 0.00, 11.09, 45.29, 101.61, 179.15, 277.20, 393.50, 526.86, 676.32,
+    839.66, 1015.03, 1201.68, 1398.24, 1602.38, 1813.12, 2028.45, 2248.46, 2472.80, 2699.12,
+    2925.73, 3150.71, 3368.88, 3578.90, 3787.21, 3990.66, 4193.65, 4397.30, 4603.54, 4811.24,
+    5022.48, 5234.53, 5451.19, 5669.98, 5893.21, 6118.27, 6343.26, 6573.79, 6804.74, 7038.18,
+    7271.35, 7505.12, 0.00, 11.09, 45.30, 101.65, 179.26, 277.42, 393.96, 527.68,
+    677.64, 841.64, 1017.93, 1205.67, 1403.43, 1609.13, 1821.14, 2038.90, 2261.22, 2487.74,
+    2716.91, 2945.27, 3173.70, 3392.81, 3606.16, 3819.04, 4026.57, 4230.38, 4439.43, 4648.62,
+    4863.17, 5076.89, 5295.84, 5515.81, 5739.66, 5968.99, 6196.82, 6429.18, 6662.76, 6900.83,
+    7140.17, 7380.08, 7620.67, 0.00, 11.09, 45.31, 101.68, 179.36, 277.65, 394.41,
+    528.49, 678.93, 843.18, 1020.79, 1209.60, 1408.19, 1615.79, 1829.60, 2049.18, 2273.26,
+    2502.20, 2733.60, 2965.43, 3196.85, 3418.73, 3634.81, 3849.83, 4060.76, 4270.99, 4480.22,
+    4695.58, 4912.78, 5133.75, 5356.52, 5582.06, 5812.69, 6043.88, 6277.57, 6515.25, 6755.57,
+    7000.06, 7243.68, 7491.56, 7738.82, 0.00, 11.09, 45.31, 101.71, 179.45, 277.87,
+    394.86, 529.29, 680.20, 845.14, 1023.61, 1213.48, 1413.37, 1622.36, 1837.96, 2059.40,
+    2285.69, 2517.23, 2751.29, 2985.56, 3217.68, 3444.47, 3663.50, 3882.10, 4096.16, 4308.62,
+    4524.61, 4741.80, 4964.52, 5188.23, 5417.71, 5647.28, 5882.87, 6119.74, 6360.10, 6603.56,
+    6850.38, 7098.98, 7349.81, 7604.97, 7858.57, 0.00, 11.09, 45.32, 101.74, 179.55,
+    278.08, 395.29, 530.07, 681.46, 847.09, 1026.38, 1217.30, 1418.47, 1628.52, 1846.17,
+    2069.15, 2298.20, 2531.96, 2768.65, 3005.66, 3240.88, 3469.55, 3691.66, 3912.75, 4129.46,
+    4347.64, 4568.22, 4790.47, 5017.31, 5245.06, 5478.36, 5713.64, 5954.54, 6197.63, 6443.69,
+    6692.32, 6944.12, 7200.93, 7457.89, 7716.92, 7975.42, 0.00, 11.09, 45.33, 101.78,
+    179.65, 278.29, 395.72, 530.85, 682.69, 849.00, 1029.11, 1221.07, 1423.50, 1635.06,
+    1854.33, 2079.33, 2310.42, 2546.40, 2784.93, 3025.56, 3263.56, 3494.78, 3719.29, 3943.95,
+    4164.74, 4386.83, 4610.24, 4837.14, 5068.86, 5303.02, 5542.13, 5781.42, 6027.47, 6275.85,
+    6527.59, 6781.10, 7041.00, 7303.34, 7567.29, 7833.08, 8095.91, 0.00, 11.09, 45.33,
+    101.81, 179.74, 278.50, 396.14, 531.61, 683.90, 850.87, 1031.80, 1224.78, 1428.46,
+    1641.52, 1862.02, 2089.38, 2322.34, 2561.02, 2802.29, 3044.92, 3285.71, 3519.48, 3750.25,
+    3977.23, 4201.11, 4427.41, 4654.87, 4886.98, 5120.76, 5359.88, 5603.21, 5849.76, 6101.29,
+    6355.90, 6611.49, 6873.32, 7138.74, 7407.97, 7679.15, 7948.94, 8216.76, 0.00, 11.09,
+    45.34, 101.84, 179.83, 278.27, 396.55, 532.35, 685.09, 852.72, 1034.45, 1228.43,
+    1433.35, 1647.89, 1870.05, 2099.27, 2334.46, 2575.58, 2819.55, 3064.97, 3307.85, 3544.67,
+    3777.63, 4008.31, 4235.21, 4465.24, 4696.85, 4932.71, 5173.90, 5418.64, 5666.45, 5916.75,
+    6174.02, 6434.32, 6699.44, 6965.20, 7238.33, 7514.01, 7788.83, 8065.01, 8337.50, 0.00,
+    11.09, 45.35, 101.87, 179.92, 278.48, 396.96, 533.08, 686.26, 854.54, 1037.06,
+    1232.03, 1438.17, 1654.15, 1878.04, 2108.66, 2346.51, 2590.05, 2835.80, 3083.99, 3330.16,
+    3569.72, 3805.57, 4040.34, 4270.66, 4504.78, 4740.64, 4981.84, 5227.66, 5477.29, 5729.56,
+    5987.86, 6249.34, 6515.31, 6785.57, 7060.18, 7338.34, 7620.83, 7900.24, 8182.06, 8459.82,
+    0.00, 11.09, 45.35, 101.90, 180.01, 278.69, 397.36, 533.80, 687.00, 856.33,
+    1039.62, 1235.57, 1442.92, 1660.34, 1885.94, 2118.45, 2358.49, 2603.88, 2853.03, 3104.06,
+    3351.69, 3594.23, 3834.29, 4070.84, 4306.09, 4546.44, 4785.36, 5031.41, 5281.40, 5535.60,
+    5794.64, 6057.82, 6325.47, 6597.60, 6873.60, 7154.91, 7438.16, 7726.73, 8013.01, 8299.81,
+    8583.64, 0.00, 11.09, 45.36, 101.93, 180.09, 278.89, 397.75, 534.51, 688.17,
+    858.08, 1042.14, 1238.65, 1447.24, 1666.01, 1893.68, 2128.19, 2370.26, 2618.39, 2869.21,
+    3123.11, 3374.34, 3619.60, 3861.57, 4101.87, 4341.78, 4583.98, 4829.12, 5080.34, 5335.04,
+    5594.66, 5858.02, 6127.44, 6401.74, 6679.06, 6960.65, 7248.86, 7541.03, 7834.13, 8126.05,
+    8418.82, 8706.24, 0.00, 11.09, 45.36, 101.95, 180.18, 279.09, 398.13, 535.20,
+    689.32, 859.81, 1044.62, 1242.18, 1451.94, 1672.07, 1901.37, 2137.76, 2381.74, 2632.51,
+    2886.06, 3142.17, 3395.61, 3643.91, 3889.28, 4133.84, 4377.38, 4624.17, 4873.29, 5127.75,
+    5390.20, 5654.12, 5923.44, 6198.50, 6477.91, 6762.69, 7051.80, 7346.02, 7644.94, 7942.08,
+    8240.41, 8536.49, 8831.64, 0.00, 11.09, 45.37, 101.98, 180.26, 279.29, 398.51,
+    535.88, 690.44, 861.51, 1047.06, 1245.64, 1456.58, 1678.12, 1908.53, 2147.30, 2393.42,
+    2646.59, 2902.49, 3161.52, 3417.36, 3668.27, 3919.86, 4165.60, 4413.39, 4661.99, 4918.53,
+    5177.41, 5444.79, 5713.66, 5988.04, 6268.73, 6557.22, 6846.62, 7141.94, 7444.52, 7748.38,
+    8050.96, 8356.38, 8656.54, 8955.77, 0.00, 11.09, 45.38, 102.01, 180.34, 279.48,
+    398.88, 536.55, 691.55, 863.17, 1049.08, 1249.04, 1461.15, 1684.09, 1916.14, 2156.15,
+    2404.92, 2660.03, 2918.75, 3180.94, 3439.58, 3692.63, 3946.15, 4197.43, 4449.30, 4703.06,
+    4963.14, 5227.18, 5498.52, 5774.28, 6054.50, 6341.66, 6633.84, 6932.12, 7234.89, 7542.54,
+    7852.81, 8160.59, 8470.63, 8777.43, 9081.87, 0.00, 11.09, 45.38, 102.03, 180.42,
+    279.66, 399.24, 537.20, 692.63, 864.81, 1051.50, 1252.39, 1465.64, 1689.93, 1923.64,
+    2165.74, 2416.40, 2673.89, 2935.27, 3198.96, 3459.62, 3717.12, 3973.37, 4227.16, 4483.85,
+    4743.69, 5006.53, 5277.77, 5553.50, 5833.49, 6122.38, 6414.09, 6713.59, 7017.47, 7328.08,
+    7641.75, 7957.09, 8271.04, 8586.86, 8898.74, 9208.25, 0.00, 11.09, 45.39, 102.06,
+    180.50, 279.85, 399.59, 537.84, 693.70, 866.42, 1053.88, 1255.69, 1470.07, 1695.71,
+    1931.01, 2174.99, 2427.20, 2687.59, 2950.44, 3218.26, 3481.78, 3740.68, 4001.49, 4260.44,
+    4520.13, 4782.29, 5052.12, 5327.20, 5609.65, 5895.03, 6187.92, 6487.22, 6793.88, 7104.99,
+    7420.76, 7741.47, 8062.05, 8382.31, 8703.09, 9021.36, 9337.71, 0.00, 11.09, 45.39,
+    102.09, 180.57, 280.03, 399.94, 538.47, 694.74, 868.00, 1056.22, 1258.92, 1474.42,
+    1701.41, 1938.28, 2184.09, 2438.64, 2701.14, 2966.86, 3236.68, 3502.81, 3765.13, 4028.40,
+    4290.43, 4554.35, 4823.17, 5096.58, 5378.10, 5664.03, 5955.85, 6255.55, 6561.92, 6874.54,
+    7192.62, 7515.42, 7841.71, 8167.20, 8494.17, 8821.13, 9142.90, 9466.78, 0.00, 11.09,
+    45.40, 102.11, 180.65, 280.20, 400.28, 539.09, 695.77, 869.55, 1058.52, 1262.11,
+    1478.70, 1706.95, 1945.39, 2193.18, 2449.75, 2713.57, 2982.59, 3255.39, 3523.57, 3788.35,
+    4057.50, 4321.64, 4590.74, 4862.42, 5142.49, 5427.65, 5721.01, 6018.28, 6322.62, 6636.54,
+    6955.47, 7281.83, 7610.59, 7941.68, 8274.35, 8606.43, 8939.16, 9268.44, 9597.85, 0.00,
+    11.09, 45.40, 102.13, 180.72, 280.37, 400.62, 539.70, 696.78, 871.07, 1060.77,
+    1265.24, 1482.92, 1712.11, 1952.08, 2201.98, 2460.74, 2727.11, 2998.55, 3273.23, 3544.19,
+    3813.38, 4084.12, 4353.56, 4625.97, 4903.79, 5186.95, 5478.97, 5775.87, 6080.48, 6393.14,
+    6712.62, 7038.61, 7371.36, 7705.57, 8043.52, 8381.33, 8720.34, 9058.52, 9392.02, 9726.53,
+    0.00, 11.09, 45.41, 102.16, 180.79, 280.54, 400.95, 540.29, 697.77, 872.14,
+    1062.99, 1268.31, 1486.69, 1717.65, 1959.14, 2210.39, 2471.56, 2740.07, 3013.48, 3290.87,
+    3565.27, 3836.44, 4111.38, 4384.52, 4660.48, 4943.28, 5233.83, 5529.36, 5832.54, 6143.33,
+    6462.11, 6787.68, 7122.44, 7461.49, 7801.92, 8145.54, 8489.67, 8833.07, 9176.72, 9516.61,
+    9856.46, 0.00, 11.10, 45.41, 102.18, 180.86, 280.71, 400.83, 540.88, 698.74,
+    873.65, 1065.17, 1271.34, 1490.85, 1723.06, 1966.11, 2219.27, 2482.02, 2753.12, 3029.13,
+    3308.87, 3585.15, 3861.34, 4137.71, 4414.75, 4696.68, 4982.81, 5278.17, 5580.30, 5889.65,
+    6206.71, 6532.68, 6865.66, 7207.05, 7550.58, 7898.84, 8247.42, 8597.45, 8947.31, 9295.52,
+    9638.44, 9987.07, 0.00, 11.10, 45.42, 102.20, 180.93, 280.87, 401.16, 541.45,
+    699.68, 875.13, 1067.30, 1273.87, 1494.94, 1728.42, 1972.97, 2227.89, 2492.71, 2765.72,
+    3044.42, 3325.78, 3606.21, 3884.99, 4166.21, 4445.40, 4731.98, 5023.71, 5324.35, 5632.33,
+    5947.26, 6271.24, 6602.64, 6943.88, 7292.37, 7642.60, 7996.18, 8351.21, 8706.78, 9061.37,
+    9412.00, 9763.15, 10114.37, 0.00, 11.10, 45.42, 102.23, 181.00, 281.03, 401.48,
+    542.01, 700.62, 876.58, 1069.39, 1276.85, 1498.95, 1733.63, 1979.67, 2236.39, 2503.25,
+    2778.03, 3059.79, 3343.90, 3626.03, 3907.90, 4192.37, 4477.74, 4767.15, 5064.71, 5369.71,
+    5683.90, 6004.24, 6335.41, 6674.42, 7023.91, 7377.32, 7734.12, 8093.31, 8453.80, 8813.33,
+    9173.42, 9531.10, 9885.97, 10242.69, 0.00, 11.10, 45.43, 102.25, 181.06, 281.19,
+    401.80, 542.56, 701.53, 878.01, 1071.45, 1279.78, 1502.89, 1738.80, 1986.30, 2244.75,
+    2513.62, 2790.80, 3074.03, 3360.66, 3645.66, 3931.61, 4219.12, 4508.46, 4803.49, 5105.62,
+    5415.36, 5735.72, 6063.62, 6400.98, 6747.83, 7104.96, 7464.62, 7826.66, 8190.79, 8556.91,
+    8921.29, 9286.67, 9646.86, 10006.62, 10369.99, 0.00, 11.10, 45.43, 102.27, 181.13,
+    281.34, 402.11, 543.10, 702.42, 879.40, 1073.47, 1282.65, 1506.76, 1743.89, 1992.80,
+    2253.07, 2523.94, 2803.05, 3089.13, 3377.89, 3665.87, 3954.56, 4245.84, 4539.53, 4839.27,
+    5146.83, 5462.64, 5788.96, 6123.19, 6467.61, 6821.81, 7185.52, 7551.23, 7917.99, 8287.94,
+    8658.24, 9028.35, 9398.25, 9763.66, 10128.33, 10497.90, 0.00, 11.10, 45.44, 102.29,
+    181.19, 281.49, 402.41, 543.62, 703.30, 880.77, 1075.44, 1285.48, 1510.57, 1748.86,
+    1998.86, 2260.80, 2533.61, 2815.45, 3103.86, 3394.73, 3686.09, 3978.61, 4273.00, 4570.94,
+    4875.58, 5188.55, 5510.85, 5841.46, 6181.87, 6534.10, 6895.90, 7266.58, 7636.76, 8010.23,
+    8385.08, 8760.42, 9133.85, 9509.51, 9879.05, 10249.00, 10623.39, 0.00, 11.10, 45.44,
+    102.31, 181.25, 281.64, 402.70, 544.13, 704.16, 882.11, 1077.38, 1288.25, 1514.31,
+    1753.38, 2005.24, 2268.89, 2543.73, 2826.92, 3118.48, 3412.06, 3704.78, 4001.65, 4300.39,
+    4602.95, 4912.11, 5229.56, 5557.93, 5896.47, 6244.31, 6602.19, 6971.59, 7347.07, 7723.29,
+    8100.64, 8480.69, 8860.06, 9240.02, 9617.22, 9992.69, 10368.01, 10746.78, 0.00, 11.10,
+    45.45, 102.33, 181.31, 281.78, 403.00, 544.64, 705.00, 883.43, 1079.28, 1290.95,
+    1517.97, 1758.24, 2011.55, 2276.89, 2553.61, 2839.10, 3132.34, 3428.69, 3725.21, 4025.36,
+    4326.37, 4632.78, 4947.07, 5272.11, 5606.32, 5950.87, 6304.72, 6671.57, 7047.97, 7428.53,
+    7808.12, 8191.59, 8575.58, 8960.63, 9344.89, 9727.53, 10107.12, 10487.96, 10871.47, 0.00,
+    11.10, 45.45, 102.35, 181.37, 281.92, 403.28, 545.13, 705.83, 884.71, 1080.72,
+    1293.62, 1521.56, 1763.07, 2017.73, 2284.72, 2563.51, 2851.05, 3146.84, 3445.22, 3744.93,
+    4047.19, 4354.48, 4665.71, 4984.95, 5314.23, 5654.68, 6005.94, 6367.44, 6741.00, 7123.25,
+    7507.82, 7893.20, 8280.98, 8670.58, 9059.78, 9447.97, 9835.15, 10219.93, 10606.79, 10993.64,
+    0.00, 11.10, 45.45, 102.37, 181.43, 282.06, 403.55, 545.62, 706.63, 885.97,
+    1082.60, 1296.23, 1524.68, 1767.80, 2023.82, 2292.52, 2573.18, 2863.06, 3161.39, 3462.15,
+    3764.15, 4071.94, 4381.12, 4697.02, 5021.46, 5357.89, 5704.78, 6061.35, 6429.96, 6810.01,
+    7198.76, 7587.96, 7978.38, 8370.01, 8764.06, 9157.46, 9551.54, 9942.82, 10330.20, 10721.94,
+    11114.58, 0.00, 11.10, 45.46, 102.39, 181.48, 282.19, 403.83, 545.65, 707.42,
+    887.21, 1084.43, 1298.79, 1528.22, 1772.43, 2029.80, 2300.19, 2582.46, 2874.25, 3175.53,
+    3479.54, 3783.98, 4095.77, 4408.15, 4730.17, 5059.78, 5400.80, 5754.07, 6118.54, 6493.78,
+    6879.57, 7272.63, 7666.26, 8061.50, 8458.57, 8857.57, 9255.16, 9653.63, 10047.68, 10440.89,
+    10838.72, 11235.24, 0.00, 11.10, 45.46, 102.41, 181.54, 282.32, 404.09, 546.13,
+    708.19, 888.42, 1086.23, 1301.29, 1531.68, 1777.03, 2035.79, 2307.53, 2592.25, 2886.47,
+    3189.82, 3495.88, 3804.03, 4118.24, 4436.73, 4762.47, 5097.96, 5445.43, 5805.17, 6174.88,
+    6555.75, 6948.96, 7346.72, 7744.64, 8144.40, 8545.73, 8948.97, 9351.45, 9754.13, 10152.31,
+    10548.98, 10952.30, 11353.87, 0.00, 11.10, 45.46, 102.42, 181.59, 282.45, 404.35,
+    546.60, 708.95, 889.60, 1087.99, 1303.76, 1535.11, 1781.58, 2041.35, 2315.31, 2602.00,
+    2898.38, 3204.18, 3512.74, 3823.77, 4143.15, 4465.32, 4795.11, 5136.29, 5489.23, 5854.98,
+    6231.26, 6618.38, 7017.37, 7419.58, 7822.20, 8225.72, 8632.97, 9040.22, 9446.32, 9853.26,
+    10254.54, 10658.53, 11064.94, 11472.09, 0.00, 11.10, 45.47, 102.44, 181.65, 282.57,
+    404.60, 547.06, 709.68, 890.76, 1089.73, 1306.21, 1538.56, 1786.18, 2047.47, 2323.17,
+    2611.83, 2910.23, 3218.50, 3530.01, 3843.86, 4166.92, 4492.77, 4830.17, 5176.37, 5535.18,
+    5906.01, 6288.17, 6681.70, 7085.93, 7492.43, 7899.16, 8307.39, 8718.53, 9129.92, 9540.84,
+    9951.65, 10358.03, 10765.53, 11177.92, 11589.29, 0.00, 11.10, 45.47, 102.46, 181.70,
+    282.69, 404.85, 547.51, 710.41, 891.91, 1091.47, 1308.69, 1542.04, 1790.80, 2053.69,
+    2331.04, 2621.39, 2922.43, 3232.66, 3546.93, 3865.71, 4191.51, 4523.29, 4863.95, 5215.70,
+    5579.59, 5955.95, 6344.05, 6744.51, 7153.20, 7563.38, 7974.93, 8387.82, 8802.83, 9218.18,
+    9633.31, 10047.76, 10459.21, 10872.83, 11287.87, 11700.26, 0.00, 11.10, 45.48, 102.47,
+    181.75, 282.81, 405.10, 547.96, 711.15, 893.09, 1093.27, 1310.80, 1545.55, 1795.10,
+    2059.92, 2339.03, 2631.35, 2934.33, 3247.12, 3563.89, 3886.62, 4215.79, 4552.41, 4898.17,
+    5254.57, 5624.60, 6006.14, 6399.79, 6807.08, 7219.74, 7633.94, 8049.71, 8466.80, 8886.50,
+    9305.77, 9724.93, 10142.80, 10559.45, 10976.92, 11396.68, 11812.48, 0.00, 11.10, 45.48,
+    102.49, 181.80, 282.94, 405.36, 548.44, 711.93, 894.33, 1095.13, 1313.48, 1549.18,
+    1800.01, 2066.26, 2347.08, 2640.90, 2946.62, 3261.94, 3582.11, 3908.43, 4241.31, 4582.18,
+    4931.97, 5294.13, 5668.48, 6057.17, 6455.98, 6868.60, 7285.51, 7703.62, 8123.82, 8545.14,
+    8968.30, 9392.28, 9815.58, 10237.94, 10658.83, 11079.87, 11504.40, 11923.71, 0.00, 11.10,
+    45.48, 102.51, 181.86, 283.08, 405.63, 548.94, 712.75, 895.60, 1097.03, 1316.19,
+    1552.85, 1804.93, 2072.62, 2354.71, 2651.03, 2959.06, 3277.05, 3600.38, 3930.27, 4267.85,
+    4611.94, 4966.56, 5332.60, 5713.92, 6105.95, 6510.98, 6928.85, 7350.42, 7772.64, 8196.35,
+    8622.04, 9049.27, 9477.03, 9904.79, 10331.16, 10754.82, 11181.58, 11609.58, 12034.65, 0.00,
+    11.10, 45.49, 102.53, 181.91, 283.21, 405.91, 549.43, 713.11, 896.84, 1098.86,
+    1318.81, 1556.38, 1809.70, 2078.76, 2362.59, 2660.83, 2971.18, 3291.63, 3618.11, 3951.24,
+    4292.53, 4640.44, 4999.93, 5372.17, 5756.35, 6154.68, 6566.05, 6988.08, 7413.61, 7840.36,
+    8267.73, 8696.96, 9128.90, 9560.18, 9992.18, 10422.24, 10849.68, 11280.83, 11713.59, 12140.70,
+    0.00, 11.10, 45.49, 102.54, 181.96, 283.33, 406.17, 549.90, 713.90, 898.03,
+    1100.63, 1321.33, 1559.79, 1814.30, 2084.70, 2370.23, 2670.39, 2982.81, 3305.48, 3635.06,
+    3971.02, 4316.85, 4669.11, 5032.19, 5408.65, 5798.88, 6202.05, 6618.68, 7045.90, 7475.17,
+    7905.68, 8336.46, 8770.31, 9205.32, 9641.28, 10076.47, 10510.89, 10942.47, 11376.84, 11813.96,
+    12245.26, 0.00, 11.10, 45.50, 102.56, 182.02, 283.46, 406.42, 550.35, 714.65,
+    899.17, 1102.33, 1323.76, 1562.65, 1818.74, 2090.10, 2377.60, 2679.56, 2993.80, 3319.41,
+    3651.80, 3991.28, 4340.00, 4696.26, 5065.41, 5445.33, 5840.10, 6248.66, 6671.27, 7102.14,
+    7535.04, 7969.51, 8404.00, 8841.06, 9280.25, 9719.39, 10159.10, 10597.23, 11032.34, 11470.45,
+    11910.30, 12345.86, 0.00, 11.08, 45.17, 101.04, 177.90, 273.38, 385.85, 513.95,
+    655.27, 807.94, 970.22, 1140.27, 1317.09, 1498.81, 1683.73, 1870.99, 2060.07, 2250.12,
+    2441.11, 2629.37, 2816.39, 2997.76, 3171.14, 3337.56, 3502.69, 3662.54, 3819.33, 3977.16,
+    4135.05, 4293.46, 4455.34, 4614.90, 4774.57, 4937.03, 5099.84, 5263.35, 5426.68, 5591.97,
+    5756.59, 5922.13, 6087.09, 0.00, 11.08, 45.18, 101.08, 178.03, 273.68, 386.45,
+    514.98, 656.89, 810.36, 973.64, 1144.96, 1323.14, 1506.12, 1693.27, 1882.61, 2073.15,
+    2266.15, 2459.32, 2650.60, 2840.53, 3024.55, 3199.35, 3369.06, 3536.36, 3698.55, 3860.21,
+    4020.52, 4182.57, 4344.44, 4506.43, 4673.54, 4838.58, 5003.04, 5170.39, 5337.47, 5504.59,
+    5672.53, 5843.62, 6011.92, 6181.57, 0.00, 11.08, 45.19, 101.13, 178.15, 273.98,
+    387.03, 515.98, 658.48, 812.74, 977.04, 1149.57, 1328.70, 1513.83, 1702.77, 1894.06,
+    2086.90, 2281.53, 2477.86, 2671.61, 2863.53, 3050.11, 3228.49, 3400.44, 3570.12, 3735.05,
+    3900.20, 4065.27, 4228.45, 4393.40, 4562.81, 4729.44, 4899.72, 5069.04, 5239.83, 5410.42,
+    5581.74, 5754.71, 5931.55, 6105.69, 6279.13, 0.00, 11.08, 45.20, 101.17, 178.28,
+    274.27, 387.61, 516.98, 659.63, 814.71, 980.38, 1154.14, 1334.74, 1521.45, 1712.20,
+    1905.49, 2100.49, 2297.77, 2496.64, 2692.41, 2887.72, 3076.45, 3257.15, 3433.51, 3605.57,
+    3774.01, 3940.07, 4108.01, 4277.91, 4445.76, 4617.89, 4788.65, 4961.14, 5136.74, 5311.53,
+    5487.22, 5662.24, 5839.96, 6018.60, 6196.05, 6374.36, 0.00, 11.08, 45.21, 101.22,
+    177.96, 274.55, 388.18, 517.96, 661.23, 817.10, 983.29, 1158.66, 1340.72, 1529.01,
+    1721.52, 1916.81, 2114.31, 2313.76, 2514.70, 2713.78, 2911.22, 3102.85, 3285.88, 3464.73,
+    3639.63, 3811.36, 3982.13, 4150.92, 4324.11, 4498.31, 4672.20, 4849.18, 5025.56, 5202.33,
+    5382.29, 5561.19, 5741.34, 5926.73, 6108.00, 6290.41, 6473.70, 0.00, 11.08, 45.22,
+    101.26, 178.09, 274.83, 388.74, 518.92, 662.81, 819.46, 986.63, 1163.12, 1346.63,
+    1536.47, 1730.33, 1927.69, 2127.42, 2329.58, 2533.04, 2734.60, 2934.61, 3128.28, 3314.69,
+    3496.44, 3673.07, 3847.56, 4021.65, 4197.24, 4372.50, 4550.18, 4729.63, 4907.45, 5089.05,
+    5271.37, 5457.33, 5638.96, 5824.33, 6011.64, 6198.85, 6385.62, 6575.79, 0.00, 11.08,
+    45.22, 101.30, 178.21, 275.10, 389.29, 519.87, 664.37, 821.78, 989.94, 1167.11,
+    1352.49, 1543.48, 1739.67, 1939.02, 2140.87, 2345.37, 2551.57, 2755.21, 2958.59, 3154.10,
+    3343.23, 3527.29, 3710.84, 3887.38, 4065.15, 4241.97, 4421.31, 4603.91, 4786.07, 4967.91,
+    5156.20, 5340.43, 5530.05, 5717.21, 5908.14, 6099.78, 6290.99, 6483.82, 6676.39, 0.00,
+    11.08, 45.23, 101.34, 178.34, 275.38, 389.84, 520.80, 665.91, 824.07, 993.19,
+    1171.57, 1358.26, 1550.95, 1748.92, 1950.26, 2154.32, 2361.18, 2569.69, 2776.45, 2982.40,
+    3180.57, 3371.77, 3561.23, 3744.31, 3924.62, 4106.65, 4287.29, 4472.22, 4657.26, 4841.67,
+    5031.13, 5221.05, 5411.11, 5604.27, 5797.50, 5992.39, 6188.51, 6386.67, 6583.34, 6779.81,
+    0.00, 11.08, 45.24, 101.38, 178.45, 275.64, 390.37, 521.72, 667.42, 826.32,
+    996.40, 1175.97, 1363.96, 1558.33, 1758.01, 1961.33, 2167.73, 2376.96, 2588.34, 2797.38,
+    3006.22, 3207.64, 3401.14, 3591.63, 3779.71, 3961.87, 4146.95, 4332.14, 4520.64, 4709.29,
+    4900.47, 5093.32, 5286.01, 5483.31, 5679.72, 5876.27, 6077.59, 6278.38, 6480.40, 6682.48,
+    6886.81, 0.00, 11.08, 45.25, 101.42, 178.57, 275.90, 390.90, 522.19, 668.91,
+    828.55, 999.57, 1180.31, 1369.24, 1565.64, 1767.06, 1972.05, 2180.68, 2392.38, 2605.83,
+    2818.15, 3029.74, 3232.83, 3429.52, 3623.42, 3814.65, 4002.90, 4189.43, 4380.08, 4570.55,
+    4764.12, 4959.51, 5155.97, 5354.10, 5554.36, 5756.79, 5959.15, 6163.13, 6372.07, 6577.94,
+    6785.35, 6993.50, 0.00, 11.08, 45.26, 101.46, 178.69, 276.16, 391.41, 523.11,
+    670.37, 830.75, 1002.70, 1184.61, 1374.93, 1572.85, 1775.72, 1983.08, 2193.92, 2408.18,
+    2623.94, 2839.53, 3052.86, 3259.66, 3459.17, 3657.68, 3849.41, 4040.67, 4232.00, 4426.80,
+    4622.88, 4819.36, 5015.99, 5218.63, 5421.31, 5628.29, 5834.50, 6043.92, 6252.01, 6464.14,
+    6677.86, 6889.96, 7103.71, 0.00, 11.08, 45.27, 101.50, 178.80, 276.41, 391.92,
+    524.02, 671.82, 832.91, 1005.78, 1188.83, 1380.56, 1579.99, 1784.77, 1994.08, 2207.36,
+    2423.76, 2642.24, 2860.31, 3076.78, 3285.94, 3488.36, 3690.10, 3884.02, 4080.60, 4275.31,
+    4472.11, 4672.74, 4873.89, 5077.48, 5282.49, 5491.54, 5700.61, 5913.38, 6126.23, 6342.37,
+    6558.48, 6776.63, 6997.50, 7216.30, 0.00, 11.09, 45.28, 101.53, 178.91, 276.66,
+    392.42, 524.92, 673.24, 835.04, 1008.82, 1193.01, 1386.12, 1586.70, 1793.60, 2004.98,
+    2219.96, 2439.06, 2660.72, 2880.68, 3100.17, 3311.70, 3516.91, 3721.06, 3922.05, 4118.93,
+    4318.14, 4520.23, 4724.20, 4930.26, 5136.77, 5348.00, 5560.16, 5776.37, 5992.80, 6212.16,
+    6431.49, 6655.80, 6878.15, 7102.21, 7328.66, 0.00, 11.09, 45.28, 101.57, 179.02,
+    276.90, 392.91, 525.79, 674.64, 837.13, 1011.81, 1197.13, 1391.61, 1593.81, 1802.44,
+    2015.34, 2233.14, 2454.73, 2678.15, 2901.27, 3123.01, 3337.30, 3546.39, 3753.27, 3956.31,
+    4159.08, 4362.43, 4567.03, 4776.24, 4986.80, 5199.39, 5413.66, 5631.95, 5851.03, 6073.97,
+    6296.93, 6523.39, 6751.90, 6981.44, 7211.93, 7444.91, 0.00, 11.09, 45.29, 101.61,
+    179.13, 277.14, 393.39, 526.66, 676.01, 839.20, 1014.33, 1201.18, 1397.02, 1600.83,
+    1811.17, 2026.21, 2246.21, 2470.26, 2696.31, 2922.60, 3145.70, 3364.45, 3575.11, 3786.31,
+    3992.30, 4198.52, 4406.27, 4615.44, 4827.29, 5044.59, 5260.31, 5480.57, 5702.48, 5928.34,
+    6155.15, 6385.05, 6618.75, 6851.62, 7086.91, 7323.97, 7560.57, 0.00, 11.09, 45.30,
+    101.64, 179.23, 277.37, 393.86, 527.51, 677.36, 841.23, 1017.32, 1204.83, 1402.36,
+    1607.77, 1819.45, 2036.86, 2259.13, 2485.63, 2714.51, 2943.22, 3169.89, 3390.30, 3604.47,
+    3818.16, 4027.90, 4238.92, 4449.35, 4664.73, 4879.88, 5099.96, 5322.93, 5546.98, 5775.22,
+    6007.54, 6238.78, 6473.67, 6711.15, 6952.27, 7192.58, 7436.24, 7679.63, 0.00, 11.09,
+    45.31, 101.67, 179.34, 277.60, 394.33, 528.34, 678.69, 842.81, 1020.26, 1208.88,
+    1407.25, 1614.62, 1828.14, 2047.48, 2271.51, 2500.75, 2731.38, 2963.63, 3193.28, 3416.66,
+    3632.53, 3852.37, 4062.76, 4277.05, 4494.16, 4711.42, 4934.06, 5157.00, 5384.71, 5615.82,
+    5847.77, 6085.32, 6322.67, 6562.85, 6807.74, 7054.41, 7300.87, 7550.76, 7799.59, 0.00,
+    11.09, 45.31, 101.71, 179.44, 277.83, 394.78, 529.17, 680.00, 844.83, 1023.16,
+    1212.86, 1412.57, 1621.37, 1836.73, 2057.99, 2284.55, 2516.08, 2749.64, 2984.04, 3216.13,
+    3441.71, 3664.02, 3884.38, 4101.39, 4319.77, 4537.15, 4760.71, 4987.19, 5216.85, 5449.37,
+    5683.06, 5923.00, 6163.80, 6406.73, 6654.63, 6903.99, 7156.44, 7411.71, 7668.31, 7921.22,
+    0.00, 11.09, 45.32, 101.74, 179.54, 278.05, 395.23, 529.97, 681.29, 846.82,
+    1026.01, 1216.79, 1417.81, 1627.68, 1845.13, 2068.05, 2297.28, 2531.18, 2767.09, 3004.74,
+    3239.34, 3467.64, 3693.25, 3916.01, 4136.10, 4358.43, 4582.76, 4810.49, 5039.89, 5274.19,
+    5512.43, 5752.26, 5996.83, 6242.97, 6493.69, 6745.99, 7003.64, 7261.81, 7523.02, 7785.80,
+    8044.15, 0.00, 11.09, 45.33, 101.77, 179.63, 278.27, 395.67, 530.77, 682.55,
+    848.79, 1028.81, 1220.66, 1422.98, 1634.39, 1853.51, 2078.50, 2309.80, 2545.85, 2784.56,
+    3024.68, 3261.86, 3494.41, 3721.67, 3948.61, 4173.20, 4398.72, 4627.30, 4858.37, 5094.54,
+    5333.27, 5576.38, 5821.76, 6072.08, 6325.44, 6580.43, 6840.50, 7101.67, 7368.59, 7634.99,
+    7904.68, 8170.19, 0.00, 11.09, 45.33, 101.81, 179.73, 278.48, 396.10, 531.55,
+    683.80, 850.72, 1031.57, 1224.46, 1428.07, 1641.02, 1861.37, 2088.74, 2321.93, 2560.96,
+    2802.56, 3045.52, 3284.79, 3519.65, 3751.12, 3981.14, 4208.59, 4438.36, 4671.47, 4907.76,
+    5148.92, 5393.28, 5640.75, 5891.79, 6147.94, 6406.49, 6669.11, 6933.94, 7203.96, 7475.74,
+    7750.15, 8023.78, 8293.60, 0.00, 11.09, 45.34, 101.84, 179.82, 278.25, 396.53,
+    532.31, 685.02, 852.61, 1034.29, 1228.21, 1433.09, 1647.48, 1869.70, 2098.94, 2334.42,
+    2576.03, 2819.47, 3065.30, 3308.39, 3545.81, 3780.61, 4014.80, 4246.76, 4480.95, 4717.07,
+    4958.36, 5204.57, 5453.40, 5706.65, 5964.35, 6224.00, 6488.33, 6756.86, 7029.42, 7305.98,
+    7585.74, 7864.68, 8143.78, 8418.21, 0.00, 11.09, 45.35, 101.87, 179.92, 278.47,
+    396.94, 533.06, 686.22, 854.48, 1036.96, 1231.92, 1438.04, 1653.93, 1877.90, 2108.61,
+    2346.91, 2590.81, 2836.60, 3085.32, 3330.17, 3570.95, 3808.55, 4047.28, 4281.87, 4521.21,
+    4762.75, 5009.02, 5259.30, 5513.41, 5772.26, 6034.69, 6302.35, 6572.81, 6847.42, 7127.18,
+    7410.68, 7696.11, 7981.47, 8263.92, 8545.28, 0.00, 11.09, 45.35, 101.90, 180.00,
+    278.68, 397.35, 533.80, 686.99, 856.31, 1039.59, 1235.55, 1442.90, 1660.28, 1885.93,
+    2118.73, 2359.14, 2605.16, 2853.83, 3105.32, 3353.48, 3596.18, 3839.93, 4078.08, 4318.95,
+    4560.83, 4806.87, 5059.66, 5315.11, 5574.64, 5838.51, 6107.20, 6380.87, 6657.76, 6938.14,
+    7224.84, 7515.95, 7807.09, 8098.47, 8386.98, 8673.74, 0.00, 11.09, 45.36, 101.93,
+    180.09, 278.89, 397.75, 534.52, 688.19, 858.11, 1042.18, 1238.72, 1447.35, 1666.08,
+    1893.91, 2128.72, 2371.19, 2619.62, 2871.29, 3125.60, 3375.95, 3622.00, 3867.20, 4111.25,
+    4354.79, 4603.20, 4853.98, 5109.47, 5370.92, 5635.17, 5904.52, 6179.31, 6460.60, 6744.04,
+    7031.43, 7325.18, 7622.82, 7919.33, 8216.14, 8509.48, 8802.80, 0.00, 11.09, 45.37,
+    101.96, 180.18, 279.10, 398.15, 535.23, 689.37, 859.88, 1044.73, 1242.32, 1452.17,
+    1672.37, 1901.75, 2138.67, 2382.95, 2634.30, 2888.41, 3144.70, 3398.14, 3647.62, 3897.55,
+    4143.44, 4392.82, 4643.98, 4899.43, 5159.87, 5427.14, 5697.16, 5971.90, 6253.47, 6539.65,
+    6829.11, 7125.75, 7426.71, 7729.80, 8032.53, 8334.32, 8633.67, 8930.93, 0.00, 11.09,
+    45.37, 101.98, 180.26, 279.29, 398.53, 535.93, 690.52, 861.62, 1046.78, 1245.87,
+    1456.92, 1678.57, 1909.19, 2148.39, 2394.87, 2648.62, 2904.60, 3164.42, 3420.48, 3671.74,
+    3925.33, 4176.89, 4429.31, 4684.08, 4945.89, 5211.50, 5482.60, 5758.91, 6041.67, 6327.69,
+    6619.65, 6917.68, 7219.69, 7529.12, 7837.73, 8145.07, 8453.44, 8758.96, 9063.03, 0.00,
+    11.09, 45.38, 102.01, 180.35, 279.49, 398.91, 536.61, 691.65, 863.33, 1049.31,
+    1249.36, 1461.60, 1684.62, 1916.99, 2157.62, 2406.86, 2662.00, 2921.78, 3184.04, 3442.60,
+    3697.62, 3955.16, 4208.25, 4464.98, 4725.99, 4992.06, 5262.60, 5540.30, 5821.01, 6109.36,
+    6402.59, 6702.41, 7006.05, 7317.44, 7631.63, 7945.75, 8259.85, 8574.63, 8884.51, 9195.61,
+    0.00, 11.09, 45.38, 102.04, 180.43, 279.68, 399.28, 537.28, 692.76, 865.00,
+    1051.78, 1252.79, 1466.20, 1690.64, 1924.61, 2167.24, 2418.50, 2676.17, 2938.29, 3203.26,
+    3464.80, 3722.61, 3983.59, 4241.36, 4502.43, 4767.47, 5037.29, 5314.98, 5596.29, 5885.70,
+    6178.22, 6479.24, 6783.71, 7096.55, 7414.75, 7735.25, 8054.64, 8375.38, 8696.02, 9012.16,
+    9329.18, 0.00, 11.09, 45.39, 102.06, 180.51, 279.87, 399.64, 537.94, 693.85,
+    866.65, 1054.21, 1256.16, 1470.73, 1696.56, 1932.18, 2176.66, 2429.76, 2690.34, 2954.59,
+    3221.47, 3486.06, 3747.75, 4011.55, 4274.32, 4539.61, 4808.08, 5083.88, 5365.67, 5654.68,
+    5948.44, 6248.12, 6556.30, 6868.99, 7188.56, 7513.46, 7839.63, 8165.03, 8492.03, 8816.67,
+    9139.29, 9461.07, 0.00, 11.09, 45.39, 102.09, 180.58, 280.05, 400.00, 538.58,
+    694.92, 868.26, 1056.61, 1259.47, 1475.18, 1702.35, 1939.59, 2186.15, 2441.25, 2703.93,
+    2970.72, 3240.96, 3508.08, 3773.99, 4039.76, 4305.92, 4575.36, 4850.43, 5130.23, 5418.62,
+    5712.31, 6012.78, 6320.02, 6634.48, 6954.95, 7281.97, 7612.13, 7944.33, 8276.58, 8609.10,
+    8939.03, 9266.98, 9595.76, 0.00, 11.09, 45.40, 102.12, 180.66, 280.23, 400.35,
+    539.21, 695.97, 869.85, 1058.96, 1262.73, 1479.56, 1708.08, 1946.93, 2195.33, 2452.75,
+    2717.36, 2987.26, 3259.06, 3529.40, 3798.40, 4067.52, 4338.10, 4613.08, 4891.39, 5177.93,
+    5471.17, 5771.20, 6077.41, 6391.09, 6712.32, 7040.46, 7374.43, 7711.58, 8050.17, 8387.42,
+    8726.83, 9060.78, 9394.01, 9728.62, 0.00, 11.09, 45.40, 102.14, 180.74, 280.41,
+    400.69, 539.83, 697.00, 871.40, 1061.26, 1265.92, 1483.43, 1713.39, 1953.75, 2204.02,
+    2463.98, 2730.67, 3003.25, 3277.85, 3551.04, 3822.87, 4097.02, 4369.85, 4649.65, 4934.79,
+    5225.47, 5524.75, 5829.33, 6143.86, 6464.70, 6793.04, 7128.92, 7469.54, 7812.12, 8156.65,
+    8500.16, 8842.49, 9182.64, 9521.19, 9860.45, 0.00, 11.09, 45.41, 102.17, 180.81,
+    280.58, 401.02, 540.44, 698.01, 872.51, 1063.52, 1269.06, 1487.75, 1719.00, 1960.99,
+    2213.05, 2475.06, 2744.19, 3019.00, 3296.71, 3571.82, 3847.19, 4124.32, 4403.73, 4685.88,
+    4976.50, 5273.50, 5578.10, 5890.63, 6210.02, 6537.32, 6873.53, 7217.63, 7564.63, 7913.47,
+    8263.40, 8610.79, 8958.77, 9303.40, 9647.73, 9993.21, 0.00, 11.10, 45.41, 102.19,
+    180.88, 280.75, 400.92, 541.03, 699.00, 874.05, 1065.74, 1272.15, 1492.00, 1724.55,
+    1968.11, 2222.00, 2485.70, 2757.31, 3034.66, 3314.47, 3593.19, 3871.70, 4152.82, 4435.87,
+    4723.50, 5018.80, 5321.61, 5632.19, 5950.85, 6276.55, 6612.48, 6957.44, 7307.47, 7658.82,
+    8013.82, 8368.46, 8721.77, 9075.37, 9425.04, 9772.75, 10125.64, 0.00, 11.10, 45.42,
+    102.21, 180.95, 280.92, 401.26, 541.62, 699.96, 875.56, 1067.92, 1274.76, 1496.16,
+    1730.00, 1975.09, 2230.91, 2496.72, 2770.13, 3050.47, 3332.82, 3614.03, 3897.85, 4182.33,
+    4468.00, 4761.49, 5061.07, 5370.23, 5687.49, 6011.18, 6345.30, 6689.19, 7040.63, 7397.51,
+    7755.92, 8115.02, 8474.53, 8832.95, 9191.29, 9544.96, 9899.34, 10256.08, 0.00, 11.10,
+    45.43, 102.23, 181.02, 281.08, 401.59, 542.19, 700.91, 877.04, 1070.06, 1277.80,
+    1500.26, 1735.37, 1981.98, 2239.53, 2507.47, 2782.96, 3065.46, 3350.63, 3635.27, 3921.26,
+    4209.32, 4501.40, 4799.20, 5103.57, 5418.43, 5742.01, 6073.70, 6415.35, 6765.84, 7125.36,
+    7486.91, 7850.23, 8213.75, 8578.83, 8941.90, 9304.26, 9664.39, 10023.88, 10386.43, 0.00,
+    11.10, 45.43, 102.26, 181.09, 281.24, 401.91, 542.74, 701.84, 878.49, 1072.15,
+    1280.79, 1504.28, 1740.64, 1988.70, 2248.11, 2518.07, 2795.99, 3080.82, 3368.84, 3655.58,
+    3946.38, 4238.39, 4534.58, 4836.93, 5147.99, 5468.60, 5798.67, 6136.75, 6485.63, 6843.90,
+    7209.35, 7576.44, 7944.10, 8313.43, 8683.71, 9051.95, 9418.84, 9782.62, 10148.75, 10516.17,
+    0.00, 11.10, 45.43, 102.28, 181.15, 281.39, 402.22, 543.29, 702.75, 879.91,
+    1074.20, 1283.72, 1508.22, 1745.78, 1994.93, 2256.09, 2528.09, 2808.67, 3096.47, 3386.29,
+    3676.65, 3970.82, 4265.81, 4566.54, 4874.73, 5191.61, 5518.88, 5854.88, 6200.68, 6555.73,
+    6922.30, 7293.52, 7664.58, 8038.28, 8413.17, 8786.57, 9160.81, 9532.29, 9900.62, 10271.63,
+    10644.20, 0.00, 11.10, 45.44, 102.30, 181.21, 281.55, 402.53, 543.83, 703.64,
+    881.30, 1076.22, 1286.59, 1512.10, 1750.86, 2001.57, 2264.64, 2538.75, 2821.23, 3111.78,
+    3404.48, 3698.04, 3995.91, 4295.84, 4601.01, 4914.09, 5236.97, 5569.71, 5912.92, 6265.17,
+    6627.57, 7000.83, 7376.27, 7753.33, 8131.78, 8510.51, 8889.76, 9268.38, 9644.95, 10018.60,
+    10395.04, 10771.32, 0.00, 11.10, 45.44, 102.32, 181.28, 281.70, 402.83, 544.35,
+    704.52, 882.67, 1078.19, 1289.41, 1515.89, 1755.50, 2008.16, 2272.97, 2549.22, 2833.79,
+    3126.99, 3422.55, 3718.33, 4020.39, 4324.92, 4634.44, 4953.45, 5282.21, 5622.17, 5970.98,
+    6330.66, 6698.98, 7078.37, 7459.12, 7841.19, 8223.68, 8608.20, 8992.11, 9375.46, 9755.46,
+    10133.88, 10516.66, 10898.36, 0.00, 11.10, 45.45, 102.34, 181.34, 281.84, 403.12,
+    544.86, 705.37, 884.00, 1080.12, 1292.17, 1519.62, 1760.54, 2014.67, 2281.37, 2559.73,
+    2846.78, 3142.36, 3440.05, 3739.59, 4045.58, 4353.15, 4669.88, 4993.83, 5328.42, 5673.60,
+    6029.83, 6395.09, 6771.81, 7156.72, 7541.25, 7927.76, 8316.25, 8705.26, 9093.15, 9482.15,
+    9866.35, 10249.42, 10637.01, 11024.43, 0.00, 11.10, 45.45, 102.36, 181.40, 281.98,
+    403.41, 545.36, 706.21, 885.31, 1081.62, 1294.88, 1522.88, 1765.54, 2021.23, 2289.70,
+    2570.12, 2859.67, 3157.74, 3458.40, 3761.62, 4070.39, 4383.73, 4703.79, 5033.74, 5374.91,
+    5727.09, 6088.63, 6459.87, 6842.87, 7233.19, 7623.15, 8014.26, 8407.20, 8801.11, 9194.33,
+    9586.76, 9975.24, 10363.08, 10755.78, 11147.36, 0.00, 11.10, 45.46, 102.38, 181.46,
+    282.12, 403.69, 545.85, 707.02, 886.59, 1083.53, 1297.58, 1526.67, 1770.58, 2027.79,
+    2298.18, 2580.33, 2872.28, 3173.53, 3476.85, 3782.61, 4096.62, 4413.70, 4739.93, 5075.37,
+    5421.92, 5779.12, 6147.13, 6525.02, 6915.25, 7310.06, 7704.26, 8100.10, 8497.74, 8895.83,
+    9292.66, 9690.45, 10082.99, 10476.98, 10875.50, 11272.42, 0.00, 11.10, 45.46, 102.40,
+    181.51, 282.26, 403.97, 545.91, 707.83, 887.87, 1085.46, 1300.31, 1530.49, 1775.68,
+    2034.50, 2306.26, 2590.74, 2885.21, 3188.10, 3495.42, 3805.81, 4122.80, 4444.64, 4775.20,
+    5115.92, 5468.26, 5831.44, 6205.16, 6590.30, 6986.28, 7384.85, 7784.06, 8184.68, 8587.02,
+    8989.45, 9391.35, 9792.29, 10190.12, 10589.70, 10992.81, 11390.63, 0.00, 11.10, 45.46,
+    102.41, 181.57, 282.38, 404.24, 546.40, 708.64, 889.17, 1087.44, 1303.11, 1534.36,
+    1780.84, 2040.79, 2314.97, 2601.64, 2898.50, 3204.13, 3513.55, 3828.16, 4149.23, 4475.43,
+    4811.06, 5158.29, 5515.83, 5884.81, 6264.16, 6655.76, 7057.11, 7459.50, 7863.24, 8268.57,
+    8675.14, 9082.17, 9488.75, 9893.54, 10296.58, 10701.96, 11108.69, 11509.97, 0.00, 11.10,
+    45.47, 102.44, 181.62, 282.53, 404.52, 546.93, 709.51, 890.54, 1089.49, 1306.00,
+    1538.36, 1786.12, 2047.74, 2323.78, 2612.42, 2911.92, 3220.04, 3533.06, 3851.28, 4176.33,
+    4507.86, 4848.53, 5199.27, 5562.45, 5936.66, 6321.95, 6719.79, 7126.15, 7533.56, 7941.48,
+    8351.12, 8762.84, 9173.85, 9585.17, 9994.05, 10402.13, 10811.86, 11223.05, 11629.68, 0.00,
+    11.10, 45.47, 102.46, 181.69, 282.68, 404.84, 547.50, 710.42, 891.95, 1091.60,
+    1308.92, 1542.40, 1791.43, 2054.69, 2332.57, 2623.31, 2925.27, 3236.27, 3552.55, 3874.54,
+    4202.75, 4539.35, 4884.12, 5240.13, 5608.54, 5988.22, 6379.82, 6783.75, 7195.18, 7606.68,
+    8018.93, 8433.28, 8848.63, 9264.57, 9680.15, 10093.47, 10506.10, 10920.29, 11334.73, 11745.71,
+    0.00, 11.10, 45.48, 102.47, 181.75, 282.83, 405.14, 548.04, 711.29, 893.32,
+    1093.62, 1311.33, 1546.29, 1796.19, 2061.44, 2341.07, 2633.46, 2937.92, 3251.75, 3570.95,
+    3897.06, 4229.15, 4569.55, 4919.30, 5280.35, 5653.50, 6040.08, 6437.06, 6847.12, 7262.18,
+    7678.12, 8094.96, 8513.09, 8933.22, 9352.66, 9772.44, 10190.48, 10607.31, 11024.90, 11444.44,
+    11860.31, 0.00, 11.10, 45.48, 102.50, 181.81, 282.97, 405.43, 548.56, 712.13,
+    894.63, 1095.58, 1314.12, 1550.06, 1801.25, 2067.96, 2349.30, 2643.82, 2950.50, 3267.20,
+    3589.62, 3918.83, 4255.81, 4599.74, 4953.81, 5319.68, 5699.17, 6089.54, 6493.22, 6908.32,
+    7327.83, 7747.55, 8168.43, 8590.85, 9014.95, 9438.75, 9862.56, 10285.32, 10706.34, 11127.66,
+    11551.73, 11971.52, 0.00, 11.10, 45.48, 102.51, 181.87, 283.11, 405.70, 549.07,
+    712.94, 895.90, 1097.46, 1316.81, 1553.70, 1806.14, 2074.26, 2356.90, 2653.86, 2962.83,
+    3282.03, 3607.69, 3940.41, 4281.14, 4628.51, 4987.59, 5358.93, 5741.93, 6138.73, 6547.51,
+    6968.34, 7391.44, 7815.30, 8240.38, 8666.81, 9094.51, 9522.76, 9950.47, 10377.24, 10800.91,
+    11228.24, 11655.77, 12080.93, 0.00, 11.07, 45.13, 100.84, 177.36, 272.09, 383.27,
+    509.55, 648.32, 797.62, 955.60, 1121.06, 1291.46, 1466.59, 1644.45, 1824.00, 2003.94,
+    2184.39, 2365.97, 2544.32, 2721.76, 2892.72, 3056.84, 3213.62, 3370.08, 3518.00, 3667.95,
+    3814.77, 3962.65, 4111.08, 4263.57, 4412.65, 4561.35, 4711.04, 4862.28, 5010.06, 5161.46,
+    5313.05, 5464.98, 5616.20, 5764.85, 0.00, 11.08, 45.14, 100.89, 177.50, 272.42,
+    383.92, 510.66, 650.08, 800.22, 959.28, 1125.94, 1297.90, 1474.67, 1654.34, 1835.57,
+    2018.00, 2201.21, 2384.84, 2565.62, 2744.84, 2919.26, 3084.23, 3244.11, 3403.94, 3555.92,
+    3706.79, 3857.16, 4011.10, 4161.97, 4315.03, 4467.78, 4620.82, 4774.67, 4928.66, 5082.46,
+    5236.77, 5391.81, 5548.32, 5703.65, 5855.32, 0.00, 11.08, 45.15, 100.94, 177.63,
+    272.74, 384.56, 511.76, 651.81, 802.80, 962.92, 1130.77, 1304.28, 1482.70, 1664.23,
+    1847.52, 2031.58, 2217.58, 2403.55, 2587.26, 2769.12, 2944.76, 3113.89, 3276.06, 3437.35,
+    3592.80, 3746.74, 3902.07, 4056.85, 4211.80, 4368.28, 4524.85, 4681.68, 4838.68, 4996.47,
+    5154.11, 5312.47, 5472.32, 5630.46, 5789.37, 5947.81, 0.00, 11.08, 45.16, 100.99,
+    177.77, 273.05, 385.20, 512.84, 653.51, 805.33, 966.52, 1135.22, 1310.60, 1490.64,
+    1674.01, 1859.31, 2045.71, 2233.56, 2422.50, 2608.91, 2793.25, 2971.62, 3142.78, 3310.81,
+    3471.24, 3629.98, 3788.06, 3946.05, 4104.13, 4263.16, 4420.76, 4580.57, 4743.76, 4905.13,
+    5066.60, 5228.97, 5390.46, 5553.74, 5716.50, 5880.16, 6042.77, 0.00, 11.08, 45.17,
+    101.04, 177.90, 273.37, 385.82, 513.91, 655.20, 807.83, 970.07, 1140.06, 1316.84,
+    1498.51, 1683.35, 1870.62, 2060.00, 2250.11, 2441.46, 2630.00, 2817.35, 2998.45, 3172.49,
+    3341.55, 3506.59, 3667.75, 3829.52, 3990.55, 4151.20, 4315.30, 4477.93, 4640.63, 4804.29,
+    4971.13, 5135.73, 5301.92, 5468.26, 5635.53, 5803.38, 5970.15, 6136.92, 0.00, 11.08,
+    45.18, 101.09, 178.03, 273.67, 386.43, 514.95, 656.85, 810.30, 973.57, 1144.85,
+    1323.02, 1506.00, 1693.05, 1882.50, 2073.47, 2266.52, 2460.08, 2651.68, 2841.82, 3025.20,
+    3201.19, 3373.40, 3541.60, 3706.44, 3871.52, 4034.14, 4201.15, 4365.81, 4531.71, 4700.14,
+    4867.69, 5037.09, 5208.53, 5378.05, 5548.99, 5720.35, 5891.88, 6061.69, 6234.93, 0.00,
+    11.08, 45.19, 101.13, 178.16, 273.97, 387.03, 515.99, 658.49, 812.74, 977.03,
+    1149.58, 1328.71, 1513.89, 1702.78, 1894.19, 2087.54, 2282.37, 2479.02, 2673.05, 2865.09,
+    3051.32, 3230.93, 3405.33, 3575.69, 3744.68, 3912.10, 4080.97, 4248.51, 4419.61, 4587.97,
+    4761.96, 4932.80, 5106.25, 5280.40, 5454.20, 5628.44, 5803.95, 5980.56, 6156.05, 6332.61,
+    0.00, 11.08, 45.20, 101.18, 178.28, 274.27, 387.62, 517.00, 659.67, 814.77,
+    980.45, 1154.25, 1334.89, 1521.68, 1712.41, 1905.88, 2101.39, 2299.11, 2498.08, 2694.04,
+    2889.82, 3077.97, 3260.28, 3438.89, 3613.30, 3784.20, 3953.04, 4125.58, 4298.60, 4470.75,
+    4646.15, 4821.17, 4997.59, 5173.96, 5352.70, 5533.38, 5711.36, 5891.30, 6072.36, 6252.98,
+    6433.91, 0.00, 11.08, 45.21, 101.22, 177.97, 274.56, 388.20, 518.00, 661.31,
+    817.21, 983.44, 1158.86, 1341.01, 1529.39, 1721.96, 1917.46, 2115.36, 2315.37, 2516.68,
+    2715.96, 2913.96, 3105.09, 3288.86, 3470.65, 3648.28, 3821.66, 3997.22, 4171.49, 4346.85,
+    4524.93, 4703.39, 4881.39, 5064.85, 5245.29, 5426.00, 5610.71, 5793.96, 5979.22, 6165.78,
+    6350.69, 6536.78, 0.00, 11.08, 45.22, 101.26, 178.10, 274.84, 388.78, 518.99,
+    662.92, 819.62, 986.85, 1163.42, 1347.06, 1537.03, 1731.05, 1928.67, 2128.77, 2331.61,
+    2534.85, 2737.31, 2938.30, 3132.14, 3318.76, 3502.53, 3682.92, 3860.20, 4038.96, 4217.19,
+    4397.81, 4579.22, 4760.34, 4945.94, 5128.36, 5315.71, 5501.63, 5690.82, 5878.85, 6069.35,
+    6259.37, 6448.93, 6641.96, 0.00, 11.08, 45.23, 101.31, 178.23, 275.12, 389.34,
+    519.96, 664.51, 822.00, 990.24, 1167.52, 1353.03, 1544.22, 1740.60, 1940.25, 2142.63,
+    2347.62, 2553.88, 2758.83, 2962.58, 3158.74, 3348.17, 3534.94, 3719.90, 3901.01, 4081.53,
+    4264.83, 4447.30, 4632.12, 4820.75, 5008.10, 5195.87, 5387.99, 5578.69, 5771.42, 5963.64,
+    6160.23, 6355.33, 6551.34, 6745.58, 0.00, 11.08, 45.24, 101.35, 178.35, 275.40,
+    389.89, 520.91, 666.08, 824.34, 993.56, 1172.07, 1358.93, 1551.86, 1750.04, 1951.73,
+    2156.61, 2363.90, 2572.49, 2780.46, 2986.20, 3185.48, 3377.83, 3569.46, 3754.89, 3940.67,
+    4124.24, 4311.01, 4497.94, 4689.11, 4879.71, 5070.36, 5265.28, 5460.44, 5654.71, 5854.11,
+    6052.85, 6251.99, 6454.97, 6653.55, 6855.16, 0.00, 11.08, 45.24, 101.39, 178.47,
+    275.67, 390.44, 521.85, 667.62, 826.64, 996.84, 1176.57, 1364.76, 1559.39, 1759.29,
+    1963.01, 2169.70, 2379.95, 2591.48, 2802.05, 3010.88, 3212.53, 3407.68, 3602.26, 3790.12,
+    3980.30, 4169.57, 4358.36, 4551.87, 4745.17, 4938.25, 5135.58, 5334.47, 5534.88, 5736.01,
+    5936.19, 6141.81, 6345.91, 6552.02, 6759.33, 6965.47, 0.00, 11.08, 45.25, 101.43,
+    178.59, 275.94, 390.98, 522.34, 669.15, 828.91, 1000.07, 1181.00, 1370.18, 1566.85,
+    1768.10, 1974.02, 2183.44, 2395.94, 2609.37, 2823.00, 3034.41, 3238.83, 3437.48, 3634.82,
+    3828.55, 4019.18, 4211.83, 4404.82, 4602.06, 4799.68, 4999.49, 5200.48, 5404.27, 5608.80,
+    5815.71, 6021.43, 6230.93, 6442.19, 6651.13, 6863.60, 7077.33, 0.00, 11.08, 45.26,
+    101.47, 178.71, 276.20, 391.50, 523.28, 670.64, 831.15, 1003.26, 1185.38, 1375.99,
+    1574.21, 1777.43, 1985.33, 2197.01, 2412.04, 2628.52, 2844.22, 3058.33, 3266.40, 3466.74,
+    3667.85, 3863.68, 4058.15, 4256.28, 4454.57, 4654.67, 4857.04, 5060.26, 5266.44, 5473.83,
+    5684.61, 5895.21, 6108.27, 6321.23, 6537.98, 6755.14, 6972.28, 7186.78, 0.00, 11.08,
+    45.27, 101.51, 178.82, 276.46, 392.02, 524.21, 672.11, 833.35, 1006.41, 1189.70,
+    1381.73, 1581.50, 1786.61, 1996.56, 2210.61, 2428.16, 2647.28, 2865.82, 3082.95, 3292.79,
+    3496.89, 3701.19, 3901.22, 4100.10, 4299.88, 4502.94, 4707.73, 4913.73, 5123.09, 5332.54,
+    5545.87, 5760.86, 5977.81, 6194.30, 6415.76, 6636.70, 6858.14, 7081.58, 7303.41, 0.00,
+    11.09, 45.28, 101.54, 178.94, 276.71, 392.53, 525.12, 673.56, 835.52, 1009.50,
+    1193.95, 1387.40, 1588.39, 1795.73, 2007.69, 2223.52, 2443.61, 2664.79, 2887.39, 3106.40,
+    3319.90, 3526.42, 3733.67, 3937.00, 4140.02, 4344.80, 4550.88, 4760.68, 4972.74, 5184.78,
+    5400.42, 5617.95, 5838.81, 6059.22, 6282.67, 6508.42, 6735.78, 6963.87, 7194.43, 7422.11,
+    0.00, 11.09, 45.29, 101.58, 179.05, 276.96, 393.03, 526.01, 674.98, 837.65,
+    1012.55, 1198.15, 1392.99, 1595.65, 1804.75, 2018.29, 2237.18, 2459.80, 2683.59, 2908.53,
+    3130.54, 3346.64, 3558.45, 3767.99, 3973.51, 4181.68, 4389.46, 4601.16, 4813.21, 5030.79,
+    5248.14, 5468.23, 5692.13, 5915.60, 6143.17, 6373.68, 6604.67, 6837.75, 7071.47, 7307.20,
+    7541.92, 0.00, 11.09, 45.29, 101.62, 179.16, 277.20, 393.52, 526.90, 676.38,
+    839.75, 1015.16, 1201.87, 1398.52, 1602.78, 1813.14, 2029.38, 2250.46, 2475.61, 2702.38,
+    2929.43, 3154.27, 3372.42, 3588.24, 3801.22, 4011.62, 4220.97, 4433.87, 4650.84, 4868.21,
+    5088.04, 5311.07, 5537.88, 5764.88, 5996.13, 6229.08, 6462.69, 6701.52, 6939.56, 7180.31,
+    7422.68, 7663.77, 0.00, 11.09, 45.30, 101.65, 179.26, 277.44, 394.00, 527.76,
+    677.76, 841.83, 1018.19, 1206.04, 1403.96, 1609.85, 1822.12, 2040.30, 2263.64, 2490.79,
+    2720.03, 2950.98, 3178.72, 3399.44, 3618.07, 3834.11, 4048.41, 4263.56, 4480.93, 4698.94,
+    4922.72, 5148.34, 5376.82, 5605.94, 5840.94, 6076.84, 6314.00, 6554.90, 6799.21, 7044.72,
+    7290.96, 7538.04, 7786.38, 0.00, 11.09, 45.31, 101.69, 179.37, 277.67, 394.47,
+    528.61, 679.12, 843.46, 1021.19, 1210.16, 1408.98, 1616.83, 1830.98, 2051.13, 2276.38,
+    2506.68, 2738.67, 2971.64, 3201.55, 3426.64, 3649.19, 3867.94, 4086.14, 4305.32, 4525.50,
+    4750.55, 4978.52, 5207.04, 5440.62, 5676.21, 5916.78, 6157.10, 6401.86, 6648.12, 6897.37,
+    7150.12, 7402.90, 7658.33, 7912.58, 0.00, 11.09, 45.32, 101.72, 179.47, 277.90,
+    394.93, 529.45, 680.45, 845.52, 1024.13, 1214.22, 1414.40, 1623.20, 1839.69, 2061.37,
+    2289.50, 2522.28, 2756.73, 2992.96, 3225.53, 3453.55, 3678.00, 3900.47, 4122.34, 4345.40,
+    4571.32, 4800.36, 5032.30, 5267.72, 5507.34, 5746.98, 5992.38, 6238.99, 6489.14, 6741.70,
+    6998.45, 7256.50, 7518.06, 7779.28, 8037.90, 0.00, 11.09, 45.32, 101.75, 179.57,
+    278.13, 395.39, 530.26, 681.75, 847.55, 1027.03, 1218.21, 1419.73, 1630.14, 1848.33,
+    2072.18, 2302.46, 2537.93, 2774.76, 3013.65, 3249.42, 3479.76, 3707.59, 3935.99, 4160.64,
+    4388.20, 4618.45, 4852.54, 5087.20, 5327.67, 5571.71, 5819.24, 6069.74, 6323.04, 6577.61,
+    6837.77, 7100.68, 7366.64, 7634.67, 7899.85, 8165.34, 0.00, 11.09, 45.33, 101.79,
+    179.67, 278.35, 395.84, 531.07, 683.04, 849.54, 1029.89, 1222.15, 1425.00, 1636.97,
+    1856.86, 2082.79, 2315.47, 2552.88, 2792.64, 3034.35, 3272.12, 3505.77, 3738.71, 3968.71,
+    4198.11, 4428.60, 4663.51, 4901.62, 5143.97, 5389.91, 5638.63, 5891.32, 6146.34, 6405.43,
+    6668.63, 6935.28, 7204.88, 7477.43, 7752.71, 8023.30, 8294.18, 0.00, 11.09, 45.34,
+    101.82, 179.77, 278.12, 396.28, 531.86, 684.30, 851.50, 1032.70, 1226.02, 1430.17,
+    1643.72, 1864.90, 2093.30, 2327.77, 2568.18, 2810.54, 3055.16, 3296.29, 3532.48, 3768.93,
+    4001.93, 4235.05, 4470.69, 4709.47, 4952.97, 5200.43, 5451.44, 5705.36, 5964.32, 6226.24,
+    6491.02, 6760.48, 7033.30, 7310.82, 7590.46, 7871.94, 8148.75, 8423.06, 0.00, 11.09,
+    45.34, 101.85, 179.86, 278.35, 396.71, 532.64, 685.54, 853.43, 1035.46, 1229.83,
+    1435.27, 1650.33, 1873.37, 2103.84, 2340.61, 2583.40, 2828.60, 3076.08, 3318.96, 3558.59,
+    3797.53, 4035.13, 4272.08, 4514.43, 4757.08, 5005.62, 5257.40, 5512.64, 5773.20, 6037.40,
+    6306.31, 6577.83, 6853.88, 7134.32, 7418.42, 7705.41, 7991.38, 8273.01, 8556.16, 0.00,
+    11.09, 45.35, 101.88, 179.96, 278.57, 397.13, 533.40, 686.34, 855.31, 1038.17,
+    1233.59, 1440.30, 1656.89, 1881.68, 2113.69, 2353.18, 2598.12, 2845.56, 3095.75, 3342.55,
+    3585.21, 3828.20, 4067.69, 4310.76, 4555.12, 4803.71, 5057.18, 5314.26, 5574.71, 5840.62,
+    6111.70, 6387.27, 6666.13, 6948.50, 7236.48, 7528.41, 7820.01, 8111.27, 8400.49, 8686.52,
+    0.00, 11.09, 45.36, 101.91, 180.05, 278.78, 397.54, 534.15, 687.57, 857.18,
+    1040.84, 1237.28, 1444.83, 1663.34, 1889.91, 2124.05, 2365.72, 2612.68, 2863.46, 3116.53,
+    3365.39, 3610.80, 3857.07, 4102.09, 4348.53, 4597.41, 4849.74, 5109.40, 5371.83, 5638.45,
+    5910.25, 6187.07, 6467.95, 6753.60, 7043.32, 7339.64, 7638.63, 7935.58, 8233.53, 8526.17,
+    8822.51, 0.00, 11.09, 45.36, 101.94, 180.14, 278.99, 397.95, 534.88, 688.78,
+    859.00, 1043.46, 1240.54, 1449.81, 1669.28, 1898.02, 2134.17, 2377.68, 2627.67, 2881.05,
+    3136.40, 3388.72, 3637.46, 3888.23, 4136.22, 4386.12, 4639.81, 4897.63, 5162.19, 5429.09,
+    5702.00, 5980.89, 6263.01, 6551.92, 6843.76, 7141.21, 7445.12, 7748.76, 8052.55, 8356.93,
+    8656.61, 8957.00, 0.00, 11.09, 45.37, 101.97, 180.22, 279.20, 398.35, 535.60,
+    689.97, 860.80, 1046.04, 1244.20, 1454.71, 1675.67, 1905.57, 2144.17, 2389.98, 2642.39,
+    2898.05, 3156.10, 3411.81, 3663.02, 3917.54, 4169.34, 4424.08, 4682.07, 4944.65, 5215.16,
+    5488.12, 5766.46, 6050.10, 6341.38, 6635.70, 6935.42, 7240.16, 7550.60, 7861.19, 8171.41,
+    8479.38, 8786.79, 9092.91, 0.00, 11.09, 45.38, 102.00, 180.31, 279.40, 398.74,
+    536.31, 691.14, 862.56, 1048.17, 1247.80, 1459.53, 1681.93, 1913.60, 2154.13, 2402.23,
+    2656.50, 2915.59, 3175.96, 3433.87, 3689.48, 3947.22, 4203.06, 4461.78, 4723.68, 4993.41,
+    5267.18, 5546.54, 5831.93, 6122.18, 6418.60, 6720.98, 7028.09, 7341.53, 7657.59, 7975.18,
+    8291.00, 8605.00, 8916.62, 9229.82, 0.00, 11.09, 45.38, 102.03, 180.39, 279.60,
+    399.12, 536.99, 692.29, 864.29, 1050.72, 1251.33, 1464.27, 1688.12, 1921.48, 2163.56,
+    2414.20, 2671.11, 2932.32, 3195.71, 3456.64, 3715.97, 3976.03, 4236.03, 4499.00, 4767.64,
+    5040.80, 5321.93, 5606.05, 5896.97, 6195.05, 6498.59, 6806.81, 7122.54, 7444.17, 7766.18,
+    8088.58, 8410.27, 8730.14, 9048.49, 9366.70, 0.00, 11.09, 45.39, 102.06, 180.47,
+    279.79, 399.50, 537.67, 693.41, 865.98, 1053.24, 1254.81, 1468.93, 1694.23, 1929.27,
+    2173.29, 2425.79, 2685.08, 2949.07, 3215.28, 3479.15, 3741.58, 4006.38, 4269.77, 4538.10,
+    4810.08, 5090.45, 5375.69, 5665.33, 5963.65, 6267.36, 6578.74, 6894.94, 7219.19, 7546.45,
+    7875.22, 8203.62, 8530.75, 8854.70, 9177.15, 9503.07, 0.00, 11.09, 45.39, 102.08,
+    180.56, 279.98, 399.86, 538.33, 694.51, 867.64, 1055.70, 1258.22, 1473.52, 1700.17,
+    1936.89, 2182.97, 2437.64, 2699.47, 2965.99, 3234.67, 3501.62, 3768.09, 4035.19, 4302.80,
+    4575.77, 4854.68, 5138.96, 5430.72, 5727.11, 6031.25, 6342.05, 6661.01, 6984.93, 7315.78,
+    7649.69, 7984.76, 8317.08, 8650.97, 8980.51, 9308.28, 9638.11, 0.00, 11.09, 45.40,
+    102.11, 180.63, 280.17, 400.22, 538.99, 695.59, 869.27, 1058.12, 1261.58, 1478.02,
+    1706.07, 1944.43, 2192.39, 2449.37, 2712.96, 2982.82, 3253.69, 3523.15, 3792.67, 4064.42,
+    4337.65, 4613.98, 4897.34, 5188.68, 5485.17, 5788.66, 6098.98, 6417.71, 6743.28, 7076.52,
+    7414.20, 7753.96, 8093.20, 8432.52, 8770.02, 9104.22, 9437.90, 9773.96, 0.00, 11.09,
+    45.40, 102.13, 180.71, 280.35, 400.57, 539.63, 696.65, 870.88, 1060.49, 1264.86,
+    1482.45, 1711.50, 1951.45, 2201.84, 2460.92, 2727.06, 2999.12, 3272.74, 3545.38, 3820.07,
+    4093.94, 4371.26, 4652.96, 4940.83, 5237.98, 5540.88, 5850.41, 6168.03, 6495.20, 6827.72,
+    7168.37, 7511.45, 7857.43, 8202.96, 8545.87, 8889.92, 9229.06, 9566.74, 9910.24, 0.00,
+    11.09, 45.41, 102.16, 180.78, 280.53, 400.92, 540.25, 697.69, 872.01, 1062.81,
+    1268.10, 1486.43, 1717.29, 1958.90, 2210.68, 2472.40, 2740.96, 3015.11, 3291.93, 3567.63,
+    3845.47, 4124.01, 4404.59, 4692.54, 4986.03, 5288.18, 5596.87, 5913.44, 6239.80, 6572.18,
+    6913.41, 7261.31, 7610.85, 7960.34, 8310.83, 8660.25, 9009.57, 9352.84, 9697.49, 10044.78,
+    0.00, 11.09, 45.41, 102.18, 180.86, 280.70, 400.82, 540.86, 698.71, 873.60,
+    1065.10, 1271.27, 1490.80, 1723.01, 1966.21, 2219.89, 2483.30, 2754.37, 3031.68, 3311.03,
+    3589.02, 3871.04, 4153.19, 4439.66, 4732.32, 5030.80, 5338.64, 5654.43, 5979.06, 6310.16,
+    6651.10, 7000.16, 7353.92, 7708.50, 8063.70, 8419.45, 8773.54, 9126.25, 9475.96, 9827.65,
+    10178.63, 0.00, 11.10, 45.42, 102.21, 180.93, 280.87, 401.17, 541.46, 699.70,
+    875.15, 1067.34, 1273.94, 1495.08, 1728.58, 1973.37, 2228.95, 2494.58, 2767.68, 3047.83,
+    3329.34, 3611.79, 3896.47, 4183.24, 4474.25, 4771.29, 5076.48, 5390.60, 5712.18, 6043.37,
+    6382.35, 6731.14, 7086.64, 7445.62, 7805.64, 8166.78, 8526.37, 8886.32, 9243.67, 9599.38,
+    9955.12, 10312.54, 0.00, 11.10, 45.43, 102.23, 181.00, 281.04, 401.50, 542.05,
+    700.68, 876.67, 1069.53, 1277.07, 1499.29, 1734.10, 1980.45, 2237.98, 2505.74, 2781.26,
+    3063.84, 3348.96, 3633.78, 3923.55, 4214.31, 4508.59, 4811.30, 5122.24, 5443.28, 5771.58,
+    6109.05, 6455.97, 6810.64, 7173.62, 7538.38, 7903.04, 8269.46, 8634.11, 8998.95, 9361.12,
+    9720.90, 10082.70, 10445.82, 0.00, 11.10, 45.43, 102.25, 181.07, 281.20, 401.83,
+    542.62, 701.63, 878.17, 1071.69, 1280.14, 1503.42, 1739.51, 1987.43, 2246.86, 2516.96,
+    2795.06, 3080.24, 3367.87, 3656.04, 3948.92, 4243.76, 4544.75, 4852.24, 5168.95, 5495.45,
+    5831.25, 6175.44, 6529.18, 6891.64, 7260.77, 7629.08, 7999.64, 8370.39, 8740.51, 9110.27,
+    9476.27, 9843.02, 10209.92, 10577.75, 0.00, 11.10, 45.43, 102.27, 181.14, 281.36,
+    402.16, 543.18, 702.57, 879.63, 1073.80, 1283.15, 1507.48, 1744.87, 1993.95, 2255.29,
+    2527.66, 2808.38, 3096.75, 3386.92, 3678.13, 3975.70, 4274.27, 4579.97, 4893.49, 5217.17,
+    5550.30, 5891.56, 6242.86, 6602.54, 6972.44, 7345.93, 7720.04, 8094.96, 8471.62, 8846.71,
+    9221.67, 9592.12, 9962.69, 10336.12, 10709.69, 0.00, 11.10, 45.44, 102.29, 181.20,
+    281.52, 402.48, 543.73, 703.48, 881.06, 1075.86, 1286.11, 1511.50, 1750.22, 2001.03,
+    2264.37, 2538.89, 2821.75, 3113.10, 3406.16, 3701.12, 4001.86, 4306.15, 4617.44, 4935.06,
+    5264.74, 5604.30, 5952.18, 6308.80, 6676.69, 7053.04, 7431.52, 7809.97, 8190.89, 8571.58,
+    8951.61, 9330.50, 9706.63, 10082.45, 10461.55, 10839.28, 0.00, 11.10, 45.44, 102.32,
+    181.26, 281.67, 402.78, 544.27, 704.38, 882.46, 1077.90, 1289.06, 1515.53, 1755.21,
+    2008.15, 2273.43, 2550.33, 2835.69, 3129.29, 3425.69, 3723.88, 4029.43, 4336.92, 4653.29,
+    4978.44, 5312.75, 5658.25, 6012.92, 6376.44, 6750.98, 7132.89, 7516.05, 7900.06, 8285.35,
+    8671.26, 9055.63, 9439.87, 9819.64, 10200.58, 10585.24, 10968.19, 0.00, 11.10, 45.45,
+    102.34, 181.33, 281.82, 403.08, 544.79, 705.26, 883.85, 1079.95, 1292.04, 1519.60,
+    1760.76, 2015.41, 2282.66, 2561.44, 2849.51, 3145.67, 3444.97, 3747.99, 4056.37, 4370.09,
+    4690.80, 5021.13, 5362.10, 5713.38, 6072.92, 6443.43, 6824.46, 7212.50, 7600.06, 7989.02,
+    8379.41, 8768.91, 9158.37, 9546.80, 9932.91, 10320.05, 10708.60, 11095.05, 0.00, 11.10,
+    45.45, 102.36, 181.39, 281.97, 403.38, 545.32, 706.16, 885.28, 1081.66, 1295.08,
+    1523.31, 1766.36, 2022.69, 2291.91, 2572.99, 2863.65, 3162.68, 3465.21, 3771.27, 4084.72,
+    4401.99, 4728.73, 5064.65, 5410.99, 5767.22, 6134.02, 6511.18, 6898.95, 7291.53, 7683.16,
+    8077.05, 8471.95, 8866.60, 9261.48, 9653.43, 10044.83, 10437.48, 10830.50, 11220.46, 0.00,
+    11.10, 45.46, 102.38, 181.45, 282.11, 403.69, 545.88, 707.11, 886.78, 1083.91,
+    1298.23, 1527.67, 1772.11, 2030.10, 2301.29, 2584.12, 2877.55, 3179.27, 3485.43, 3796.44,
+    4112.58, 4435.33, 4766.66, 5107.53, 5459.16, 5821.36, 6194.12, 6577.91, 6972.16, 7368.98,
+    7766.19, 8164.52, 8564.13, 8963.54, 9362.70, 9759.75, 10155.49, 10552.83, 10951.36, 11345.05,
+    0.00, 11.10, 45.46, 102.40, 181.52, 282.29, 404.04, 546.06, 708.10, 888.33,
+    1086.20, 1301.42, 1532.07, 1777.89, 2037.53, 2310.38, 2595.93, 2891.95, 3196.42, 3505.53,
+    3820.71, 4141.34, 4468.49, 4803.80, 5151.05, 5508.17, 5876.43, 6254.92, 6645.07, 7044.74,
+    7445.80, 7847.62, 8250.88, 8654.86, 9058.82, 9462.71, 9864.89, 10264.71, 10667.04, 11070.15,
+    11468.79, 0.00, 11.10, 45.47, 102.42, 181.59, 282.45, 404.37, 546.65, 709.06,
+    889.82, 1088.43, 1304.51, 1536.32, 1783.49, 2044.38, 2319.60, 2607.35, 2905.97, 3213.33,
+    3525.96, 3844.12, 4169.40, 4500.00, 4842.06, 5192.78, 5555.72, 5929.21, 6313.82, 6710.17,
+    7115.50, 7521.04, 7927.14, 8334.58, 8743.49, 9152.38, 9560.75, 9966.86, 10372.14, 10778.95,
+    11186.49, 11590.68, 0.00, 11.10, 45.47, 102.45, 181.66, 282.61, 404.69, 547.22,
+    709.98, 891.26, 1090.57, 1307.48, 1540.43, 1788.89, 2051.47, 2328.54, 2618.42, 2919.51,
+    3229.78, 3545.70, 3867.62, 4195.97, 4532.87, 4877.84, 5233.95, 5602.00, 5981.53, 6371.98,
+    6774.52, 7184.59, 7594.60, 8004.96, 8417.14, 8830.12, 9242.85, 9656.26, 10067.15, 10476.62,
+    10887.85, 11299.74, 11707.61, 0.00, 11.10, 45.47, 102.47, 181.72, 282.76, 404.99,
+    547.77, 710.87, 892.65, 1092.63, 1310.36, 1544.39, 1793.68, 2058.29, 2337.16, 2629.13,
+    2932.27, 3245.38, 3564.23, 3890.38, 4222.62, 4563.24, 4913.47, 5274.30, 5647.61, 6033.07,
+    6429.31, 6838.12, 7251.87, 7666.26, 8080.79, 8497.45, 8914.78, 9331.97, 9748.60, 10164.59,
+    10578.50, 10993.37, 11410.00, 11823.01, 0.00, 11.07, 45.09, 100.65, 176.81, 270.81,
+    380.72, 505.22, 641.51, 787.53, 942.00, 1102.21, 1267.62, 1436.44, 1607.40, 1779.10,
+    1951.46, 2123.95, 2295.88, 2466.07, 2633.15, 2795.20, 2950.38, 3099.03, 3248.22, 3388.13,
+    3528.53, 3668.17, 3805.64, 3947.23, 4087.33, 4225.30, 4365.25, 4505.14, 4646.03, 4785.92,
+    4923.33, 5062.87, 5203.11, 5342.22, 5479.85, 0.00, 11.07, 45.10, 100.70, 176.96,
+    271.16, 381.43, 506.42, 643.39, 790.31, 945.82, 1107.39, 1274.28, 1444.80, 1617.65,
+    1791.36, 1965.83, 2140.38, 2315.37, 2487.22, 2657.83, 2821.85, 2979.61, 3130.55, 3280.88,
+    3425.32, 3568.38, 3710.75, 3853.26, 3995.04, 4138.39, 4280.87, 4423.98, 4568.32, 4711.90,
+    4853.31, 4997.11, 5139.51, 5283.29, 5425.01, 5567.20, 0.00, 11.07, 45.11, 100.76,
+    177.11, 271.51, 382.12, 507.60, 645.24, 793.06, 949.16, 1112.52, 1280.88, 1453.08,
+    1627.78, 1803.65, 1979.86, 2157.38, 2334.63, 2508.66, 2681.05, 2848.85, 3008.14, 3162.69,
+    3315.16, 3462.62, 3608.69, 3752.23, 3897.99, 4044.38, 4192.76, 4339.09, 4485.84, 4630.18,
+    4777.29, 4924.17, 5070.34, 5217.66, 5364.80, 5509.56, 5656.46, 0.00, 11.07, 45.12,
+    100.81, 177.26, 271.85, 382.80, 508.76, 647.08, 795.77, 953.00, 1117.60, 1287.41,
+    1460.90, 1637.46, 1815.85, 1994.37, 2174.13, 2353.69, 2530.88, 2705.94, 2874.76, 3037.51,
+    3196.47, 3348.83, 3499.90, 3647.64, 3798.61, 3947.59, 4096.06, 4244.75, 4394.56, 4544.66,
+    4695.19, 4845.27, 4995.76, 5146.28, 5297.55, 5445.32, 5595.86, 5745.21, 0.00, 11.07,
+    45.13, 100.86, 177.40, 272.19, 383.47, 509.91, 648.88, 798.45, 956.78, 1122.62,
+    1293.54, 1469.22, 1647.69, 1827.54, 2008.94, 2190.52, 2373.10, 2552.79, 2730.07, 2902.17,
+    3067.53, 3228.89, 3385.01, 3536.63, 3690.72, 3841.90, 3993.22, 4147.16, 4299.10, 4452.42,
+    4605.94, 4760.04, 4914.59, 5068.12, 5222.28, 5377.17, 5529.92, 5684.16, 5837.91, 0.00,
+    11.08, 45.14, 100.91, 177.54, 272.52, 384.14, 511.04, 650.67, 801.10, 960.52,
+    1127.59, 1300.09, 1477.45, 1657.82, 1839.79, 2022.85, 2207.50, 2392.10, 2574.33, 2754.79,
+    2929.39, 3096.49, 3259.92, 3419.68, 3574.28, 3731.72, 3885.40, 4041.29, 4197.55, 4353.85,
+    4508.97, 4668.83, 4826.72, 4984.20, 5142.38, 5300.94, 5459.17, 5618.58, 5772.97, 5931.50,
+    0.00, 11.08, 45.15, 100.96, 177.68, 272.85, 384.79, 512.15, 652.43, 803.71,
+    964.22, 1132.09, 1306.58, 1485.61, 1667.77, 1851.95, 2037.27, 2224.16, 2411.42, 2596.45,
+    2779.64, 2956.75, 3126.39, 3292.53, 3454.30, 3614.50, 3772.40, 3930.91, 4089.61, 4250.30,
+    4410.26, 4569.34, 4730.64, 4891.64, 5054.34, 5216.36, 5377.50, 5540.43, 5703.59, 5865.19,
+    6026.84, 0.00, 11.08, 45.16, 101.01, 177.82, 273.17, 385.43, 513.25, 654.16,
+    806.29, 967.88, 1137.08, 1313.00, 1493.69, 1677.73, 1863.91, 2051.66, 2240.58, 2430.80,
+    2618.15, 2804.21, 2982.91, 3155.88, 3324.90, 3490.05, 3652.99, 3814.84, 3975.65, 4139.45,
+    4301.41, 4467.24, 4630.41, 4794.03, 4959.29, 5125.69, 5292.60, 5458.76, 5625.85, 5793.15,
+    5959.38, 6126.40, 0.00, 11.08, 45.18, 101.06, 177.95, 273.49, 386.06, 514.33,
+    655.87, 808.83, 971.48, 1141.99, 1319.34, 1501.31, 1687.32, 1875.54, 2066.05, 2257.61,
+    2449.66, 2639.65, 2828.38, 3009.89, 3186.51, 3358.06, 3526.60, 3691.24, 3856.22, 4022.89,
+    4187.48, 4355.79, 4521.69, 4691.97, 4859.40, 5029.21, 5198.83, 5368.96, 5539.61, 5710.34,
+    5882.01, 6052.64, 6222.81, 0.00, 11.08, 45.19, 101.11, 178.08, 273.80, 386.68,
+    515.39, 657.55, 811.34, 975.04, 1146.85, 1325.62, 1509.39, 1697.25, 1887.63, 2079.85,
+    2274.33, 2468.90, 2661.92, 2853.16, 3037.54, 3214.94, 3390.91, 3562.76, 3731.67, 3900.31,
+    4067.97, 4237.86, 4407.62, 4579.93, 4752.07, 4924.89, 5098.21, 5271.63, 5448.32, 5623.22,
+    5798.68, 5974.24, 6148.54, 6324.61, 0.00, 11.08, 45.20, 101.15, 178.21, 274.10,
+    387.29, 516.44, 659.21, 813.41, 978.55, 1151.66, 1331.49, 1517.40, 1707.14, 1899.57,
+    2094.17, 2290.58, 2487.87, 2683.77, 2877.56, 3064.57, 3245.61, 3423.31, 3597.92, 3769.39,
+    3942.65, 4115.45, 4287.54, 4463.15, 4637.99, 4814.24, 4992.34, 5169.69, 5347.00, 5526.63,
+    5705.71, 5885.68, 6066.73, 6246.05, 6427.65, 0.00, 11.08, 45.21, 101.20, 177.90,
+    274.40, 387.89, 517.47, 660.43, 815.91, 981.59, 1156.39, 1337.76, 1525.32, 1716.93,
+    1911.46, 2108.32, 2307.47, 2507.07, 2705.78, 2902.66, 3092.03, 3275.60, 3455.91, 3635.20,
+    3811.16, 3986.16, 4161.22, 4339.58, 4517.79, 4696.44, 4877.77, 5058.16, 5240.97, 5422.61,
+    5608.82, 5791.33, 5976.21, 6162.17, 6346.95, 6532.04, 0.00, 11.08, 45.21, 101.24,
+    178.03, 274.69, 388.48, 518.48, 662.10, 818.39, 985.10, 1161.07, 1343.97, 1533.16,
+    1726.24, 1922.90, 2122.23, 2324.09, 2526.47, 2727.91, 2927.56, 3119.51, 3306.09, 3491.90,
+    3670.59, 3850.04, 4029.20, 4209.50, 4390.34, 4572.20, 4756.81, 4940.98, 5125.82, 5314.11,
+    5500.41, 5688.69, 5877.79, 6068.81, 6259.06, 6447.79, 6638.99, 0.00, 11.08, 45.22,
+    101.29, 178.16, 274.98, 389.06, 519.48, 663.73, 820.83, 988.56, 1165.71, 1350.11,
+    1540.49, 1735.94, 1934.70, 2136.36, 2340.32, 2545.52, 2749.96, 2951.95, 3146.44, 3336.38,
+    3524.00, 3707.29, 3890.46, 4071.71, 4255.92, 4441.65, 4628.56, 4816.16, 5006.50, 5195.00,
+    5386.83, 5578.50, 5771.84, 5965.33, 6161.09, 6354.97, 6552.82, 6747.07, 0.00, 11.08,
+    45.23, 101.33, 178.29, 275.27, 389.63, 520.46, 665.34, 823.23, 991.98, 1169.93,
+    1356.16, 1548.31, 1745.63, 1946.47, 2150.45, 2357.13, 2564.48, 2771.47, 2975.67, 3173.80,
+    3366.06, 3558.01, 3745.37, 3930.64, 4117.60, 4304.72, 4495.60, 4685.45, 4878.59, 5070.23,
+    5265.60, 5461.63, 5657.51, 5855.88, 6055.79, 6255.60, 6456.66, 6655.98, 6858.66, 0.00,
+    11.08, 45.24, 101.37, 178.42, 275.55, 390.19, 521.43, 666.93, 825.61, 995.36,
+    1174.54, 1362.16, 1556.05, 1755.22, 1958.10, 2164.49, 2373.69, 2584.00, 2793.30, 3000.47,
+    3202.03, 3396.70, 3591.50, 3781.83, 3970.95, 4162.78, 4355.19, 4547.89, 4743.87, 4938.47,
+    5136.09, 5336.54, 5537.00, 5739.68, 5941.40, 6145.29, 6352.68, 6556.70, 6762.99, 6967.03,
+    0.00, 11.08, 45.25, 101.41, 178.54, 275.82, 390.74, 522.38, 668.49, 827.93,
+    998.68, 1179.10, 1367.67, 1563.70, 1764.66, 1969.31, 2178.05, 2389.81, 2602.55, 2815.15,
+    3025.26, 3228.64, 3426.73, 3625.05, 3818.56, 4013.75, 4206.24, 4402.03, 4600.28, 4800.11,
+    5000.21, 5203.53, 5407.17, 5613.91, 5820.67, 6027.23, 6237.64, 6449.15, 6660.80, 6871.90,
+    7082.00, 0.00, 11.08, 45.26, 101.45, 178.66, 276.09, 391.28, 522.90, 670.03,
+    830.23, 1001.95, 1183.59, 1373.64, 1571.26, 1773.72, 1980.95, 2191.93, 2406.36, 2621.48,
+    2837.45, 3049.43, 3256.68, 3459.76, 3658.36, 3856.30, 4052.89, 4253.33, 4452.21, 4654.83,
+    4857.79, 5062.89, 5270.00, 5480.19, 5689.86, 5902.74, 6115.72, 6331.85, 6547.24, 6763.45,
+    6982.40, 7198.78, 0.00, 11.08, 45.27, 101.49, 178.78, 276.35, 391.81, 523.85,
+    671.54, 832.49, 1005.18, 1188.02, 1379.53, 1578.71, 1783.17, 1992.39, 2205.96, 2422.89,
+    2640.67, 2859.17, 3074.45, 3284.17, 3490.61, 3694.67, 3893.34, 4095.20, 4297.56, 4500.19,
+    4708.82, 4916.84, 5126.26, 5338.87, 5552.82, 5768.78, 5986.51, 6205.54, 6425.96, 6648.80,
+    6871.17, 7095.36, 7317.33, 0.00, 11.08, 45.28, 101.53, 178.89, 276.61, 392.34,
+    524.79, 673.02, 834.73, 1008.36, 1192.40, 1385.34, 1585.74, 1792.45, 2003.79, 2219.61,
+    2438.70, 2659.63, 2880.65, 3098.96, 3311.34, 3520.08, 3726.89, 3931.39, 4135.85, 4343.18,
+    4551.12, 4764.06, 4976.66, 5190.88, 5407.79, 5627.44, 5847.82, 6070.67, 6297.09, 6522.95,
+    6749.91, 6979.17, 7207.75, 7437.53, 0.00, 11.09, 45.28, 101.57, 179.01, 276.87,
+    392.85, 525.71, 674.49, 836.92, 1011.49, 1196.70, 1391.08, 1593.17, 1801.69, 2014.66,
+    2232.96, 2455.09, 2678.32, 2902.32, 3123.10, 3338.29, 3552.08, 3761.12, 3969.76, 4179.15,
+    4388.15, 4602.69, 4817.69, 5036.67, 5255.40, 5478.20, 5701.55, 5929.59, 6158.01, 6387.77,
+    6619.92, 6854.63, 7088.82, 7323.99, 7560.05, 0.00, 11.09, 45.29, 101.61, 179.12,
+    277.12, 393.35, 526.61, 675.93, 839.07, 1014.15, 1200.95, 1396.74, 1600.52, 1810.82,
+    2026.02, 2246.63, 2471.34, 2697.42, 2924.09, 3146.99, 3366.05, 3582.37, 3795.73, 4008.21,
+    4220.71, 4435.52, 4654.35, 4873.10, 5095.61, 5321.07, 5547.36, 5778.72, 6010.41, 6243.86,
+    6480.39, 6719.49, 6959.39, 7201.23, 7443.23, 7685.44, 0.00, 11.09, 45.30, 101.64,
+    179.23, 277.36, 393.85, 527.50, 677.34, 841.19, 1017.26, 1204.77, 1402.32, 1607.69,
+    1819.49, 2037.22, 2260.15, 2487.41, 2715.71, 2946.00, 3172.20, 3393.71, 3612.62, 3828.89,
+    4044.97, 4262.48, 4482.18, 4703.93, 4929.74, 5155.51, 5386.58, 5619.74, 5855.76, 6092.27,
+    6332.34, 6575.17, 6819.04, 7066.83, 7315.72, 7562.35, 7811.87, 0.00, 11.09, 45.31,
+    101.68, 179.34, 277.60, 394.33, 528.37, 678.73, 842.87, 1020.33, 1208.99, 1407.45,
+    1614.84, 1828.57, 2048.32, 2273.27, 2503.23, 2734.37, 2966.78, 3196.32, 3420.90, 3644.92,
+    3864.78, 4084.97, 4306.34, 4528.45, 4755.88, 4985.81, 5217.76, 5453.25, 5692.59, 5932.50,
+    6176.38, 6421.74, 6669.73, 6922.46, 7175.09, 7430.74, 7686.34, 7941.30, 0.00, 11.09,
+    45.31, 101.71, 179.44, 277.84, 394.81, 529.23, 680.09, 844.98, 1023.35, 1213.16,
+    1413.00, 1621.90, 1837.47, 2058.84, 2286.72, 2519.04, 2753.16, 2988.70, 3220.86, 3447.91,
+    3674.79, 3898.46, 4122.36, 4347.71, 4576.27, 4808.09, 5043.21, 5278.95, 5519.97, 5764.24,
+    6011.04, 6260.30, 6511.43, 6767.49, 7026.77, 7286.26, 7549.85, 7810.98, 8072.74, 0.00,
+    11.09, 45.32, 101.75, 179.55, 278.07, 395.28, 530.07, 681.44, 847.05, 1026.33,
+    1217.25, 1418.47, 1628.49, 1846.32, 2070.01, 2299.96, 2534.96, 2771.61, 3010.11, 3245.01,
+    3475.04, 3705.32, 3932.74, 4160.45, 4390.44, 4623.09, 4859.50, 5099.62, 5341.53, 5588.20,
+    5837.71, 6091.23, 6344.97, 6604.05, 6866.63, 7132.10, 7400.11, 7669.93, 7936.23, 8204.28,
+    0.00, 11.09, 45.33, 101.78, 179.65, 278.30, 395.74, 530.89, 682.75, 849.10,
+    1029.25, 1221.28, 1423.85, 1635.50, 1855.05, 2080.89, 2313.18, 2550.28, 2789.82, 3031.05,
+    3268.09, 3501.96, 3735.81, 3967.15, 4198.55, 4432.45, 4671.94, 4913.59, 5158.18, 5403.05,
+    5655.31, 5910.90, 6169.98, 6432.36, 6697.88, 6967.04, 7240.23, 7515.36, 7792.02, 8064.26,
+    8337.52, 0.00, 11.09, 45.34, 101.81, 179.75, 278.52, 396.19, 531.70, 684.05,
+    851.11, 1032.13, 1225.25, 1429.16, 1642.41, 1863.31, 2091.59, 2325.79, 2565.64, 2807.94,
+    3052.13, 3292.83, 3529.19, 3766.80, 4002.31, 4238.50, 4476.39, 4717.83, 4964.62, 5215.08,
+    5468.82, 5726.38, 5986.92, 6251.64, 6520.57, 6793.58, 7069.27, 7349.58, 7632.05, 7914.28,
+    8194.29, 8471.46, 0.00, 11.09, 45.34, 101.85, 179.84, 278.30, 396.63, 532.50,
+    685.31, 853.08, 1034.96, 1229.15, 1434.38, 1649.15, 1871.97, 2102.27, 2339.00, 2581.18,
+    2826.35, 3073.47, 3316.31, 3556.37, 3798.26, 4035.93, 4276.56, 4519.45, 4766.38, 5017.11,
+    5273.74, 5532.71, 5796.39, 6063.53, 6334.96, 6610.61, 6890.16, 7173.48, 7461.27, 7750.42,
+    8038.92, 8323.01, 8608.45, 0.00, 11.09, 45.35, 101.88, 179.94, 278.53, 397.06,
+    533.28, 686.13, 855.02, 1037.73, 1232.99, 1439.52, 1655.85, 1880.45, 2112.38, 2351.84,
+    2596.63, 2844.00, 3093.27, 3340.28, 3583.31, 3828.85, 4070.57, 4314.80, 4562.49, 4814.73,
+    5071.49, 5332.19, 5597.33, 5866.20, 6140.54, 6417.82, 6700.15, 6989.04, 7280.05, 7575.03,
+    7869.93, 8163.60, 8454.63, 8746.20, 0.00, 11.09, 45.36, 101.91, 180.03, 278.75,
+    397.48, 534.04, 687.39, 856.92, 1040.46, 1236.77, 1444.16, 1662.46, 1888.88, 2123.05,
+    2364.62, 2611.40, 2862.32, 3114.57, 3363.61, 3610.03, 3857.85, 4104.61, 4353.67, 4606.11,
+    4863.33, 5124.56, 5392.18, 5662.17, 5938.19, 6219.24, 6503.44, 6792.67, 7087.41, 7388.62,
+    7689.99, 7992.01, 8289.56, 8587.21, 8886.49, 0.00, 11.09, 45.36, 101.94, 180.12,
+    278.96, 397.90, 534.79, 688.64, 858.78, 1043.15, 1240.11, 1449.25, 1668.56, 1897.16,
+    2133.37, 2376.84, 2626.77, 2879.84, 3135.07, 3387.19, 3638.13, 3888.95, 4139.27, 4392.54,
+    4649.58, 4912.85, 5179.16, 5451.32, 5728.52, 6011.44, 6298.29, 6589.54, 6887.11, 7189.93,
+    7498.49, 7804.95, 8112.62, 8417.92, 8721.39, 9024.61, 0.00, 11.09, 45.37, 101.97,
+    180.21, 279.17, 398.31, 535.53, 689.85, 860.62, 1045.78, 1243.85, 1454.26, 1675.10,
+    1904.92, 2143.60, 2389.55, 2641.37, 2897.40, 3155.33, 3410.50, 3664.31, 3919.41, 4173.86,
+    4430.95, 4694.46, 4961.72, 5234.34, 5512.60, 5795.24, 6083.94, 6378.24, 6677.86, 6983.37,
+    7294.52, 7609.34, 7922.48, 8235.81, 8545.65, 8853.48, 9164.24, 0.00, 11.09, 45.38,
+    102.00, 180.30, 279.38, 398.71, 536.25, 691.05, 862.42, 1047.96, 1247.53, 1459.19,
+    1681.48, 1913.13, 2153.73, 2401.99, 2655.98, 2915.11, 3175.83, 3434.05, 3691.72, 3950.32,
+    4208.46, 4471.82, 4738.44, 5010.86, 5290.31, 5573.53, 5864.11, 6158.38, 6460.60, 6767.87,
+    7081.11, 7399.81, 7720.59, 8039.19, 8358.85, 8673.75, 8987.90, 9303.32, 0.00, 11.09,
+    45.38, 102.03, 180.39, 279.58, 399.09, 536.95, 692.22, 864.19, 1050.58, 1251.14,
+    1464.04, 1687.81, 1921.16, 2163.37, 2414.25, 2671.01, 2932.72, 3194.79, 3456.17, 3717.73,
+    3980.32, 4242.56, 4510.21, 4782.57, 5061.00, 5344.85, 5635.91, 5931.99, 6235.48, 6544.39,
+    6858.67, 7179.60, 7505.93, 7832.71, 8156.74, 8481.22, 8800.68, 9120.45, 9441.00, 0.00,
+    11.09, 45.39, 102.06, 180.47, 279.78, 399.48, 537.65, 693.37, 865.92, 1053.14,
+    1254.70, 1468.80, 1694.04, 1929.12, 2173.42, 2426.03, 2685.54, 2949.32, 3215.50, 3479.96,
+    3744.21, 4010.49, 4278.24, 4550.33, 4828.09, 5111.64, 5402.50, 5698.35, 6001.87, 6312.36,
+    6629.28, 6951.56, 7281.00, 7612.90, 7944.57, 8274.45, 8603.95, 8929.17, 9254.90, 9581.66,
+    0.00, 11.09, 45.39, 102.08, 180.55, 279.98, 399.85, 538.33, 694.50, 867.62,
+    1055.65, 1258.18, 1473.48, 1700.14, 1936.92, 2183.23, 2438.13, 2700.14, 2966.90, 3235.37,
+    3503.01, 3772.24, 4041.11, 4313.52, 4590.94, 4872.61, 5163.40, 5459.39, 5763.23, 6073.43,
+    6390.70, 6715.55, 7045.27, 7382.48, 7719.69, 8055.68, 8391.02, 8726.72, 9056.54, 9387.43,
+    9720.39, 0.00, 11.09, 45.40, 102.11, 180.63, 280.17, 400.22, 538.99, 695.59,
+    869.28, 1058.12, 1261.60, 1478.08, 1706.16, 1944.63, 2192.88, 2450.19, 2713.78, 2984.04,
+    3255.26, 3525.91, 3798.57, 4072.60, 4348.33, 4631.43, 4919.57, 5214.93, 5518.47, 5828.21,
+    6145.90, 6470.26, 6802.75, 7140.91, 7483.04, 7825.93, 8167.35, 8508.22, 8847.04, 9184.27,
+    9521.89, 9858.10, 0.00, 11.09, 45.40, 102.13, 180.71, 280.35, 400.58, 539.64,
+    696.68, 870.92, 1060.55, 1264.96, 1482.60, 1711.67, 1951.79, 2202.42, 2462.06, 2728.38,
+    3001.29, 3274.84, 3548.86, 3825.74, 4103.81, 4384.81, 4673.07, 4966.06, 5267.78, 5577.62,
+    5894.58, 6218.49, 6551.60, 6890.71, 7236.95, 7583.77, 7931.51, 8278.63, 8624.95, 8968.57,
+    9310.63, 9654.15, 9996.80, 0.00, 11.09, 45.41, 102.16, 180.79, 280.53, 400.93,
+    540.27, 697.73, 872.08, 1062.92, 1268.26, 1486.68, 1717.61, 1959.40, 2211.53, 2473.76,
+    2742.69, 3017.95, 3295.15, 3572.53, 3852.02, 4134.08, 4421.21, 4713.00, 5013.31, 5321.55,
+    5638.05, 5960.94, 6293.31, 6632.88, 6979.36, 7331.47, 7684.58, 8037.54, 8389.33, 8740.84,
+    9089.66, 9437.47, 9785.40, 10135.46, 0.00, 11.09, 45.42, 102.19, 180.86, 280.71,
+    400.84, 540.90, 698.77, 873.70, 1065.25, 1271.49, 1491.12, 1723.45, 1966.88, 2221.13,
+    2485.28, 2757.07, 3035.37, 3314.97, 3595.50, 3880.97, 4167.15, 4458.38, 4755.24, 5061.57,
+    5376.74, 5698.28, 6029.27, 6367.90, 6715.21, 7069.03, 7426.01, 7784.26, 8143.05, 8499.42,
+    8856.95, 9211.29, 9563.28, 9916.55, 10271.72, 0.00, 11.10, 45.42, 102.21, 180.93,
+    280.89, 401.20, 541.52, 699.79, 875.29, 1067.53, 1274.24, 1495.50, 1729.20, 1974.35,
+    2230.62, 2497.15, 2770.92, 3052.61, 3335.37, 3618.81, 3907.82, 4197.82, 4494.35, 4798.17,
+    5110.75, 5431.69, 5760.59, 6097.48, 6443.19, 6797.08, 7157.98, 7520.31, 7883.65, 8247.98,
+    8609.90, 8972.45, 9330.00, 9687.32, 10047.98, 10407.92, 0.00, 11.10, 45.43, 102.23,
+    181.01, 281.06, 401.54, 542.11, 700.78, 876.84, 1069.77, 1277.43, 1499.83, 1734.96,
+    1981.81, 2240.15, 2508.98, 2785.60, 3069.37, 3355.47, 3642.83, 3935.67, 4230.61, 4532.39,
+    4841.79, 5160.38, 5486.91, 5822.42, 6166.05, 6518.69, 6879.64, 7246.70, 7614.21, 7982.96,
+    8351.23, 8718.96, 9086.58, 9449.06, 9812.76, 10177.84, 10542.59, 0.00, 11.10, 45.43,
+    102.25, 181.08, 281.22, 401.88, 542.70, 701.76, 878.35, 1071.98, 1280.62, 1504.18,
+    1740.70, 1989.32, 2249.71, 2520.95, 2800.21, 3087.13, 3375.84, 3666.65, 3964.85, 4263.92,
+    4571.10, 4885.38, 5209.69, 5543.65, 5884.74, 6235.38, 6594.97, 6962.87, 7334.94, 7707.70,
+    8081.18, 8455.29, 8827.60, 9199.44, 9568.66, 9936.63, 10307.77, 10677.71, 0.00, 11.10,
+    45.43, 102.28, 181.15, 281.38, 402.20, 543.26, 702.71, 879.87, 1074.20, 1283.84,
+    1508.58, 1746.56, 1996.60, 2259.10, 2532.43, 2814.58, 3104.26, 3396.73, 3692.57, 3992.55,
+    4297.88, 4610.36, 4929.67, 5259.85, 5598.93, 5947.21, 6303.50, 6670.48, 7045.50, 7423.04,
+    7800.27, 8179.34, 8557.68, 8935.26, 9311.01, 9684.82, 10059.85, 10437.24, 10809.11, 0.00,
+    11.10, 45.44, 102.30, 181.21, 281.54, 402.53, 543.83, 703.68, 881.42, 1076.48,
+    1287.14, 1513.04, 1752.08, 2004.44, 2269.04, 2544.80, 2829.39, 3121.83, 3417.80, 3716.67,
+    4022.36, 4330.94, 4648.81, 4975.17, 5309.90, 5655.20, 6009.75, 6373.06, 6746.79, 7127.45,
+    7509.62, 7892.58, 8276.12, 8659.52, 9041.90, 9423.36, 9802.12, 10181.88, 10564.42, 10941.89,
+    0.00, 11.10, 45.44, 102.32, 181.28, 281.71, 402.87, 544.45, 704.72, 883.04,
+    1078.85, 1290.54, 1517.65, 1758.29, 2012.42, 2279.12, 2557.28, 2844.70, 3139.91, 3439.04,
+    3742.81, 4051.80, 4366.53, 4688.15, 5019.39, 5360.85, 5712.16, 6071.62, 6441.98, 6822.36,
+    7209.46, 7596.07, 7983.77, 8372.39, 8759.96, 9147.91, 9533.97, 9918.29, 10303.91, 10689.83,
+    11073.12, 0.00, 11.10, 45.45, 102.35, 181.36, 281.89, 403.24, 545.09, 705.79,
+    884.73, 1080.86, 1294.00, 1522.30, 1764.52, 2020.43, 2289.18, 2569.73, 2859.89, 3158.28,
+    3461.04, 3768.14, 4081.77, 4400.65, 4727.69, 5064.42, 5411.20, 5767.65, 6134.56, 6511.54,
+    6898.73, 7290.38, 7681.26, 8073.88, 8467.34, 8860.22, 9253.31, 9643.76, 10033.44, 10423.64,
+    10814.42, 11201.88, 0.00, 11.10, 45.45, 102.37, 181.43, 282.07, 403.61, 545.71,
+    706.83, 886.35, 1083.27, 1297.34, 1526.45, 1770.56, 2028.18, 2298.94, 2581.26, 2874.27,
+    3176.18, 3482.12, 3793.60, 4110.93, 4434.17, 4766.38, 5107.62, 5460.17, 5822.67, 6195.52,
+    6579.11, 6972.88, 7368.99, 7765.19, 8162.40, 8560.55, 8958.38, 9355.81, 9751.33, 10145.23,
+    10541.14, 10936.92, 11329.48, 0.00, 11.10, 45.46, 102.40, 181.51, 282.24, 403.95,
+    545.89, 707.84, 887.92, 1085.59, 1300.56, 1530.89, 1776.40, 2035.68, 2308.09, 2593.16,
+    2888.80, 3193.02, 3502.30, 3818.00, 4139.28, 4467.41, 4803.64, 5151.57, 5509.20, 5877.78,
+    6256.34, 6646.30, 7045.77, 7445.88, 7846.76, 8248.83, 8651.37, 9053.76, 9455.95, 9856.37,
+    10254.88, 10655.07, 11056.04, 11452.90, 0.00, 11.10, 45.46, 102.42, 181.58, 282.41,
+    404.28, 546.49, 708.81, 889.42, 1087.83, 1303.68, 1535.19, 1782.04, 2042.55, 2317.36,
+    2604.67, 2902.89, 3210.04, 3522.83, 3841.48, 4167.48, 4500.08, 4841.88, 5193.36, 5556.79,
+    5930.61, 6315.31, 6711.44, 7116.28, 7521.15, 7926.30, 8332.58, 8739.79, 9147.30, 9554.11,
+    9958.52, 10362.01, 10766.99, 11172.57, 11574.71,
+};
+
+}  // namespace apogee_table_data
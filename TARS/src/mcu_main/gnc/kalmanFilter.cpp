@@ -10,6 +10,8 @@
 
 #include <cmath>
 
+#include "mcu_main/Profiler.h"
+#include "mcu_main/Trace.h"
 #include "mcu_main/finite-state-machines/rocketFSM.h"
 
 #define EIGEN_MATRIX_PLUGIN "MatrixAddons.h"
@@ -84,7 +86,8 @@ void KalmanFilter::SetF(float dt) {
  * @param sd Spectral density of the noise
  */
 void KalmanFilter::kfTickFunction(float dt, float sd) {
-    if (getActiveFSM().getFSMState() >= FSM_State::STATE_IDLE) {
+    PROFILE_SCOPE("KalmanFilter::kfTickFunction");
+    if (getActiveFSMState() >= FSM_State::STATE_IDLE) {
         SetF(float(dt) / 1000);
         SetQ(float(dt) / 1000, sd);
         priori();
@@ -277,7 +280,7 @@ void KalmanFilter::priori() {
  *
  */
 void KalmanFilter::update() {
-    if (getActiveFSM().getFSMState() == FSM_State::STATE_LAUNCH_DETECT) {
+    if (getActiveFSMState() == FSM_State::STATE_LAUNCH_DETECT) {
         float sum = 0;
         float data[10];
         alt_buffer.readSlice(data, 0, 10);
@@ -285,7 +288,7 @@ void KalmanFilter::update() {
             sum += i;
         }
         setState((KalmanState){sum / 10.0f, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    } else if (getActiveFSM().getFSMState() >= FSM_State::STATE_APOGEE) {
+    } else if (getActiveFSMState() >= FSM_State::STATE_APOGEE) {
         H(1, 2) = 0;
     }
 
@@ -297,13 +300,14 @@ void KalmanFilter::update() {
     // TODO These mutex locks are almost certainly not necessary
     // Sensor Measurements
     Eigen::Matrix<float, 3, 1> accel = Eigen::Matrix<float, 3, 1>::Zero();
-    chMtxLock(&highG.mutex);
+    TRACE_MTX_LOCK(&highG.mutex);
     accel(0, 0) = highG.getAccel().az - 0.045;
     accel(1, 0) = highG.getAccel().ay - 0.065;
     accel(2, 0) = -highG.getAccel().ax - 0.06;
+    systime_t accel_time = highG.getTimestamp();
     chMtxUnlock(&highG.mutex);
 
-    chMtxLock(&orientation.mutex);
+    TRACE_MTX_LOCK(&orientation.mutex);
     euler_t angles = orientation.getEuler();
     // euler_t angles = (euler_t){0, 0, 0};
     chMtxUnlock(&orientation.mutex);
@@ -316,7 +320,7 @@ void KalmanFilter::update() {
     y_k(2, 0) = (acc(1)) * 9.81;
     y_k(3, 0) = (acc(2)) * 9.81;
 
-    chMtxLock(&barometer.mutex);
+    TRACE_MTX_LOCK(&barometer.mutex);
     y_k(0, 0) = barometer.getAltitude();
     alt_buffer.push(barometer.getAltitude());
     chMtxUnlock(&barometer.mutex);
@@ -325,7 +329,7 @@ void KalmanFilter::update() {
     x_k = x_priori + K * (y_k - (H * x_priori));
     P_k = (identity - K * H) * P_priori;
 
-    chMtxLock(&mutex);
+    TRACE_MTX_LOCK(&mutex);
     kalman_state.state_est_pos_x = x_k(0, 0);
     kalman_state.state_est_vel_x = x_k(1, 0);
     kalman_state.state_est_accel_x = x_k(2, 0);
@@ -337,6 +341,7 @@ void KalmanFilter::update() {
     kalman_state.state_est_accel_z = x_k(8, 0);
 
     timestamp = chVTGetSystemTime();
+    sample_time = accel_time;
     chMtxUnlock(&mutex);
 
     struct KalmanData kalman_data;
@@ -350,6 +355,7 @@ void KalmanFilter::update() {
     kalman_data.kalman_pos_y = kalman_state.state_est_pos_y;
     kalman_data.kalman_pos_z = kalman_state.state_est_pos_z;
     kalman_data.kalman_apo = kalman_apo;
+    kalman_data.kalman_apo_var = kalman_apo_var;
     kalman_data.timeStamp_state = timestamp;
 
     dataLogger.pushKalmanFifo(kalman_data);
@@ -378,6 +384,16 @@ Eigen::Matrix<float, 3, 1> KalmanFilter::BodyToGlobal(euler_t angles, Eigen::Mat
  */
 KalmanState KalmanFilter::getState() const { return kalman_state; }
 
+/**
+ * @brief Time the sensor data behind the current state was measured, for measuring latency downstream of the filter
+ */
+systime_t KalmanFilter::getSampleTime() const { return sample_time; }
+
+/**
+ * @brief Time the current state was estimated, for the age of what is computed from it
+ */
+systime_t KalmanFilter::getStateTime() const { return timestamp; }
+
 /**
  * @brief Sets state vector x
  *
@@ -390,6 +406,16 @@ void KalmanFilter::setState(KalmanState state) { kalman_state = state; }
  *
  * @param estimate Apogee estimate
  */
-void KalmanFilter::updateApogee(float estimate) { kalman_apo = estimate; }
+void KalmanFilter::updateApogee(float estimate, float variance) {
+    kalman_apo = estimate;
+    kalman_apo_var = variance;
+}
+
+/**
+ * @brief Returns the covariance of the vertical position and velocity estimates
+ *
+ * @return 2x2 block of P_k for (pos_x, vel_x)
+ */
+Eigen::Matrix<float, 2, 2> KalmanFilter::getAltitudeCovariance() const { return P_k.block<2, 2>(0, 0); }
 
 KalmanFilter kalmanFilter;
@@ -54,15 +54,21 @@ class KalmanFilter {
     void kfTickFunction(float dt, float sd);
 
     KalmanState getState() const;
+    systime_t getSampleTime() const;
+    systime_t getStateTime() const;
     void setState(KalmanState state);
-    void updateApogee(float estimate);
+    void updateApogee(float estimate, float variance = 0);
+    Eigen::Matrix<float, 2, 2> getAltitudeCovariance() const;
 
    private:
     float s_dt = 0.050;
 
     KalmanState kalman_state;
     float kalman_apo = 0;
+    float kalman_apo_var = 0;
     systime_t timestamp = 0;
+    // Time the high-G sample used by the last update was taken
+    systime_t sample_time = 0;
 
     Eigen::Matrix<float, 3, 1> init_accel = Eigen::Matrix<float, 3, 1>::Zero();
     Eigen::Matrix<float, 3, 1> world_accel;
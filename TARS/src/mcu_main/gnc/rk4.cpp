@@ -6,11 +6,11 @@
  */
 #include "mcu_main/gnc/rk4.h"
 
-#include <Arduino.h>
-
 #include <array>
 #include <cmath>
 
+#include "mcu_main/Profiler.h"
+
 // TODO: make a typedef for array<float, 2>
 // using std::array;
 
@@ -37,10 +37,21 @@ float rk4::cd(float alt, float vel) {
     //     cd += poly[150 - i] * mach_power;
     //     mach_power *= mach;
     // }
-    approximate_cubic_spline_(mach);
+    cd = approximate_cubic_spline_(mach);
     return float(cd);
 }
 
+/**
+ * @brief Additional drag area (Cd * A) contributed by the flaps
+ *
+ * Each flap is treated as a flat plate of width flap_width protruding
+ * extension mm into the flow.
+ *
+ * @param extension the flap extension in mm
+ * @return float the flap drag area in m^2
+ */
+float rk4::flapDragArea(float extension) { return flap_count * flap_width * (extension / 1000) * flap_cd; }
+
 /**
  * @brief A function that calculates the acceleration of the rocket at a given
  * altitude and velocity given by the rk4 simulation
@@ -48,10 +59,28 @@ float rk4::cd(float alt, float vel) {
  * @param u an array containing the altitude and vertical velocity from the rk4
  * apogee simulation
  * @param rho the air density returned from the atmosphere class
+ * @param extension the flap extension in mm
  * @return array<float, 2> the velocity and acceleration (fixed frame) due to
  * aerodynamic forces at the current step of the rk4
  */
-array<float, 2> rk4::accel(array<float, 2> u, float rho) {
+array<float, 2> rk4::accel(array<float, 2> u, float rho, float extension) {
+    float accel_f = dragAccel(u, rho, extension) - 9.81f;
+
+    array<float, 2> f1{u[1], accel_f};
+
+    return f1;
+}
+
+/**
+ * @brief The acceleration due to aerodynamic forces alone, from the body's
+ * Cd at the current Mach number and the flaps
+ *
+ * @param u the altitude and vertical velocity
+ * @param rho the air density returned from the atmosphere class
+ * @param extension the flap extension in mm
+ * @return float the aerodynamic acceleration, negative while climbing
+ */
+float rk4::dragAccel(array<float, 2> u, float rho, float extension) {
     float r1 = u[0];
     float v1 = u[1];
 
@@ -59,13 +88,8 @@ array<float, 2> rk4::accel(array<float, 2> u, float rho) {
     float Sref_a = .007854;
     float Cd_total = cd(r1, v1);
 
-    float F_a = -((rho * (v1 * v1) * Sref_a * Cd_total) / 2);
-    float accel_a = F_a / 21;  // Acceleration due to Aerodynamic Forces
-    float accel_f = accel_a - 9.81;
-
-    array<float, 2> f1{v1, accel_f};
-
-    return f1;
+    float F_a = -((rho * (v1 * v1) * (Sref_a * Cd_total + flapDragArea(extension))) / 2);
+    return F_a / mass;
 }
 
 /**
@@ -74,19 +98,19 @@ array<float, 2> rk4::accel(array<float, 2> u, float rho) {
  * @param state the rk4 altitude and velocity
  * @param dt the time step size
  * @param rho the density of the air at a given rk4 step altitude
+ * @param extension the flap extension in mm
  * @return array<float, 2> the next rk4 state
  */
-array<float, 2> rk4::rk4_step(array<float, 2> state, float dt, float rho) {
+array<float, 2> rk4::rk4_step(array<float, 2> state, float dt, float rho, float extension) {
     // rk4 iteration
-    array<float, 2> y1 = accel(state, rho);
-
+    // Each stage starts from the slope of the one before it
+    array<float, 2> y1 = accel(state, rho, extension);
     array<float, 2> u1 = {(float)(state[0] + .5 * dt * y1[0]), (float)(state[1] + .5 * dt * y1[1])};
+    array<float, 2> y2 = accel(u1, rho, extension);
     array<float, 2> u2 = {(float)(state[0] + .5 * dt * y2[0]), (float)(state[1] + .5 * dt * y2[1])};
+    array<float, 2> y3 = accel(u2, rho, extension);
     array<float, 2> u3 = {(float)(state[0] + dt * y3[0]), (float)(state[1] + dt * y3[1])};
-
-    array<float, 2> y2 = accel(u1, rho);
-    array<float, 2> y3 = accel(u2, rho);
-    array<float, 2> y4 = accel(u3, rho);
+    array<float, 2> y4 = accel(u3, rho, extension);
 
     array<float, 2> temp = {state[0] + (dt * (y1[0] + 2 * y2[0] + 2 * y3[0] + y4[0])) / 6,
                             state[1] + (dt * (y1[1] + 2 * y2[1] + 2 * y3[1] + y4[1])) / 6};
@@ -100,10 +124,12 @@ array<float, 2> rk4::rk4_step(array<float, 2> state, float dt, float rho) {
  *
  * @param state altitude and velocity from kalman filter
  * @param dt the time step size
+ * @param extension the flap extension in mm, held constant until apogee
  * @return array<float, 2> the predicted apogee and velocity at that altitude
  * (should be close to zero)
  */
-array<float, 2> rk4::sim_apogee(array<float, 2> state, float dt) {
+array<float, 2> rk4::sim_apogee(array<float, 2> state, float dt, float extension) {
+    PROFILE_SCOPE("rk4::sim_apogee");
     for (int iters = 0; iters < 120 && state[1] > 0; iters++) {
         // grabbing the current states (I commented these out because they were
         // unused) float pos_f = state[0]; float vel_f = state[1];
@@ -112,7 +138,7 @@ array<float, 2> rk4::sim_apogee(array<float, 2> state, float dt) {
         float rho = atmo_.getDensity(state[0]);
 
         // rk4 iteration
-        rk4_kp1 = rk4_step(state, dt, rho);
+        rk4_kp1 = rk4_step(state, dt, rho, extension);
 
         state = rk4_kp1;
     }
@@ -0,0 +1,119 @@
+/**
+ * @file HILSIMLink.cpp
+ *
+ * @brief Takes in the host's sensor frames and answers each with the state of the flight code.
+ */
+
+#include "mcu_main/hilsim/HILSIMLink.h"
+
+#include <Arduino.h>
+
+#include <cstring>
+
+#include "mcu_main/finite-state-machines/rocketFSM.h"
+#include "mcu_main/gnc/ActiveControl.h"
+
+HILSIMLink hilsim_link;
+
+/**
+ * @brief Takes in everything received so far and answers every sensor frame in it.
+ */
+void HILSIMLink::update() {
+    while (Serial.available() > 0) {
+        int byte = Serial.read();
+        if (byte < 0) {
+            break;
+        }
+        if (receive((uint8_t)byte)) {
+            publish();
+            sendStatus();
+        }
+    }
+}
+
+/**
+ * @brief Takes in the next byte received.
+ *
+ * @return true if the byte completed a sensor frame, which publish() then publishes before the next byte
+ */
+bool HILSIMLink::receive(uint8_t byte) {
+    if (!reader_.push(byte)) {
+        return false;
+    }
+    return reader_.header().type == HILSIMFrameType::Sensor && reader_.bodySize() == sizeof(HILSIMPacket);
+}
+
+/**
+ * @brief Publishes the sensor frame receive() completed to the sensor thread.
+ */
+void HILSIMLink::publish() {
+    const HILSIMHeader& header = reader_.header();
+
+    // The host's clock starts from 0 with every stream
+    if (received_ > 0 && (int32_t)(header.time_us - header_.time_us) < 0) {
+        next_sequence_ = header.sequence;
+        have_offset_ = false;
+    }
+    header_ = header;
+
+    uint16_t gap = header.sequence - next_sequence_;
+    // Anything further back than half the sequence space is a frame that came out of order
+    if (gap < 0x8000) {
+        dropped_ += gap;
+        next_sequence_ = header.sequence + 1;
+    }
+
+    HILSIMSample sample;
+    memcpy(&sample.packet, reader_.body(), sizeof(HILSIMPacket));
+#ifdef HILSIM_SLAVED_TIME
+    // The clock follows the frames, so none is ever late
+    sample.time = (systime_t)TIME_US2I(header.sim_time_us);
+#else
+    // The baseline creeps up by a microsecond a frame so that the two clocks drifting apart does not make every frame
+    // late, a delay that lasts for seconds becomes the new baseline
+    int32_t offset_us = (int32_t)(micros() - header.time_us);
+    if (!have_offset_ || offset_us < min_offset_us_) {
+        min_offset_us_ = offset_us;
+        have_offset_ = true;
+    } else {
+        min_offset_us_++;
+        if (offset_us - min_offset_us_ > HILSIM_LATE_US) {
+            late_++;
+        }
+    }
+    sample.time = chVTGetSystemTime() - TIME_US2I(offset_us - min_offset_us_);
+#endif
+    sample.count = ++received_;
+    bus_.write(sample);
+}
+
+/**
+ * @brief Answers the last sensor frame taken in.
+ */
+void HILSIMLink::sendStatus() {
+    HILSIMStatus status{};
+    status.ack_sequence = header_.sequence;
+    status.fsm_state = (uint8_t)getActiveFSMState();
+    status.servo_angle = (uint8_t)activeController.activeControlServos.angle;
+    status.ack_time_us = header_.time_us;
+    status.flap_extension = activeController.extension;
+    status.received = received_;
+    status.dropped = dropped_;
+    status.late = late_;
+    status.errors = reader_.errors();
+
+    uint32_t now_us = micros();
+    HILSIMHeader header{HILSIM_PROTOCOL_VERSION, HILSIMFrameType::Status, status_sequence_++, now_us, now_us};
+    uint8_t frame[HILSIM_MAX_FRAME];
+    size_t length = encodeHILSIMFrame(header, &status, sizeof(status), frame);
+    Serial.write(frame, length);
+    Serial.flush();
+}
+
+/**
+ * @brief Reads the most recently published sample. Only the sensor thread may call this.
+ *
+ * @param sample written with the latest sample
+ * @returns false if no sample has been published yet
+ */
+bool HILSIMLink::latest(HILSIMSample& sample) { return bus_.read(sample); }
@@ -0,0 +1,53 @@
+/**
+ * @file HILSIMLink.h
+ *
+ * @brief TARS' end of the HILSIM serial link, see HILSIMProtocol.h.
+ *
+ * Each sensor frame is published whole to the sensor thread as a HILSIMSample through a lock-free slot, stamped with
+ * the time it was sampled at rather than the time the sensor thread gets to it. On the Teensy that is when the frame
+ * would have arrived without the link's jitter. With HILSIM_SLAVED_TIME the flight code runs on the simulated clock
+ * instead, tools/hilsim_target moves that clock on as the frames arrive and the samples carry the simulated time.
+ */
+
+#pragma once
+
+#include "common/TripleBuffer.h"
+#include "mcu_main/hilsim/HILSIMPacket.h"
+#include "mcu_main/hilsim/HILSIMProtocol.h"
+
+class HILSIMLink;
+
+extern HILSIMLink hilsim_link;
+
+class HILSIMLink {
+   public:
+    void update();
+    bool receive(uint8_t byte);
+    void publish();
+    void sendStatus();
+    bool latest(HILSIMSample& sample);
+
+    // Simulated time of the sensor frame receive() completed
+    uint32_t receivedSimTimeUs() const { return reader_.header().sim_time_us; }
+
+    uint32_t received() const { return received_; }
+    uint32_t dropped() const { return dropped_; }
+    uint32_t late() const { return late_; }
+    uint32_t errors() const { return reader_.errors(); }
+
+   private:
+    HILSIMFrameReader reader_;
+    TripleBuffer<HILSIMSample> bus_;
+    // Header of the last sensor frame taken in, the one the next status frame answers
+    HILSIMHeader header_{};
+    uint16_t status_sequence_ = 0;
+    uint16_t next_sequence_ = 0;
+
+    // Smallest difference between the local clock and the host's seen in this stream, the link's fixed delay
+    bool have_offset_ = false;
+    int32_t min_offset_us_ = 0;
+
+    uint32_t received_ = 0;
+    uint32_t dropped_ = 0;
+    uint32_t late_ = 0;
+};
@@ -43,3 +43,13 @@ typedef struct HILSIMPacket {
     float ornt_pitch{};
     float ornt_yaw{};
 } HILSIMPacket;
+
+/**
+ * @brief A HILSIMPacket as published to the sensor thread, with the time on the flight code's clock it was sampled at.
+ */
+struct HILSIMSample {
+    HILSIMPacket packet;
+    systime_t time;
+    // Counts the samples published, the sensor thread only takes in each one once
+    uint32_t count;
+};
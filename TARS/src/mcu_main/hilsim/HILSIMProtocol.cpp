@@ -0,0 +1,142 @@
+/**
+ * @file HILSIMProtocol.cpp
+ *
+ * @brief COBS framing and CRC-16 of the HILSIM link.
+ */
+
+#include "mcu_main/hilsim/HILSIMProtocol.h"
+
+#include <cstring>
+
+/**
+ * @brief CRC-16/CCITT-FALSE, polynomial 0x1021 starting from 0xFFFF.
+ */
+uint16_t crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Consistent overhead byte stuffing, replaces every zero byte by the distance to the next one.
+ *
+ * @param out room for length + length / 254 + 1 bytes
+ * @return number of bytes written, none of them zero
+ */
+size_t cobsEncode(const uint8_t* data, size_t length, uint8_t* out) {
+    size_t code_index = 0;
+    size_t written = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != 0) {
+            out[written++] = data[i];
+            code++;
+        }
+        if (data[i] == 0 || code == 0xFF) {
+            out[code_index] = code;
+            code_index = written++;
+            code = 1;
+        }
+    }
+    out[code_index] = code;
+    return written;
+}
+
+/**
+ * @return number of bytes decoded, 0 if the data is not valid COBS
+ */
+size_t cobsDecode(const uint8_t* data, size_t length, uint8_t* out) {
+    size_t written = 0;
+    size_t i = 0;
+    while (i < length) {
+        uint8_t code = data[i++];
+        if (code == 0 || i + code - 1 > length) {
+            return 0;
+        }
+        for (uint8_t j = 1; j < code; j++) {
+            out[written++] = data[i++];
+        }
+        if (code != 0xFF && i < length) {
+            out[written++] = 0;
+        }
+    }
+    return written;
+}
+
+/**
+ * @param header sent as it is, its version should be HILSIM_PROTOCOL_VERSION
+ * @param out room for HILSIM_MAX_FRAME bytes
+ * @return length of the frame, delimiters included
+ */
+size_t encodeHILSIMFrame(const HILSIMHeader& header, const void* body, size_t size, uint8_t* out) {
+    uint8_t payload[HILSIM_MAX_PAYLOAD];
+    memcpy(payload, &header, sizeof(header));
+    memcpy(payload + sizeof(header), body, size);
+    size_t length = sizeof(header) + size;
+    uint16_t crc = crc16(payload, length);
+    payload[length++] = (uint8_t)crc;
+    payload[length++] = (uint8_t)(crc >> 8);
+
+    out[0] = 0;
+    size_t written = 1 + cobsEncode(payload, length, out + 1);
+    out[written++] = 0;
+    return written;
+}
+
+/**
+ * @brief Takes in the next byte received.
+ *
+ * @return true if the byte completed a valid frame, available through header() and body() until the next call.
+ *         Text in between frames is available through text() the same way.
+ */
+bool HILSIMFrameReader::push(uint8_t byte) {
+    text_size_ = 0;
+    if (byte != 0) {
+        if (length_ < sizeof(frame_)) {
+            frame_[length_++] = byte;
+        } else {
+            overflow_ = true;
+        }
+        printable_ = printable_ && ((byte >= ' ' && byte <= '~') || byte == '\r' || byte == '\n' || byte == '\t');
+        last_ = byte;
+        return false;
+    }
+
+    // Back to back delimiters enclose nothing
+    bool valid = length_ > 0 && decode();
+    if (length_ > 0 && !valid) {
+        // A frame is never only printable bytes ending in a newline, its header holds a byte below ' '
+        if (printable_ && last_ == '\n') {
+            text_size_ = length_;
+        } else {
+            errors_++;
+        }
+    }
+    length_ = 0;
+    overflow_ = false;
+    printable_ = true;
+    return valid;
+}
+
+bool HILSIMFrameReader::decode() {
+    size_t length = overflow_ ? 0 : cobsDecode(frame_, length_, payload_);
+    if (length < sizeof(HILSIMHeader) + 2 || length > HILSIM_MAX_PAYLOAD) {
+        return false;
+    }
+    length -= 2;
+    uint16_t crc = (uint16_t)(payload_[length] | (payload_[length + 1] << 8));
+    if (crc != crc16(payload_, length)) {
+        return false;
+    }
+    memcpy(&header_, payload_, sizeof(header_));
+    if (header_.version != HILSIM_PROTOCOL_VERSION) {
+        return false;
+    }
+    body_size_ = length - sizeof(HILSIMHeader);
+    return true;
+}
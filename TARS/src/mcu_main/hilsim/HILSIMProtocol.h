@@ -0,0 +1,112 @@
+/**
+ * @file HILSIMProtocol.h
+ *
+ * @brief Binary framing of the HILSIM serial link, shared by the flight code and tools/hilsim_stream.
+ *
+ * Every frame is a header, a body and the CRC-16 of both, COBS encoded and sent between two zero bytes. A zero byte
+ * therefore always ends a frame, so a receiver resynchronizes on the next one after a lost or corrupted byte, and text
+ * printed on the same serial port ends up in frames of its own that fail the CRC.
+ *
+ * The host sends a HILSIMPacket in a sensor frame at every recorded timestamp, and TARS answers each one it takes in
+ * with a status frame that carries the flap command, the FSM state and TARS' own receive counters. Both ends are
+ * little-endian, so the structs are sent as they are laid out in memory.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mcu_main/hilsim/HILSIMPacket.h"
+
+// Bumped on every change to the frame layout, frames of another version are rejected
+#define HILSIM_PROTOCOL_VERSION 2
+
+enum class HILSIMFrameType : uint8_t {
+    Sensor = 1,
+    Status = 2,
+};
+
+struct HILSIMHeader {
+    uint8_t version;
+    HILSIMFrameType type;
+    // Counts the frames of each type from each side, gaps are dropped frames
+    uint16_t sequence;
+    // Sender's clock in us. The host's is the time the frame was due to be sent, relative to the start of the stream.
+    uint32_t time_us;
+    // Simulated time in us the sample stands for, from the start of the stream at normal speed. TARS sends its own
+    // system time.
+    uint32_t sim_time_us;
+};
+
+/**
+ * @brief Body of the status frame TARS returns for every sensor frame it takes in.
+ */
+struct HILSIMStatus {
+    // Sequence number and header time of the sensor frame being answered, so the host can time the round trip
+    uint16_t ack_sequence;
+    uint8_t fsm_state;
+    uint8_t servo_angle;
+    uint32_t ack_time_us;
+    // Flap extension last commanded by the controller, in mm
+    float flap_extension;
+    // Sensor frames taken in, lost in between, more than HILSIM_LATE_US behind the others, and frames rejected
+    uint32_t received;
+    uint32_t dropped;
+    uint32_t late;
+    uint32_t errors;
+};
+
+static_assert(sizeof(HILSIMHeader) == 12, "HILSIMHeader must not be padded");
+static_assert(sizeof(HILSIMPacket) == 76, "HILSIMPacket must not be padded");
+static_assert(sizeof(HILSIMStatus) == 28, "HILSIMStatus must not be padded");
+
+// A frame is late if it took this much longer to arrive than the quickest frame so far
+#define HILSIM_LATE_US 2000
+
+#define HILSIM_MAX_BODY sizeof(HILSIMPacket)
+#define HILSIM_MAX_PAYLOAD (sizeof(HILSIMHeader) + HILSIM_MAX_BODY + 2)
+// COBS adds a byte per 254 and the frame has a zero byte on either side
+#define HILSIM_MAX_FRAME (HILSIM_MAX_PAYLOAD + HILSIM_MAX_PAYLOAD / 254 + 3)
+
+uint16_t crc16(const uint8_t* data, size_t length);
+
+size_t cobsEncode(const uint8_t* data, size_t length, uint8_t* out);
+
+size_t cobsDecode(const uint8_t* data, size_t length, uint8_t* out);
+
+size_t encodeHILSIMFrame(const HILSIMHeader& header, const void* body, size_t size, uint8_t* out);
+
+/**
+ * @brief Reassembles frames from the bytes received one at a time.
+ */
+class HILSIMFrameReader {
+   public:
+    bool push(uint8_t byte);
+
+    const HILSIMHeader& header() const { return header_; }
+    const uint8_t* body() const { return payload_ + sizeof(HILSIMHeader); }
+    size_t bodySize() const { return body_size_; }
+
+    // Text printed on the same port in between frames, cut to HILSIM_MAX_FRAME bytes and kept until the next byte
+    const char* text() const { return (const char*)frame_; }
+    size_t textSize() const { return text_size_; }
+
+    // Frames that did not decode, failed the CRC or had another version
+    uint32_t errors() const { return errors_; }
+
+   private:
+    bool decode();
+
+    uint8_t frame_[HILSIM_MAX_FRAME];
+    size_t length_ = 0;
+    bool overflow_ = false;
+    bool printable_ = true;
+    uint8_t last_ = 0;
+    size_t text_size_ = 0;
+
+    uint8_t payload_[HILSIM_MAX_FRAME];
+    HILSIMHeader header_{};
+    size_t body_size_ = 0;
+    uint32_t errors_ = 0;
+};
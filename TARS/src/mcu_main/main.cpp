@@ -32,6 +32,10 @@
 #include <Wire.h>
 
 #include "mcu_main/Abort.h"
+#include "mcu_main/PeriodicTask.h"
+#include "mcu_main/Profiler.h"
+#include "mcu_main/ThreadTable.h"
+#include "mcu_main/Trace.h"
 #include "mcu_main/SDLogger.h"
 #include "mcu_main/buzzer/buzzer.h"
 #include "mcu_main/dataLog.h"
@@ -39,8 +43,9 @@
 #include "mcu_main/error.h"
 #include "mcu_main/finite-state-machines/rocketFSM.h"
 #include "mcu_main/gnc/ActiveControl.h"
+#include "mcu_main/gnc/ApogeePredictor.h"
 #include "mcu_main/gnc/kalmanFilter.h"
-#include "mcu_main/hilsim/HILSIMPacket.h"
+#include "mcu_main/hilsim/HILSIMLink.h"
 #include "mcu_main/pins.h"
 #include "mcu_main/sensors/sensors.h"
 #include "mcu_main/telemetry.h"
@@ -50,65 +55,15 @@
 #define ENABLE_SENSOR_FAST
 #endif
 
-#ifdef ENABLE_HILSIM_MODE
-HILSIMPacket hilsim_reader;
+// With HILSIM_SLAVED_TIME tools/hilsim_target takes in the frames as it moves the clock on
+#if defined(ENABLE_HILSIM_MODE) && !defined(HILSIM_SLAVED_TIME)
+bool hilsim_start = false;
 
 static THD_FUNCTION(hilsim_THD, arg) {
-    // Creating array for data to be read into
-    char data_read[512];
-    int fields_to_read = 19;
-    Serial.setTimeout(10);
-    Serial.println("[TARS] Hardware-in-Loop Test Commenced");
-
-    while (1) {
-        int bytes_read = Serial.readBytesUntil('\n', data_read, 511);
-        if (bytes_read > 0) {
-            Serial.println(bytes_read);
-            Serial.println("Got something");
-            if (data_read[bytes_read - 1] == '\r') data_read[bytes_read - 1] = 0;
-
-            char* token;
-            float parsed_values[fields_to_read];
-            int i = 0;
-            token = strtok(data_read, ",");
-            while (token) {
-                parsed_values[i] = atof(token);
-                token = strtok(NULL, ",");
-                i++;
-            }
-            hilsim_reader.imu_high_ax = parsed_values[0];
-            hilsim_reader.imu_high_ay = parsed_values[1];
-            hilsim_reader.imu_high_az = parsed_values[2];
-            hilsim_reader.barometer_altitude = parsed_values[3];
-            hilsim_reader.barometer_temperature = parsed_values[4];
-            hilsim_reader.barometer_pressure = parsed_values[5];
-            hilsim_reader.imu_low_ax = parsed_values[6];
-            hilsim_reader.imu_low_ay = parsed_values[7];
-            hilsim_reader.imu_low_az = parsed_values[8];
-            hilsim_reader.imu_low_gx = parsed_values[9];
-            hilsim_reader.imu_low_gy = parsed_values[10];
-            hilsim_reader.imu_low_gz = parsed_values[11];
-            hilsim_reader.mag_x = parsed_values[12];
-            hilsim_reader.mag_y = parsed_values[13];
-            hilsim_reader.mag_z = parsed_values[14];
-            hilsim_reader.ornt_roll = parsed_values[15];
-            hilsim_reader.ornt_pitch = parsed_values[16];
-            hilsim_reader.ornt_yaw = parsed_values[17];
-
-            Serial.print("ax: ");
-            Serial.println(hilsim_reader.imu_high_ax);
-            Serial.print("ay: ");
-            Serial.println(hilsim_reader.imu_high_ay);
-            Serial.print("az: ");
-            Serial.println(hilsim_reader.imu_high_az);
-            Serial.print("Barom alt: ");
-            Serial.println(hilsim_reader.barometer_altitude);
-
-            data_read[bytes_read] = 0;
-        } else {
-            Serial.println("Got nothing");
-        }
+    hilsim_start = true;
 
+    while (true) {
+        hilsim_link.update();
         chThdSleepMilliseconds(1);
     }
 }
@@ -119,16 +74,20 @@ static THD_FUNCTION(hilsim_THD, arg) {
 
 #ifdef ENABLE_TELEMETRY
 bool telemetry_buffering_start = false;
+// About 13 datapoints for each packet sent, of which the bit packed frames have room for 11 in boost, the summary in
+// the status covering the samples in between
+PeriodicTask telemetry_buffering_task("telemetry_buffering", TIME_MS2I(30));
 
 static THD_FUNCTION(telemetry_buffering_THD, arg) {
     telemetry_buffering_start = true;
 
+    telemetry_buffering_task.start();
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### telemetry buffering thread entrance");
 #endif
         tlm.bufferData();
-        chThdSleepMilliseconds(80);
+        telemetry_buffering_task.waitNext();
     }
 }
 #endif
@@ -138,21 +97,23 @@ static THD_FUNCTION(telemetry_buffering_THD, arg) {
 
 #ifdef ENABLE_TELEMETRY
 bool telemetry_sending_start = false;
+// Woken by the radio's interrupts rather than a period
+PeriodicTask telemetry_sending_task("telemetry_sending", 0);
 
 static THD_FUNCTION(telemetry_sending_THD, arg) {
     telemetry_sending_start = true;
 
+    telemetry_sending_task.start();
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### telemetry sending thread entrance");
 #endif
-        tlm.transmit();
+        sysinterval_t timeout = tlm.serviceRadio();
 
         if (tlm.abort) {
             startAbort();
         }
-        chThdSleepMilliseconds(200);
-        // transmit has a sleep in it
+        telemetry_sending_task.waitEvents(Telemetry::radio_event, timeout);
     }
 }
 #endif
@@ -162,20 +123,39 @@ static THD_FUNCTION(telemetry_sending_THD, arg) {
 
 bool rocket_fsm_start = false;
 
+// Time from the newest high-G sample until the FSMs and the arbiter have acted on it
+DataLatency fsm_latency;
+
 static THD_FUNCTION(rocket_FSM_THD, arg) {
     rocket_fsm_start = true;
 
+    DataSubscriber high_g;
+    high_g.subscribe(dataLogger, DATA_HIGH_G);
+    FSM_State reported_state = FSM_State::STATE_UNKNOWN;
+
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### Rocket FSM thread entrance");
 #endif
 
+        TRACE_EVENT(MarkBegin, TRACE_FSM_TICK);
         fsmCollection.tick();
 
         rocketStateData<4> fsm_state = fsmCollection.getStates();
+        fsmArbiter.update(fsm_state);
+        TRACE_EVENT(MarkEnd, TRACE_FSM_TICK);
         dataLogger.pushRocketStateFifo(fsm_state);
+        fsm_latency.record(fsmCollection.getFeatures().sample_time);
+
+        // Sent down ahead of the telemetry frames as soon as it changes
+        FSM_State state = getActiveFSMState();
+        if (state != reported_state) {
+            reported_state = state;
+            tlm.postEvent(EVENT_STATE_CHANGE, (int16_t)state);
+        }
 
-        chThdSleepMilliseconds(6);  // FSM runs at 100 Hz
+        // Tick on every high-G sample, the timeout keeps the FSM timers running if the sensor stops
+        high_g.wait(TIME_MS2I(10));
     }
 }
 
@@ -184,24 +164,33 @@ static THD_FUNCTION(rocket_FSM_THD, arg) {
 
 #ifdef ENABLE_SENSOR_FAST
 bool sensor_fast_start = false;
+PeriodicTask sensor_fast_task("sensor_fast", TIME_MS2I(6));
 
 static THD_FUNCTION(sensor_fast_THD, arg) {
     sensor_fast_start = true;
+#ifdef ENABLE_HILSIM_MODE
+    uint32_t hilsim_count = 0;
+#endif
 
+    sensor_fast_task.start();
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### Sensor fast thread entrance");
 #endif
+        TRACE_EVENT(MarkBegin, TRACE_SENSOR_READ);
 #ifdef ENABLE_HILSIM_MODE
-
-        barometer.update(hilsim_reader);
-        magnetometer.update(hilsim_reader);
+        // Every sample is taken in once, like a new reading from each sensor
+        HILSIMSample sample;
+        if (hilsim_link.latest(sample) && sample.count != hilsim_count) {
+            hilsim_count = sample.count;
+            barometer.update(sample);
+            magnetometer.update(sample);
+            orientation.update(sample);
+            lowG.update(sample);
+            highG.update(sample);
+        }
         gas.refresh();
-        orientation.update(hilsim_reader);
-        lowG.update(hilsim_reader);
         voltage.read();
-        highG.update(hilsim_reader);
-
 #else
         barometer.update();
         magnetometer.update();
@@ -211,8 +200,9 @@ static THD_FUNCTION(sensor_fast_THD, arg) {
         voltage.read();
         highG.update();
 #endif
+        TRACE_EVENT(MarkEnd, TRACE_SENSOR_READ);
 
-        chThdSleepMilliseconds(6);
+        sensor_fast_task.waitNext();
     }
 }
 #endif
@@ -222,17 +212,19 @@ static THD_FUNCTION(sensor_fast_THD, arg) {
 
 #ifdef ENABLE_GPS
 bool gps_start = false;
+PeriodicTask gps_task("gps", TIME_MS2I(200));  // Read the gps @ 5 Hz
 
 static THD_FUNCTION(gps_THD, arg) {
     gps_start = true;
 
+    gps_task.start();
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### GPS thread entrance");
 #endif
         gps.update();
 
-        chThdSleepMilliseconds(190);  // Read the gps @ ~5 Hz
+        gps_task.waitNext();
     }
 }
 #endif
@@ -241,6 +233,7 @@ static THD_FUNCTION(gps_THD, arg) {
 /* KALMAN FILTER THREAD                                                       */
 
 bool kalman_start = false;
+PeriodicTask kalman_task("kalman", TIME_MS2I(50));
 
 static THD_FUNCTION(kalman_THD, arg) {
     kalman_start = true;
@@ -249,17 +242,20 @@ static THD_FUNCTION(kalman_THD, arg) {
 
     systime_t last = chVTGetSystemTime();
 
+    kalman_task.start();
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### Kalman thread entrance");
 #endif
         // Serial.println("entering tick");
+        TRACE_EVENT(MarkBegin, TRACE_KALMAN_UPDATE);
         kalmanFilter.kfTickFunction(TIME_I2MS(chVTGetSystemTime() - last), 13.0);
+        TRACE_EVENT(MarkEnd, TRACE_KALMAN_UPDATE);
         // Serial.println("exiting tick");
         // Serial.println(TIME_I2MS(chVTGetSystemTime() - last));
         last = chVTGetSystemTime();
 
-        chThdSleepMilliseconds(50);
+        kalman_task.waitNext();
     }
 }
 
@@ -273,13 +269,48 @@ static THD_FUNCTION(servo_THD, arg) {
 
     activeController.init();
 
+    DataSubscriber rocket_state;
+    rocket_state.subscribe(dataLogger, DATA_ROCKET_STATE);
+
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("### Servo thread entrance");
 #endif
+        TRACE_EVENT(MarkBegin, TRACE_SERVO_TICK);
         activeController.ctrlTickFunction();
+        TRACE_EVENT(MarkEnd, TRACE_SERVO_TICK);
+
+        /*
+         * Tick right after the FSM so a state change reaches the flaps without waiting out a period. The FSM follows
+         * the high-G sensor, which keeps the servo near the ~166 Hz the rate limit is tuned for, and the timeout
+         * retracts stale estimates if the FSM stops.
+         */
+        rocket_state.wait(TIME_MS2I(20));
+    }
+}
+
+/******************************************************************************/
+/* APOGEE PREDICTION THREAD                                                   */
+
+bool apogee_prediction_start = false;
+
+static THD_FUNCTION(apogee_prediction_THD, arg) {
+    apogee_prediction_start = true;
 
-        chThdSleepMilliseconds(6);  // FSM runs at 166 Hz
+    DataSubscriber kalman;
+    kalman.subscribe(dataLogger, DATA_KALMAN);
+
+    while (true) {
+#ifdef THREAD_DEBUG
+        Serial.println("### Apogee prediction thread entrance");
+#endif
+        TRACE_EVENT(MarkBegin, TRACE_APOGEE_PREDICTION);
+        apogeePredictor.tick();
+        TRACE_EVENT(MarkEnd, TRACE_APOGEE_PREDICTION);
+
+        // The prediction only changes with the Kalman state. Not predicting while the filter is stalled lets the
+        // estimate age out in the controller.
+        kalman.wait(TIME_INFINITE);
     }
 }
 
@@ -292,14 +323,20 @@ bool sd_start = false;
 static THD_FUNCTION(dataLogger_THD, arg) {
     sd_start = true;
 
+    DataSubscriber high_g;
+    high_g.subscribe(dataLogger, DATA_HIGH_G);
+
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("Data Logging thread entrance");
 #endif
 
+        TRACE_EVENT(MarkBegin, TRACE_SD_WRITE);
         sd_logger.update();
+        TRACE_EVENT(MarkEnd, TRACE_SD_WRITE);
 
-        chThdSleepMilliseconds(6);
+        // Write one record per sensor cycle, high-G is the last sample the sensor thread pushes
+        high_g.wait(TIME_MS2I(6));
     }
 }
 #endif
@@ -309,10 +346,12 @@ static THD_FUNCTION(dataLogger_THD, arg) {
 
 #ifdef ENABLE_BUZZER
 bool buzzer_start = false;
+PeriodicTask buzzer_task("buzzer", TIME_MS2I(6));
 
 static THD_FUNCTION(buzzer_THD, arg) {
     buzzer_start = true;
 
+    buzzer_task.start();
     while (true) {
 #ifdef THREAD_DEBUG
         Serial.println("Buzzer thread entrance");
@@ -320,72 +359,99 @@ static THD_FUNCTION(buzzer_THD, arg) {
 
         buzzer1.tick();
 
-        chThdSleepMilliseconds(6);
+        buzzer_task.waitNext();
     }
 }
 #endif
 
-#define THREAD_WA 4096
+/*
+ * Stack sizes. A THREAD_PROFILING build gives every thread the same large stack so that the stack report shows what
+ * each one really needs, see printStackReport.
+ */
+#ifdef THREAD_PROFILING
+#define STACK(size) 8192
+#else
+#define STACK(size) (size)
+#endif
 
-#ifdef ENABLE_HILSIM_MODE
-static THD_WORKING_AREA(hilsim_WA, THREAD_WA);
+#if defined(ENABLE_HILSIM_MODE) && !defined(HILSIM_SLAVED_TIME)
+static THD_WORKING_AREA(hilsim_WA, STACK(4096));
 #endif
 #ifdef ENABLE_GPS
-static THD_WORKING_AREA(gps_WA, THREAD_WA);
+static THD_WORKING_AREA(gps_WA, STACK(2048));
 #endif
-static THD_WORKING_AREA(rocket_FSM_WA, THREAD_WA);
-static THD_WORKING_AREA(servo_WA, THREAD_WA);
+static THD_WORKING_AREA(rocket_FSM_WA, STACK(2048));
+static THD_WORKING_AREA(servo_WA, STACK(2048));
+static THD_WORKING_AREA(apogee_prediction_WA, STACK(4096));
 #ifdef ENABLE_SD
-static THD_WORKING_AREA(dataLogger_WA, THREAD_WA);
+static THD_WORKING_AREA(dataLogger_WA, STACK(3072));
 #endif
 #ifdef ENABLE_TELEMETRY
-static THD_WORKING_AREA(telemetry_sending_WA, THREAD_WA);
-static THD_WORKING_AREA(telemetry_buffering_WA, THREAD_WA);
+static THD_WORKING_AREA(telemetry_sending_WA, STACK(4096));
+static THD_WORKING_AREA(telemetry_buffering_WA, STACK(2048));
 #endif
-static THD_WORKING_AREA(kalman_WA, THREAD_WA);
+static THD_WORKING_AREA(kalman_WA, STACK(4096));
 #ifdef ENABLE_BUZZER
-static THD_WORKING_AREA(buzzer_WA, THREAD_WA);
+static THD_WORKING_AREA(buzzer_WA, STACK(1024));
 #endif
 #ifdef ENABLE_SENSOR_FAST
-static THD_WORKING_AREA(sensor_fast_WA, THREAD_WA);
+static THD_WORKING_AREA(sensor_fast_WA, STACK(4096));
 #endif
 
-#undef THREAD_WA
+#undef STACK
 
-#define START_THREAD(NAME) chThdCreateStatic(NAME##_WA, sizeof(NAME##_WA), NORMALPRIO + 1, NAME##_THD, nullptr)
-#define CHECK_THREAD(NAME, SHORT)                         \
-    do {                                                  \
-        Serial.print(" " SHORT ": ");                     \
-        Serial.print(NAME##_start ? "\u2713" : "\u2717"); \
-        all_passed &= NAME##_start;                       \
-    } while (0)
+#define THREAD(NAME, SHORT, STARTED, PERIOD, PRIO) \
+    { #NAME, SHORT, NAME##_THD, NAME##_WA, sizeof(NAME##_WA), PERIOD, PRIO, &STARTED }
 
-/**
- * @brief Starts all of the threads.
+/*
+ * Every thread, in start order. A priority of 0 is assigned rate monotonically from the period, with ties going to the
+ * row listed first, so the rows with the same period are in order of importance.
  */
-void chSetup() {
-#ifdef ENABLE_HILSIM_MODE
-    START_THREAD(hilsim);
+static ThreadConfig threads[] = {
+#if defined(ENABLE_HILSIM_MODE) && !defined(HILSIM_SLAVED_TIME)
+    THREAD(hilsim, "HIL", hilsim_start, TIME_MS2I(1), 0),
 #endif
 #ifdef ENABLE_TELEMETRY
-    START_THREAD(telemetry_sending);
-    START_THREAD(telemetry_buffering);
-#endif
-    START_THREAD(rocket_FSM);
-#ifdef ENABLE_GPS
-    START_THREAD(gps);
+    // Woken by the radio, below every periodic thread since a late frame only delays the downlink
+    THREAD(telemetry_sending, "TLMS", telemetry_sending_start, telemetry_sending_task.period(), NORMALPRIO + 2),
+    THREAD(telemetry_buffering, "TLMB", telemetry_buffering_start, telemetry_buffering_task.period(), 0),
 #endif
 #ifdef ENABLE_SENSOR_FAST
-    START_THREAD(sensor_fast);
+    THREAD(sensor_fast, "SF", sensor_fast_start, sensor_fast_task.period(), 0),
 #endif
-    START_THREAD(servo);
+    // Woken by every high-G sample
+    THREAD(rocket_FSM, "FSM", rocket_fsm_start, TIME_MS2I(6), 0),
+#ifdef ENABLE_GPS
+    THREAD(gps, "GPS", gps_start, gps_task.period(), 0),
+#endif
+    // Woken by every FSM tick
+    THREAD(servo, "SRV", servo_start, TIME_MS2I(6), 0),
+    // Runs below every other thread so that a slow prediction can never delay the servo loop, but above the main
+    // thread which spins forever at NORMALPRIO once setup is done
+    THREAD(apogee_prediction, "APO", apogee_prediction_start, kalman_task.period(), NORMALPRIO + 1),
 #ifdef ENABLE_SD
-    START_THREAD(dataLogger);
+    // Woken by every high-G sample, below the threads that act on them so writing the card can not delay them
+    THREAD(dataLogger, "SD", sd_start, TIME_MS2I(6), 0),
 #endif
-    START_THREAD(kalman);
+    THREAD(kalman, "KLMN", kalman_start, kalman_task.period(), 0),
 #ifdef ENABLE_BUZZER
-    START_THREAD(buzzer);
+    THREAD(buzzer, "BUZZ", buzzer_start, buzzer_task.period(), 0),
 #endif
+};
+
+#undef THREAD
+
+static constexpr size_t thread_count = sizeof(threads) / sizeof(threads[0]);
+
+/**
+ * @brief Starts all of the threads.
+ */
+void chSetup() {
+#ifdef ENABLE_TRACE
+    traceRegisterThread(chThdGetSelfX(), "main");
+#endif
+    assignPriorities(threads, thread_count, NORMALPRIO + 3);
+    startThreads(threads, thread_count);
 
     bool all_passed;
     do {
@@ -393,41 +459,46 @@ void chSetup() {
         all_passed = true;
 
         Serial.print("Thread Starts:");
-#ifdef ENABLE_TELEMETRY
-        CHECK_THREAD(telemetry_sending, "TLMS");
-        CHECK_THREAD(telemetry_buffering, "TLMB");
-#endif
-        CHECK_THREAD(rocket_fsm, "FSM");
-#ifdef ENABLE_GPS
-        CHECK_THREAD(gps, "GPS");
-#endif
-#ifdef ENABLE_SENSOR_FAST
-        CHECK_THREAD(sensor_fast, "SF");
-#endif
-        CHECK_THREAD(servo, "SRV");
-#ifdef ENABLE_SD
-        CHECK_THREAD(sd, "SD");
-#endif
-        CHECK_THREAD(kalman, "KLMN");
-#ifdef ENABLE_BUZZER
-        CHECK_THREAD(buzzer, "BUZZ");
-#endif
+        for (const ThreadConfig& thread : threads) {
+            Serial.print(" ");
+            Serial.print(thread.short_name);
+            Serial.print(": ");
+            Serial.print(*thread.started ? "\u2713" : "\u2717");
+            all_passed &= *thread.started;
+        }
         Serial.println("");
 
         chThdSleepMilliseconds(200);
         digitalWrite(LED_GREEN, LOW);
         chThdSleepMilliseconds(200);
     } while (!all_passed);
+    printStackReport(threads, thread_count);
     // buzzer1.init_sponge();
     buzzer1.init_sponge();
     // buzzer1.init_mario();
-    while (true)
-        ;
+    while (true) {
+#ifdef TASK_STATS
+        printTaskStats();
+#endif
+#ifdef THREAD_PROFILING
+        printStackReport(threads, thread_count);
+#endif
+#ifdef ENABLE_PROFILING
+        ProfileSite::printSummary(Serial);
+#endif
+#if defined(ENABLE_TRACE) && !defined(ENABLE_HILSIM_MODE)
+        // HILSIM owns the serial input
+        if (Serial.available() && Serial.read() == 't') {
+            traceDumpSerial();
+        }
+#endif
+        // The native build's threads run in parallel, so spinning here would keep a host core busy for nothing
+#if defined(TASK_STATS) || defined(THREAD_PROFILING) || defined(ENABLE_PROFILING) || !defined(ARDUINO)
+        chThdSleepMilliseconds(1000);
+#endif
+    }
 }
 
-#undef CHECK_THREAD
-#undef START_THREAD
-
 /**
  * @brief Handles all configuration necessary before the threads start.
  *
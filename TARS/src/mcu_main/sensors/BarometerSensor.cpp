@@ -26,13 +26,13 @@ void BarometerSensor::update() {
 #endif
 }
 
-void BarometerSensor::update(HILSIMPacket hilsim_packet) {
+void BarometerSensor::update(const HILSIMSample& sample) {
 #ifdef ENABLE_BAROMETER
     chMtxLock(&mutex);
-    pressure = hilsim_packet.barometer_pressure;
-    temperature = hilsim_packet.barometer_temperature;
-    altitude = hilsim_packet.barometer_altitude;
-    dataLogger.pushBarometerFifo((BarometerData){temperature, pressure, altitude, chVTGetSystemTime()});
+    pressure = sample.packet.barometer_pressure;
+    temperature = sample.packet.barometer_temperature;
+    altitude = sample.packet.barometer_altitude;
+    dataLogger.pushBarometerFifo((BarometerData){temperature, pressure, altitude, sample.time});
     chMtxUnlock(&mutex);
 #endif
 }
@@ -25,7 +25,7 @@ struct BarometerSensor {
 
     ErrorCode __attribute__((warn_unused_result)) init();
     void update();
-    void update(HILSIMPacket hilsim_packet);
+    void update(const HILSIMSample& sample);
 
     float getPressure() const;
     float getTemperature() const;
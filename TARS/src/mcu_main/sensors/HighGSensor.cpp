@@ -23,15 +23,16 @@ void HighGSensor::update() {
 #endif
 }
 
-void HighGSensor::update(HILSIMPacket hilsim_packet) {
+void HighGSensor::update(const HILSIMSample& sample) {
 #ifdef ENABLE_HIGH_G
     chSysLock();
     chMtxLock(&mutex);
-    ax = hilsim_packet.imu_high_ax;
-    ay = hilsim_packet.imu_high_ay;
-    az = hilsim_packet.imu_high_az;
+    ax = sample.packet.imu_high_ax;
+    ay = sample.packet.imu_high_ay;
+    az = sample.packet.imu_high_az;
 
-    dataLogger.pushHighGFifo((HighGData){ax, ay, az, chVTGetSystemTime()});
+    timestamp = sample.time;
+    dataLogger.pushHighGFifo((HighGData){ax, ay, az, timestamp});
 
     chMtxUnlock(&mutex);
     chSysUnlock();
@@ -40,6 +41,8 @@ void HighGSensor::update(HILSIMPacket hilsim_packet) {
 
 Acceleration HighGSensor::getAccel() { return {ax, ay, az}; }
 
+systime_t HighGSensor::getTimestamp() { return timestamp; }
+
 ErrorCode HighGSensor::init() {
 #ifdef ENABLE_HIGH_G
     KX.beginSPI(KX134_CS);
@@ -29,8 +29,9 @@ struct HighGSensor {
 
     ErrorCode __attribute__((warn_unused_result)) init();
     void update();
-    void update(HILSIMPacket hilsim_packet);
+    void update(const HILSIMSample& sample);
     Acceleration getAccel();
+    systime_t getTimestamp();
 
    private:
     float ax = 0.0, ay = 0.0, az = 0.0;
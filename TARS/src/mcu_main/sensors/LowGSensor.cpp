@@ -29,18 +29,19 @@ void LowGSensor::update() {
 #endif
 }
 
-void LowGSensor::update(HILSIMPacket hilsim_packet) {
+void LowGSensor::update(const HILSIMSample& sample) {
 #ifdef ENABLE_LOW_G
     chSysLock();
     chMtxLock(&mutex);
-    ax = hilsim_packet.imu_low_ax;
-    ay = hilsim_packet.imu_low_ay;
-    az = hilsim_packet.imu_low_az;
-    gx = hilsim_packet.imu_low_gx;
-    gy = hilsim_packet.imu_low_gy;
-    gz = hilsim_packet.imu_low_gz;
+    ax = sample.packet.imu_low_ax;
+    ay = sample.packet.imu_low_ay;
+    az = sample.packet.imu_low_az;
+    gx = sample.packet.imu_low_gx;
+    gy = sample.packet.imu_low_gy;
+    gz = sample.packet.imu_low_gz;
+    timestamp = sample.time;
 
-    dataLogger.pushLowGFifo((LowGData){ax, ay, az, gx, gy, gz, chVTGetSystemTime()});
+    dataLogger.pushLowGFifo((LowGData){ax, ay, az, gx, gy, gz, timestamp});
 
     chMtxUnlock(&mutex);
     chSysUnlock();
@@ -55,7 +56,7 @@ Gyroscope LowGSensor::getGyroscope() { return Gyroscope{gx, gy, gz}; }
 ErrorCode LowGSensor::init() {
 #ifdef ENABLE_LOW_G
     // note, we need to send this our CS pins (defined above)
-    if (!LSM.begin()) {
+    if (LSM.begin() != IMU_SUCCESS) {
         return ErrorCode::CANNOT_CONNECT_LSM9DS1;
     }
 #endif
@@ -26,7 +26,7 @@ class LowGSensor {
 
     ErrorCode __attribute__((warn_unused_result)) init();
     void update();
-    void update(HILSIMPacket hilsim_packet);
+    void update(const HILSIMSample& sample);
     Acceleration getAcceleration();
     Gyroscope getGyroscope();
 
@@ -28,12 +28,12 @@ void MagnetometerSensor::update() {
 #endif
 }
 
-void MagnetometerSensor::update(HILSIMPacket hilsim_packet) {
+void MagnetometerSensor::update(const HILSIMSample& sample) {
 #ifdef ENABLE_MAGNETOMETER
-    time_stamp = chVTGetSystemTime();
-    mx = hilsim_packet.mag_x;
-    my = hilsim_packet.mag_y;
-    mz = hilsim_packet.mag_z;
+    time_stamp = sample.time;
+    mx = sample.packet.mag_x;
+    my = sample.packet.mag_y;
+    mz = sample.packet.mag_z;
     dataLogger.pushMagnetometerFifo((MagnetometerData){{mx, my, mz}, time_stamp});
 
 #endif
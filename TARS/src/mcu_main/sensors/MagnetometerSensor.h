@@ -9,7 +9,7 @@
 class MagnetometerSensor {
    public:
     void update();
-    void update(HILSIMPacket hilsim_packet);
+    void update(const HILSIMSample& sample);
     ErrorCode __attribute__((warn_unused_result)) init();
 
     Magnetometer getMagnetometer();
@@ -83,13 +83,14 @@ void OrientationSensor::update() {
 #endif
 }
 
-void OrientationSensor::update(HILSIMPacket hilsim_packet) {
+void OrientationSensor::update(const HILSIMSample& sample) {
 #ifdef ENABLE_ORIENTATION
     chSysLock();
     chMtxLock(&mutex);
-    _orientationEuler = (euler_t){hilsim_packet.ornt_roll, hilsim_packet.ornt_pitch, hilsim_packet.ornt_yaw};
+    _orientationEuler = (euler_t){sample.packet.ornt_roll, sample.packet.ornt_pitch, sample.packet.ornt_yaw};
+    time_stamp = sample.time;
     dataLogger.pushOrientationFifo(
-        (OrientationData){_accelerations, _gyro, _magnetometer, _orientationEuler, chVTGetSystemTime()});
+        (OrientationData){_accelerations, _gyro, _magnetometer, _orientationEuler, time_stamp});
     chMtxUnlock(&mutex);
     chSysUnlock();
 #endif
@@ -39,7 +39,7 @@ class OrientationSensor {
     explicit OrientationSensor(Adafruit_BNO08x const& imu);
 
     void update();
-    void update(HILSIMPacket hilsim_packet);
+    void update(const HILSIMSample& sample);
 
     ErrorCode __attribute__((warn_unused_result)) init();
 
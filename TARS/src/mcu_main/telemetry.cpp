@@ -15,31 +15,13 @@
 
 #include "mcu_main/telemetry.h"
 
-#include <limits>
-
 #include "RHHardwareSPI1.h"
+#include "mcu_main/Profiler.h"
 #include "mcu_main/dataLog.h"
 #include "mcu_main/debug.h"
 
 Telemetry tlm;
 
-/**
- * @brief This function maps an input value onto within a particular range into a fixed point value of a certin binary
- * size
- *
- * @param val: number to map into target range, values outside of the range will be clamped
- *
- * @param range: range to map number into. For unsigned output, [0, range). For signed output [-range/2, range)
- *
- * @return fixed point value represing val mapped onto the target range
- */
-template <typename T>
-T inv_convert_range(float val, float range) {
-    size_t numeric_range = (int64_t)std::numeric_limits<T>::max() - (int64_t)std::numeric_limits<T>::min() + 1;
-    float converted = val * (float)numeric_range / range;
-    return std::max(std::min((float)std::numeric_limits<T>::max(), converted), (float)std::numeric_limits<T>::min());
-}
-
 ErrorCode Telemetry::init() {
 #ifdef ENABLE_TELEMETRY
     pinMode(RFM96_RST, OUTPUT);
@@ -58,12 +40,18 @@ ErrorCode Telemetry::init() {
     }
     Serial.println("[DEBUG]: Radio Initialized");
 
-    // Defaults after init are 434.0MHz, 13dBm, Bw = 125 kHz, Cr = 4/5, Sf =
-    // 128chips/symbol, CRC on
-
     if (!rf95.setFrequency(RF95_FREQ)) {
         return ErrorCode::RADIO_SET_FREQUENCY_FAILED;
     }
+#ifdef ENABLE_TELEMETRY_FEC
+    static_assert(LINK_ANNOUNCE_FRAMES + TELEMETRY_FEC_DEPTH - 1 <= LINK_MAX_ANNOUNCE_FRAMES,
+                  "switches cannot be announced for long enough to get through the interleaver");
+    link.setAnnounceFrames(LINK_ANNOUNCE_FRAMES + TELEMETRY_FEC_DEPTH - 1);
+#endif
+    summary_queue.attach(dataLogger);
+
+    // The link starts on its most robust profile, as does the ground station, until the ground station reports in
+    applyProfile();
 
     /*
      * The default transmitter power is 13dBm, using PA_BOOST.
@@ -83,6 +71,33 @@ Telemetry::Telemetry() : rf95(RFM96_CS, RFM96_INT, hardware_spi1) {}
 Telemetry::Telemetry() {}
 #endif
 
+/**
+ * @brief Handles an uplink from the ground station: its link report, its event acknowledgement and the commands in
+ * it that have not run yet. See common/CommandProtocol.h.
+ *
+ * @param uplink with count no more than the commands the packet held
+ */
+void Telemetry::handleUplink(const CommandUplink &uplink) {
+    /* Check if the security code is present and matches on ground and on the
+     * rocket */
+    if (!CommandReceiver::verify(uplink)) {
+        return;
+    }
+    link.onReport(uplink.link);
+    chMtxLock(&events_mutex);
+    events.acknowledge(uplink.event_ack, radio_stats.event_ack_latency);
+    chMtxUnlock(&events_mutex);
+
+    /* Repeats of commands already run are acknowledged again but not run */
+    commands.setBase(uplink.base);
+    for (size_t i = 0; i < uplink.count && i < COMMAND_WINDOW; i++) {
+        if (commands.receive(uplink.commands[i].id)) {
+            radio_stats.commands_run++;
+            handleCommand(uplink.commands[i]);
+        }
+    }
+}
+
 /**
  * @brief  This function handles commands sent from the ground station
  * to TARS. The effects of this function depend on the command
@@ -94,16 +109,7 @@ Telemetry::Telemetry() {}
  * @return void
  */
 void Telemetry::handleCommand(const telemetry_command &cmd) {
-    /* Check if the security code is present and matches on ground and on the
-     * rocket */
-    if (cmd.verify != std::array<char, 6>{'A', 'Y', 'B', 'E', 'R', 'K'}) {
-        return;
-    }
-    /* Check if lasted command ID matched current command ID */
-    if (last_command_id == cmd.cmd_id) {
-        return;
-    }
-    last_command_id = (int16_t)cmd.cmd_id;
+    last_command_id = (int16_t)cmd.id;
 
     /*
      * Write frequency to SD card to save
@@ -112,6 +118,10 @@ void Telemetry::handleCommand(const telemetry_command &cmd) {
     if (cmd.command == SET_FREQ) {
         freq_status.should_change = true;
         freq_status.new_freq = cmd.freq;
+#ifdef ENABLE_TELEMETRY_FEC
+        // The ground station only follows once it has decoded the frame acknowledging it, from its last share
+        freq_status.packets_left = TELEMETRY_FEC_DEPTH - 1;
+#endif
     }
 
     if (cmd.command == SET_CALLSIGN) {
@@ -123,63 +133,219 @@ void Telemetry::handleCommand(const telemetry_command &cmd) {
         if (!abort) {
             abort = !abort;
         }
+        postEvent(EVENT_ABORT, (int16_t)cmd.id);
         Serial.println("[DEBUG]: Got abort");
     }
 }
 
-//#define TLM_DEBUG
+void Telemetry::postEvent(TelemetryEventKind kind, int16_t value) {
+    chMtxLock(&events_mutex);
+    if (!events.post(kind, value, chVTGetSystemTime())) {
+        radio_stats.events_dropped++;
+    }
+    chMtxUnlock(&events_mutex);
+}
 
 /**
- * @brief This function transmits data from the struct provided as
- * the parameter (data collected from sensor suite) to the
- * ground station. The function also switches to a new commanded
- * frequency based on a previously received command and waits for
- * a response from the ground station.
+ * @brief Moves the radio on to its next state. Called in a loop by the telemetry thread, which then waits for
+ * radio_event for as long as this returns.
  *
- * @param sensor_data: struct of data from the sensor suite to be
- *                     transmitted to the ground station.
+ * Frames go out back to back, each built from the latest data as the one before finishes, so the radio is only idle
+ * while listening. The first frame sent TELEMETRY_RX_INTERVAL_MS after the last window is flagged
+ * TELEMETRY_FLAG_LISTENING and followed by a window long enough for the ground station's command and link report, cut
+ * short once one arrives. The DIO0 interrupt ends each wait; timeouts only cover a lost interrupt. The modem profile
+ * only changes between frames, as the LinkAdapter announced.
  *
- * @return void
+ * Urgent events take priority over the routine frames: an event message goes out in place of the next frame as soon
+ * as an event is posted, and is always followed by a window for the ground station to acknowledge it in. Unacknowledged
+ * events are sent again every TELEMETRY_EVENT_RETRY_MS, with frames going out in between.
  */
-void Telemetry::transmit() {
+sysinterval_t Telemetry::serviceRadio() {
 #ifdef ENABLE_TELEMETRY
-#ifdef TLM_DEBUG
-    const uint8_t data[4] = {0, 1, 2, 3};
-    rf95.send(data, 4);
-    Serial.println("Sending packet...");
-    rf95.waitPacketSent();
-    Serial.println("Sent packet");
-#else
+    uint32_t now = micros();
+    if (last_service_us == 0) {
+        rf95.notify(chThdGetSelfX(), radio_event);
+        last_window_us = now;
+    } else {
+        radio_stats.elapsed_us += now - last_service_us;
+    }
+    last_service_us = now;
+
+    switch (radio_state) {
+        case RadioState::Idle:
+            return startTransmit();
+        case RadioState::Transmitting:
+            return finishTransmit();
+        case RadioState::Listening:
+            return finishListening();
+    }
+#endif
+    return TIME_INFINITE;
+}
+
+//#define TLM_DEBUG
+
+// Sends the next frame or event message and returns how long to wait for it to go out
+sysinterval_t Telemetry::startTransmit() {
+    TRACE_EVENT(MarkBegin, TRACE_TELEMETRY_SEND);
     static bool blue_state = false;
     digitalWrite(LED_BLUE, blue_state);
     blue_state = !blue_state;
 
-    TelemetryPacket packet = makePacket(dataLogger.read());
-    rf95.send((uint8_t *)&packet, sizeof(packet));
-
-    chThdSleepMilliseconds(170);
+    if (link.startFrame()) {
+        applyProfile();
+    }
+    const LoRaProfile& profile = link_profiles[link.profile()];
+
+    uint32_t now = micros();
+    systime_t now_time = chVTGetSystemTime();
+    chMtxLock(&events_mutex);
+    bool send_events = events.due(now_time);
+    if (send_events) {
+        events.fill(event_message, now_time, radio_stats.event_latency);
+    }
+    chMtxUnlock(&events_mutex);
+
+    listen_after_tx = send_events || now - last_window_us >= (uint32_t)TELEMETRY_RX_INTERVAL_MS * 1000;
+    uint8_t flags = listen_after_tx ? TELEMETRY_FLAG_LISTENING : 0;
+#ifdef ENABLE_TELEMETRY_FEC
+    // Event messages go out whole, with a CRC, rather than wait out the interleaver
+    if (!send_events) {
+        flags |= TELEMETRY_FLAG_FEC;
+    }
+    setModem(send_events);
+#endif
+    rf95.setHeaderFlags(flags);
+    rf95.setHeaderId(frame_sequence++);
+    // Drop an event left over from the last state
+    chEvtGetAndClearEvents(radio_event);
+#ifdef TLM_DEBUG
+    const uint8_t encoded[4] = {0, 1, 2, 3};
+    size_t size = sizeof(encoded);
+#else
+    uint8_t encoded[TELEMETRY_MAX_FRAME_SIZE];
+    size_t size = 0;
+    if (send_events) {
+        event_message.command_ack = commands.ack();
+        event_message.command_sack = commands.sack();
+        event_message.link_next = link.next();
+        event_message.link_countdown = link.countdown();
+        size = encodeTelemetryEvents(event_message, encoded, profile.max_frame);
+        radio_stats.event_messages_sent++;
+#ifdef ENABLE_TELEMETRY_FEC
+        // Its packet of the interleaver is left out, which the ground station decodes around as if it was lost
+        uint8_t skipped[TELEMETRY_MAX_FRAME_SIZE];
+        fec.push(encoded, 0, skipped);
+        // It acknowledges a frequency change whole, and the ground station follows as soon as it has it
+        freq_status.packets_left = 0;
+#endif
+    } else {
+        makeFrame(dataLogger.read());
+        // The datapoints that did not fit are dropped, oldest first
+        size_t oldest = 0;
+#ifdef ENABLE_TELEMETRY_FEC
+        // Always a whole packet, the interleaved shares of this frame and the ones before it
+        uint8_t coded[TELEMETRY_MAX_FRAME_SIZE];
+        size_t coded_size = encodeTelemetryFrame(frame, coded, fecDataLength(profile.max_frame), &oldest);
+        fec.push(coded, coded_size, encoded);
+        size = fec.length();
+#else
+        size = encodeTelemetryFrame(frame, encoded, profile.max_frame, &oldest);
+#endif
+        if (oldest < frame.datapoint_count) {
+            radio_stats.frame_latency.record(TIME_MS2I(frame.datapoints[oldest].timestamp));
+        }
+    }
+#endif
+    rf95.send(encoded, (uint8_t)size);
+    tx_airtime_us = loraAirtimeUs(profile.modulation, size + RH_RF95_HEADER_LEN);
+    state_start_us = now;
+    radio_state = RadioState::Transmitting;
+    TRACE_EVENT(MarkEnd, TRACE_TELEMETRY_SEND);
+    // Checks just after the packet should have ended
+    return TIME_US2I(tx_airtime_us + 1000);
+}
 
-    rf95.waitPacketSent();
+sysinterval_t Telemetry::finishTransmit() {
+    uint32_t elapsed = micros() - state_start_us;
+    // Twice the airtime and then some before giving up on the interrupt
+    uint32_t limit = 2 * tx_airtime_us + 10000;
+    if (rf95.mode() == RHGenericDriver::RHModeTx) {
+        if (elapsed < limit) {
+            // Checks again just after the packet should have ended, and then at the limit
+            uint32_t wait = elapsed < tx_airtime_us + 1000 ? tx_airtime_us + 1000 - elapsed : limit - elapsed;
+            return TIME_US2I(wait);
+        }
+        rf95.setModeIdle();
+        radio_stats.tx_timeouts++;
+        postEvent(EVENT_ERROR, RADIO_TX_TIMEOUT);
+    }
+    radio_stats.frames_sent++;
+    radio_stats.tx_us += elapsed < limit ? elapsed : limit;
 
-    // change the frequency after we acknowledge
-    if (freq_status.should_change) {
+    // Change the frequency once the frame acknowledging the command is out
+    if (freq_status.should_change && freq_status.packets_left > 0) {
+        freq_status.packets_left--;
+    } else if (freq_status.should_change) {
         rf95.setFrequency(freq_status.new_freq);
         freq_status.should_change = false;
     }
 
-    // Now wait for a reply
+    if (listen_after_tx) {
+        const LoRaModulation& modulation = link_profiles[link.profile()].modulation;
+        rx_window_us = loraAirtimeUs(modulation, sizeof(CommandUplink) + RH_RF95_HEADER_LEN) +
+                       (uint32_t)TELEMETRY_RX_WINDOW_MS * 1000;
+        rf95.setModeRx();
+        state_start_us = micros();
+        last_window_us = state_start_us;
+        radio_stats.rx_windows++;
+        radio_state = RadioState::Listening;
+        return TIME_US2I(rx_window_us);
+    }
+    return startTransmit();
+}
+
+sysinterval_t Telemetry::finishListening() {
+    uint32_t elapsed = micros() - state_start_us;
+    bool received = rf95.available();
+    if (!received && elapsed < rx_window_us) {
+        return TIME_US2I(rx_window_us - elapsed);
+    }
+    radio_stats.rx_us += elapsed;
+
     uint8_t buf[RH_RF95_MAX_MESSAGE_LEN];
     uint8_t len = sizeof(buf);
-    if (rf95.available() && rf95.recv(buf, &len)) {
-        telemetry_command received{};
-        memcpy(&received, buf, sizeof(received));
-
-        handleCommand(received);
+    if (received && rf95.recv(buf, &len)) {
+        CommandUplink uplink;
+        memcpy(&uplink, buf, std::min((size_t)len, sizeof(uplink)));
+        radio_stats.uplinks_received++;
+        // Dropped if too short for the commands it counts, whose ids would otherwise be taken as received
+        if (len >= commandUplinkSize(0) && len >= commandUplinkSize(std::min<size_t>(uplink.count, COMMAND_WINDOW))) {
+            handleUplink(uplink);
+        }
+    } else {
+        link.onWindowMissed();
     }
-#endif
+    return startTransmit();
+}
+
+void Telemetry::applyProfile() {
+#ifdef ENABLE_TELEMETRY_FEC
+    // The frames in flight are lost with the old packet length, as the ground station resets its decoder too
+    fec.reset(link_profiles[link.profile()].max_frame);
+    setModem(false);
+#else
+    setModem(true);
 #endif
 }
 
+// Sets the modem registers of the link's current profile, with or without the payload CRC
+void Telemetry::setModem(bool crc) {
+    LoRaModemRegisters registers = loraModemRegisters(link_profiles[link.profile()].modulation, crc);
+    RH_RF95::ModemConfig config = {registers.reg_1d, registers.reg_1e, registers.reg_26};
+    rf95.setModemRegisters(&config);
+}
+
 void printFloat(float f, int precision = 5) {
     if (isinf(f) || isnan(f)) {
         Serial.print(-1);
@@ -227,7 +393,11 @@ void Telemetry::serialPrint(const sensorDataStruct_t &sensor_data) {
     printJSONField("IMU_mx", sensor_data.magnetometer_data.magnetometer.mx);
     printJSONField("IMU_my", sensor_data.magnetometer_data.magnetometer.my);
     printJSONField("IMU_mz", sensor_data.magnetometer_data.magnetometer.mz);
+#ifdef ENABLE_FSM_VOTING
+    printJSONField("FSM_state", (int)sensor_data.rocketState_data.arbiter_state);
+#else
     printJSONField("FSM_state", (int)sensor_data.rocketState_data.rocketStates[0]);
+#endif
     printJSONField("sign", "NOSIGN");
     printJSONField("RSSI", rf95.lastRssi());
     printJSONField("Voltage", sensor_data.voltage_data.v_battery);
@@ -237,6 +407,7 @@ void Telemetry::serialPrint(const sensorDataStruct_t &sensor_data) {
     printJSONField("STE_VEL", sensor_data.kalman_data.kalman_vel_x);
     printJSONField("STE_ACC", sensor_data.kalman_data.kalman_acc_x);
     printJSONField("STE_APO", sensor_data.kalman_data.kalman_apo);
+    printJSONField("STE_APO_VAR", sensor_data.kalman_data.kalman_apo_var);
     printJSONField("BNO_YAW", sensor_data.orientation_data.angle.yaw);
     printJSONField("BNO_PITCH", sensor_data.orientation_data.angle.pitch);
     printJSONField("BNO_ROLL", sensor_data.orientation_data.angle.roll);
@@ -337,61 +508,117 @@ void Telemetry::serialPrint(const sensorDataStruct_t &sensor_data) {
     // Serial.println("}}\n");
 }
 
-TelemetryPacket Telemetry::makePacket(const sensorDataStruct_t &data_struct) {
-    TelemetryPacket packet{};
-    packet.gps_lat = data_struct.gps_data.latitude;
-    packet.gps_long = data_struct.gps_data.longitude;
-    packet.gps_alt = data_struct.gps_data.altitude;
-
-    packet.gnc_state_ax = data_struct.kalman_data.kalman_acc_x;
-    packet.gnc_state_vx = data_struct.kalman_data.kalman_vel_x;
-    packet.gnc_state_x = data_struct.kalman_data.kalman_pos_x;
-    packet.gnc_state_ay = data_struct.kalman_data.kalman_acc_y;
-    packet.gnc_state_vy = data_struct.kalman_data.kalman_vel_y;
-    packet.gnc_state_y = data_struct.kalman_data.kalman_pos_y;
-    packet.gnc_state_az = data_struct.kalman_data.kalman_acc_z;
-    packet.gnc_state_vz = data_struct.kalman_data.kalman_vel_z;
-    packet.gnc_state_z = data_struct.kalman_data.kalman_pos_z;
-    packet.gns_state_apo = data_struct.kalman_data.kalman_apo;
-
-    packet.mag_x = inv_convert_range<int16_t>(data_struct.magnetometer_data.magnetometer.mx, 8);
-    packet.mag_y = inv_convert_range<int16_t>(data_struct.magnetometer_data.magnetometer.my, 8);
-    packet.mag_z = inv_convert_range<int16_t>(data_struct.magnetometer_data.magnetometer.mz, 8);
-
-    packet.gyro_x = inv_convert_range<int16_t>(data_struct.lowG_data.gx, 8192);
-    packet.gyro_y = inv_convert_range<int16_t>(data_struct.lowG_data.gy, 8192);
-    packet.gyro_z = inv_convert_range<int16_t>(data_struct.lowG_data.gz, 8192);
-
-    packet.response_ID = last_command_id;
-    packet.rssi = rf95.lastRssi();
-    packet.voltage_battery = inv_convert_range<uint8_t>(data_struct.voltage_data.v_battery, 16);
-    packet.FSM_State = (uint8_t)data_struct.rocketState_data.rocketStates[0];
-    packet.barometer_temp = inv_convert_range<int16_t>(data_struct.barometer_data.temperature, 256);
-
-    TelemetryDataLite data{};
-    packet.datapoint_count = 0;
-    for (int8_t i = 0; i < 4 && buffered_data.pop(data); i++) {
-        packet.datapoints[i] = data;
-        packet.datapoint_count = i + (int8_t)1;
+void Telemetry::makeFrame(const sensorDataStruct_t &data_struct) {
+    PROFILE_SCOPE("Telemetry::makeFrame");
+    TelemetryStatus &status = frame.status;
+    status = TelemetryStatus{};
+    status.gps_lat = data_struct.gps_data.latitude;
+    status.gps_long = data_struct.gps_data.longitude;
+    status.gps_alt = data_struct.gps_data.altitude;
+
+    status.gnc_state_ax = data_struct.kalman_data.kalman_acc_x;
+    status.gnc_state_vx = data_struct.kalman_data.kalman_vel_x;
+    status.gnc_state_x = data_struct.kalman_data.kalman_pos_x;
+    status.gnc_state_ay = data_struct.kalman_data.kalman_acc_y;
+    status.gnc_state_vy = data_struct.kalman_data.kalman_vel_y;
+    status.gnc_state_y = data_struct.kalman_data.kalman_pos_y;
+    status.gnc_state_az = data_struct.kalman_data.kalman_acc_z;
+    status.gnc_state_vz = data_struct.kalman_data.kalman_vel_z;
+    status.gnc_state_z = data_struct.kalman_data.kalman_pos_z;
+    status.gnc_state_apo = data_struct.kalman_data.kalman_apo;
+    status.gnc_state_apo_var = data_struct.kalman_data.kalman_apo_var;
+
+    status.mag_x = data_struct.magnetometer_data.magnetometer.mx;
+    status.mag_y = data_struct.magnetometer_data.magnetometer.my;
+    status.mag_z = data_struct.magnetometer_data.magnetometer.mz;
+
+    status.gyro_x = data_struct.lowG_data.gx;
+    status.gyro_y = data_struct.lowG_data.gy;
+    status.gyro_z = data_struct.lowG_data.gz;
+
+    status.response_ID = last_command_id;
+    status.command_ack = commands.ack();
+    status.command_sack = commands.sack();
+    status.rssi = (int8_t)rf95.lastRssi();
+    status.link_next = link.next();
+    status.link_countdown = link.countdown();
+    status.voltage_battery = data_struct.voltage_data.v_battery;
+#ifdef ENABLE_FSM_VOTING
+    status.FSM_State = (uint8_t)data_struct.rocketState_data.arbiter_state;
+#else
+    status.FSM_State = (uint8_t)data_struct.rocketState_data.rocketStates[0];
+#endif
+    status.barometer_temp = data_struct.barometer_data.temperature;
+
+    chMtxLock(&summary_mutex);
+    status.highG_ax_min = summary.highG_ax.min;
+    status.highG_ax_max = summary.highG_ax.max;
+    status.highG_ax_mean = summary.highG_ax.mean();
+    status.highG_ay_min = summary.highG_ay.min;
+    status.highG_ay_max = summary.highG_ay.max;
+    status.highG_ay_mean = summary.highG_ay.mean();
+    status.highG_az_min = summary.highG_az.min;
+    status.highG_az_max = summary.highG_az.max;
+    status.highG_az_mean = summary.highG_az.mean();
+    status.flap_extension_min = summary.flap_extension.min;
+    status.flap_extension_max = summary.flap_extension.max;
+    status.flap_extension_mean = summary.flap_extension.mean();
+    summary.highG_ax.reset();
+    summary.highG_ay.reset();
+    summary.highG_az.reset();
+    summary.flap_extension.reset();
+    chMtxUnlock(&summary_mutex);
+
+    downlinked_task = downlinked_task && downlinked_task->next() ? downlinked_task->next() : PeriodicTask::first();
+    if (downlinked_task) {
+        const TaskStats& stats = downlinked_task->stats();
+        status.task_id = downlinked_task->id();
+        status.task_overruns = std::min(stats.overruns, (uint32_t)UINT8_MAX);
+        status.task_wcet_us = std::min(stats.wcet_us, (uint32_t)UINT16_MAX);
+        status.task_jitter_us_max = std::min(stats.jitter_us_max, (uint32_t)UINT16_MAX);
+    }
+
+    // The encoder sends as many of the newest as fit
+    frame.datapoint_count = 0;
+    while (frame.datapoint_count < TELEMETRY_MAX_DATAPOINTS &&
+           buffered_data.pop(frame.datapoints[frame.datapoint_count])) {
+        frame.datapoint_count++;
     }
-    return packet;
 }
 
 void Telemetry::bufferData() {
 #ifdef ENABLE_TELEMETRY
 #ifndef TLM_DEBUG
+    // Every sample since the last call goes into the summary, the datapoint only gets the latest
+    chMtxLock(&summary_mutex);
+    while (true) {
+        sensorDataStruct_t sample = summary_queue.next();
+        if (!sample.has_highG_data && !sample.has_flap_data) {
+            break;
+        }
+        if (sample.has_highG_data) {
+            summary.highG_ax.add(sample.highG_data.hg_ax);
+            summary.highG_ay.add(sample.highG_data.hg_ay);
+            summary.highG_az.add(sample.highG_data.hg_az);
+        }
+        if (sample.has_flap_data) {
+            summary.flap_extension.add(sample.flap_data.extension);
+        }
+    }
+    chMtxUnlock(&summary_mutex);
+
     sensorDataStruct_t sensor_data = dataLogger.read();
-    TelemetryDataLite data{};
+    TelemetryDatapoint data{};
     data.timestamp = TIME_I2MS(chVTGetSystemTime());
-    data.barometer_pressure = inv_convert_range<uint16_t>(sensor_data.barometer_data.pressure, 4096);
+    data.barometer_pressure = sensor_data.barometer_data.pressure;
 
-    data.highG_ax = inv_convert_range<int16_t>(sensor_data.highG_data.hg_ax, 256);
-    data.highG_ay = inv_convert_range<int16_t>(sensor_data.highG_data.hg_ay, 256);
-    data.highG_az = inv_convert_range<int16_t>(sensor_data.highG_data.hg_az, 256);
+    data.highG_ax = sensor_data.highG_data.hg_ax;
+    data.highG_ay = sensor_data.highG_data.hg_ay;
+    data.highG_az = sensor_data.highG_data.hg_az;
 
-    data.bno_pitch = inv_convert_range<int16_t>(sensor_data.orientation_data.angle.pitch, 8);
-    data.bno_yaw = inv_convert_range<int16_t>(sensor_data.orientation_data.angle.yaw, 8);
-    data.bno_roll = inv_convert_range<int16_t>(sensor_data.orientation_data.angle.roll, 8);
+    data.bno_pitch = sensor_data.orientation_data.angle.pitch;
+    data.bno_yaw = sensor_data.orientation_data.angle.yaw;
+    data.bno_roll = sensor_data.orientation_data.angle.roll;
 
     data.flap_extension = sensor_data.flap_data.extension;
     buffered_data.push(data);
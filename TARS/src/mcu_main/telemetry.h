@@ -3,10 +3,17 @@
 #include <ChRt.h>
 #include <RH_RF95.h>
 
-#include <array>
-
+#include "common/CommandProtocol.h"
+#include "common/LinkAdaptation.h"
 #include "common/MessageQueue.h"
+#include "common/TelemetryCodec.h"
+#include "common/TelemetryFec.h"
+#include "common/WindowStats.h"
 #include "common/packet.h"
+#include "mcu_main/PeriodicTask.h"
+#include "mcu_main/Trace.h"
+#include "mcu_main/dataLog.h"
+#include "mcu_main/debug.h"
 #include "mcu_main/error.h"
 #include "mcu_main/pins.h"
 
@@ -16,83 +23,192 @@
 // Change to 434.0 or other frequency, must match RX's freq!
 #define RF95_FREQ 434.0
 
+// A listening window follows the first frame sent this long after the last window opened
+#define TELEMETRY_RX_INTERVAL_MS 1000
+// How long a window stays open beyond the airtime of a command, for the ground station to start answering
+#define TELEMETRY_RX_WINDOW_MS 100
+// Events the ground station has not acknowledged are sent again this long after, with frames going out in between
+#define TELEMETRY_EVENT_RETRY_MS 500
+
 class Telemetry;
 extern Telemetry tlm;
 
-struct TelemetryDataLite {
-    systime_t timestamp;  //[0, 2^32]
-
-    uint16_t barometer_pressure;  //[0, 4096]
-    int16_t highG_ax;             //[128, -128]
-    int16_t highG_ay;             //[128, -128]
-    int16_t highG_az;             //[128, -128]
-    int16_t bno_roll;             //[-4,4]
-    int16_t bno_pitch;            //[-4,4]
-    int16_t bno_yaw;              //[-4,4]
+/**
+ * @brief How the radio has spent its time since the telemetry thread started.
+ */
+struct RadioStats {
+    uint32_t frames_sent = 0;
+    // Frames whose TX done interrupt never came
+    uint32_t tx_timeouts = 0;
+    uint32_t rx_windows = 0;
+    uint32_t uplinks_received = 0;
+    // Commands run, each once however many times it was received
+    uint32_t commands_run = 0;
+    uint64_t tx_us = 0;
+    uint64_t rx_us = 0;
+    uint64_t elapsed_us = 0;
+    uint32_t event_messages_sent = 0;
+    // Events dropped unsent or unacknowledged to make room for newer ones
+    uint32_t events_dropped = 0;
+    // From an event being posted until it was first sent, and until the ground station acknowledged it
+    DataLatency event_latency;
+    DataLatency event_ack_latency;
+    // From the oldest datapoint of a frame being buffered until the frame was sent
+    DataLatency frame_latency;
 
-    float flap_extension;  //[0, 256]
+    // Share of the time spent transmitting
+    float utilization() const { return elapsed_us ? (float)tx_us / (float)elapsed_us : 0; }
 };
 
-struct TelemetryPacket {
-    TelemetryDataLite datapoints[4];
-    float gps_lat;
-    float gps_long;
-    float gps_alt;
-    float yaw;
-    float pitch;
-    float roll;
-    float gnc_state_x;
-    float gnc_state_vx;
-    float gnc_state_ax;
-    float gnc_state_y;
-    float gnc_state_vy;
-    float gnc_state_ay;
-    float gnc_state_z;
-    float gnc_state_vz;
-    float gnc_state_az;
-    float gns_state_apo;
-    int16_t mag_x;            //[-4, 4]
-    int16_t mag_y;            //[-4, 4]
-    int16_t mag_z;            //[-4, 4]
-    int16_t gyro_x;           //[-4096, 4096]
-    int16_t gyro_y;           //[-4096, 4096]
-    int16_t gyro_z;           //[-4096, 4096]
-    int16_t response_ID;      //[0, 2^16]
-    int8_t rssi;              //[-128, 128]
-    int8_t datapoint_count;   //[0,4]
-    uint8_t voltage_battery;  //[0, 16]
-    uint8_t FSM_State;        //[0,256]
-    int16_t barometer_temp;   //[-128, 128]
+/**
+ * @brief The high rate channels over the interval of a frame, from every sample rather than one per datapoint.
+ */
+struct TelemetrySummary {
+    WindowStats highG_ax;
+    WindowStats highG_ay;
+    WindowStats highG_az;
+    WindowStats flap_extension;
 };
 
-// Commands transmitted from ground station to rocket
-enum CommandType { SET_FREQ, SET_CALLSIGN, ABORT, TEST_FLAPS, EMPTY };
+/**
+ * @brief The events the ground station has not acknowledged yet, oldest first.
+ *
+ * They all go out together in every event message. The ground station answers one with the id of the next event it
+ * is waiting for, which drops those before it.
+ */
+class TelemetryEventQueue {
+   public:
+    // Queues an event unless it repeats the newest one still waiting, so a state entered again after another is sent
+    // again. Returns false if the oldest had to be dropped for it.
+    bool post(TelemetryEventKind kind, int16_t value, systime_t now) {
+        if (count_ > 0 && entries_[count_ - 1].event.kind == kind && entries_[count_ - 1].event.value == value) {
+            return true;
+        }
+        bool full = count_ == TELEMETRY_MAX_EVENTS;
+        if (full) {
+            drop(1);
+        }
+        Entry& entry = entries_[count_++];
+        entry.event.id = next_id_++;
+        entry.event.kind = kind;
+        entry.event.timestamp = TIME_I2MS(now);
+        entry.event.value = value;
+        entry.posted = now;
+        entry.sent = false;
+        return !full;
+    }
+
+    // Whether to send an event message rather than the next frame: an event has not gone out yet, or the last message
+    // went unacknowledged for TELEMETRY_EVENT_RETRY_MS
+    bool due(systime_t now) const {
+        if (count_ == 0) {
+            return false;
+        }
+        return !entries_[count_ - 1].sent || now - last_sent_ >= TIME_MS2I(TELEMETRY_EVENT_RETRY_MS);
+    }
+
+    // Puts every waiting event in message, recording how long the ones going out for the first time waited
+    void fill(TelemetryEventMessage& message, systime_t now, DataLatency& latency) {
+        message.event_count = (uint8_t)count_;
+        for (size_t i = 0; i < count_; i++) {
+            message.events[i] = entries_[i].event;
+            if (!entries_[i].sent) {
+                latency.record(entries_[i].posted);
+                entries_[i].sent = true;
+            }
+        }
+        last_sent_ = now;
+    }
 
-struct telemetry_command {
-    CommandType command;
-    int cmd_id;
-    union {
-        char callsign[8];
-        float freq;
-        bool do_abort;
+    // Drops the events before ack, ignoring an ack for events never sent, such as that of a ground station which has
+    // heard none yet
+    void acknowledge(uint8_t ack, DataLatency& latency) {
+        if (count_ == 0) {
+            return;
+        }
+        size_t acknowledged = (uint8_t)(ack - entries_[0].event.id);
+        if (acknowledged > count_ || (acknowledged > 0 && !entries_[acknowledged - 1].sent)) {
+            return;
+        }
+        for (size_t i = 0; i < acknowledged; i++) {
+            latency.record(entries_[i].posted);
+        }
+        drop(acknowledged);
+    }
+
+   private:
+    struct Entry {
+        TelemetryEvent event;
+        systime_t posted;
+        bool sent;
     };
-    std::array<char, 6> verify;
+
+    void drop(size_t count) {
+        for (size_t i = count; i < count_; i++) {
+            entries_[i - count] = entries_[i];
+        }
+        count_ -= count;
+    }
+
+    Entry entries_[TELEMETRY_MAX_EVENTS];
+    size_t count_ = 0;
+    uint8_t next_id_ = 0;
+    systime_t last_sent_ = 0;
+};
+
+/**
+ * @brief The RFM96, waking the telemetry thread from its DIO0 interrupt once RadioHead has handled it.
+ */
+class TelemetryRadio : public RH_RF95 {
+   public:
+    using RH_RF95::RH_RF95;
+
+    // Thread to signal with event on every TX done, RX done or bad packet
+    void notify(thread_t* thread, eventmask_t event) {
+        thread_ = thread;
+        event_ = event;
+    }
+
+   protected:
+    void handleInterrupt() override {
+        CH_IRQ_PROLOGUE();
+        TRACE_EVENT(IsrEnter, RFM96_INT);
+        RH_RF95::handleInterrupt();
+        chSysLockFromISR();
+        if (thread_) {
+            chEvtSignalI(thread_, event_);
+        }
+        chSysUnlockFromISR();
+        TRACE_EVENT(IsrExit, RFM96_INT);
+        CH_IRQ_EPILOGUE();
+    }
+
+   private:
+    thread_t* volatile thread_ = nullptr;
+    eventmask_t event_ = 0;
 };
 
 struct command_handler_struct {
     bool should_change{};
     float new_freq{};
+    // Packets still to send on the old frequency after the next, for the rest of the acknowledging frame's shares
+    uint8_t packets_left{};
 };
 
 class Telemetry {
    public:
+    // Event the radio signals the telemetry thread with
+    static constexpr eventmask_t radio_event = EVENT_MASK(0);
+
     bool abort = false;
 
     Telemetry();
 
     ErrorCode __attribute__((warn_unused_result)) init();
 
-    void transmit();
+    sysinterval_t serviceRadio();
+
+    void handleUplink(const CommandUplink& uplink);
 
     void handleCommand(const telemetry_command& cmd);
 
@@ -100,16 +216,60 @@ class Telemetry {
 
     void serialPrint(const sensorDataStruct_t& sensor_data);
 
+    // Sends an event ahead of the frames until the ground station acknowledges it, from any thread
+    void postEvent(TelemetryEventKind kind, int16_t value);
+
+    const RadioStats& radioStats() const { return radio_stats; }
+    const LinkAdapter& linkAdapter() const { return link; }
+
    private:
-    RH_RF95 rf95;
-    MessageQueue<TelemetryDataLite, 4> buffered_data;
+    enum class RadioState { Idle, Transmitting, Listening };
 
-    // Initializing command ID
+    sysinterval_t startTransmit();
+    sysinterval_t finishTransmit();
+    sysinterval_t finishListening();
+    // Sets the radio to the link's current profile
+    void applyProfile();
+    void setModem(bool crc);
+
+    TelemetryRadio rf95;
+    LinkAdapter link;
+#ifdef ENABLE_TELEMETRY_FEC
+    TelemetryFecEncoder fec;
+#endif
+    // Header id of the next frame, for the ground station to count the frames it missed
+    uint8_t frame_sequence = 0;
+    RadioState radio_state = RadioState::Idle;
+    RadioStats radio_stats;
+    // micros() when the radio last changed state, when serviceRadio last ran and when the last window opened
+    uint32_t state_start_us = 0;
+    uint32_t last_service_us = 0;
+    uint32_t last_window_us = 0;
+    uint32_t tx_airtime_us = 0;
+    uint32_t rx_window_us = 0;
+    bool listen_after_tx = false;
+    MessageQueue<TelemetryDatapoint, TELEMETRY_MAX_DATAPOINTS> buffered_data;
+    // Every sample, summarized by bufferData until makeFrame sends the summary and starts the next
+    DataLogQueue summary_queue;
+    TelemetrySummary summary;
+    MUTEX_DECL(summary_mutex);
+    TelemetryEventQueue events;
+    MUTEX_DECL(events_mutex);
+    // Kept here rather than on the sending thread's stack
+    TelemetryFrame frame;
+    TelemetryEventMessage event_message;
+
+    // Which commands have been run, for each to run once
+    CommandReceiver commands;
+    // Id of the last command run
     int16_t last_command_id = -1;
 
     // Initializing callsign
     char callsign[8] = "NO SIGN";
     command_handler_struct freq_status = {};
 
-    TelemetryPacket makePacket(const sensorDataStruct_t& data_struct);
+    // Task whose stats were sent in the last packet
+    PeriodicTask* downlinked_task = nullptr;
+
+    void makeFrame(const sensorDataStruct_t& data_struct);
 };
@@ -0,0 +1,37 @@
+/**
+ * @file Adafruit_BME680.h
+ *
+ * @brief BME680 gas sensor for the native build. A reading is ready on the next call after it is started.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class Adafruit_BME680 {
+   public:
+    explicit Adafruit_BME680(int8_t cs_pin) { (void)cs_pin; }
+
+    bool begin(uint8_t address = 0x77, bool init_settings = true) {
+        (void)address;
+        (void)init_settings;
+        return true;
+    }
+    uint32_t beginReading() {
+        reading_ = true;
+        return 1;
+    }
+    int remainingReadingMillis() { return reading_ ? 0 : -1; }
+    bool performReading() {
+        reading_ = false;
+        return true;
+    }
+
+    float temperature = 20.0f;
+    uint32_t pressure = 101325;
+    float humidity = 40.0f;
+    uint32_t gas_resistance = 0;
+
+   private:
+    bool reading_ = false;
+};
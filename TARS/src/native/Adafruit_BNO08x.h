@@ -0,0 +1,74 @@
+/**
+ * @file Adafruit_BNO08x.h
+ *
+ * @brief BNO08x orientation IMU for the native build, which never reports.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "SPI.h"
+
+typedef uint8_t sh2_SensorId_t;
+
+#define SH2_ACCELEROMETER 0x01
+#define SH2_GYROSCOPE_CALIBRATED 0x02
+#define SH2_MAGNETIC_FIELD_CALIBRATED 0x03
+#define SH2_ROTATION_VECTOR 0x05
+#define SH2_ARVR_STABILIZED_RV 0x28
+#define SH2_GYRO_INTEGRATED_RV 0x2A
+
+typedef struct {
+    float x, y, z;
+} sh2_Vector_t;
+
+typedef struct {
+    float value;
+} sh2_Scalar_t;
+
+typedef struct {
+    float i, j, k, real, accuracy;
+} sh2_RotationVectorWAcc_t;
+
+typedef struct {
+    float i, j, k, real, angVelX, angVelY, angVelZ;
+} sh2_GyroIntegratedRV_t;
+
+typedef struct {
+    uint8_t sensorId;
+    uint8_t sequence;
+    uint8_t status;
+    uint64_t timestamp;
+    union {
+        sh2_Vector_t accelerometer;
+        sh2_Vector_t gyroscope;
+        sh2_Vector_t magneticField;
+        sh2_Scalar_t temperature;
+        sh2_Scalar_t pressure;
+        sh2_RotationVectorWAcc_t arvrStabilizedRV;
+        sh2_GyroIntegratedRV_t gyroIntegratedRV;
+    } un;
+} sh2_SensorValue_t;
+
+class Adafruit_BNO08x {
+   public:
+    explicit Adafruit_BNO08x(int8_t reset_pin = -1) { (void)reset_pin; }
+
+    bool begin_SPI(uint8_t cs_pin, uint8_t int_pin, SPIClass* spi = &SPI, int32_t sensor_id = 0) {
+        (void)cs_pin;
+        (void)int_pin;
+        (void)spi;
+        (void)sensor_id;
+        return true;
+    }
+    bool enableReport(sh2_SensorId_t sensor, uint32_t interval_us = 10000) {
+        (void)sensor;
+        (void)interval_us;
+        return true;
+    }
+    bool getSensorEvent(sh2_SensorValue_t* value) {
+        (void)value;
+        return false;
+    }
+};
@@ -0,0 +1,43 @@
+/**
+ * @file Adafruit_LIS3MDL.h
+ *
+ * @brief LIS3MDL magnetometer for the native build, reading native_sensors.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "NativeSensors.h"
+#include "SPI.h"
+
+typedef enum { LIS3MDL_CONTINUOUSMODE = 0, LIS3MDL_SINGLEMODE = 1, LIS3MDL_POWERDOWNMODE = 3 } lis3mdl_operationmode_t;
+typedef enum { LIS3MDL_DATARATE_80_HZ = 0x7, LIS3MDL_DATARATE_155_HZ = 0x1 } lis3mdl_dataRate_t;
+typedef enum {
+    LIS3MDL_RANGE_4_GAUSS,
+    LIS3MDL_RANGE_8_GAUSS,
+    LIS3MDL_RANGE_12_GAUSS,
+    LIS3MDL_RANGE_16_GAUSS,
+} lis3mdl_range_t;
+
+class Adafruit_LIS3MDL {
+   public:
+    bool begin_SPI(uint8_t cs_pin, SPIClass* spi = &SPI, uint32_t frequency = 1000000) {
+        (void)cs_pin;
+        (void)spi;
+        (void)frequency;
+        return true;
+    }
+    void setOperationMode(lis3mdl_operationmode_t mode) { (void)mode; }
+    void setDataRate(lis3mdl_dataRate_t rate) { (void)rate; }
+    void setRange(lis3mdl_range_t range) { (void)range; }
+    void read() {
+        x_gauss = native_sensors.mag[0];
+        y_gauss = native_sensors.mag[1];
+        z_gauss = native_sensors.mag[2];
+    }
+
+    float x_gauss = 0.0f;
+    float y_gauss = 0.0f;
+    float z_gauss = 0.0f;
+};
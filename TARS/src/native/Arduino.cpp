@@ -0,0 +1,169 @@
+/**
+ * @file Arduino.cpp
+ *
+ * @brief Time, pins, Print and Serial of the native Arduino shim.
+ */
+
+#include "Arduino.h"
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+
+#include "ChRt.h"
+
+NativeSerial Serial;
+
+static std::atomic<int> pins[NATIVE_PIN_COUNT];
+static void (*pin_listener)(uint8_t pin, uint8_t val) = nullptr;
+
+uint32_t micros() { return (uint32_t)nativeTimeUs(); }
+
+uint32_t millis() { return (uint32_t)(nativeTimeUs() / 1000); }
+
+void delay(uint32_t ms) { chThdSleepMilliseconds(ms); }
+
+void delayMicroseconds(uint32_t us) { chThdSleepMicroseconds(us); }
+
+uint64_t nativeCycleCount() { return nativeTimeUs() * (F_CPU_ACTUAL / 1000000); }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    if (pin < NATIVE_PIN_COUNT) {
+        pins[pin] = val;
+    }
+    if (pin_listener) {
+        pin_listener(pin, val);
+    }
+}
+
+uint8_t digitalRead(uint8_t pin) { return pin < NATIVE_PIN_COUNT ? pins[pin].load() : 0; }
+
+int nativePinValue(uint8_t pin) { return digitalRead(pin); }
+
+void nativeSetPinListener(void (*listener)(uint8_t pin, uint8_t val)) { pin_listener = listener; }
+
+int analogRead(uint8_t pin) {
+    (void)pin;
+    return 0;
+}
+
+void analogWrite(uint8_t pin, int val) { digitalWrite(pin, val); }
+
+void tone(uint8_t pin, uint16_t frequency, uint32_t duration) {
+    (void)pin;
+    (void)frequency;
+    (void)duration;
+}
+
+void noTone(uint8_t pin) { (void)pin; }
+
+char* itoa(int value, char* str, int base) {
+    char digits[34];
+    int count = 0;
+    unsigned int magnitude = value < 0 && base == 10 ? -(unsigned int)value : (unsigned int)value;
+    do {
+        digits[count++] = "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % base];
+        magnitude /= base;
+    } while (magnitude);
+    char* out = str;
+    if (value < 0 && base == 10) {
+        *out++ = '-';
+    }
+    while (count) {
+        *out++ = digits[--count];
+    }
+    *out = 0;
+    return str;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t count = 0;
+    while (size--) {
+        count += write(*buffer++);
+    }
+    return count;
+}
+
+size_t Print::printSigned(long long n, int base) {
+    if (n < 0 && base == DEC) {
+        return print('-') + printNumber(-(unsigned long long)n, base);
+    }
+    return printNumber(n, base);
+}
+
+size_t Print::printNumber(unsigned long long n, int base) {
+    char buffer[65];
+    char* digit = &buffer[sizeof(buffer) - 1];
+    *digit = 0;
+    if (base < 2) {
+        base = 10;
+    }
+    do {
+        *--digit = "0123456789ABCDEF"[n % base];
+        n /= base;
+    } while (n);
+    return write(digit);
+}
+
+size_t Print::printFloat(double number, int digits) {
+    if (std::isnan(number)) return print("nan");
+    if (std::isinf(number)) return print("inf");
+    char buffer[64];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.*f", digits, number);
+    return write((const uint8_t*)buffer, length > 0 ? (size_t)length : 0);
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = timedRead();
+        if (c < 0) break;
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+size_t Stream::readBytesUntil(char terminator, char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = timedRead();
+        if (c < 0 || c == terminator) break;
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+size_t NativeSerial::write(uint8_t b) { return std::fwrite(&b, 1, 1, stdout); }
+
+size_t NativeSerial::write(const uint8_t* buffer, size_t size) { return std::fwrite(buffer, 1, size, stdout); }
+
+void NativeSerial::flush() { std::fflush(stdout); }
+
+int NativeSerial::available() {
+    pollfd input = {STDIN_FILENO, POLLIN, 0};
+    return poll(&input, 1, 0) > 0 && (input.revents & POLLIN) ? 1 : 0;
+}
+
+int NativeSerial::read() {
+    if (!available()) {
+        return -1;
+    }
+    uint8_t c;
+    return ::read(STDIN_FILENO, &c, 1) == 1 ? c : -1;
+}
+
+int NativeSerial::timedRead() {
+    pollfd input = {STDIN_FILENO, POLLIN, 0};
+    if (poll(&input, 1, (int)timeout_) <= 0) {
+        return -1;
+    }
+    uint8_t c;
+    return ::read(STDIN_FILENO, &c, 1) == 1 ? c : -1;
+}
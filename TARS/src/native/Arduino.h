@@ -0,0 +1,159 @@
+/**
+ * @file Arduino.h
+ *
+ * @brief The Arduino/Teensy core functions the flight code uses, for the native build.
+ *
+ * Serial is the process' stdin and stdout. Time comes from the virtual clock in ChRt.h, and the pins only remember
+ * the last value written to them so a host test can look at the LEDs.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using std::abs;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define NATIVE_PIN_COUNT 64
+
+// There are no interrupts to enable or disable on the host
+#define sei() \
+    do {      \
+    } while (false)
+#define cli() \
+    do {      \
+    } while (false)
+
+#define sq(x) ((x) * (x))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Like the Teensy core's, for the libraries that call them unqualified
+template <class A, class B>
+constexpr auto min(const A& a, const B& b) -> decltype(a < b ? a : b) {
+    return b < a ? b : a;
+}
+template <class A, class B>
+constexpr auto max(const A& a, const B& b) -> decltype(a < b ? b : a) {
+    return a < b ? b : a;
+}
+
+uint32_t micros();
+uint32_t millis();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+uint8_t digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+void tone(uint8_t pin, uint16_t frequency, uint32_t duration = 0);
+void noTone(uint8_t pin);
+
+char* itoa(int value, char* str, int base);
+
+class Print {
+   public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t b) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+    virtual void flush() {}
+
+    size_t print(const char* str) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char n, int base = DEC) { return printNumber(n, base); }
+    size_t print(int n, int base = DEC) { return printSigned(n, base); }
+    size_t print(unsigned int n, int base = DEC) { return printNumber(n, base); }
+    size_t print(long n, int base = DEC) { return printSigned(n, base); }
+    size_t print(unsigned long n, int base = DEC) { return printNumber(n, base); }
+    size_t print(long long n, int base = DEC) { return printSigned(n, base); }
+    size_t print(unsigned long long n, int base = DEC) { return printNumber(n, base); }
+    size_t print(double n, int digits = 2) { return printFloat(n, digits); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(T value) {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(T value, int format) {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+   private:
+    size_t printSigned(long long n, int base);
+    size_t printNumber(unsigned long long n, int base);
+    size_t printFloat(double number, int digits);
+};
+
+class Stream : public Print {
+   public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+
+    void setTimeout(uint32_t timeout) { timeout_ = timeout; }
+    size_t readBytes(char* buffer, size_t length);
+    size_t readBytesUntil(char terminator, char* buffer, size_t length);
+
+   protected:
+    // Reads a byte, waiting up to the timeout for one, -1 if none came
+    virtual int timedRead() = 0;
+
+    uint32_t timeout_ = 1000;
+};
+
+/**
+ * @brief Serial over the process' stdin and stdout.
+ */
+class NativeSerial : public Stream {
+   public:
+    void begin(uint32_t baud) { (void)baud; }
+    explicit operator bool() const { return true; }
+
+    using Print::write;
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override;
+
+    int available() override;
+    int read() override;
+
+   protected:
+    int timedRead() override;
+};
+
+extern NativeSerial Serial;
+
+// The cycle counter of the Teensy's DWT unit, counted on the virtual clock at the Teensy's clock speed
+#define F_CPU_ACTUAL 600000000u
+#define ARM_DWT_CYCCNT ((uint32_t)nativeCycleCount())
+uint64_t nativeCycleCount();
+
+/**
+ * @brief The last value written to a pin, for host tests.
+ */
+int nativePinValue(uint8_t pin);
+
+/**
+ * @brief Sets a function called with every value written to a pin, which is how SPI devices see their chip select.
+ */
+void nativeSetPinListener(void (*listener)(uint8_t pin, uint8_t val));
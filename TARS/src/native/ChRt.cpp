@@ -0,0 +1,179 @@
+/**
+ * @file ChRt.cpp
+ *
+ * @brief Clock, sleeps, mutexes and events of the native ChibiOS shim, on top of the port in ChRtPort.h.
+ */
+
+#include "ChRt.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "ChRtPort.h"
+
+namespace {
+
+uint64_t ticksNow() { return nativeTimeUs() * CH_CFG_ST_FREQUENCY / 1000000; }
+
+uint64_t deadlineAfter(sysinterval_t interval) {
+    return interval == TIME_INFINITE ? NATIVE_INFINITE_DEADLINE : ticksNow() + interval;
+}
+
+}  // namespace
+
+// The kernel lock is recursive, so the status does not need to record anything
+syssts_t chSysGetStatusAndLockX() {
+    chSysLock();
+    return 0;
+}
+
+void chSysRestoreStatusX(syssts_t sts) {
+    (void)sts;
+    chSysUnlock();
+}
+
+void chSysHalt(const char* reason) {
+    std::fprintf(stderr, "chSysHalt: %s\n", reason);
+    std::abort();
+}
+
+systime_t chVTGetSystemTimeX() { return (systime_t)ticksNow(); }
+
+systime_t chVTGetSystemTime() { return chVTGetSystemTimeX(); }
+
+tprio_t chThdGetPriorityX() { return chThdGetSelfX()->prio; }
+
+void chThdSleep(sysinterval_t time) {
+    if (time == TIME_IMMEDIATE) {
+        chThdYield();
+        return;
+    }
+    chSysLock();
+    nativeSleepS([] { return false; }, deadlineAfter(time));
+    chSysUnlock();
+}
+
+void chThdSleepUntil(systime_t time) {
+    chSysLock();
+    sysinterval_t interval = chTimeDiffX(chVTGetSystemTimeX(), time);
+    if (interval > 0) {
+        nativeSleepS([] { return false; }, deadlineAfter(interval));
+    }
+    chSysUnlock();
+}
+
+systime_t chThdSleepUntilWindowed(systime_t prev, systime_t next) {
+    chSysLock();
+    systime_t now = chVTGetSystemTimeX();
+    if (chTimeIsInRangeX(now, prev, next)) {
+        nativeSleepS([] { return false; }, deadlineAfter(chTimeDiffX(now, next)));
+    }
+    chSysUnlock();
+    return next;
+}
+
+void chMtxLock(mutex_t* mp) {
+    chSysLock();
+    thread_t* me = chThdGetSelfX();
+    if (mp->owner == me) {
+        chSysHalt("chMtxLock: mutex already owned by the calling thread");
+    }
+    if (mp->owner) {
+        nativeSleepS([mp] { return mp->owner == nullptr; }, NATIVE_INFINITE_DEADLINE);
+    }
+    mp->owner = me;
+    chSysUnlock();
+}
+
+bool chMtxTryLock(mutex_t* mp) {
+    chSysLock();
+    bool acquired = mp->owner == nullptr;
+    if (acquired) {
+        mp->owner = chThdGetSelfX();
+    }
+    chSysUnlock();
+    return acquired;
+}
+
+void chMtxUnlock(mutex_t* mp) {
+    chSysLock();
+    mp->owner = nullptr;
+    chSysUnlock();
+}
+
+void chEvtRegisterMaskWithFlags(event_source_t* esp, event_listener_t* elp, eventmask_t events, eventflags_t wflags) {
+    chSysLock();
+    elp->next = esp->next;
+    esp->next = elp;
+    elp->listener = chThdGetSelfX();
+    elp->events = events;
+    elp->flags = 0;
+    elp->wflags = wflags;
+    chSysUnlock();
+}
+
+void chEvtUnregister(event_source_t* esp, event_listener_t* elp) {
+    chSysLock();
+    for (event_listener_t** link = &esp->next; *link; link = &(*link)->next) {
+        if (*link == elp) {
+            *link = elp->next;
+            break;
+        }
+    }
+    chSysUnlock();
+}
+
+/**
+ * @brief Adds flags to every listener and signals the ones whose wflags match. The kernel lock has to be held.
+ */
+void chEvtBroadcastFlagsI(event_source_t* esp, eventflags_t flags) {
+    for (event_listener_t* elp = esp->next; elp; elp = elp->next) {
+        elp->flags |= flags;
+        if (flags == 0 || (flags & elp->wflags) != 0) {
+            elp->listener->epending |= elp->events;
+        }
+    }
+}
+
+void chEvtBroadcastFlags(event_source_t* esp, eventflags_t flags) {
+    chSysLock();
+    chEvtBroadcastFlagsI(esp, flags);
+    chSysUnlock();
+}
+
+void chEvtSignalI(thread_t* tp, eventmask_t events) { tp->epending |= events; }
+
+void chEvtSignal(thread_t* tp, eventmask_t events) {
+    chSysLock();
+    chEvtSignalI(tp, events);
+    chSysUnlock();
+}
+
+eventmask_t chEvtWaitAnyTimeout(eventmask_t events, sysinterval_t timeout) {
+    thread_t* me = chThdGetSelfX();
+    chSysLock();
+    if ((me->epending & events) == 0 && timeout != TIME_IMMEDIATE) {
+        nativeSleepS([me, events] { return (me->epending & events) != 0; }, deadlineAfter(timeout));
+    }
+    eventmask_t received = me->epending & events;
+    me->epending &= ~received;
+    chSysUnlock();
+    return received;
+}
+
+eventmask_t chEvtGetAndClearEvents(eventmask_t events) {
+    thread_t* me = chThdGetSelfX();
+    chSysLock();
+    eventmask_t received = me->epending & events;
+    me->epending &= ~received;
+    chSysUnlock();
+    return received;
+}
+
+eventflags_t chEvtGetAndClearFlags(event_listener_t* elp) {
+    chSysLock();
+    eventflags_t flags = elp->flags;
+    elp->flags = 0;
+    chSysUnlock();
+    return flags;
+}
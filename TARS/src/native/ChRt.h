@@ -0,0 +1,146 @@
+/**
+ * @file ChRt.h
+ *
+ * @brief The subset of the ChibiOS/RT API the flight code uses, for the native build.
+ *
+ * Every kernel object is only changed while holding the kernel lock taken by chSysLock, so the I-class and S-class
+ * functions keep their meaning. A thread that blocks (chThdSleep, chMtxLock, chEvtWaitAnyTimeout) gives the kernel
+ * lock up while it is asleep, the way a ChibiOS thread that sleeps inside a critical section lets the next thread run.
+ *
+ * The kernel objects are in ChRt.cpp and the threads, kernel lock and clock underneath them in a port, see ChRtPort.h.
+ * ChRtThreads.cpp runs the threads on the host's clock, the SILSIM tool runs them on a simulated one. One tick is one
+ * millisecond, the same as the flight computer.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Arduino.h"
+
+#define CH_CFG_ST_FREQUENCY 1000
+
+typedef uint32_t systime_t;
+typedef uint32_t sysinterval_t;
+typedef uint32_t syssts_t;
+typedef uint32_t tprio_t;
+typedef int32_t msg_t;
+typedef uint32_t eventmask_t;
+typedef uint32_t eventflags_t;
+typedef void (*tfunc_t)(void* p);
+typedef uint64_t stkalign_t;
+
+#define TIME_IMMEDIATE ((sysinterval_t)0)
+#define TIME_INFINITE ((sysinterval_t)-1)
+
+// Conversions round up, like ChibiOS
+#define TIME_S2I(secs) ((sysinterval_t)((uint64_t)(secs) * CH_CFG_ST_FREQUENCY))
+#define TIME_MS2I(msecs) ((sysinterval_t)(((uint64_t)(msecs) * CH_CFG_ST_FREQUENCY + 999) / 1000))
+#define TIME_US2I(usecs) ((sysinterval_t)(((uint64_t)(usecs) * CH_CFG_ST_FREQUENCY + 999999) / 1000000))
+#define TIME_I2S(interval) ((uint32_t)(((uint64_t)(interval) + CH_CFG_ST_FREQUENCY - 1) / CH_CFG_ST_FREQUENCY))
+#define TIME_I2MS(interval) ((uint32_t)(((uint64_t)(interval) * 1000 + CH_CFG_ST_FREQUENCY - 1) / CH_CFG_ST_FREQUENCY))
+#define TIME_I2US(interval) \
+    ((uint32_t)(((uint64_t)(interval) * 1000000 + CH_CFG_ST_FREQUENCY - 1) / CH_CFG_ST_FREQUENCY))
+
+#define IDLEPRIO ((tprio_t)1)
+#define LOWPRIO ((tprio_t)2)
+#define NORMALPRIO ((tprio_t)128)
+#define HIGHPRIO ((tprio_t)255)
+
+#define ALL_EVENTS ((eventmask_t)-1)
+#define EVENT_MASK(eid) ((eventmask_t)1 << (eventmask_t)(eid))
+
+struct ch_thread {
+    const char* name;
+    tprio_t prio;
+    // Events signalled to the thread and not yet waited for
+    eventmask_t epending;
+};
+typedef struct ch_thread thread_t;
+
+typedef struct ch_mutex {
+    thread_t* owner;
+} mutex_t;
+
+#define _MUTEX_DATA(name) \
+    { nullptr }
+#define MUTEX_DECL(name) mutex_t name = _MUTEX_DATA(name)
+
+typedef struct event_listener {
+    struct event_listener* next;
+    thread_t* listener;
+    eventmask_t events;
+    eventflags_t flags;
+    eventflags_t wflags;
+} event_listener_t;
+
+typedef struct event_source {
+    event_listener_t* next;
+} event_source_t;
+
+#define _EVENTSOURCE_DATA(name) \
+    { nullptr }
+#define EVENTSOURCE_DECL(name) event_source_t name = _EVENTSOURCE_DATA(name)
+
+// The host threads have their own stacks, the working areas are only kept so the stack report has something to read
+#define THD_WORKING_AREA_SIZE(n) (((size_t)(n) + sizeof(stkalign_t) - 1) / sizeof(stkalign_t) * sizeof(stkalign_t))
+#define THD_WORKING_AREA(s, n) stkalign_t s[THD_WORKING_AREA_SIZE(n) / sizeof(stkalign_t)]
+#define THD_FUNCTION(tname, arg) void tname(void* arg)
+
+void chBegin(void (*mainThread)());
+
+void chSysLock();
+void chSysUnlock();
+syssts_t chSysGetStatusAndLockX();
+void chSysRestoreStatusX(syssts_t sts);
+#define chSysLockFromISR() chSysLock()
+#define chSysUnlockFromISR() chSysUnlock()
+// Nothing runs in interrupt context in the native build
+#define CH_IRQ_PROLOGUE()
+#define CH_IRQ_EPILOGUE()
+void chSysHalt(const char* reason);
+
+systime_t chVTGetSystemTimeX();
+systime_t chVTGetSystemTime();
+
+static inline systime_t chTimeAddX(systime_t systime, sysinterval_t interval) { return systime + interval; }
+static inline sysinterval_t chTimeDiffX(systime_t start, systime_t end) { return end - start; }
+static inline bool chTimeIsInRangeX(systime_t time, systime_t start, systime_t end) {
+    return (systime_t)(time - start) < (systime_t)(end - start);
+}
+static inline sysinterval_t chVTTimeElapsedSinceX(systime_t start) { return chTimeDiffX(start, chVTGetSystemTimeX()); }
+
+thread_t* chThdCreateStatic(void* wsp, size_t size, tprio_t prio, tfunc_t pf, void* arg);
+thread_t* chThdGetSelfX();
+static inline void chRegSetThreadNameX(thread_t* tp, const char* name) { tp->name = name; }
+tprio_t chThdGetPriorityX();
+tprio_t chThdSetPriority(tprio_t newprio);
+void chThdSleep(sysinterval_t time);
+void chThdSleepUntil(systime_t time);
+systime_t chThdSleepUntilWindowed(systime_t prev, systime_t next);
+void chThdYield();
+#define chThdSleepSeconds(sec) chThdSleep(TIME_S2I(sec))
+#define chThdSleepMilliseconds(msec) chThdSleep(TIME_MS2I(msec))
+#define chThdSleepMicroseconds(usec) chThdSleep(TIME_US2I(usec))
+
+void chMtxLock(mutex_t* mp);
+bool chMtxTryLock(mutex_t* mp);
+void chMtxUnlock(mutex_t* mp);
+
+void chEvtRegisterMaskWithFlags(event_source_t* esp, event_listener_t* elp, eventmask_t events, eventflags_t wflags);
+void chEvtUnregister(event_source_t* esp, event_listener_t* elp);
+void chEvtBroadcastFlagsI(event_source_t* esp, eventflags_t flags);
+void chEvtBroadcastFlags(event_source_t* esp, eventflags_t flags);
+void chEvtSignalI(thread_t* tp, eventmask_t events);
+void chEvtSignal(thread_t* tp, eventmask_t events);
+eventmask_t chEvtWaitAnyTimeout(eventmask_t events, sysinterval_t timeout);
+eventmask_t chEvtGetAndClearEvents(eventmask_t events);
+eventflags_t chEvtGetAndClearFlags(event_listener_t* elp);
+
+/**
+ * @brief Microseconds since the kernel's clock started, backs micros() and millis() in the Arduino shim.
+ *
+ * Provided by the port.
+ */
+uint64_t nativeTimeUs();
@@ -0,0 +1,32 @@
+/**
+ * @file ChRtPort.h
+ *
+ * @brief What the kernel objects in ChRt.cpp need from the port of the native ChibiOS shim.
+ *
+ * A port implements the kernel lock (chSysLock, chSysUnlock), the threads (chBegin, chThdCreateStatic,
+ * chThdGetSelfX, chThdSetPriority, chThdYield), the clock (nativeTimeUs) and the one way of blocking declared here.
+ * ChRtThreads.cpp is the port of the native build, tools/silsim/SimKernel.cpp the one of the SILSIM and
+ * HILSIM target tools.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "ChRt.h"
+
+// Deadline of a sleep without a timeout
+#define NATIVE_INFINITE_DEADLINE UINT64_MAX
+
+/**
+ * @brief Sleeps until woken() or until the tick deadline, with the kernel lock released meanwhile.
+ *
+ * The caller holds the kernel lock, which is held again on return at the same depth. woken() is only evaluated while
+ * no thread holds the kernel lock, so it can read any kernel object.
+ *
+ * @param woken condition the thread waits for
+ * @param deadline system time in ticks, not wrapped, or NATIVE_INFINITE_DEADLINE
+ * @return whether woken() became true, false on timeout
+ */
+bool nativeSleepS(const std::function<bool()>& woken, uint64_t deadline);
@@ -0,0 +1,137 @@
+/**
+ * @file ChRtThreads.cpp
+ *
+ * @brief Port of the native ChibiOS shim that runs every thread on its own std::thread, on the host's clock.
+ *
+ * The kernel lock is one recursive lock shared by all threads. The threads really run in parallel, so priorities are
+ * recorded but do not order anything. The clock starts at zero when the program starts and follows the host's
+ * monotonic clock.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "ChRtPort.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Guards the kernel lock, which is held by lock_owner lock_depth times. All kernel objects belong to the kernel lock.
+std::mutex kernel_mutex;
+std::condition_variable kernel_unlocked;
+std::thread::id lock_owner;
+int lock_depth = 0;
+
+thread_local thread_t* self = nullptr;
+
+// A function static so the clock is already running for the constructors of the globals in the flight code
+Clock::time_point startTime() {
+    static const Clock::time_point start = Clock::now();
+    return start;
+}
+
+Clock::time_point hostTime(uint64_t ticks) {
+    return startTime() + std::chrono::microseconds(ticks * 1000000 / CH_CFG_ST_FREQUENCY);
+}
+
+}  // namespace
+
+uint64_t nativeTimeUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime()).count();
+}
+
+bool nativeSleepS(const std::function<bool()>& woken, uint64_t deadline) {
+    std::unique_lock<std::mutex> lock(kernel_mutex);
+    int depth = lock_depth;
+    lock_depth = 0;
+    lock_owner = std::thread::id();
+    kernel_unlocked.notify_all();
+
+    bool timed = deadline != NATIVE_INFINITE_DEADLINE;
+    Clock::time_point wake_time = timed ? hostTime(deadline) : Clock::time_point::max();
+    bool result = false;
+    while (true) {
+        if (lock_depth == 0) {
+            if (woken()) {
+                result = true;
+                break;
+            }
+            if (timed && Clock::now() >= wake_time) {
+                break;
+            }
+        }
+        // Past the deadline only the kernel lock being released is left to wait for
+        if (timed && Clock::now() < wake_time) {
+            kernel_unlocked.wait_until(lock, wake_time);
+        } else {
+            kernel_unlocked.wait(lock);
+        }
+    }
+
+    lock_owner = std::this_thread::get_id();
+    lock_depth = depth;
+    return result;
+}
+
+/**
+ * @brief Runs the main thread. The kernel needs no setup on the host, so the name is all that is left to give it.
+ */
+void chBegin(void (*mainThread)()) {
+    chThdGetSelfX()->name = "main";
+    mainThread();
+}
+
+void chSysLock() {
+    std::unique_lock<std::mutex> lock(kernel_mutex);
+    std::thread::id me = std::this_thread::get_id();
+    if (lock_depth > 0 && lock_owner == me) {
+        lock_depth++;
+        return;
+    }
+    kernel_unlocked.wait(lock, [] { return lock_depth == 0; });
+    lock_owner = me;
+    lock_depth = 1;
+}
+
+void chSysUnlock() {
+    std::lock_guard<std::mutex> lock(kernel_mutex);
+    if (--lock_depth == 0) {
+        lock_owner = std::thread::id();
+        kernel_unlocked.notify_all();
+    }
+}
+
+/**
+ * @brief Starts pf on a new host thread. The working area is left alone, the host gives the thread its own stack.
+ */
+thread_t* chThdCreateStatic(void* wsp, size_t size, tprio_t prio, tfunc_t pf, void* arg) {
+    (void)wsp;
+    (void)size;
+    thread_t* thread = new thread_t{"", prio, 0};
+    std::thread([thread, pf, arg] {
+        self = thread;
+        pf(arg);
+    }).detach();
+    return thread;
+}
+
+/**
+ * @brief The calling thread. Threads the kernel did not start, like the one running setup(), get one on first use.
+ */
+thread_t* chThdGetSelfX() {
+    if (!self) {
+        self = new thread_t{"", NORMALPRIO, 0};
+    }
+    return self;
+}
+
+tprio_t chThdSetPriority(tprio_t newprio) {
+    tprio_t old = chThdGetSelfX()->prio;
+    chThdGetSelfX()->prio = newprio;
+    return old;
+}
+
+void chThdYield() { std::this_thread::yield(); }
@@ -0,0 +1,38 @@
+/**
+ * @file FS.h
+ *
+ * @brief Files for the native build, backed by files on the host.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "Arduino.h"
+
+#define FILE_READ 0
+#define FILE_WRITE 1
+#define FILE_WRITE_BEGIN 2
+
+class File : public Print {
+   public:
+    File() = default;
+    File(FILE* file, const char* name);
+
+    using Print::write;
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override;
+
+    int read();
+    int available();
+    void close();
+    const char* name() const { return name_.c_str(); }
+    explicit operator bool() const { return file_ != nullptr; }
+
+   private:
+    std::shared_ptr<FILE> file_;
+    std::string name_;
+};
@@ -0,0 +1,25 @@
+/**
+ * @file MS5611.h
+ *
+ * @brief MS5611 barometer for the native build, reading native_sensors.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "NativeSensors.h"
+
+class MS5611 {
+   public:
+    explicit MS5611(uint8_t CSpin) { (void)CSpin; }
+
+    void init() {}
+    int read(uint8_t bits = 8) {
+        (void)bits;
+        return 0;
+    }
+    // Hundredths of a degree C and hundredths of a millibar, like the driver
+    int32_t getTemperature() const { return native_sensors.temperature; }
+    uint32_t getPressure() const { return native_sensors.pressure; }
+};
@@ -0,0 +1,17 @@
+/**
+ * @file NativeDevices.cpp
+ *
+ * @brief The bus and radio instances the Arduino and RadioHead libraries would define, and the sensor readings.
+ */
+
+#include "NativeSensors.h"
+#include "RHHardwareSPI1.h"
+#include "SPI.h"
+#include "Wire.h"
+
+SPIClass SPI;
+SPIClass SPI1;
+TwoWire Wire;
+RHHardwareSPI1 hardware_spi1;
+
+NativeSensorReadings native_sensors;
@@ -0,0 +1,29 @@
+/**
+ * @file NativeSensors.h
+ *
+ * @brief The readings the sensor shims of the native build return.
+ *
+ * They start out at rest on the pad at sea level with the z axis up, and stay that way in the native build. The
+ * SILSIM tool writes them from its physics model.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct NativeSensorReadings {
+    // KX134, in g
+    float high_g[3] = {0.0f, 0.0f, 1.0f};
+    // LSM6DS3, in g and degrees per second
+    float low_g[3] = {0.0f, 0.0f, 1.0f};
+    float gyro[3] = {0.0f, 0.0f, 0.0f};
+    // LIS3MDL, in gauss
+    float mag[3] = {0.0f, 0.0f, 0.0f};
+    // MS5611, in hundredths of a millibar and hundredths of a degree C like the driver
+    uint32_t pressure = 101325;
+    int32_t temperature = 2000;
+    // BNO08x rotation as a quaternion, i, j, k and real
+    float orientation[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+};
+
+extern NativeSensorReadings native_sensors;
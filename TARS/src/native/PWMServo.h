@@ -0,0 +1,26 @@
+/**
+ * @file PWMServo.h
+ *
+ * @brief Servo for the native build, which remembers the last commanded angle.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class PWMServo {
+   public:
+    uint8_t attach(int pin, int min = 544, int max = 2400) {
+        (void)min;
+        (void)max;
+        pin_ = pin;
+        return 1;
+    }
+    void write(int angle) { angle_ = angle; }
+    uint8_t read() { return (uint8_t)angle_; }
+    uint8_t attached() { return pin_ >= 0; }
+
+   private:
+    int pin_ = -1;
+    int angle_ = 0;
+};
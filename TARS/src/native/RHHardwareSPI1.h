@@ -0,0 +1,13 @@
+/**
+ * @file RHHardwareSPI1.h
+ *
+ * @brief The RadioHead SPI1 driver instance for the native build.
+ */
+
+#pragma once
+
+#include "RH_RF95.h"
+
+class RHHardwareSPI1 : public RHGenericSPI {};
+
+extern RHHardwareSPI1 hardware_spi1;
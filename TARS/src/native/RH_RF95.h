@@ -0,0 +1,128 @@
+/**
+ * @file RH_RF95.h
+ *
+ * @brief LoRa radio for the native build. Packets go nowhere and nothing is ever received.
+ *
+ * A sent packet keeps the radio in RHModeTx for its airtime at the radio's modulation, so a thread that waits for
+ * mode() to change is paced as it would be on the flight computer. There is no DIO0 interrupt, handleInterrupt is
+ * never called.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Arduino.h"
+#include "common/LoRa.h"
+
+#define RH_RF95_MAX_PAYLOAD_LEN 255
+#define RH_RF95_HEADER_LEN 4
+#define RH_RF95_MAX_MESSAGE_LEN (RH_RF95_MAX_PAYLOAD_LEN - RH_RF95_HEADER_LEN)
+
+#define RH_FLAGS_APPLICATION_SPECIFIC 0x0f
+
+class RHGenericSPI {};
+
+class RHGenericDriver {
+   public:
+    typedef enum { RHModeInitialising = 0, RHModeSleep, RHModeIdle, RHModeTx, RHModeRx, RHModeCad } RHMode;
+
+    virtual ~RHGenericDriver() = default;
+
+    RHMode mode() {
+        if (mode_ == RHModeTx && (int32_t)(micros() - tx_end_us_) >= 0) {
+            mode_ = RHModeIdle;
+        }
+        return mode_;
+    }
+
+    void setHeaderId(uint8_t id) { tx_header_id_ = id; }
+    uint8_t headerId() { return 0; }
+    void setHeaderFlags(uint8_t set, uint8_t clear = RH_FLAGS_APPLICATION_SPECIFIC) {
+        tx_header_flags_ = (uint8_t)((tx_header_flags_ & ~clear) | set);
+    }
+    uint8_t headerFlags() { return 0; }
+    // Flags of the packets sent, for host tests
+    uint8_t txHeaderFlags() const { return tx_header_flags_; }
+
+   protected:
+    RHMode mode_ = RHModeIdle;
+    uint32_t tx_end_us_ = 0;
+    uint8_t tx_header_id_ = 0;
+    uint8_t tx_header_flags_ = 0;
+};
+
+class RH_RF95 : public RHGenericDriver {
+   public:
+    RH_RF95(uint8_t slave_select_pin, uint8_t interrupt_pin, RHGenericSPI& spi) {
+        (void)slave_select_pin;
+        (void)interrupt_pin;
+        (void)spi;
+    }
+
+    typedef struct {
+        uint8_t reg_1d;
+        uint8_t reg_1e;
+        uint8_t reg_26;
+    } ModemConfig;
+
+    bool init() { return true; }
+    bool setFrequency(float centre) {
+        frequency_ = centre;
+        return true;
+    }
+    // Keeps the spreading factor, bandwidth and coding rate for the airtime of later packets
+    void setModemRegisters(const ModemConfig* config) {
+        modulation_.spreading_factor = config->reg_1e >> 4;
+        modulation_.bandwidth_hz = lora_bandwidths_hz[(config->reg_1d >> 4) % 10];
+        modulation_.coding_rate = ((config->reg_1d >> 1) & 0x07) + 4;
+    }
+    void setTxPower(int8_t power, bool use_rfo = false) {
+        (void)power;
+        (void)use_rfo;
+    }
+
+    bool send(const uint8_t* data, uint8_t len) {
+        (void)data;
+        waitPacketSent();
+        sent_++;
+        mode_ = RHModeTx;
+        tx_end_us_ = micros() + loraAirtimeUs(modulation_, len + RH_RF95_HEADER_LEN);
+        return true;
+    }
+    // Ends the packet at once rather than spinning, which would stall a simulated clock
+    bool waitPacketSent() {
+        if (mode() == RHModeTx) {
+            mode_ = RHModeIdle;
+        }
+        return true;
+    }
+    bool available() {
+        if (mode() == RHModeTx) {
+            return false;
+        }
+        setModeRx();
+        return false;
+    }
+    bool recv(uint8_t* buf, uint8_t* len) {
+        (void)buf;
+        (void)len;
+        return false;
+    }
+    void setModeIdle() { mode_ = RHModeIdle; }
+    void setModeRx() { mode_ = RHModeRx; }
+    int16_t lastRssi() { return 0; }
+
+    // For host tests
+    float frequency() const { return frequency_; }
+    const LoRaModulation& modulation() const { return modulation_; }
+    uint32_t packetsSent() const { return sent_; }
+
+   protected:
+    virtual void handleInterrupt() {}
+
+   private:
+    float frequency_ = 915.0;
+    uint32_t sent_ = 0;
+    LoRaModulation modulation_;
+};
@@ -0,0 +1,65 @@
+/**
+ * @file SD.cpp
+ *
+ * @brief Host file backed SD card and files of the native build.
+ */
+
+#include "SD.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+SDClass SD;
+
+File::File(FILE* file, const char* name) : file_(file, std::fclose), name_(name) {}
+
+size_t File::write(uint8_t b) { return file_ ? std::fwrite(&b, 1, 1, file_.get()) : 0; }
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    return file_ ? std::fwrite(buffer, 1, size, file_.get()) : 0;
+}
+
+void File::flush() {
+    if (file_) {
+        std::fflush(file_.get());
+    }
+}
+
+int File::read() { return file_ ? std::fgetc(file_.get()) : -1; }
+
+int File::available() {
+    if (!file_) {
+        return 0;
+    }
+    int c = std::fgetc(file_.get());
+    if (c == EOF) {
+        return 0;
+    }
+    std::ungetc(c, file_.get());
+    return 1;
+}
+
+void File::close() { file_.reset(); }
+
+bool SDClass::begin(uint8_t cs_pin) {
+    (void)cs_pin;
+    const char* dir = std::getenv("TARS_SD_DIR");
+    root_ = dir ? dir : "sd";
+    mkdir(root_.c_str(), 0755);
+    struct stat info;
+    return stat(root_.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+std::string SDClass::path(const char* filepath) const { return root_ + "/" + filepath; }
+
+bool SDClass::exists(const char* filepath) { return access(path(filepath).c_str(), F_OK) == 0; }
+
+File SDClass::open(const char* filepath, uint8_t mode) {
+    const char* host_mode = mode == FILE_READ ? "rb" : mode == FILE_WRITE ? "ab" : "wb";
+    FILE* file = std::fopen(path(filepath).c_str(), host_mode);
+    return file ? File(file, filepath) : File();
+}
+
+bool SDClass::remove(const char* filepath) { return std::remove(path(filepath).c_str()) == 0; }
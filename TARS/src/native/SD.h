@@ -0,0 +1,26 @@
+/**
+ * @file SD.h
+ *
+ * @brief SD card for the native build. The card is the directory named by TARS_SD_DIR, "sd" if it is not set.
+ */
+
+#pragma once
+
+#include "FS.h"
+
+#define BUILTIN_SDCARD 254
+
+class SDClass {
+   public:
+    bool begin(uint8_t cs_pin);
+    bool exists(const char* filepath);
+    File open(const char* filepath, uint8_t mode = FILE_READ);
+    bool remove(const char* filepath);
+
+   private:
+    std::string path(const char* filepath) const;
+
+    std::string root_;
+};
+
+extern SDClass SD;
@@ -0,0 +1,101 @@
+/**
+ * @file SPI.cpp
+ *
+ * @brief Routes the transfers of the native SPI buses to the devices attached to them.
+ */
+
+#include "SPI.h"
+
+#include <vector>
+
+#include "Arduino.h"
+
+namespace {
+
+struct Attachment {
+    SPIClass* bus;
+    SPIDevice* device;
+    uint8_t cs_pin;
+    bool selected;
+};
+
+std::vector<Attachment> attachments;
+
+void chipSelectWritten(uint8_t pin, uint8_t val) {
+    for (Attachment& attachment : attachments) {
+        if (attachment.cs_pin != pin || attachment.selected == (val == LOW)) {
+            continue;
+        }
+        attachment.selected = val == LOW;
+        if (attachment.selected) {
+            attachment.device->traffic.selects++;
+            attachment.device->select();
+        } else {
+            attachment.device->deselect();
+        }
+    }
+}
+
+}  // namespace
+
+void SPIClass::attach(uint8_t cs_pin, SPIDevice* device) {
+    attachments.push_back({this, device, cs_pin, false});
+    nativeSetPinListener(chipSelectWritten);
+}
+
+SPIDevice* SPIClass::selected() {
+    for (Attachment& attachment : attachments) {
+        if (attachment.bus == this && attachment.selected) {
+            return attachment.device;
+        }
+    }
+    return nullptr;
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+    traffic_.calls++;
+    traffic_.bytes++;
+    SPIDevice* device = selected();
+    if (!device) {
+        return 0;
+    }
+    device->traffic.calls++;
+    device->traffic.bytes++;
+    return device->transfer(data);
+}
+
+uint16_t SPIClass::transfer16(uint16_t data) {
+    traffic_.calls++;
+    traffic_.bytes += 2;
+    SPIDevice* device = selected();
+    if (!device) {
+        return 0;
+    }
+    device->traffic.calls++;
+    device->traffic.bytes += 2;
+    uint8_t high = device->transfer(data >> 8);
+    return (uint16_t)(high << 8 | device->transfer(data & 0xFF));
+}
+
+void SPIClass::transfer(void* buffer, size_t count) {
+    uint8_t* bytes = (uint8_t*)buffer;
+    traffic_.calls++;
+    traffic_.bytes += count;
+    SPIDevice* device = selected();
+    if (device) {
+        device->traffic.calls++;
+        device->traffic.bytes += count;
+    }
+    for (size_t i = 0; i < count; i++) {
+        bytes[i] = device ? device->transfer(bytes[i]) : 0;
+    }
+}
+
+void SPIClass::resetTraffic() {
+    traffic_ = SPITraffic();
+    for (Attachment& attachment : attachments) {
+        if (attachment.bus == this) {
+            attachment.device->traffic = SPITraffic();
+        }
+    }
+}
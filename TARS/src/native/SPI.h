@@ -0,0 +1,96 @@
+/**
+ * @file SPI.h
+ *
+ * @brief SPI buses for the native build.
+ *
+ * Nothing is connected in the native build and every transfer reads back zeros. A host tool can attach SPIDevices to a
+ * bus, each behind a chip select pin: a device is selected while its pin is low and sees every byte clocked on the bus
+ * meanwhile. tools/spi_bench attaches register level emulations of the sensors to count what the drivers transfer.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+struct SPISettings {
+    SPISettings() = default;
+    SPISettings(uint32_t clock, uint8_t bit_order, uint8_t data_mode)
+        : clock(clock), bit_order(bit_order), data_mode(data_mode) {}
+
+    uint32_t clock = 4000000;
+    uint8_t bit_order = MSBFIRST;
+    uint8_t data_mode = SPI_MODE0;
+};
+
+/**
+ * @brief What went over a bus, or to one device on it.
+ */
+struct SPITraffic {
+    // beginTransaction calls, only counted for a whole bus
+    uint32_t transactions = 0;
+    // Times a chip select was pulled low
+    uint32_t selects = 0;
+    // transfer, transfer16 and buffer transfer calls
+    uint32_t calls = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief A chip on a native SPI bus.
+ */
+class SPIDevice {
+   public:
+    virtual ~SPIDevice() = default;
+
+    // Chip select going low starts a command, going high ends it
+    virtual void select() {}
+    virtual void deselect() {}
+    // Takes the byte clocked in on MOSI and returns the one clocked out on MISO at the same time
+    virtual uint8_t transfer(uint8_t data) = 0;
+
+    SPITraffic traffic;
+};
+
+class SPIClass {
+   public:
+    void begin() {}
+    void end() {}
+    void setMOSI(uint8_t pin) { (void)pin; }
+    void setMISO(uint8_t pin) { (void)pin; }
+    void setSCK(uint8_t pin) { (void)pin; }
+    void beginTransaction(SPISettings settings) {
+        (void)settings;
+        traffic_.transactions++;
+    }
+    void endTransaction() {}
+
+    uint8_t transfer(uint8_t data);
+    uint16_t transfer16(uint16_t data);
+    void transfer(void* buffer, size_t count);
+
+    /**
+     * @brief Connects a device with its chip select on the pin. The pin has to be high when it is attached.
+     */
+    void attach(uint8_t cs_pin, SPIDevice* device);
+
+    const SPITraffic& traffic() const { return traffic_; }
+    // Zeroes the counts of the bus and of every device on it
+    void resetTraffic();
+
+   private:
+    SPIDevice* selected();
+
+    SPITraffic traffic_;
+};
+
+extern SPIClass SPI;
+extern SPIClass SPI1;
@@ -0,0 +1,39 @@
+/**
+ * @file SparkFunLSM6DS3.h
+ *
+ * @brief LSM6DS3 IMU for the native build, reading native_sensors.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "NativeSensors.h"
+
+#define I2C_MODE 0
+#define SPI_MODE 1
+
+typedef enum {
+    IMU_SUCCESS,
+    IMU_HW_ERROR,
+    IMU_NOT_SUPPORTED,
+    IMU_GENERIC_ERROR,
+    IMU_OUT_OF_BOUNDS,
+    IMU_ALL_ONES_WARNING,
+} status_t;
+
+class LSM6DS3 {
+   public:
+    explicit LSM6DS3(uint8_t bus_type = I2C_MODE, uint8_t input_arg = 0x6B) {
+        (void)bus_type;
+        (void)input_arg;
+    }
+
+    status_t begin() { return IMU_SUCCESS; }
+    float readFloatAccelX() { return native_sensors.low_g[0]; }
+    float readFloatAccelY() { return native_sensors.low_g[1]; }
+    float readFloatAccelZ() { return native_sensors.low_g[2]; }
+    float readFloatGyroX() { return native_sensors.gyro[0]; }
+    float readFloatGyroY() { return native_sensors.gyro[1]; }
+    float readFloatGyroZ() { return native_sensors.gyro[2]; }
+};
@@ -0,0 +1,41 @@
+/**
+ * @file SparkFun_Qwiic_KX13X.h
+ *
+ * @brief KX134 accelerometer for the native build, reading native_sensors.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "NativeSensors.h"
+#include "SPI.h"
+
+#define DEFAULT_SETTINGS 0xC0
+
+struct outputData {
+    float xData;
+    float yData;
+    float zData;
+};
+
+class QwiicKX134 {
+   public:
+    bool beginSPI(uint8_t cs_pin, uint32_t spi_port_speed = 10000000, SPIClass& spi_port = SPI) {
+        (void)cs_pin;
+        (void)spi_port_speed;
+        (void)spi_port;
+        return true;
+    }
+    bool initialize(uint8_t settings = DEFAULT_SETTINGS) {
+        (void)settings;
+        return true;
+    }
+    bool setRange(uint8_t range) {
+        (void)range;
+        return true;
+    }
+    outputData getAccelData() {
+        return {native_sensors.high_g[0], native_sensors.high_g[1], native_sensors.high_g[2]};
+    }
+};
@@ -0,0 +1,45 @@
+/**
+ * @file SparkFun_u-blox_GNSS_v3.h
+ *
+ * @brief u-blox GNSS receiver for the native build, which never gets a fix.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Wire.h"
+
+#define COM_TYPE_UBX (1 << 0)
+#define VAL_CFG_SUBSEC_IOPORT 0x00000001
+
+class SFE_UBLOX_GNSS {
+   public:
+    bool begin(TwoWire& wire_port, uint8_t device_address = 0x42) {
+        (void)wire_port;
+        (void)device_address;
+        return true;
+    }
+    bool setI2COutput(uint8_t com_settings) {
+        (void)com_settings;
+        return true;
+    }
+    bool saveConfigSelective(uint32_t config_mask) {
+        (void)config_mask;
+        return true;
+    }
+    bool setNavigationFrequency(uint8_t nav_freq) {
+        (void)nav_freq;
+        return true;
+    }
+
+    bool getPVT(uint16_t max_wait) {
+        (void)max_wait;
+        return false;
+    }
+    int32_t getLatitude() { return 0; }
+    int32_t getLongitude() { return 0; }
+    int32_t getAltitudeMSL() { return 0; }
+    uint8_t getFixType() { return 0; }
+    uint8_t getSIV() { return 0; }
+};
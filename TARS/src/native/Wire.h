@@ -0,0 +1,39 @@
+/**
+ * @file Wire.h
+ *
+ * @brief I2C bus for the native build. Nothing is connected.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class TwoWire {
+   public:
+    void begin() {}
+    void setSCL(uint8_t pin) { (void)pin; }
+    void setSDA(uint8_t pin) { (void)pin; }
+    void setClock(uint32_t frequency) { (void)frequency; }
+
+    // Nothing answers, so every transmission ends in a NACK of the address and every request comes back empty
+    void beginTransmission(uint8_t address) { (void)address; }
+    size_t write(uint8_t data) {
+        (void)data;
+        return 1;
+    }
+    uint8_t endTransmission(uint8_t send_stop = true) {
+        (void)send_stop;
+        return 2;
+    }
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t send_stop = true) {
+        (void)address;
+        (void)quantity;
+        (void)send_stop;
+        return 0;
+    }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,19 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Entry point of the native build, which runs setup() and loop() like the Arduino core does.
+ */
+
+#include <cstdio>
+
+void setup();
+void loop();
+
+int main() {
+    // USB serial sends every write straight away, so only hold back partial lines
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+    setup();
+    while (true) {
+        loop();
+    }
+}
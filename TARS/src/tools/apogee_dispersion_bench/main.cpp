@@ -0,0 +1,89 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Host benchmark for ApogeeDispersion.
+ *
+ * First checks that a batch with no perturbation and no covariance reaches the apogee of rk4::sim_apogee from the
+ * same state, for a few states and extensions. Then times one full sample + propagate cycle from a typical coast state
+ * for a range of batch sizes and reports the largest batch that fits in the 6 ms control period.
+ *
+ *     pio run -e apogee_dispersion_bench && .pio/build/apogee_dispersion_bench/program
+ *
+ * Exits with 1 if the check fails.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "mcu_main/gnc/ApogeeDispersion.h"
+#include "mcu_main/gnc/rk4.h"
+
+static constexpr double control_period_us = 6000;
+static constexpr int repeats = 50;
+
+static size_t largest_in_budget = 0;
+static rk4 model;
+
+// Largest difference from rk4::sim_apogee allowed, for the rounding of the scaled drag
+static constexpr float max_model_error = 0.5;
+
+static bool checkModel() {
+    ApogeeDispersion<4> dispersion;
+    dispersion.cd_sd = 0;
+    dispersion.mass_sd = 0;
+    bool ok = true;
+    for (float pos : {500.0f, 3000.0f}) {
+        for (float vel : {80.0f, 250.0f, 450.0f}) {
+            for (float extension : {0.0f, 6.0f, 12.7f}) {
+                dispersion.sample(pos, vel, 0, 0, 0);
+                ApogeeDistribution batch = dispersion.propagate(model, 0.3, extension);
+                float nominal = model.sim_apogee({pos, vel}, 0.3, extension)[0];
+                if (std::fabs(batch.mean - nominal) > max_model_error || batch.variance != 0) {
+                    std::printf("batch apogee %.2f m differs from rk4's %.2f m at %.0f m, %.0f m/s, %.1f mm\n",
+                                batch.mean, nominal, pos, vel, extension);
+                    ok = false;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+template <size_t N>
+static void bench() {
+    static ApogeeDispersion<N> dispersion;
+    double best_us = 1e30;
+    ApogeeDistribution result{};
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        dispersion.sample(3000, 250, 4, 0.5, 1);
+        result = dispersion.propagate(model, 0.3);
+        auto end = std::chrono::steady_clock::now();
+        best_us = std::min(best_us, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    std::printf("N = %5zu: %9.1f us  (%6.3f us/sample)  apogee %.1f +- %.1f m\n", N, best_us, best_us / N, result.mean,
+                std::sqrt(result.variance));
+    if (best_us <= control_period_us) {
+        largest_in_budget = N;
+    }
+}
+
+int main() {
+    if (!checkModel()) {
+        return 1;
+    }
+    bench<16>();
+    bench<32>();
+    bench<64>();
+    bench<128>();
+    bench<256>();
+    bench<512>();
+    bench<1024>();
+    bench<2048>();
+    bench<4096>();
+    bench<8192>();
+    std::printf("largest N within the %.0f us control period: %zu\n", control_period_us, largest_in_budget);
+    return 0;
+}
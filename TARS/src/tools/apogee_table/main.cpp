@@ -0,0 +1,160 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Host tool that generates mcu_main/gnc/apogee_table_data.h
+ *
+ * Sweeps rk4::sim_apogee over the flight envelope and writes the remaining climb (apogee - altitude) on a regular
+ * (extension, altitude, velocity) grid as a C++ header. Rerun this whenever the rk4 model, the atmosphere model or
+ * the envelope below changes:
+ *
+ *     pio run -e apogee_table
+ *     .pio/build/apogee_table/program src/mcu_main/gnc/apogee_table_data.h
+ *
+ * Pass --check to instead print how far the table deviates from the model at the centre of every grid cell.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "mcu_main/gnc/rk4.h"
+
+// Flight envelope covered by the table. Altitude is MSL in the barometric frame used by the Kalman filter.
+static constexpr float alt_min = -500;
+static constexpr float alt_max = 12000;
+static constexpr float alt_step = 250;
+static constexpr float vel_min = 0;
+static constexpr float vel_max = 600;
+static constexpr float vel_step = 15;
+
+// Flap extension in mm, from retracted to Controller::max_extension
+static constexpr float ext_min = 0;
+static constexpr float ext_step = 12.70362857 / 4;
+static constexpr size_t n_ext = 5;
+
+// Must match the time step used by Controller::ctrlTickFunction
+static constexpr float sim_dt = 0.3;
+
+static size_t count(float min, float max, float step) { return (size_t)std::lround((max - min) / step) + 1; }
+
+static float simulate(rk4& model, float alt, float vel, float ext) {
+    return model.sim_apogee({alt, vel}, sim_dt, ext)[0];
+}
+
+static void generate(rk4& model, std::vector<float>& climb, size_t n_alt, size_t n_vel) {
+    for (size_t k = 0; k < n_ext; k++) {
+        for (size_t i = 0; i < n_alt; i++) {
+            for (size_t j = 0; j < n_vel; j++) {
+                float ext = ext_min + k * ext_step;
+                float alt = alt_min + i * alt_step;
+                float vel = vel_min + j * vel_step;
+                climb.push_back(simulate(model, alt, vel, ext) - alt);
+            }
+        }
+    }
+}
+
+static int write(const char* path, const std::vector<float>& climb, size_t n_alt, size_t n_vel) {
+    FILE* out = std::fopen(path, "w");
+    if (!out) {
+        std::perror(path);
+        return 1;
+    }
+
+    std::fprintf(out,
+                 "/**\n"
+                 " * @file apogee_table_data.h\n"
+                 " *\n"
+                 " * @brief Generated by src/tools/apogee_table. Do not edit by hand.\n"
+                 " *\n"
+                 " * Remaining climb (apogee - altitude) predicted by rk4::sim_apogee, indexed as\n"
+                 " * climb[(ext * n_alt + alt) * n_vel + vel].\n"
+                 " */\n\n"
+                 "#pragma once\n\n"
+                 "#include <cstddef>\n\n"
+                 "namespace apogee_table_data {\n\n");
+    std::fprintf(out, "static constexpr size_t n_ext = %zu;\n", n_ext);
+    std::fprintf(out, "static constexpr size_t n_alt = %zu;\n", n_alt);
+    std::fprintf(out, "static constexpr size_t n_vel = %zu;\n\n", n_vel);
+    std::fprintf(out, "static constexpr float ext_min = %.8g;\n", ext_min);
+    std::fprintf(out, "static constexpr float ext_step = %.8g;\n", ext_step);
+    std::fprintf(out, "static constexpr float alt_min = %g;\n", alt_min);
+    std::fprintf(out, "static constexpr float alt_step = %g;\n", alt_step);
+    std::fprintf(out, "static constexpr float vel_min = %g;\n", vel_min);
+    std::fprintf(out, "static constexpr float vel_step = %g;\n\n", vel_step);
+
+    std::fprintf(out, "static constexpr float climb[n_ext * n_alt * n_vel] = {\n");
+    for (size_t i = 0; i < climb.size(); i++) {
+        if (i % 10 == 0) std::fprintf(out, "    ");
+        std::fprintf(out, "%.2f,", climb[i]);
+        std::fprintf(out, (i % 10 == 9 || i + 1 == climb.size()) ? "\n" : " ");
+    }
+    std::fprintf(out, "};\n\n}  // namespace apogee_table_data\n");
+
+    std::fclose(out);
+    std::printf("wrote %zu points (%zu bytes) to %s\n", climb.size(), climb.size() * sizeof(float), path);
+    return 0;
+}
+
+/**
+ * @brief Compares interpolation of the generated grid against the model at every cell centre.
+ *
+ * Cell centres are taken halfway between extension slices too, so the error includes the linear blend across
+ * extension.
+ */
+static int check(rk4& model, const std::vector<float>& climb, size_t n_alt, size_t n_vel) {
+    float max_err = 0;
+    double sum_err = 0;
+    size_t cells = 0;
+    size_t n_ext_cells = n_ext > 1 ? n_ext - 1 : 1;
+    for (size_t k = 0; k < n_ext_cells; k++) {
+        for (size_t i = 0; i + 1 < n_alt; i++) {
+            for (size_t j = 0; j + 1 < n_vel; j++) {
+                float ext = n_ext > 1 ? ext_min + (k + 0.5f) * ext_step : ext_min;
+                float alt = alt_min + (i + 0.5f) * alt_step;
+                float vel = vel_min + (j + 0.5f) * vel_step;
+
+                float interp = 0;
+                size_t slices = n_ext > 1 ? 2 : 1;
+                for (size_t s = 0; s < slices; s++) {
+                    const float* row0 = &climb[((k + s) * n_alt + i) * n_vel];
+                    const float* row1 = row0 + n_vel;
+                    interp += (row0[j] + row0[j + 1] + row1[j] + row1[j + 1]) / 4 / slices;
+                }
+
+                float err = std::fabs(alt + interp - simulate(model, alt, vel, ext));
+                if (err > max_err) max_err = err;
+                sum_err += err;
+                cells++;
+            }
+        }
+    }
+    std::printf("cell-centre error over %zu cells: mean %.3f m, max %.3f m\n", cells, sum_err / cells, max_err);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const char* path = "src/mcu_main/gnc/apogee_table_data.h";
+    bool do_check = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--check") == 0) {
+            do_check = true;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    size_t n_alt = count(alt_min, alt_max, alt_step);
+    size_t n_vel = count(vel_min, vel_max, vel_step);
+
+    rk4 model;
+    std::vector<float> climb;
+    climb.reserve(n_ext * n_alt * n_vel);
+    generate(model, climb, n_alt, n_vel);
+
+    if (do_check) {
+        return check(model, climb, n_alt, n_vel);
+    }
+    return write(path, climb, n_alt, n_vel);
+}
@@ -0,0 +1,475 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Checks the Reed-Solomon code and the interleaver of common/TelemetryFec.h, times them and simulates the
+ * frames they save on a fading channel.
+ *
+ * First corrects random codewords with every mix of errors and erasures the parity allows, and checks that packets
+ * lost or corrupted one at a time never cost an interleaved frame. It also runs a SET_FREQ through the interleaver,
+ * checking that TARS and the ground station retune on the same packet and lose no frame. Then times coding a frame of
+ * each profile's length, clean, with a packet lost, with as many corrupted bytes as can be corrected and with both,
+ * and converts the field multiplications it took into time on the Teensy 4.1's Cortex-M7 at 600 MHz, which encodes,
+ * and the Feather M0's SAMD21 at 48 MHz, which decodes, at about 5 and 18 cycles per table driven multiplication:
+ *
+ *     {"type": "fec_cost", "value": {"length": 190, "parity": 48, "case": "packet_lost", "host_us": 119.50,
+ *      "multiplies": 26518, "m7_us": 221.0, "samd21_us": 9944.2}}
+ *
+ * Last, sends frames of 190 bytes through a Gilbert-Elliott channel stepped byte by byte, fades corrupting half the
+ * bytes they cover and losing the packets whose header they hit, and prints the share of frames lost with the
+ * payload CRC, with Reed-Solomon per packet and through the encoder and decoder at TELEMETRY_FEC_DEPTH, at the same
+ * parity:
+ *
+ *     {"type": "fec_loss", "value": {"channel": "spin_nulls", "scheme": "encoder", "depth": 8, "frame_loss": 0.0834,
+ *      "data_bytes_per_packet": 130.2, "corrected_per_frame": 12.7, "latency_packets": 7}}
+ *
+ *     pio run -e fec_bench && .pio/build/fec_bench/program
+ *
+ * The fec_bench_interleaved environment builds it with a depth of 8, to compare the interleaver with the default.
+ *
+ * Exits with 1 if a check fails.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+static uint64_t multiplies = 0;
+#define REED_SOLOMON_COUNT(n) (multiplies += (n))
+
+#include "common/LinkAdaptation.h"
+#include "common/TelemetryFec.h"
+
+static constexpr double m7_cycles_per_multiply = 5;
+static constexpr double m7_mhz = 600;
+static constexpr double samd21_cycles_per_multiply = 18;
+static constexpr double samd21_mhz = 48;
+
+static std::mt19937 rng(1);
+static int failures = 0;
+
+static unsigned below(unsigned n) { return std::uniform_int_distribution<unsigned>(0, n - 1)(rng); }
+static double chance() { return std::uniform_real_distribution<double>(0, 1)(rng); }
+
+static void fail(const char* what, size_t length, size_t errors, size_t erasures) {
+    if (failures++ < 10) {
+        std::fprintf(stderr, "%s: length %zu, %zu errors, %zu erasures\n", what, length, errors, erasures);
+    }
+}
+
+// Picks count distinct positions below length
+static std::vector<uint8_t> positions(size_t length, size_t count) {
+    std::vector<uint8_t> all(length);
+    for (size_t i = 0; i < length; i++) {
+        all[i] = (uint8_t)i;
+    }
+    for (size_t i = 0; i < count; i++) {
+        std::swap(all[i], all[i + below((unsigned)(length - i))]);
+    }
+    all.resize(count);
+    return all;
+}
+
+static void checkCode() {
+    for (size_t length : {96, 128, 190, 255}) {
+        ReedSolomon rs((uint8_t)fecParity(length));
+        size_t parity = rs.parity();
+        size_t data_length = length - parity;
+        for (int trial = 0; trial < 300; trial++) {
+            uint8_t sent[255];
+            for (size_t i = 0; i < data_length; i++) {
+                sent[i] = (uint8_t)below(256);
+            }
+            rs.encode(sent, data_length, sent + data_length);
+
+            size_t erasure_count = below((unsigned)parity + 1);
+            size_t error_count = below((unsigned)(parity - erasure_count) / 2 + 1);
+            std::vector<uint8_t> where = positions(length, erasure_count + error_count);
+            uint8_t received[255];
+            memcpy(received, sent, length);
+            for (uint8_t i : where) {
+                received[i] ^= (uint8_t)(1 + below(255));
+            }
+            int corrected = rs.decode(received, length, where.data(), erasure_count);
+            if (corrected != (int)(erasure_count + error_count) || memcmp(received, sent, length) != 0) {
+                fail("not corrected", length, error_count, erasure_count);
+            }
+
+        }
+
+        // One error too many must be refused, or at worst miscorrected into another codeword
+        for (int trial = 0; trial < 100; trial++) {
+            uint8_t sent[255];
+            for (size_t i = 0; i < data_length; i++) {
+                sent[i] = (uint8_t)below(256);
+            }
+            rs.encode(sent, data_length, sent + data_length);
+            uint8_t received[255];
+            memcpy(received, sent, length);
+            size_t errors = parity / 2 + 1;
+            for (uint8_t i : positions(length, errors)) {
+                received[i] ^= (uint8_t)(1 + below(255));
+            }
+            int result = rs.decode(received, length, nullptr, 0);
+            if (result >= 0 && memcmp(received, sent, length) == 0) {
+                fail("corrected beyond the parity", length, errors, 0);
+            }
+        }
+    }
+}
+
+// Bytes of each codeword a packet carries, which its loss erases
+static size_t packetShare(size_t length) { return (length + TELEMETRY_FEC_DEPTH - 1) / TELEMETRY_FEC_DEPTH; }
+
+static void checkInterleaver() {
+    for (size_t length : {96, 190}) {
+        TelemetryFecEncoder encoder;
+        TelemetryFecDecoder decoder;
+        encoder.reset(length);
+        decoder.reset(length);
+        size_t data_length = fecDataLength(length);
+        std::vector<std::vector<uint8_t>> frames;
+        size_t decoded = 0;
+        int expected = -1;
+
+        for (int n = 0; n < 400; n++) {
+            std::vector<uint8_t> frame(data_length);
+            for (uint8_t& b : frame) {
+                b = (uint8_t)below(256);
+            }
+            frames.push_back(frame);
+            uint8_t packet[255];
+            encoder.push(frame.data(), frame.size(), packet);
+
+            // Every sixteenth packet is lost, where the parity covers its share, and the one halfway between has the
+            // longest burst that can be corrected
+            if (n % 16 == 1 && n > 16 && packetShare(length) <= fecParity(length)) {
+                continue;
+            }
+            if (n % 16 == 9) {
+                size_t burst = std::min(length, fecParity(length) / 2 * TELEMETRY_FEC_DEPTH);
+                size_t start = below((unsigned)(length - burst + 1));
+                for (size_t i = start; i < start + burst; i++) {
+                    packet[i] ^= (uint8_t)(1 + below(255));
+                }
+            }
+            decoder.push((uint8_t)n, packet, length, [&](const uint8_t* data, size_t size, const FecResult& result) {
+                int first = n - result.latency;
+                // Codewords from before the first packet
+                if (first < 0) {
+                    return;
+                }
+                if (expected >= 0 && first != expected) {
+                    fail("frame skipped", length, 0, first - expected);
+                }
+                expected = first + 1;
+                if (result.corrected < 0 || size != data_length || memcmp(data, frames[first].data(), size) != 0) {
+                    fail("interleaved frame lost", length, 0, result.erased);
+                }
+                decoded++;
+            });
+        }
+        // All but the frames still in flight at the end
+        if (decoded != 400 - (TELEMETRY_FEC_DEPTH - 1)) {
+            fail("frames missing", length, 0, 400 - decoded);
+        }
+    }
+}
+
+/**
+ * @brief Runs a frequency change through the interleaver, with and without an event message among the packets TARS
+ * sends before it retunes.
+ *
+ * As Telemetry::finishTransmit does, TARS retunes once TELEMETRY_FEC_DEPTH - 1 packets have followed the one with
+ * the first share of the acknowledging frame, or right after an event message, which acknowledges the change whole.
+ * The ground station hears only the packets sent on its frequency and retunes on the first acknowledgement it gets.
+ */
+static void checkFrequencySwitch() {
+    static constexpr int packets = 60;
+    // The first packet after the command, whose frame acknowledges it
+    static constexpr int acknowledging = 20;
+    const size_t length = 96;
+    const size_t data_length = fecDataLength(length);
+    for (int event_at : {-1, acknowledging + 3}) {
+        TelemetryFecEncoder encoder;
+        TelemetryFecDecoder decoder;
+        encoder.reset(length);
+        decoder.reset(length);
+        std::vector<std::vector<uint8_t>> frames(packets, std::vector<uint8_t>(data_length));
+        bool tars_switched = false;
+        bool ground_switched = false;
+        bool pending = false;
+        int packets_left = 0;
+        std::vector<bool> decoded(packets, false);
+
+        for (int n = 0; n < packets; n++) {
+            if (n == acknowledging) {
+                pending = true;
+                packets_left = TELEMETRY_FEC_DEPTH - 1;
+            }
+            uint8_t packet[255];
+            bool heard = tars_switched == ground_switched;
+            if (n == event_at) {
+                encoder.push(frames[n].data(), 0, packet);
+                packets_left = 0;
+                if (heard && pending) {
+                    ground_switched = true;
+                }
+            } else {
+                for (uint8_t& b : frames[n]) {
+                    b = (uint8_t)below(256);
+                }
+                encoder.push(frames[n].data(), data_length, packet);
+                if (heard) {
+                    decoder.push((uint8_t)n, packet, length, [&](const uint8_t* data, size_t size, const FecResult& r) {
+                        int first = n - r.latency;
+                        if (first < 0 || first == event_at) {
+                            return;
+                        }
+                        if (r.corrected >= 0 && memcmp(data, frames[first].data(), size) == 0) {
+                            decoded[first] = true;
+                            ground_switched |= first >= acknowledging;
+                        }
+                    });
+                }
+            }
+
+            // After the packet is out, as in Telemetry::finishTransmit
+            if (pending && packets_left > 0) {
+                packets_left--;
+            } else if (pending) {
+                pending = false;
+                tars_switched = true;
+            }
+        }
+
+        if (!tars_switched || !ground_switched) {
+            fail("frequency change not followed", length, 0, 0);
+        }
+        // All but the frames still in flight at the end
+        for (int n = 0; n < packets - (TELEMETRY_FEC_DEPTH - 1); n++) {
+            if (n != event_at && !decoded[n]) {
+                fail("frame lost to the frequency change", length, 0, (size_t)n);
+            }
+        }
+    }
+}
+
+static void printCost(size_t length, const char* name, double host_us, uint64_t count) {
+    std::printf(R"({"type": "fec_cost", "value": {"length": %zu, "parity": %zu, "case": "%s", "host_us": %.2f, )"
+                R"("multiplies": %llu, "m7_us": %.1f, "samd21_us": %.1f}})"
+                "\n",
+                length, fecParity(length), name, host_us, (unsigned long long)count,
+                count * m7_cycles_per_multiply / m7_mhz, count * samd21_cycles_per_multiply / samd21_mhz);
+}
+
+static void measureCost() {
+    using Clock = std::chrono::steady_clock;
+    static constexpr int repeats = 2000;
+    size_t lengths[LINK_PROFILE_COUNT];
+    for (int p = 0; p < LINK_PROFILE_COUNT; p++) {
+        lengths[p] = link_profiles[p].max_frame;
+    }
+    // The two fastest profiles share a length
+    for (int p = 1; p < LINK_PROFILE_COUNT; p++) {
+        size_t length = lengths[p];
+        ReedSolomon rs((uint8_t)fecParity(length));
+        size_t parity = rs.parity();
+        size_t data_length = length - parity;
+        uint8_t codeword[255];
+        for (size_t i = 0; i < data_length; i++) {
+            codeword[i] = (uint8_t)below(256);
+        }
+
+        multiplies = 0;
+        Clock::time_point start = Clock::now();
+        for (int r = 0; r < repeats; r++) {
+            rs.encode(codeword, data_length, codeword + data_length);
+        }
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / repeats;
+        printCost(length, "encode", us, multiplies / repeats);
+
+        struct Case {
+            const char* name;
+            size_t erasures;
+            size_t errors;
+        };
+        // A lost packet erases its share of the codeword, and loses the frame outright past the parity
+        size_t share = packetShare(length);
+        std::vector<Case> cases = {
+            {"clean", 0, 0},
+            {"errors", 0, parity / 2},
+        };
+        if (share <= parity) {
+            cases.push_back({"packet_lost", share, 0});
+            cases.push_back({"packet_lost_and_errors", share, (parity - share) / 2});
+        }
+        for (const Case& c : cases) {
+            std::vector<uint8_t> where = positions(length, c.erasures + c.errors);
+            uint8_t received[255];
+            multiplies = 0;
+            double total = 0;
+            for (int r = 0; r < repeats; r++) {
+                memcpy(received, codeword, length);
+                for (uint8_t i : where) {
+                    received[i] ^= 0x5a;
+                }
+                start = Clock::now();
+                int corrected = rs.decode(received, length, where.data(), c.erasures);
+                total += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+                if (corrected != (int)(c.erasures + c.errors)) {
+                    fail("timed decode", length, c.errors, c.erasures);
+                }
+            }
+            printCost(length, c.name, total / repeats, multiplies / repeats);
+        }
+    }
+}
+
+// Gilbert-Elliott channel run byte by byte through the packets and the gaps between them
+struct ChannelModel {
+    const char* name;
+    // Chance per byte of a fade starting, and its mean length in bytes
+    double fade_start;
+    double fade_bytes;
+    // Chance of a byte being corrupted, out of and in fades
+    double byte_error_good;
+    double byte_error_fade;
+};
+
+// Bytes of air time before each packet, the preamble and header, a fade in which loses the packet
+static constexpr size_t header_bytes = 10;
+// Bytes of air time between packets, the listening window and the rest of the frame period
+static constexpr size_t gap_bytes = 60;
+
+struct Packet {
+    bool lost = false;
+    std::vector<uint8_t> errors;
+};
+
+static void simulateLoss() {
+    static constexpr int packets = 20000;
+    const size_t length = link_profiles[0].max_frame;
+    const size_t parity = fecParity(length);
+    const size_t data_length = length - parity;
+    ChannelModel channels[] = {
+        {"clear", 1.0 / 20000, 20, 1e-5, 0.5},
+        {"spin_nulls", 1.0 / 300, 12, 1e-5, 0.5},
+        {"deep_fades", 1.0 / 2000, 150, 1e-5, 0.5},
+    };
+
+    for (const ChannelModel& channel : channels) {
+        // The same draws for every scheme
+        std::vector<Packet> draws(packets);
+        bool fade = false;
+        auto step = [&]() {
+            fade = fade ? chance() >= 1 / channel.fade_bytes : chance() < channel.fade_start;
+            return fade;
+        };
+        for (Packet& packet : draws) {
+            for (size_t i = 0; i < gap_bytes; i++) {
+                step();
+            }
+            for (size_t i = 0; i < header_bytes; i++) {
+                packet.lost |= step();
+            }
+            for (size_t i = 0; i < length; i++) {
+                if (chance() < (step() ? channel.byte_error_fade : channel.byte_error_good)) {
+                    packet.errors.push_back((uint8_t)i);
+                }
+            }
+        }
+
+        // As they are, a frame filling the packet and dropped by the CRC at any error
+        int plain = 0;
+        for (const Packet& packet : draws) {
+            plain += !packet.lost && packet.errors.empty();
+        }
+        std::printf(R"({"type": "fec_loss", "value": {"channel": "%s", "scheme": "crc", "frame_loss": %.4f, )"
+                    R"("data_bytes_per_packet": %.1f, "corrected_per_frame": 0.0, "latency_packets": 0}})"
+                    "\n",
+                    channel.name, 1 - (double)plain / packets, (double)plain * length / packets);
+
+        // Reed-Solomon per packet, with the same parity: a lost packet is a lost frame
+        ReedSolomon rs((uint8_t)parity);
+        int per_packet = 0;
+        double corrected_total = 0;
+        for (const Packet& packet : draws) {
+            if (packet.lost) {
+                continue;
+            }
+            uint8_t codeword[255];
+            for (size_t i = 0; i < data_length; i++) {
+                codeword[i] = (uint8_t)below(256);
+            }
+            rs.encode(codeword, data_length, codeword + data_length);
+            uint8_t received[255];
+            memcpy(received, codeword, length);
+            for (uint8_t i : packet.errors) {
+                received[i] ^= (uint8_t)(1 + below(255));
+            }
+            int corrected = rs.decode(received, length, nullptr, 0);
+            if (corrected >= 0 && memcmp(received, codeword, length) == 0) {
+                per_packet++;
+                corrected_total += corrected;
+            }
+        }
+        std::printf(R"({"type": "fec_loss", "value": {"channel": "%s", "scheme": "per_packet", "frame_loss": %.4f, )"
+                    R"("data_bytes_per_packet": %.1f, "corrected_per_frame": %.1f, "latency_packets": 0}})"
+                    "\n",
+                    channel.name, 1 - (double)per_packet / packets, (double)per_packet * data_length / packets,
+                    per_packet ? corrected_total / per_packet : 0.0);
+
+        // Through the encoder and decoder TARS and the ground station run, interleaved if TELEMETRY_FEC_DEPTH > 1
+        TelemetryFecEncoder encoder;
+        TelemetryFecDecoder decoder;
+        encoder.reset(length);
+        decoder.reset(length);
+        std::vector<std::vector<uint8_t>> frames(packets, std::vector<uint8_t>(data_length));
+        int decoded = 0;
+        corrected_total = 0;
+        for (int n = 0; n < packets; n++) {
+            for (uint8_t& b : frames[n]) {
+                b = (uint8_t)below(256);
+            }
+            uint8_t packet[255];
+            encoder.push(frames[n].data(), data_length, packet);
+            if (draws[n].lost) {
+                continue;
+            }
+            for (uint8_t i : draws[n].errors) {
+                packet[i] ^= (uint8_t)(1 + below(255));
+            }
+            decoder.push((uint8_t)n, packet, length, [&](const uint8_t* data, size_t size, const FecResult& result) {
+                int first = n - result.latency;
+                if (first >= 0 && result.corrected >= 0 && memcmp(data, frames[first].data(), size) == 0) {
+                    decoded++;
+                    corrected_total += result.corrected;
+                }
+            });
+        }
+        std::printf(R"({"type": "fec_loss", "value": {"channel": "%s", "scheme": "encoder", "depth": %d, )"
+                    R"("frame_loss": %.4f, "data_bytes_per_packet": %.1f, "corrected_per_frame": %.1f, )"
+                    R"("latency_packets": %d}})"
+                    "\n",
+                    channel.name, TELEMETRY_FEC_DEPTH, 1 - (double)decoded / packets,
+                    (double)decoded * data_length / packets, decoded ? corrected_total / decoded : 0.0,
+                    TELEMETRY_FEC_DEPTH - 1);
+    }
+}
+
+int main() {
+    checkCode();
+    checkInterleaver();
+    checkFrequencySwitch();
+    measureCost();
+    simulateLoss();
+    if (failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Host benchmark comparing the hand-written FSMs with their TableFSM versions.
+ *
+ * Replays a synthetic flight as a sequence of FlightFeatures snapshots through each pair of FSMs, reports the tick
+ * cost of both and the ticks on which their states disagree, and prints the time of every state transition.
+ *
+ *     pio run -e fsm_bench && .pio/build/fsm_bench/program
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "mcu_main/finite-state-machines/FSMTables.h"
+#include "mcu_main/finite-state-machines/HistoryBufferFSM.h"
+#include "mcu_main/finite-state-machines/KalmanFSM.h"
+#include "mcu_main/finite-state-machines/TimerFSM.h"
+
+// FSM thread period
+static constexpr int tick_ms = 10;
+static constexpr int repeats = 200;
+
+static constexpr float g = 9.81;
+
+/**
+ * @brief Builds the feature snapshots of a simple 1-D flight: pad, boost, ballistic coast, drogue and main descent.
+ */
+static std::vector<FlightFeatures> syntheticFlight() {
+    std::vector<FlightFeatures> trace;
+
+    const float dt = tick_ms / 1000.0f;
+    float alt = 0;
+    float vel = 0;
+    float burnout = -1;
+    float apogee = -1;
+    float drogue = -1;
+    float main = -1;
+    float landed = -1;
+
+    float alt_history[2 * FEATURE_WINDOW] = {};
+    float accel_history[2 * FEATURE_WINDOW] = {};
+    float az_history[2 * FEATURE_WINDOW] = {};
+
+    for (int i = 0; landed < 0 || i * dt < landed + 5; i++) {
+        float t = i * dt;
+        float accel;
+        float az;
+        if (t < 2) {
+            accel = 0;
+            az = 1;
+        } else if (t < 6.5) {
+            accel = 7 * g;
+            az = 8;
+        } else if (vel > 0 && apogee < 0) {
+            if (burnout < 0) burnout = t;
+            accel = -g;
+            az = -0.1;
+        } else if (drogue < 0 || t < drogue) {
+            if (apogee < 0) {
+                apogee = t;
+                drogue = t + 1;
+            }
+            accel = -g;
+            az = 0;
+        } else if (alt > 300) {
+            // drag balances gravity at the drogue descent rate
+            accel = vel < -25 ? (-25 - vel) / dt : 0;
+            az = t < drogue + 0.2 ? 3 : 1;
+        } else if (alt > 0) {
+            if (main < 0) main = t;
+            accel = vel < -6 ? (-6 - vel) / dt : 0;
+            az = t < main + 0.2 ? 4 : 1;
+        } else {
+            if (landed < 0) landed = t;
+            accel = 0;
+            vel = 0;
+            alt = 0;
+            az = 1;
+        }
+        vel += accel * dt;
+        alt = std::max(0.0f, alt + vel * dt);
+
+        std::copy(alt_history + 1, alt_history + 2 * FEATURE_WINDOW, alt_history);
+        std::copy(accel_history + 1, accel_history + 2 * FEATURE_WINDOW, accel_history);
+        std::copy(az_history + 1, az_history + 2 * FEATURE_WINDOW, az_history);
+        alt_history[2 * FEATURE_WINDOW - 1] = alt;
+        accel_history[2 * FEATURE_WINDOW - 1] = accel;
+        az_history[2 * FEATURE_WINDOW - 1] = az;
+
+        auto window = [](float* history, int w) {
+            float sum = 0;
+            for (int k = 0; k < FEATURE_WINDOW; k++) sum += history[w * FEATURE_WINDOW + k];
+            return sum / FEATURE_WINDOW;
+        };
+
+        FlightFeatures f{};
+        f.now = i * tick_ms;
+        f.highg_az = az;
+        f.altitude = alt;
+        f.baro_altitude_window0 = window(alt_history, 0);
+        f.baro_altitude_window1 = window(alt_history, 1);
+        f.baro_altitude_delta = f.baro_altitude_window0 - f.baro_altitude_window1;
+        f.baro_velocity = vel;
+        f.baro_accel_window0 = window(accel_history, 0);
+        f.baro_accel_window1 = window(accel_history, 1);
+        f.accel_window0 = window(az_history, 0);
+        f.accel_window1 = window(az_history, 1);
+        f.accel_average = (f.accel_window0 + f.accel_window1) / 2;
+        f.kalman_accel = az;
+        f.kalman_vel = vel;
+        f.kalman_altitude_window0 = f.baro_altitude_window0;
+        f.kalman_altitude_window1 = f.baro_altitude_window1;
+        f.kalman_accel_window0 = f.accel_window0;
+        f.kalman_accel_window1 = f.accel_window1;
+        f.kalman_altitude_accel_window0 = f.baro_accel_window0;
+        f.kalman_altitude_accel_window1 = f.baro_accel_window1;
+        trace.push_back(f);
+    }
+
+    std::printf("synthetic flight: burnout %.2f s, apogee %.2f s, drogue %.2f s, main %.2f s, landed %.2f s\n\n",
+                burnout, apogee, drogue, main, landed);
+    return trace;
+}
+
+/**
+ * @brief Runs one FSM over the trace repeatedly and returns the best time per tick in ns.
+ */
+template <typename FSM>
+static double timeTicks(const std::vector<FlightFeatures>& trace) {
+    double best_ns = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        FSM fsm;
+        auto start = std::chrono::steady_clock::now();
+        for (const FlightFeatures& f : trace) {
+            fsm.tickFSM(f);
+        }
+        auto end = std::chrono::steady_clock::now();
+        // keep the final state observable so the loop is not optimized away
+        if (fsm.getFSMState() == FSM_State::STATE_UNKNOWN) {
+            std::printf("?");
+        }
+        best_ns = std::min(best_ns, std::chrono::duration<double, std::nano>(end - start).count() / trace.size());
+    }
+    return best_ns;
+}
+
+template <typename FSM>
+static std::vector<FSM_State> states(const std::vector<FlightFeatures>& trace) {
+    FSM fsm;
+    std::vector<FSM_State> result;
+    for (const FlightFeatures& f : trace) {
+        fsm.tickFSM(f);
+        result.push_back(fsm.getFSMState());
+    }
+    return result;
+}
+
+static void printTransitions(const char* name, const std::vector<FSM_State>& result) {
+    std::printf("  %-7s", name);
+    for (size_t i = 1; i < result.size(); i++) {
+        if (result[i] != result[i - 1]) {
+            std::printf(" %d@%.2f", (int)result[i], i * tick_ms / 1000.0);
+        }
+    }
+    std::printf("\n");
+}
+
+template <typename Switch, typename Table>
+static void compare(const char* name, const std::vector<FlightFeatures>& trace) {
+    double switch_ns = timeTicks<Switch>(trace);
+    double table_ns = timeTicks<Table>(trace);
+
+    std::vector<FSM_State> switch_states = states<Switch>(trace);
+    std::vector<FSM_State> table_states = states<Table>(trace);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < trace.size(); i++) {
+        mismatches += switch_states[i] != table_states[i];
+    }
+
+    std::printf("%s: switch %.1f ns/tick, table %.1f ns/tick, %zu/%zu ticks disagree\n", name, switch_ns, table_ns,
+                mismatches, trace.size());
+    printTransitions("switch", switch_states);
+    printTransitions("table", table_states);
+}
+
+int main() {
+    std::vector<FlightFeatures> trace = syntheticFlight();
+    compare<TimerFSM, TableFSM<TimerFSMTable>>("TimerFSM", trace);
+    compare<HistoryBufferFSM<6>, TableFSM<HistoryBufferFSMTable>>("HistoryBufferFSM", trace);
+    compare<KalmanFSM, TableFSM<KalmanFSMTable>>("KalmanFSM", trace);
+    return 0;
+}
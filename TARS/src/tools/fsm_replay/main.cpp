@@ -0,0 +1,272 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Replays recorded flights through every FSM and the FSMArbiter and reports detection latencies.
+ *
+ * Each CSV has the columns of mcu_main/hilsim/flight_computer.csv. The rows are turned into FlightFeatures with the
+ * same history windows as on board, then fed to the four FSMs and to arbiters using the flight vote policies and each
+ * single voting mode. Launch, burnout and apogee are taken from the data itself: the first high-G reading above the
+ * launch threshold, the first reading below the coast threshold after that, and the highest smoothed barometer
+ * altitude. The latency is the time from that event until the FSM first reaches BOOST, COAST_PREGNC and APOGEE.
+ *
+ *     pio run -e fsm_replay && .pio/build/fsm_replay/program src/mcu_main/hilsim/flight_computer.csv
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mcu_main/finite-state-machines/rocketFSM.h"
+
+static constexpr size_t policy_count = sizeof(fsm_vote_policies) / sizeof(fsm_vote_policies[0]);
+
+struct Sample {
+    systime_t time;
+    float baro_altitude;
+    float highg_az;
+    float kalman_pos;
+    float kalman_vel;
+    float kalman_acc;
+};
+
+// First time each event was detected, -1 if never
+struct Detection {
+    long launch = -1;
+    long burnout = -1;
+    long apogee = -1;
+
+    void observe(FSM_State state, systime_t time) {
+        if (state == FSM_State::STATE_ABORT) {
+            return;
+        }
+        if (launch < 0 && state >= FSM_State::STATE_BOOST) launch = time;
+        if (burnout < 0 && state >= FSM_State::STATE_COAST_PREGNC) burnout = time;
+        if (apogee < 0 && state >= FSM_State::STATE_APOGEE) apogee = time;
+    }
+};
+
+static std::vector<Sample> readFlight(const char* path) {
+    std::vector<Sample> samples;
+    std::ifstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return samples;
+    }
+
+    std::string line;
+    std::getline(file, line);
+    std::vector<std::string> columns;
+    {
+        std::stringstream header(line);
+        std::string name;
+        while (std::getline(header, name, ',')) {
+            columns.push_back(name);
+        }
+    }
+    auto column = [&](const char* name) {
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (columns[i] == name) return (int)i;
+        }
+        std::fprintf(stderr, "%s has no %s column\n", path, name);
+        std::exit(1);
+    };
+    int time_col = column("timestamp_ms");
+    int baro_col = column("barometer_altitude");
+    int highg_col = column("highg_az");
+    int pos_col = column("state_est_x");
+    int vel_col = column("state_est_vx");
+    int acc_col = column("state_est_ax");
+
+    long first_time = -1;
+    while (std::getline(file, line)) {
+        std::vector<double> values;
+        std::stringstream row(line);
+        std::string value;
+        while (std::getline(row, value, ',')) {
+            values.push_back(std::atof(value.c_str()));
+        }
+        if (values.size() < columns.size()) {
+            continue;
+        }
+        long time = (long)values[time_col];
+        if (first_time < 0) first_time = time;
+        samples.push_back({(systime_t)(time - first_time), (float)values[baro_col], (float)values[highg_col],
+                           (float)values[pos_col], (float)values[vel_col], (float)values[acc_col]});
+    }
+    return samples;
+}
+
+static std::vector<FlightFeatures> buildFeatures(const std::vector<Sample>& samples) {
+    std::vector<FlightFeatures> trace;
+    FeatureExtractor extractor;
+    BarometerData baro[2 * FEATURE_WINDOW] = {};
+    HighGData high_g[2 * FEATURE_WINDOW] = {};
+    KalmanData kalman[2 * FEATURE_WINDOW] = {};
+
+    for (size_t n = 0; n < samples.size(); n++) {
+        const Sample& s = samples[n];
+        // The log repeats the barometer and Kalman state between their updates, which reach the FIFOs on board once
+        bool new_baro = n == 0 || s.baro_altitude != samples[n - 1].baro_altitude;
+        bool new_kalman = n == 0 || s.kalman_pos != samples[n - 1].kalman_pos;
+        for (size_t i = 0; i + 1 < 2 * FEATURE_WINDOW; i++) {
+            if (new_baro) baro[i] = baro[i + 1];
+            high_g[i] = high_g[i + 1];
+            if (new_kalman) kalman[i] = kalman[i + 1];
+        }
+        if (new_baro) {
+            BarometerData& b = baro[2 * FEATURE_WINDOW - 1];
+            b.altitude = s.baro_altitude;
+            b.timeStamp_barometer = s.time;
+        }
+        HighGData& g = high_g[2 * FEATURE_WINDOW - 1];
+        g.hg_az = s.highg_az;
+        g.timeStamp_highG = s.time;
+        if (new_kalman) {
+            KalmanData& k = kalman[2 * FEATURE_WINDOW - 1];
+            k.kalman_pos_x = s.kalman_pos;
+            k.kalman_vel_x = s.kalman_vel;
+            k.kalman_acc_x = s.kalman_acc;
+            k.timeStamp_state = s.time;
+        }
+
+        FlightFeatures f{};
+        f.now = s.time;
+        f.highg_az = s.highg_az;
+        f.altitude = s.baro_altitude;
+        f.kalman_accel = s.kalman_acc;
+        f.kalman_vel = s.kalman_vel;
+        extractor.derive(f, baro, high_g, kalman);
+        trace.push_back(f);
+    }
+    return trace;
+}
+
+static Detection truth(const std::vector<Sample>& samples) {
+    Detection events;
+    for (const Sample& s : samples) {
+        if (events.launch < 0 && s.highg_az > launch_linear_acceleration_thresh) {
+            events.launch = s.time;
+        } else if (events.launch >= 0 && events.burnout < 0 && s.highg_az < coast_thresh) {
+            events.burnout = s.time;
+        }
+    }
+
+    const size_t smoothing = 5;
+    float best = -1e30;
+    for (size_t i = smoothing; i < samples.size(); i++) {
+        float sum = 0;
+        for (size_t j = i - smoothing; j < i; j++) {
+            sum += samples[j].baro_altitude;
+        }
+        if (sum / smoothing > best) {
+            best = sum / smoothing;
+            events.apogee = samples[i - smoothing / 2 - 1].time;
+        }
+    }
+    return events;
+}
+
+static void printLatency(const char* name, const Detection& detected, const Detection& events) {
+    auto latency = [](long detected_time, long event_time) {
+        static char buffers[3][24];
+        static int next = 0;
+        char* buffer = buffers[next++ % 3];
+        if (detected_time < 0 || event_time < 0) {
+            std::snprintf(buffer, 24, "%s", "never");
+        } else {
+            std::snprintf(buffer, 24, "%+ld", detected_time - event_time);
+        }
+        return buffer;
+    };
+    std::printf("  %-24s %10s %10s %10s\n", name, latency(detected.launch, events.launch),
+                latency(detected.burnout, events.burnout), latency(detected.apogee, events.apogee));
+}
+
+static void replay(const char* path) {
+    std::vector<Sample> samples = readFlight(path);
+    if (samples.empty()) {
+        return;
+    }
+    std::vector<FlightFeatures> trace = buildFeatures(samples);
+    Detection events = truth(samples);
+
+    TimerFSM timer;
+    ModularFSM modular;
+    HistoryBufferFSM<6> history_buffer;
+    KalmanFSM kalman;
+    RocketFSMBase* fsms[4] = {&timer, &modular, &history_buffer, &kalman};
+    const char* names[4] = {"TimerFSM", "ModularFSM", "HistoryBufferFSM", "KalmanFSM"};
+
+    VotePolicy first_to_agree[policy_count];
+    VotePolicy majority[policy_count];
+    VotePolicy weighted[policy_count];
+    for (size_t p = 0; p < policy_count; p++) {
+        first_to_agree[p] = majority[p] = weighted[p] = fsm_vote_policies[p];
+        first_to_agree[p].mode = VoteMode::FirstToAgree;
+        majority[p].mode = VoteMode::Majority;
+        weighted[p].mode = VoteMode::Weighted;
+        weighted[p].threshold = 0.5;
+    }
+    const float equal_weights[4] = {1, 1, 1, 1};
+    FSMArbiter<4, policy_count> arbiters[4] = {
+        {fsm_vote_weights, fsm_vote_policies},
+        {equal_weights, first_to_agree},
+        {equal_weights, majority},
+        {fsm_vote_weights, weighted},
+    };
+    const char* arbiter_names[4] = {"arbiter (flight policy)", "arbiter (first to agree)", "arbiter (majority)",
+                                    "arbiter (weighted)"};
+
+    Detection fsm_detections[4];
+    Detection arbiter_detections[4];
+    for (const FlightFeatures& f : trace) {
+        rocketStateData<4> states;
+        states.timestamp = f.now;
+        for (size_t i = 0; i < 4; i++) {
+            fsms[i]->tickFSM(f);
+            states.rocketStates[i] = fsms[i]->getFSMState();
+            fsm_detections[i].observe(states.rocketStates[i], f.now);
+        }
+        for (size_t a = 0; a < 4; a++) {
+            rocketStateData<4> voted = states;
+            arbiter_detections[a].observe(arbiters[a].update(voted), f.now);
+        }
+    }
+
+    std::printf("%s: %zu samples, launch at %ld ms, burnout at %ld ms, apogee at %ld ms\n", path, samples.size(),
+                events.launch, events.burnout, events.apogee);
+    std::printf("  %-24s %10s %10s %10s\n", "detection latency (ms)", "launch", "burnout", "apogee");
+    for (size_t i = 0; i < 4; i++) {
+        printLatency(names[i], fsm_detections[i], events);
+    }
+    for (size_t a = 0; a < 4; a++) {
+        printLatency(arbiter_names[a], arbiter_detections[a], events);
+    }
+
+    std::printf("  flight policy transitions:\n");
+    static const char* reasons[] = {"none", "first to agree", "majority", "weighted", "tie timeout"};
+    for (size_t p = 0; p < policy_count; p++) {
+        const VoteRecord* record = arbiters[0].getRecord(fsm_vote_policies[p].state);
+        if (record) {
+            std::printf("    %2d -> %2d at %7lu ms: %-14s voters 0x%x support %.2f\n", (int)record->from,
+                        (int)record->to, (unsigned long)record->time, reasons[(int)record->reason], record->voters,
+                        record->support);
+        }
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s flight.csv [flight.csv ...]\n", argv[0]);
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        replay(argv[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,515 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Streams a recorded flight to TARS in HILSIM mode over the binary link of mcu_main/hilsim/HILSIMProtocol.h.
+ *
+ * The CSV has the columns of mcu_main/hilsim/flight_computer.csv, plus ornt_roll, ornt_pitch and ornt_yaw if the
+ * orientation was recorded. Rows are sent at their recorded timestamps, or at --rate frames per second interpolating
+ * between them, so a 100 Hz recording can drive TARS at 1 kHz. A .hilsim file of sensor frames, as tools/sensor_synth
+ * writes them, is read in place of a CSV, its frames are sent at their simulated times. Frames are due at fixed times from the start of the
+ * stream and the status frames TARS returns are read while waiting, so a slow frame does not delay the ones after it.
+ * Each frame also carries its simulated time, which tools/hilsim_target runs the flight code's clock on.
+ *
+ * Prints a line for every FSM state change TARS reports and passes any text TARS prints through to stderr. At the end
+ * prints a summary with both sides' counts of dropped, late and invalid frames:
+ *
+ *     pio run -e hilsim_stream && .pio/build/hilsim_stream/program /dev/ttyACM0 src/mcu_main/hilsim/flight_computer.csv
+ *
+ * Options:
+ *     --rate <hz>     frames per simulated second, the recorded timestamps if not given
+ *     --speed <x>     plays the flight x times faster, 0 sends every frame as soon as it can
+ *     --pad <s>       seconds of the first row sent before the flight, for TARS to settle on the pad (10)
+ *     --lockstep      waits for the answer to each frame before sending the next, for up to a second
+ *     --step          waits for a line on stdin before each frame, a number on the line sends that many frames
+ *     --exec          runs the port as a program instead, talking to it over its stdin and stdout
+ *     --baud <rate>   for a USB to serial adapter, Teensy USB serial ignores it (115200)
+ *     --log <path>    writes every status frame to a CSV
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mcu_main/hilsim/HILSIMProtocol.h"
+
+// A frame sent this long after it was due counts as late
+static constexpr uint32_t late_send_us = 1000;
+// How long --lockstep waits for an answer
+static constexpr uint32_t answer_timeout_us = 1000000;
+
+struct Row {
+    // Simulated time in s from the start of the stream
+    double time;
+    HILSIMPacket packet;
+};
+
+struct Options {
+    const char* port = nullptr;
+    const char* csv = nullptr;
+    double rate = 0;
+    double speed = 1;
+    double pad = 10;
+    bool lockstep = false;
+    bool step = false;
+    bool exec = false;
+    int baud = 115200;
+    const char* log = nullptr;
+};
+
+static std::vector<Row> readFlight(const char* path) {
+    std::vector<Row> rows;
+    std::ifstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        std::exit(1);
+    }
+
+    std::string line;
+    std::getline(file, line);
+    std::vector<std::string> columns;
+    {
+        std::stringstream header(line);
+        std::string name;
+        while (std::getline(header, name, ',')) {
+            if (!name.empty() && name.back() == '\r') name.pop_back();
+            columns.push_back(name);
+        }
+    }
+    auto find = [&](const char* name) {
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (columns[i] == name) return (int)i;
+        }
+        return -1;
+    };
+    auto column = [&](const char* name) {
+        int index = find(name);
+        if (index < 0) {
+            std::fprintf(stderr, "%s has no %s column\n", path, name);
+            std::exit(1);
+        }
+        return index;
+    };
+
+    // Packet fields in order after the timestamp, orientation is optional
+    const char* names[18] = {"highg_ax", "highg_ay", "highg_az", "barometer_altitude", "temperature", "pressure",
+                             "ax",       "ay",       "az",       "gx",                 "gy",          "gz",
+                             "mx",       "my",       "mz",       "ornt_roll",          "ornt_pitch",  "ornt_yaw"};
+    int time_col = column("timestamp_ms");
+    int field_cols[18];
+    for (int i = 0; i < 18; i++) {
+        field_cols[i] = i < 15 ? column(names[i]) : find(names[i]);
+    }
+
+    double first_time = -1;
+    while (std::getline(file, line)) {
+        std::vector<double> values;
+        std::stringstream row(line);
+        std::string value;
+        while (std::getline(row, value, ',')) {
+            values.push_back(std::atof(value.c_str()));
+        }
+        if (values.size() < columns.size()) {
+            continue;
+        }
+        double time = values[time_col];
+        if (first_time < 0) first_time = time;
+
+        Row r{(time - first_time) / 1000, {}};
+        r.packet.timestamp = (uint32_t)time;
+        float* fields = &r.packet.imu_high_ax;
+        for (int i = 0; i < 18; i++) {
+            fields[i] = field_cols[i] < 0 ? 0 : (float)values[field_cols[i]];
+        }
+        rows.push_back(r);
+    }
+    return rows;
+}
+
+/**
+ * @brief Reads a file of HILSIM sensor frames, timed by their simulated time from the first frame.
+ */
+static std::vector<Row> readFrames(const char* path) {
+    std::vector<Row> rows;
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        std::exit(1);
+    }
+
+    HILSIMFrameReader reader;
+    uint32_t first_us = 0;
+    uint8_t buffer[65536];
+    size_t length;
+    while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        for (size_t i = 0; i < length; i++) {
+            if (!reader.push(buffer[i]) || reader.header().type != HILSIMFrameType::Sensor ||
+                reader.bodySize() != sizeof(HILSIMPacket)) {
+                continue;
+            }
+            if (rows.empty()) first_us = reader.header().sim_time_us;
+            Row r{(reader.header().sim_time_us - first_us) / 1e6, {}};
+            std::memcpy(&r.packet, reader.body(), sizeof(HILSIMPacket));
+            rows.push_back(r);
+        }
+    }
+    if (reader.errors() > 0) {
+        std::fprintf(stderr, "%s has %u invalid frames\n", path, (unsigned)reader.errors());
+    }
+    std::fclose(file);
+    return rows;
+}
+
+/**
+ * @brief The packets to send, after options.pad seconds of the first row.
+ */
+static std::vector<Row> schedule(const std::vector<Row>& flight, const Options& options) {
+    std::vector<Row> frames;
+    double pad = options.pad;
+    double period = options.rate > 0 ? 1 / options.rate : 0;
+    if (period > 0) {
+        for (double t = 0; t < pad; t += period) {
+            frames.push_back({t, flight.front().packet});
+        }
+        size_t i = 0;
+        for (double t = 0; t <= flight.back().time; t += period) {
+            while (i + 2 < flight.size() && flight[i + 1].time <= t) i++;
+            const Row& a = flight[i];
+            const Row& b = flight[std::min(i + 1, flight.size() - 1)];
+            float fraction = b.time > a.time ? (float)((t - a.time) / (b.time - a.time)) : 0;
+            Row r{pad + t, a.packet};
+            r.packet.timestamp = a.packet.timestamp + (uint32_t)((t - a.time) * 1000);
+            const float* from = &a.packet.imu_high_ax;
+            const float* to = &b.packet.imu_high_ax;
+            float* fields = &r.packet.imu_high_ax;
+            for (int f = 0; f < 18; f++) {
+                fields[f] = from[f] + (to[f] - from[f]) * fraction;
+            }
+            frames.push_back(r);
+        }
+    } else {
+        double spacing = flight.size() > 1 ? flight[1].time - flight[0].time : 0.01;
+        for (double t = 0; spacing > 0 && t < pad; t += spacing) {
+            frames.push_back({t, flight.front().packet});
+        }
+        for (const Row& r : flight) {
+            frames.push_back({pad + r.time, r.packet});
+        }
+    }
+    return frames;
+}
+
+/**
+ * @brief Starts the program with one end of a socket as its stdin and stdout and returns the other.
+ */
+static int startProgram(const char* program) {
+    int ends[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, ends) < 0) {
+        std::fprintf(stderr, "socketpair failed: %s\n", std::strerror(errno));
+        std::exit(1);
+    }
+    if (fork() == 0) {
+        dup2(ends[1], STDIN_FILENO);
+        dup2(ends[1], STDOUT_FILENO);
+        close(ends[0]);
+        close(ends[1]);
+        execl(program, program, (char*)nullptr);
+        std::fprintf(stderr, "cannot run %s: %s\n", program, std::strerror(errno));
+        _exit(1);
+    }
+    close(ends[1]);
+    fcntl(ends[0], F_SETFL, O_NONBLOCK);
+    return ends[0];
+}
+
+static int openPort(const Options& options) {
+    if (options.exec) {
+        return startProgram(options.port);
+    }
+    int fd = open(options.port, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) {
+        std::fprintf(stderr, "cannot open %s: %s\n", options.port, std::strerror(errno));
+        std::exit(1);
+    }
+    // Anything that is not a terminal is used as it is
+    if (isatty(fd)) {
+        termios tty{};
+        tcgetattr(fd, &tty);
+        cfmakeraw(&tty);
+        speed_t speed = B115200;
+        switch (options.baud) {
+            case 9600: speed = B9600; break;
+            case 57600: speed = B57600; break;
+            case 230400: speed = B230400; break;
+            case 460800: speed = B460800; break;
+            case 921600: speed = B921600; break;
+        }
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+        tcsetattr(fd, TCSANOW, &tty);
+        tcflush(fd, TCIOFLUSH);
+    }
+    return fd;
+}
+
+class Streamer {
+   public:
+    Streamer(int fd, FILE* log) : fd_(fd), log_(log), start_(std::chrono::steady_clock::now()) {
+        if (log_) {
+            std::fprintf(log_, "time_us,sequence,ack_sequence,rtt_us,fsm_state,servo_angle,flap_extension\n");
+        }
+    }
+
+    uint32_t now() const {
+        return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                start_)
+            .count();
+    }
+
+    /**
+     * @brief Reads the status frames TARS sends until the deadline, in us from the start of the stream.
+     *
+     * @param answered also returns once every frame sent has been answered
+     */
+    void receiveUntil(uint32_t deadline, bool answered = false) {
+        while (true) {
+            receive();
+            if (answered && status_received_ > 0 && last_.ack_sequence == (uint16_t)(sequence_ - 1)) {
+                return;
+            }
+            int32_t remaining = (int32_t)(deadline - now());
+            if (remaining <= 0) {
+                return;
+            }
+            pollfd input = {fd_, POLLIN, 0};
+            timespec timeout = {remaining / 1000000, (remaining % 1000000) * 1000L};
+            ppoll(&input, 1, &timeout, nullptr);
+        }
+    }
+
+    void send(const Row& row, uint32_t due) {
+        HILSIMHeader header{HILSIM_PROTOCOL_VERSION, HILSIMFrameType::Sensor, sequence_++, due,
+                            (uint32_t)std::lround(row.time * 1e6)};
+        uint8_t frame[HILSIM_MAX_FRAME];
+        size_t length = encodeHILSIMFrame(header, &row.packet, sizeof(row.packet), frame);
+        size_t written = 0;
+        while (written < length) {
+            ssize_t n = write(fd_, frame + written, length - written);
+            if (n > 0) {
+                written += n;
+            } else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+                std::fprintf(stderr, "write failed: %s\n", std::strerror(errno));
+                std::exit(1);
+            } else {
+                pollfd output = {fd_, POLLOUT, 0};
+                poll(&output, 1, 10);
+            }
+        }
+        uint32_t lag = now() - due;
+        sent_++;
+        max_lag_us_ = std::max(max_lag_us_, lag);
+        if (lag > late_send_us) {
+            late_++;
+        }
+    }
+
+    void printSummary() const {
+        uint32_t answered = status_received_;
+        std::printf(
+            "{\"type\": \"hilsim_summary\", \"value\": {\"sent\": %u, \"late\": %u, \"max_lag_us\": %u, "
+            "\"status_received\": %u, \"status_dropped\": %u, \"unanswered\": %u, \"errors\": %u, "
+            "\"rtt_us_mean\": %.0f, \"rtt_us_max\": %u, \"tars_received\": %u, \"tars_dropped\": %u, "
+            "\"tars_late\": %u, \"tars_errors\": %u}}\n",
+            sent_, late_, max_lag_us_, status_received_, status_dropped_, sent_ > answered ? sent_ - answered : 0,
+            reader_.errors(), answered ? (double)rtt_sum_us_ / answered : 0.0, rtt_max_us_, last_.received,
+            last_.dropped, last_.late, last_.errors);
+    }
+
+   private:
+    void receive() {
+        uint8_t buffer[512];
+        ssize_t n;
+        while ((n = read(fd_, buffer, sizeof(buffer))) > 0) {
+            for (ssize_t i = 0; i < n; i++) {
+                if (reader_.push(buffer[i])) {
+                    handleFrame();
+                } else if (reader_.textSize() > 0) {
+                    std::fwrite(reader_.text(), 1, reader_.textSize(), stderr);
+                    // Lines longer than a frame are cut short
+                    if (reader_.text()[reader_.textSize() - 1] != '\n') {
+                        std::fputs("...\n", stderr);
+                    }
+                }
+            }
+        }
+    }
+
+    void handleFrame() {
+        const HILSIMHeader& header = reader_.header();
+        if (header.type != HILSIMFrameType::Status || reader_.bodySize() != sizeof(HILSIMStatus)) {
+            return;
+        }
+        HILSIMStatus status;
+        std::memcpy(&status, reader_.body(), sizeof(status));
+        uint32_t time = now();
+
+        if (status_received_ > 0) {
+            uint16_t gap = header.sequence - next_status_;
+            if (gap < 0x8000) status_dropped_ += gap;
+        }
+        next_status_ = header.sequence + 1;
+        status_received_++;
+
+        uint32_t rtt = time - status.ack_time_us;
+        rtt_sum_us_ += rtt;
+        rtt_max_us_ = std::max(rtt_max_us_, rtt);
+
+        if (status_received_ == 1 || status.fsm_state != last_.fsm_state) {
+            std::printf("{\"type\": \"fsm_state\", \"value\": {\"time_us\": %u, \"state\": %u}}\n", time,
+                        status.fsm_state);
+            std::fflush(stdout);
+        }
+        last_ = status;
+
+        if (log_) {
+            std::fprintf(log_, "%u,%u,%u,%u,%u,%u,%.3f\n", time, header.sequence, status.ack_sequence, rtt,
+                         status.fsm_state, status.servo_angle, status.flap_extension);
+        }
+    }
+
+    int fd_;
+    FILE* log_;
+    std::chrono::steady_clock::time_point start_;
+    HILSIMFrameReader reader_;
+
+    uint16_t sequence_ = 0;
+    uint32_t sent_ = 0;
+    uint32_t late_ = 0;
+    uint32_t max_lag_us_ = 0;
+
+    uint16_t next_status_ = 0;
+    uint32_t status_received_ = 0;
+    uint32_t status_dropped_ = 0;
+    uint64_t rtt_sum_us_ = 0;
+    uint32_t rtt_max_us_ = 0;
+    HILSIMStatus last_{};
+};
+
+/**
+ * @brief With --step, waits for the go ahead to send the next frame.
+ */
+static void waitForStep(const Row& frame) {
+    static int steps_left = 0;
+    static bool input_open = true;
+    if (!input_open || --steps_left > 0) {
+        return;
+    }
+    std::fprintf(stderr, "%.3f s> ", frame.time);
+    char line[64];
+    if (!std::fgets(line, sizeof(line), stdin)) {
+        // The rest of the flight streams on its own
+        input_open = false;
+        return;
+    }
+    steps_left = std::max(1, std::atoi(line));
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--rate") && has_value) {
+            options.rate = std::atof(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--speed") && has_value) {
+            options.speed = std::atof(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--pad") && has_value) {
+            options.pad = std::atof(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--lockstep")) {
+            options.lockstep = true;
+        } else if (!std::strcmp(argv[i], "--step")) {
+            options.step = true;
+        } else if (!std::strcmp(argv[i], "--exec")) {
+            options.exec = true;
+        } else if (!std::strcmp(argv[i], "--baud") && has_value) {
+            options.baud = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--log") && has_value) {
+            options.log = argv[++i];
+        } else if (!options.port) {
+            options.port = argv[i];
+        } else if (!options.csv) {
+            options.csv = argv[i];
+        } else {
+            options.port = nullptr;
+            break;
+        }
+    }
+    if (!options.port || !options.csv || options.speed < 0) {
+        std::fprintf(stderr,
+                     "usage: %s <port> <flight.csv> [--rate hz] [--speed x] [--pad s] [--lockstep] [--step] [--exec]\n"
+                     "       [--baud rate] [--log path]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    size_t name_length = std::strlen(options.csv);
+    bool frames_file = name_length > 7 && !std::strcmp(options.csv + name_length - 7, ".hilsim");
+    std::vector<Row> flight = frames_file ? readFrames(options.csv) : readFlight(options.csv);
+    if (flight.empty()) {
+        std::fprintf(stderr, "%s has no rows\n", options.csv);
+        return 1;
+    }
+    std::vector<Row> frames = schedule(flight, options);
+
+    FILE* log = nullptr;
+    if (options.log) {
+        log = std::fopen(options.log, "w");
+        if (!log) {
+            std::fprintf(stderr, "cannot open %s\n", options.log);
+            return 1;
+        }
+    }
+
+    int fd = openPort(options);
+    Streamer streamer(fd, log);
+    // Stepping holds the stream up, so the frames are due from the time they are let through
+    uint32_t held_us = 0;
+    for (const Row& frame : frames) {
+        if (options.step) {
+            uint32_t start = streamer.now();
+            waitForStep(frame);
+            held_us += streamer.now() - start;
+        }
+        uint32_t due = options.speed > 0 ? (uint32_t)(frame.time / options.speed * 1e6) + held_us : streamer.now();
+        streamer.receiveUntil(due);
+        streamer.send(frame, due);
+        if (options.lockstep) {
+            streamer.receiveUntil(streamer.now() + answer_timeout_us, true);
+        }
+    }
+    // The answers to the last frames
+    streamer.receiveUntil(streamer.now() + 500000, true);
+    streamer.printSummary();
+
+    if (log) {
+        std::fclose(log);
+    }
+    close(fd);
+    if (options.exec) {
+        wait(nullptr);
+    }
+    return 0;
+}
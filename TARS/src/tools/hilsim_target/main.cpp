@@ -0,0 +1,87 @@
+/**
+ * @file main.cpp
+ *
+ * @brief The flight code in HILSIM mode on a clock slaved to the HILSIM stream, the host side stand-in for the Teensy.
+ *
+ * Runs the flight code on SimKernel with stdin and stdout as the serial port, like the native build, but the
+ * simulated clock only moves on as far as the sensor frames received say. When every thread is blocked, the clock
+ * gate publishes the next frame at its simulated time and answers it once the flight code has run up to that time.
+ * The timing of a flight therefore only depends on the frames, so a replay comes out the same on every run and host,
+ * and tools/hilsim_stream can step it frame by frame or slow it down:
+ *
+ *     pio run -e hilsim_target -e hilsim_stream
+ *     .pio/build/hilsim_stream/program --exec .pio/build/hilsim_target/program src/mcu_main/hilsim/flight_computer.csv \
+ *         --lockstep --speed 0
+ *
+ * The program exits when the stream closes its input.
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#include "mcu_main/hilsim/HILSIMLink.h"
+#include "tools/silsim/SimKernel.h"
+
+void setup();
+void loop();
+
+// A sensor frame taken in but not published yet, and the tick it is due at
+static bool frame_pending = false;
+static uint64_t frame_tick = 0;
+// A frame published but not answered yet, it is once every thread is blocked at its tick
+static bool answer_pending = false;
+
+/**
+ * @brief The next byte of stdin, blocking until there is one. Exits at the end of the stream.
+ */
+static uint8_t readByte() {
+    static uint8_t buffer[512];
+    static size_t position = 0;
+    static size_t length = 0;
+    if (position == length) {
+        ssize_t n;
+        while ((n = read(STDIN_FILENO, buffer, sizeof(buffer))) < 0) {
+        }
+        if (n == 0) {
+            std::fprintf(stderr, "HILSIM stream closed at %.3f s\n", hilsim_link.receivedSimTimeUs() / 1e6);
+            std::exit(0);
+        }
+        position = 0;
+        length = n;
+    }
+    return buffer[position++];
+}
+
+static uint64_t gateClock(uint64_t now, uint64_t deadline) {
+    if (answer_pending) {
+        hilsim_link.sendStatus();
+        answer_pending = false;
+    }
+    if (!frame_pending) {
+        while (!hilsim_link.receive(readByte())) {
+        }
+        frame_pending = true;
+        frame_tick = std::max(now, (uint64_t)TIME_US2I(hilsim_link.receivedSimTimeUs()));
+    }
+    // Threads due before the frame run on the previous one
+    if (deadline < frame_tick) {
+        return deadline;
+    }
+    hilsim_link.publish();
+    frame_pending = false;
+    answer_pending = true;
+    return frame_tick;
+}
+
+int main() {
+    // USB serial sends every write straight away, so only hold back partial lines
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+    simSetClockGate(gateClock);
+    setup();
+    while (true) {
+        loop();
+    }
+}
@@ -0,0 +1,296 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Runs the link adaptation of common/LinkAdaptation.h over a flight with a path loss model.
+ *
+ * TARS sends full frames back to back and listens after one a second, as Telemetry::serviceRadio does, while a
+ * LinkAdapter and a LinkFollower pick the profile at each end from what actually got through. The rocket flies to
+ * about 9 km and comes down under drogue and main, with the ground station some km from the pad. The path loss grows
+ * faster near the ground, the rocket's antenna has its null along its axis while it points up, the plume costs 10 dB
+ * in boost, and every packet fades on top of that. A packet gets through with a probability that rises from 12 % to
+ * 98 % as the SNR goes from the spreading factor's floor to 3 dB above it.
+ *
+ * Each mode runs the same flights, adaptive and then fixed at each profile, and prints the frames and datapoint bytes
+ * that got through in each phase, the longest gap between frames, and how often the link switched or fell back:
+ *
+ *     {"type": "link_sim", "value": {"mode": "adaptive", "phase": "landed", "frames_per_s": 0.89, "delivered": 0.858,
+ *      "bytes_per_s": 46.9, "max_gap_s": 4.04}}
+ *     {"type": "link_sim_summary", "value": {"mode": "adaptive", "bytes_per_s": 524.9, "max_gap_s": 4.04,
+ *      "switches": 5.2, "fallbacks": 1.46, "desync_s": 0.17}}
+ *
+ * The switches of the first flight are printed as link_sim_switch. Takes the number of flights and the distance from
+ * the ground station to the pad in m.
+ *
+ *     pio run -e link_sim && .pio/build/link_sim/program [flights] [distance_m]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "common/TelemetryCodec.h"
+
+// RH_RF95_HEADER_LEN, before every packet
+static constexpr size_t header_len = 4;
+// An uplink with one command in it
+static constexpr size_t command_size = commandUplinkSize(1);
+static constexpr double listen_interval_s = 1.0;
+// TELEMETRY_RX_WINDOW_MS, and the ground station's delay before it answers
+static constexpr double window_slack_s = 0.1;
+static constexpr double answer_delay_s = 0.05;
+
+static constexpr double rocket_power_dbm = 6;
+static constexpr double ground_power_dbm = 23;
+static constexpr double ground_gain_dbi = 3;
+// Noise of the flight computer's own electronics at its receiver
+static constexpr double rocket_noise_db = 6;
+static constexpr double frequency_hz = 434e6;
+
+// Flight times, s
+static constexpr double pad_s = 60;
+static constexpr double burnout_s = 5;
+static constexpr double apogee_s = 41;
+static constexpr double main_altitude_m = 450;
+static constexpr double landed_extra_s = 30;
+
+enum Phase { PAD, ASCENT, DESCENT, LANDED, PHASE_COUNT };
+static const char* phase_names[PHASE_COUNT] = {"pad", "ascent", "descent", "landed"};
+
+struct Position {
+    double altitude;
+    // From the ground station
+    double horizontal;
+};
+
+static double landing_s() {
+    double apogee_m = 1125 + 450 * (apogee_s - burnout_s) - 6.25 * (apogee_s - burnout_s) * (apogee_s - burnout_s);
+    return apogee_s + (apogee_m - main_altitude_m) / 30 + main_altitude_m / 6;
+}
+
+// Boosts at 90 m/s^2 to 450 m/s, coasts to about 9.2 km, then 30 m/s under drogue and 6 m/s under main
+static Position position(double t, double distance) {
+    double altitude = 0;
+    if (t < 0) {
+        altitude = 0;
+    } else if (t < burnout_s) {
+        altitude = 45 * t * t;
+    } else if (t < apogee_s) {
+        double coast = t - burnout_s;
+        altitude = 1125 + 450 * coast - 6.25 * coast * coast;
+    } else {
+        double apogee_m = 1125 + 450 * (apogee_s - burnout_s) - 6.25 * (apogee_s - burnout_s) * (apogee_s - burnout_s);
+        double drogue_s = (apogee_m - main_altitude_m) / 30;
+        if (t < apogee_s + drogue_s) {
+            altitude = apogee_m - 30 * (t - apogee_s);
+        } else {
+            altitude = std::max(0.0, main_altitude_m - 6 * (t - apogee_s - drogue_s));
+        }
+    }
+    // Drifts away from the ground station at 8 m/s once off the pad
+    return {altitude, distance + 8 * std::max(0.0, t)};
+}
+
+static Phase phase(double t) {
+    if (t < 0) {
+        return PAD;
+    }
+    if (t < apogee_s) {
+        return ASCENT;
+    }
+    return t < landing_s() ? DESCENT : LANDED;
+}
+
+struct Channel {
+    std::mt19937 rng;
+
+    // SNR at the ground station of a packet sent by the rocket at t, in dB in the profile's bandwidth
+    double downlinkSnr(double t, double distance, const LoRaModulation& modulation) {
+        Position p = position(t, distance);
+        double range = std::sqrt(p.altitude * p.altitude + p.horizontal * p.horizontal);
+        // Free space 1 m from the antenna, then an exponent of 2 aloft rising to 2.8 on the ground
+        double exponent = 2 + 0.8 * std::exp(-p.altitude / 300);
+        double loss = 20 * std::log10(4 * M_PI * frequency_hz / 299792458.0) + 10 * exponent * std::log10(range);
+        // Dipole along the axis, pointing up until apogee and swinging under the chutes after
+        double pattern = 0;
+        Phase ph = phase(t);
+        if (ph == ASCENT) {
+            pattern = std::max(-20.0, 20 * std::log10(p.horizontal / range));
+        }
+        double plume = ph == ASCENT && t < burnout_s ? -10 : 0;
+        double fading = std::normal_distribution<double>(0, ph == DESCENT ? 6 : 3)(rng);
+        double rssi = rocket_power_dbm + ground_gain_dbi - loss + pattern + plume + fading;
+        return rssi - loraNoiseFloorDbm(modulation.bandwidth_hz);
+    }
+
+    bool gets(double snr, const LoRaModulation& modulation) {
+        double margin = snr - loraRequiredSnrDb(modulation.spreading_factor);
+        return std::uniform_real_distribution<double>(0, 1)(rng) < 1 / (1 + std::exp(-2 * (margin - 1)));
+    }
+};
+
+struct PhaseStats {
+    double seconds = 0;
+    double frames_sent = 0;
+    double frames_received = 0;
+    double bytes_received = 0;
+    double max_gap_s = 0;
+};
+
+struct FlightStats {
+    PhaseStats phases[PHASE_COUNT];
+    double switches = 0;
+    double fallbacks = 0;
+    double desync_s = 0;
+};
+
+static size_t status_bytes() { return (telemetry_codec::statusBits() + 7) / 8; }
+
+/**
+ * @brief Flies once, fixed at profile if it is below LINK_PROFILE_COUNT, adaptive otherwise.
+ */
+static FlightStats fly(uint32_t seed, double distance, int fixed, bool trace) {
+    FlightStats stats;
+    Channel channel{std::mt19937(seed)};
+    LinkAdapter tars;
+    LinkFollower ground;
+    uint8_t tars_profile = fixed < LINK_PROFILE_COUNT ? (uint8_t)fixed : tars.profile();
+    uint8_t ground_profile = tars_profile;
+    uint8_t sequence = 0;
+
+    double end = landing_s() + landed_extra_s;
+    double t = -pad_s;
+    double last_window = t;
+    double last_received = t;
+    // The ground station polls its LinkFollower in its loop, so it is on its profile by the time the next frame starts
+    auto follow = [&](double now) {
+        if (fixed >= LINK_PROFILE_COUNT && ground.update((uint32_t)((now + pad_s) * 1000))) {
+            ground_profile = ground.profile();
+            if (trace) {
+                std::printf(R"({"type": "link_sim_switch", "value": {"t_s": %.2f, "side": "ground", "profile": %d}})"
+                            "\n",
+                            now, ground_profile);
+            }
+        }
+    };
+    while (t < end) {
+        if (fixed >= LINK_PROFILE_COUNT && tars.startFrame()) {
+            tars_profile = tars.profile();
+            if (trace) {
+                std::printf(R"({"type": "link_sim_switch", "value": {"t_s": %.2f, "side": "tars", "profile": %d}})"
+                            "\n",
+                            t, tars_profile);
+            }
+        }
+        follow(t);
+        // Judged as the frame starts, as both ends switch between frames
+        bool synced = ground_profile == tars_profile;
+        const LoRaProfile& profile = link_profiles[tars_profile];
+        bool listen = t - last_window >= listen_interval_s;
+        double airtime = loraAirtimeUs(profile.modulation, profile.max_frame + header_len) / 1e6;
+        double start = t;
+
+        double snr = channel.downlinkSnr(t + airtime / 2, distance, profile.modulation);
+        bool received = synced && channel.gets(snr, profile.modulation);
+        t += airtime;
+        PhaseStats& ps = stats.phases[phase(start)];
+        ps.frames_sent++;
+        if (received) {
+            ps.frames_received++;
+            ps.bytes_received += profile.max_frame - status_bytes();
+            ps.max_gap_s = std::max(ps.max_gap_s, t - last_received);
+            last_received = t;
+            if (fixed >= LINK_PROFILE_COUNT) {
+                // The SX1276 reads the RSSI including the noise, and its SNR tops out at about +10 dB
+                double noise = loraNoiseFloorDbm(profile.modulation.bandwidth_hz);
+                double rssi = 10 * std::log10(std::pow(10, (noise + snr) / 10) + std::pow(10, noise / 10));
+                double reading = std::min(snr, 10.0);
+                ground.onFrame(sequence, (int16_t)std::lround(rssi), (int8_t)std::lround(reading * 4), tars.next(),
+                               tars.countdown(), (uint32_t)((t + pad_s) * 1000));
+            }
+        }
+        sequence++;
+
+        if (listen) {
+            last_window = t;
+            double command_air = loraAirtimeUs(profile.modulation, command_size + header_len) / 1e6;
+            bool answered = false;
+            if (received) {
+                LinkReport report = ground.report();
+                double uplink_snr = snr + ground_power_dbm - rocket_power_dbm - rocket_noise_db;
+                answered = channel.gets(uplink_snr, profile.modulation);
+                if (answered && fixed >= LINK_PROFILE_COUNT) {
+                    tars.onReport(report);
+                }
+            }
+            if (!answered && fixed >= LINK_PROFILE_COUNT) {
+                tars.onWindowMissed();
+            }
+            t += answered ? answer_delay_s + command_air : command_air + window_slack_s;
+        }
+
+        ps.seconds += t - start;
+        if (!synced) {
+            stats.desync_s += t - start;
+        }
+    }
+    // The gap before landing counts against the last phase as well
+    PhaseStats& last = stats.phases[LANDED];
+    last.max_gap_s = std::max(last.max_gap_s, t - last_received);
+    stats.switches = tars.switches();
+    stats.fallbacks = tars.fallbacks() + ground.fallbacks();
+    return stats;
+}
+
+int main(int argc, char** argv) {
+    int flights = argc > 1 ? std::atoi(argv[1]) : 50;
+    double distance = argc > 2 ? std::atof(argv[2]) : 4000;
+
+    for (int mode = LINK_PROFILE_COUNT; mode >= 0; mode--) {
+        char name[16];
+        if (mode == LINK_PROFILE_COUNT) {
+            std::snprintf(name, sizeof(name), "adaptive");
+        } else {
+            std::snprintf(name, sizeof(name), "fixed_%d", mode);
+        }
+
+        FlightStats total;
+        double worst_gap[PHASE_COUNT] = {};
+        for (int flight = 0; flight < flights; flight++) {
+            FlightStats stats = fly(flight + 1, distance, mode, flight == 0 && mode == LINK_PROFILE_COUNT);
+            for (int p = 0; p < PHASE_COUNT; p++) {
+                total.phases[p].seconds += stats.phases[p].seconds;
+                total.phases[p].frames_sent += stats.phases[p].frames_sent;
+                total.phases[p].frames_received += stats.phases[p].frames_received;
+                total.phases[p].bytes_received += stats.phases[p].bytes_received;
+                worst_gap[p] = std::max(worst_gap[p], stats.phases[p].max_gap_s);
+            }
+            total.switches += stats.switches;
+            total.fallbacks += stats.fallbacks;
+            total.desync_s += stats.desync_s;
+        }
+
+        double seconds = 0;
+        double bytes = 0;
+        double gap = 0;
+        for (int p = 0; p < PHASE_COUNT; p++) {
+            const PhaseStats& ps = total.phases[p];
+            std::printf(R"({"type": "link_sim", "value": {"mode": "%s", "phase": "%s", "frames_per_s": %.2f, )"
+                        R"("delivered": %.3f, "bytes_per_s": %.1f, "max_gap_s": %.2f}})"
+                        "\n",
+                        name, phase_names[p], ps.frames_received / ps.seconds,
+                        ps.frames_sent ? ps.frames_received / ps.frames_sent : 0.0, ps.bytes_received / ps.seconds,
+                        worst_gap[p]);
+            seconds += ps.seconds;
+            bytes += ps.bytes_received;
+            gap = std::max(gap, worst_gap[p]);
+        }
+        std::printf(R"({"type": "link_sim_summary", "value": {"mode": "%s", "bytes_per_s": %.1f, "max_gap_s": %.2f, )"
+                    R"("switches": %.1f, "fallbacks": %.2f, "desync_s": %.2f}})"
+                    "\n",
+                    name, bytes / seconds, gap, total.switches / flights, total.fallbacks / flights,
+                    total.desync_s / flights);
+    }
+    return 0;
+}
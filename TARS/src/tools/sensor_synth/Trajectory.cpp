@@ -0,0 +1,180 @@
+/**
+ * @file Trajectory.cpp
+ *
+ * @brief Reading OpenRocket and RASAero exports, and flying RocketModel, into a Trajectory.
+ */
+
+#include "tools/sensor_synth/Trajectory.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+
+namespace {
+
+std::string lower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+}
+
+std::vector<std::string> split(const std::string& line) {
+    std::vector<std::string> fields;
+    std::stringstream row(line);
+    std::string field;
+    while (std::getline(row, field, ',')) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+bool isNumber(const std::string& field) {
+    char* end;
+    std::strtod(field.c_str(), &end);
+    return end != field.c_str();
+}
+
+// First column whose name starts with one of the prefixes, -1 if there is none
+int findColumn(const std::vector<std::string>& columns, std::initializer_list<const char*> prefixes) {
+    for (const char* prefix : prefixes) {
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (lower(columns[i]).rfind(prefix, 0) == 0) {
+                return (int)i;
+            }
+        }
+    }
+    return -1;
+}
+
+// Feet to metres if the column's unit is in feet
+double unitScale(const std::string& column) { return lower(column).find("(ft") != std::string::npos ? 0.3048 : 1; }
+
+// Linear interpolation of the rows onto a fixed step
+std::vector<float> resample(const std::vector<double>& times, const std::vector<double>& values, double step) {
+    std::vector<float> table;
+    size_t i = 0;
+    for (double t = times.front(); t <= times.back(); t += step) {
+        while (i + 2 < times.size() && times[i + 1] <= t) i++;
+        double span = times[i + 1] - times[i];
+        double fraction = span > 0 ? std::min(1.0, (t - times[i]) / span) : 0;
+        table.push_back((float)(values[i] + (values[i + 1] - values[i]) * fraction));
+    }
+    return table;
+}
+
+}  // namespace
+
+/**
+ * @brief Reads an OpenRocket or RASAero CSV export.
+ *
+ * OpenRocket's column names are on a comment line, RASAero's on the first line. The time, altitude and vertical
+ * acceleration columns are found by name, in feet or metres. Without an acceleration column the acceleration is
+ * differentiated from the altitude. Time 0 is taken as ignition.
+ *
+ * @return false if the file cannot be read or lacks a time or altitude column
+ */
+bool Trajectory::load(const char* path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+
+    std::vector<std::string> columns;
+    std::vector<std::vector<double>> rows;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        bool comment = !line.empty() && line[0] == '#';
+        std::vector<std::string> fields = split(comment ? line.substr(1) : line);
+        if (fields.size() < 2) {
+            continue;
+        }
+        if (!isNumber(fields[0])) {
+            // The last line of names before the data, OpenRocket also comments the flight events
+            if (rows.empty() && lower(fields[0]).find("time") != std::string::npos) {
+                columns = fields;
+                for (std::string& column : columns) {
+                    column.erase(0, column.find_first_not_of(' '));
+                }
+            }
+            continue;
+        }
+        if (comment) {
+            continue;
+        }
+        std::vector<double> values;
+        for (const std::string& field : fields) {
+            values.push_back(std::atof(field.c_str()));
+        }
+        rows.push_back(values);
+    }
+
+    int time_col = findColumn(columns, {"time"});
+    int altitude_col = findColumn(columns, {"altitude"});
+    int acceleration_col = findColumn(columns, {"vertical acceleration", "accel-v"});
+    if (time_col < 0 || altitude_col < 0 || rows.size() < 3) {
+        std::fprintf(stderr, "%s has no time and altitude columns or too few rows\n", path);
+        return false;
+    }
+
+    double altitude_scale = unitScale(columns[altitude_col]);
+    double acceleration_scale = acceleration_col >= 0 ? unitScale(columns[acceleration_col]) : 1;
+    std::vector<double> times;
+    std::vector<double> altitudes;
+    std::vector<double> accelerations;
+    for (const std::vector<double>& row : rows) {
+        if (row.size() < columns.size() || (!times.empty() && row[time_col] <= times.back())) {
+            continue;
+        }
+        times.push_back(row[time_col]);
+        altitudes.push_back(row[altitude_col] * altitude_scale);
+        accelerations.push_back(acceleration_col >= 0 ? row[acceleration_col] * acceleration_scale : 0);
+    }
+    if (acceleration_col < 0) {
+        for (size_t i = 1; i + 1 < times.size(); i++) {
+            double before = (altitudes[i] - altitudes[i - 1]) / (times[i] - times[i - 1]);
+            double after = (altitudes[i + 1] - altitudes[i]) / (times[i + 1] - times[i]);
+            accelerations[i] = 2 * (after - before) / (times[i + 1] - times[i - 1]);
+        }
+    }
+    double start = times.front();
+    for (double& t : times) {
+        t -= start;
+    }
+
+    altitude_ = resample(times, altitudes, step);
+    acceleration_ = resample(times, accelerations, step);
+    return true;
+}
+
+/**
+ * @brief Flies RocketModel with the flaps retracted until it lands, or for ten minutes.
+ */
+void Trajectory::fly(const RocketParameters& parameters) {
+    RocketModel model(parameters);
+    model.ignite();
+    altitude_.assign(1, 0);
+    acceleration_.assign(1, 0);
+    while (!model.landed() && model.time() < 600) {
+        model.step(step, 0);
+        altitude_.push_back((float)model.altitude());
+        acceleration_.push_back((float)model.acceleration());
+    }
+}
+
+double Trajectory::lookup(const std::vector<float>& table, double t) const {
+    if (table.empty()) {
+        return 0;
+    }
+    double position = std::max(0.0, std::min(t / step, table.size() - 1.0));
+    size_t below = (size_t)position;
+    if (below + 1 >= table.size()) {
+        return table.back();
+    }
+    return table[below] + (table[below + 1] - table[below]) * (position - below);
+}
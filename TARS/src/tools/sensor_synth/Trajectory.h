@@ -0,0 +1,34 @@
+/**
+ * @file Trajectory.h
+ *
+ * @brief Vertical flight path sensor_synth samples its sensors along, from a simulator export or RocketModel.
+ *
+ * Whatever the source, the path is resampled every millisecond from ignition, so looking up a time is an index.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "tools/silsim/RocketModel.h"
+
+class Trajectory {
+   public:
+    bool load(const char* path);
+    void fly(const RocketParameters& parameters);
+
+    // Seconds from ignition to the end of the path
+    double duration() const { return altitude_.empty() ? 0 : (altitude_.size() - 1) * step; }
+
+    // Height above the pad in m and vertical acceleration in m/s^2, t seconds after ignition, held at either end
+    double altitude(double t) const { return lookup(altitude_, t); }
+    double acceleration(double t) const { return lookup(acceleration_, t); }
+
+   private:
+    static constexpr double step = 0.001;
+
+    double lookup(const std::vector<float>& table, double t) const;
+
+    std::vector<float> altitude_;
+    std::vector<float> acceleration_;
+};
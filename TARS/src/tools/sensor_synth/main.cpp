@@ -0,0 +1,464 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Synthesizes the raw sensor streams of a flight along a trajectory, for HILSIM and replays.
+ *
+ * The trajectory is an OpenRocket or RASAero CSV export, or RocketModel flown with the flaps retracted. Every sensor is
+ * sampled at its own output data rate along it, preceded by --pad seconds on the pad. Each sample gets the sensor's
+ * bias and Gaussian noise, is clipped to its range and quantized to its resolution, is lost with the sensor's dropout
+ * probability and only shows up after its latency. The defaults follow the sensors' data sheets and the ranges the
+ * flight code configures, any of them can be changed with --set <sensor>.<parameter>=<value>:
+ *
+ *     sensors     highg, lowg, gyro, baro, mag, orientation, gps, voltage
+ *     parameters  odr (Hz), latency (s), dropout (probability), noise (standard deviation), bias, range (clipped to
+ *                 plus or minus, 0 for none), lsb (quantization step, 0 for none)
+ *
+ * Units are those of HILSIMPacket: g, deg/s, mbar, gauss and radians. The baro noise is in mbar, its altitude is
+ * worked out from the noisy pressure the way BarometerSensor does. The gps noise is in m.
+ *
+ * Frames hold the latest sample of every sensor and are written at --rate Hz, by default the fastest sensor's rate or
+ * at most 1 kHz in a CSV. They are written either as a file of HILSIM sensor frames (--format hilsim), which
+ * tools/hilsim_stream sends as they are, or as a CSV with the columns of mcu_main/hilsim/flight_computer.csv
+ * (--format csv) for tools/hilsim_stream and tools/fsm_replay. --runs flights are generated on --jobs threads, run n
+ * with seed --seed + n, into <out>/run_<n>:
+ *
+ *     pio run -e sensor_synth && .pio/build/sensor_synth/program --model --runs 64 --jobs 8 --out synth
+ *     pio run -e sensor_synth && .pio/build/sensor_synth/program --trajectory openrocket.csv --set lowg.range=16
+ */
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mcu_main/gnc/Atmosphere.h"
+#include "mcu_main/hilsim/HILSIMProtocol.h"
+#include "tools/sensor_synth/Trajectory.h"
+
+static constexpr double gravity = 9.81;
+
+struct SensorModel {
+    const char* name;
+    double odr;
+    double latency;
+    double dropout;
+    float noise;
+    float bias;
+    float range;
+    float lsb;
+};
+
+enum Sensor { HighG, LowG, Gyro, Baro, Mag, Orientation, Gps, Voltage, SensorCount };
+
+// KX134 at +-64 g, LSM6DS3 at +-16 g and +-2000 deg/s, MS5611 at the highest resolution, LIS3MDL at 80 Hz and
+// +-4 gauss, the BNO08x rotation vector, a 10 Hz GPS and the battery voltage divider
+static const SensorModel default_sensors[SensorCount] = {
+    {"highg", 1600, 0, 0, 0.008f, 0, 64, 128.0f / 65536},
+    {"lowg", 1666, 0, 0, 0.002f, 0, 16, 0.000488f},
+    {"gyro", 1666, 0, 0, 0.1f, 0, 2000, 0.07f},
+    {"baro", 100, 0.009, 0, 0.015f, 0, 0, 0.01f},
+    {"mag", 80, 0, 0, 0.003f, 0, 4, 1.0f / 6842},
+    {"orientation", 100, 0.005, 0, 0.002f, 0, 0, 0},
+    {"gps", 10, 0.1, 0, 2.0f, 0, 0, 0},
+    {"voltage", 10, 0, 0, 0.01f, 0, 0, 0},
+};
+
+struct Options {
+    const char* trajectory = nullptr;
+    bool model = false;
+    const char* out = "synth";
+    const char* format = "hilsim";
+    double rate = 0;
+    double pad = 10;
+    // Height of the pad above sea level, and where it is
+    double pad_altitude = 181;
+    double latitude = 41.4877;
+    double longitude = -89.5063;
+    // Temperature inside the barometer, which reads the board rather than the air
+    float baro_temperature = 33;
+    // Earth's field in the rocket's frame on the pad
+    float field[3] = {0.376f, 0.116f, -0.530f};
+    float battery = 8.0f;
+    int runs = 1;
+    int jobs = 1;
+    uint32_t seed = 1;
+    SensorModel sensors[SensorCount];
+};
+
+/**
+ * @brief One sensor's stream, the latest sample that has shown up and when the next one is taken.
+ */
+struct SensorStream {
+    const SensorModel* model;
+    double next = 0;
+    float values[3] = {};
+};
+
+/**
+ * @brief Everything one run writes, accumulated in a buffer that is written out in large blocks.
+ */
+class Output {
+   public:
+    explicit Output(FILE* file) : file_(file) { buffer_.reserve(block); }
+    ~Output() {
+        flush();
+        std::fclose(file_);
+    }
+
+    void write(const void* data, size_t size) {
+        const uint8_t* bytes = (const uint8_t*)data;
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+        if (buffer_.size() >= block) {
+            flush();
+        }
+    }
+
+    uint64_t bytes() const { return written_ + buffer_.size(); }
+
+   private:
+    static constexpr size_t block = 1 << 20;
+
+    void flush() {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        written_ += buffer_.size();
+        buffer_.clear();
+    }
+
+    FILE* file_;
+    std::vector<uint8_t> buffer_;
+    uint64_t written_ = 0;
+};
+
+class Synthesizer {
+   public:
+    Synthesizer(const Options& options, const Trajectory& trajectory, uint32_t seed)
+        : options_(options), trajectory_(trajectory), rng_(seed) {
+        for (int s = 0; s < SensorCount; s++) {
+            streams_[s].model = &options.sensors[s];
+            if (options.sensors[s].odr <= 0) {
+                continue;
+            }
+            // Every sensor starts at a random point of its sample period, with a sample from before the stream
+            double period = 1 / options.sensors[s].odr;
+            streams_[s].next = uniform_(rng_) * period;
+            sample((Sensor)s, streams_[s].next - period, streams_[s].values);
+        }
+    }
+
+    /**
+     * @brief Brings every stream up to time t in s from the start.
+     */
+    void advance(double t) {
+        for (int s = 0; s < SensorCount; s++) {
+            SensorStream& stream = streams_[s];
+            const SensorModel& model = *stream.model;
+            if (model.odr <= 0) {
+                continue;
+            }
+            // Only the last sample that has shown up by t is needed
+            double period = 1 / model.odr;
+            double last = stream.next + std::floor((t - model.latency - stream.next) / period) * period;
+            if (last < stream.next) {
+                continue;
+            }
+            stream.next = last + period;
+            if (model.dropout > 0 && uniform_(rng_) < model.dropout) {
+                continue;
+            }
+            sample((Sensor)s, last, stream.values);
+        }
+    }
+
+    const float* values(Sensor sensor) const { return streams_[sensor].values; }
+
+    // Altitude the way BarometerSensor works it out from its pressure and temperature
+    float baroAltitude() const {
+        const float* baro = values(Baro);
+        return (float)(-std::log(baro[0] * 0.000987) * (baro[1] + 273.15) * 29.254);
+    }
+
+   private:
+    float measure(const SensorModel& model, double truth) {
+        float value = (float)truth + model.bias + model.noise * normal_(rng_);
+        if (model.range > 0) {
+            value = std::max(-model.range, std::min(value, model.range));
+        }
+        if (model.lsb > 0) {
+            value = std::round(value / model.lsb) * model.lsb;
+        }
+        return value;
+    }
+
+    void sample(Sensor sensor, double t, float* out) {
+        const SensorModel& model = options_.sensors[sensor];
+        double flight_time = t - options_.pad;
+        bool flying = flight_time >= 0;
+        double altitude = flying ? trajectory_.altitude(flight_time) : 0;
+        double specific_force = 1 + (flying ? trajectory_.acceleration(flight_time) : 0) / gravity;
+
+        switch (sensor) {
+            case HighG:
+            case LowG:
+                out[0] = measure(model, 0);
+                out[1] = measure(model, 0);
+                out[2] = measure(model, specific_force);
+                break;
+            case Gyro:
+            case Orientation:
+                for (int i = 0; i < 3; i++) out[i] = measure(model, 0);
+                break;
+            case Baro:
+                out[0] = measure(model, Atmosphere::getPressure(options_.pad_altitude + altitude) / 100);
+                out[1] = options_.baro_temperature;
+                break;
+            case Mag:
+                for (int i = 0; i < 3; i++) out[i] = measure(model, options_.field[i]);
+                break;
+            case Gps: {
+                // Degrees per metre of the horizontal noise
+                double degrees = 1 / 111320.0;
+                SensorModel horizontal = model;
+                horizontal.noise *= (float)degrees;
+                horizontal.bias *= (float)degrees;
+                out[0] = measure(horizontal, options_.latitude);
+                out[1] = measure(horizontal, options_.longitude);
+                out[2] = measure(model, options_.pad_altitude + altitude);
+                break;
+            }
+            case Voltage:
+                out[0] = measure(model, options_.battery);
+                break;
+            default:
+                break;
+        }
+    }
+
+    const Options& options_;
+    const Trajectory& trajectory_;
+    std::mt19937 rng_;
+    std::normal_distribution<float> normal_{0, 1};
+    std::uniform_real_distribution<double> uniform_{0, 1};
+    SensorStream streams_[SensorCount];
+};
+
+static HILSIMPacket packetOf(const Synthesizer& synth, uint32_t timestamp) {
+    HILSIMPacket packet;
+    packet.timestamp = timestamp;
+    const float* high_g = synth.values(HighG);
+    const float* low_g = synth.values(LowG);
+    const float* gyro = synth.values(Gyro);
+    const float* baro = synth.values(Baro);
+    const float* mag = synth.values(Mag);
+    const float* orientation = synth.values(Orientation);
+    packet.imu_high_ax = high_g[0];
+    packet.imu_high_ay = high_g[1];
+    packet.imu_high_az = high_g[2];
+    packet.barometer_altitude = synth.baroAltitude();
+    packet.barometer_temperature = baro[1];
+    packet.barometer_pressure = baro[0];
+    packet.imu_low_ax = low_g[0];
+    packet.imu_low_ay = low_g[1];
+    packet.imu_low_az = low_g[2];
+    packet.imu_low_gx = gyro[0];
+    packet.imu_low_gy = gyro[1];
+    packet.imu_low_gz = gyro[2];
+    packet.mag_x = mag[0];
+    packet.mag_y = mag[1];
+    packet.mag_z = mag[2];
+    packet.ornt_roll = orientation[0];
+    packet.ornt_pitch = orientation[1];
+    packet.ornt_yaw = orientation[2];
+    return packet;
+}
+
+static void writeCsvRow(Output& output, const Synthesizer& synth, uint32_t timestamp) {
+    const float* low_g = synth.values(LowG);
+    const float* gyro = synth.values(Gyro);
+    const float* mag = synth.values(Mag);
+    const float* gps = synth.values(Gps);
+    const float* baro = synth.values(Baro);
+    const float* high_g = synth.values(HighG);
+    const float* orientation = synth.values(Orientation);
+    char row[512];
+    // The FSM, flap and state estimate columns are the flight code's outputs and left at 0
+    int length = std::snprintf(
+        row, sizeof(row),
+        "%u,%g,%g,%g,%g,%g,%g,%g,%g,%g,%.7f,%.7f,%g,12,1,%g,%g,%g,%g,%g,%g,0,0,0,0,0,0,0,0,0,%g,%g,%g,%g\n", timestamp,
+        low_g[0], low_g[1], low_g[2], gyro[0], gyro[1], gyro[2], mag[0], mag[1], mag[2], gps[0], gps[1], gps[2], baro[1],
+        baro[0], synth.baroAltitude(), high_g[0], high_g[1], high_g[2], synth.values(Voltage)[0], orientation[0],
+        orientation[1], orientation[2]);
+    output.write(row, length);
+}
+
+/**
+ * @return bytes written
+ */
+static uint64_t generateRun(const Options& options, const Trajectory& trajectory, int run) {
+    bool csv = !std::strcmp(options.format, "csv");
+    std::string path = std::string(options.out) + "/run_" + std::to_string(run) + (csv ? ".csv" : ".hilsim");
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path.c_str());
+        return 0;
+    }
+    Output output(file);
+    if (csv) {
+        const char* header =
+            "timestamp_ms,ax,ay,az,gx,gy,gz,mx,my,mz,latitude,longitude,altitude,satellite_count,position_lock,"
+            "temperature,pressure,barometer_altitude,highg_ax,highg_ay,highg_az,rocket_state0,rocket_state1,"
+            "rocket_state2,rocket_state3,flap_extension,state_est_x,state_est_vx,state_est_ax,state_est_apo,"
+            "battery_voltage,ornt_roll,ornt_pitch,ornt_yaw\n";
+        output.write(header, std::strlen(header));
+    }
+
+    Synthesizer synth(options, trajectory, options.seed + run);
+    double end = options.pad + trajectory.duration();
+    uint64_t frames = (uint64_t)(end * options.rate) + 1;
+    uint8_t frame[HILSIM_MAX_FRAME];
+    for (uint64_t i = 0; i < frames; i++) {
+        double t = i / options.rate;
+        uint32_t time_us = (uint32_t)std::llround(t * 1e6);
+        synth.advance(t);
+        if (csv) {
+            writeCsvRow(output, synth, time_us / 1000);
+        } else {
+            HILSIMPacket packet = packetOf(synth, time_us / 1000);
+            HILSIMHeader header{HILSIM_PROTOCOL_VERSION, HILSIMFrameType::Sensor, (uint16_t)i, time_us, time_us};
+            output.write(frame, encodeHILSIMFrame(header, &packet, sizeof(packet), frame));
+        }
+    }
+    return output.bytes();
+}
+
+static bool setParameter(Options& options, const char* assignment) {
+    const char* dot = std::strchr(assignment, '.');
+    const char* equals = std::strchr(assignment, '=');
+    if (!dot || !equals || equals < dot) {
+        return false;
+    }
+    std::string sensor(assignment, dot);
+    std::string parameter(dot + 1, equals);
+    double value = std::atof(equals + 1);
+    for (SensorModel& model : options.sensors) {
+        if (sensor != model.name) {
+            continue;
+        }
+        if (parameter == "odr") {
+            model.odr = value;
+        } else if (parameter == "latency") {
+            model.latency = value;
+        } else if (parameter == "dropout") {
+            model.dropout = value;
+        } else if (parameter == "noise") {
+            model.noise = (float)value;
+        } else if (parameter == "bias") {
+            model.bias = (float)value;
+        } else if (parameter == "range") {
+            model.range = (float)value;
+        } else if (parameter == "lsb") {
+            model.lsb = (float)value;
+        } else {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::copy(default_sensors, default_sensors + SensorCount, options.sensors);
+    bool usage = false;
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        bool has_value = i + 1 < argc;
+        if (option == "--model") {
+            options.model = true;
+        } else if (option == "--trajectory" && has_value) {
+            options.trajectory = argv[++i];
+        } else if (option == "--out" && has_value) {
+            options.out = argv[++i];
+        } else if (option == "--format" && has_value) {
+            options.format = argv[++i];
+        } else if (option == "--rate" && has_value) {
+            options.rate = std::atof(argv[++i]);
+        } else if (option == "--pad" && has_value) {
+            options.pad = std::atof(argv[++i]);
+        } else if (option == "--pad-altitude" && has_value) {
+            options.pad_altitude = std::atof(argv[++i]);
+        } else if (option == "--runs" && has_value) {
+            options.runs = std::atoi(argv[++i]);
+        } else if (option == "--jobs" && has_value) {
+            options.jobs = std::max(1, std::atoi(argv[++i]));
+        } else if (option == "--seed" && has_value) {
+            options.seed = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if (option == "--set" && has_value) {
+            if (!setParameter(options, argv[++i])) {
+                std::fprintf(stderr, "unknown parameter %s\n", argv[i]);
+                return 1;
+            }
+        } else {
+            usage = true;
+        }
+    }
+    bool known_format = !std::strcmp(options.format, "hilsim") || !std::strcmp(options.format, "csv");
+    if (usage || options.model == (options.trajectory != nullptr) || !known_format) {
+        std::fprintf(stderr,
+                     "usage: %s (--trajectory export.csv | --model) [--out dir] [--format hilsim|csv] [--rate hz]\n"
+                     "              [--pad s] [--pad-altitude m] [--runs n] [--jobs n] [--seed n]\n"
+                     "              [--set sensor.parameter=value]...\n",
+                     argv[0]);
+        return 1;
+    }
+    if (options.rate <= 0) {
+        for (const SensorModel& model : options.sensors) {
+            options.rate = std::max(options.rate, model.odr);
+        }
+        // The CSV's timestamps are in ms
+        if (!std::strcmp(options.format, "csv")) {
+            options.rate = std::min(options.rate, 1000.0);
+        }
+    }
+
+    Trajectory trajectory;
+    if (options.model) {
+        trajectory.fly(RocketParameters());
+    } else if (!trajectory.load(options.trajectory)) {
+        return 1;
+    }
+    mkdir(options.out, 0755);
+
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<int> next_run{0};
+    std::atomic<uint64_t> bytes{0};
+    std::vector<std::thread> workers;
+    for (int j = 0; j < std::min(options.jobs, options.runs); j++) {
+        workers.emplace_back([&] {
+            int run;
+            while ((run = next_run++) < options.runs) {
+                bytes += generateRun(options, trajectory, run);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t frames = (uint64_t)((options.pad + trajectory.duration()) * options.rate) + 1;
+    std::printf(
+        "{\"type\": \"sensor_synth_summary\", \"value\": {\"runs\": %d, \"frames_per_run\": %llu, \"flight_s\": %.3f, "
+        "\"bytes\": %llu, \"wall_s\": %.3f, \"mb_per_min\": %.0f}}\n",
+        options.runs, (unsigned long long)frames, trajectory.duration(), (unsigned long long)bytes.load(), wall_s,
+        bytes.load() / 1e6 / wall_s * 60);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file RocketModel.cpp
+ *
+ * @brief Integration of the vertical flight model.
+ */
+
+#include "tools/silsim/RocketModel.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mcu_main/gnc/Atmosphere.h"
+
+static constexpr double gravity = 9.81;
+
+/**
+ * @brief Atmosphere sampled every 10 m, the model looks the air up every step and Atmosphere takes too long for that.
+ *
+ * A global so that the table is built once before the SILSIM forks its flights.
+ */
+class AtmosphereTable {
+   public:
+    AtmosphereTable() {
+        for (int i = 0; i < size; i++) {
+            pressure_[i] = Atmosphere::getPressure(i * spacing);
+            density_[i] = Atmosphere::getDensity(i * spacing);
+        }
+    }
+
+    double pressure(double altitude) const { return lookup(pressure_, altitude); }
+    double density(double altitude) const { return lookup(density_, altitude); }
+
+   private:
+    static constexpr int size = 3001;
+    static constexpr double spacing = 10;
+
+    double lookup(const double* table, double altitude) const {
+        double position = std::max(0.0, std::min(altitude / spacing, size - 1.0));
+        int below = std::min((int)position, size - 2);
+        double fraction = position - below;
+        return table[below] + (table[below + 1] - table[below]) * fraction;
+    }
+
+    double pressure_[size];
+    double density_[size];
+};
+
+static const AtmosphereTable atmosphere;
+
+RocketModel::RocketModel(const RocketParameters& parameters) : parameters_(parameters) {}
+
+void RocketModel::ignite() { ignited_ = true; }
+
+double RocketModel::mass() const {
+    double burnt = std::min(time_ / parameters_.burn_time, 1.0);
+    return parameters_.dry_mass + parameters_.propellant_mass * (1 - burnt);
+}
+
+double RocketModel::specificForce() const { return (acceleration_ + gravity) / gravity; }
+
+double RocketModel::pressure() const { return atmosphere.pressure(parameters_.pad_altitude + altitude_); }
+
+/**
+ * @brief Advances the model by dt seconds, semi-implicit Euler.
+ *
+ * @param dt time step in s, a millisecond is plenty at the speeds involved
+ * @param commanded_extension flap extension in mm the servo is driving towards
+ */
+void RocketModel::step(double dt, float commanded_extension) {
+    float max_change = parameters_.flap_rate * (float)dt;
+    extension_ += std::max(-max_change, std::min(commanded_extension - extension_, max_change));
+
+    if (!ignited_ || landed_) {
+        acceleration_ = 0;
+        return;
+    }
+
+    double drag_area = parameters_.drag_coefficient * parameters_.reference_area +
+                       parameters_.flap_drag_area_per_mm * extension_;
+    if (pastApogee() && time_ >= apogee_time_ + parameters_.drogue_delay) {
+        drag_area += parameters_.drogue_drag_area;
+    }
+    double density = atmosphere.density(parameters_.pad_altitude + altitude_);
+    double drag = 0.5 * density * velocity_ * std::fabs(velocity_) * drag_area;
+    double thrust = time_ < parameters_.burn_time ? parameters_.thrust : 0;
+
+    acceleration_ = (thrust - drag) / mass() - gravity;
+    // The pad holds the rocket up until the thrust lifts it
+    if (altitude_ <= 0 && velocity_ <= 0 && acceleration_ < 0) {
+        acceleration_ = 0;
+    }
+    velocity_ += acceleration_ * dt;
+    altitude_ += velocity_ * dt;
+    time_ += dt;
+
+    if (!pastApogee()) {
+        if (altitude_ > apogee_) {
+            apogee_ = altitude_;
+        } else if (velocity_ < 0) {
+            apogee_time_ = time_;
+        }
+    } else if (altitude_ <= 0) {
+        altitude_ = 0;
+        velocity_ = 0;
+        acceleration_ = 0;
+        landed_ = true;
+    }
+}
+
+float servoAngleToExtension(int angle) {
+    // The constants of ServoControl.cpp
+    const float A = 11.0333f;
+    const float B = 2.5751f;
+    const float C = -1.5724f;
+    const float D = 1.6755f;
+    float radians = angle * (float)M_PI / 180;
+    return std::max(0.0f, A * std::sin(B * radians + C) + D);
+}
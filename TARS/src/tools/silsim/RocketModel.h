@@ -0,0 +1,79 @@
+/**
+ * @file RocketModel.h
+ *
+ * @brief One degree of freedom model of the rocket's vertical flight, with the flaps as the control input.
+ *
+ * The rocket sits on the pad until ignition, burns at constant thrust while the propellant mass falls linearly, then
+ * coasts under gravity and drag until apogee. Drag is that of the airframe plus the flaps, each flap counted as a flat
+ * plate like in rk4::flapDragArea. The flaps follow the commanded extension at the servo's rate. The drogue opens a
+ * fixed time after apogee and the rocket descends under it until it lands.
+ */
+
+#pragma once
+
+struct RocketParameters {
+    // Mass without propellant, the coast mass rk4 assumes
+    float dry_mass = 21.0f;
+    float propellant_mass = 8.0f;
+    // Average thrust in N over the burn
+    float thrust = 3400.0f;
+    float burn_time = 5.0f;
+    // Airframe, the reference area rk4 uses
+    float reference_area = 0.007854f;
+    float drag_coefficient = 0.5f;
+    // Drag area in m^2 per mm of flap extension, four 38.1 mm wide flaps with a Cd of 1.2
+    float flap_drag_area_per_mm = 4 * 0.0381f * 1.2f / 1000;
+    // How fast the flaps extend and retract in mm/s
+    float flap_rate = 100.0f;
+    // Drag area of the drogue in m^2 and its deployment time after apogee
+    float drogue_drag_area = 1.0f;
+    float drogue_delay = 1.0f;
+    // Height of the pad above sea level in m
+    float pad_altitude = 0.0f;
+};
+
+class RocketModel {
+   public:
+    explicit RocketModel(const RocketParameters& parameters);
+
+    void ignite();
+    void step(double dt, float commanded_extension);
+
+    // Time since ignition in s, height above the pad in m, vertical velocity and acceleration
+    double time() const { return time_; }
+    double altitude() const { return altitude_; }
+    double velocity() const { return velocity_; }
+    double acceleration() const { return acceleration_; }
+    // Acceleration measured by an accelerometer on the rocket's axis, in g
+    double specificForce() const;
+    // Static pressure of the air around the rocket in Pa
+    double pressure() const;
+    float flapExtension() const { return extension_; }
+
+    bool ignited() const { return ignited_; }
+    bool pastApogee() const { return apogee_time_ >= 0; }
+    bool landed() const { return landed_; }
+    double apogee() const { return apogee_; }
+    double apogeeTime() const { return apogee_time_; }
+
+    const RocketParameters& parameters() const { return parameters_; }
+
+   private:
+    double mass() const;
+
+    RocketParameters parameters_;
+    double time_ = 0;
+    double altitude_ = 0;
+    double velocity_ = 0;
+    double acceleration_ = 0;
+    float extension_ = 0;
+    bool ignited_ = false;
+    bool landed_ = false;
+    double apogee_ = 0;
+    double apogee_time_ = -1;
+};
+
+/**
+ * @brief Flap extension in mm for a servo angle in degrees, the inverse of ServoControl::servoActuation.
+ */
+float servoAngleToExtension(int angle);
@@ -0,0 +1,302 @@
+/**
+ * @file SimKernel.cpp
+ *
+ * @brief Scheduler, context switches and simulated clock of the SILSIM port.
+ */
+
+#include "tools/silsim/SimKernel.h"
+
+#include <ucontext.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "ChRtPort.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Host code needs more stack than the flight code does on the Teensy, printf alone takes several KB
+const size_t thread_stack_size = 256 * 1024;
+
+struct SimThread : thread_t {
+    SimThread(const char* thread_name, tprio_t priority) {
+        name = thread_name;
+        prio = priority;
+        epending = 0;
+    }
+
+    ucontext_t context;
+    std::unique_ptr<char[]> stack;
+    tfunc_t function = nullptr;
+    void* arg = nullptr;
+
+    // What the thread is blocked on, null while it is ready
+    const std::function<bool()>* woken = nullptr;
+    uint64_t deadline = 0;
+
+    // Switch count when the thread was last switched to, threads of equal priority run in this order
+    uint64_t last_run = 0;
+    uint64_t cpu_ns = 0;
+    uint32_t runs = 0;
+};
+
+// Highest priority first, then in creation order
+std::vector<SimThread*> threads;
+// Every thread in creation order, for the statistics
+std::vector<SimThread*> created;
+
+SimThread* current = nullptr;
+int lock_depth = 0;
+uint64_t now_ticks = 0;
+uint64_t switches = 0;
+
+// When current was last switched to or came back from the tick hook
+Clock::time_point slice_start;
+
+void (*tick_hook)(systime_t now) = nullptr;
+uint64_t tick_hook_ns = 0;
+uint64_t (*clock_gate)(uint64_t now, uint64_t deadline) = nullptr;
+
+// Condition of a thread that has returned from its function, which never runs again
+const std::function<bool()> never = [] { return false; };
+
+uint64_t nanosecondsSince(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+void insertByPriority(SimThread* thread) {
+    auto position = std::find_if(threads.begin(), threads.end(),
+                                 [thread](const SimThread* other) { return other->prio < thread->prio; });
+    threads.insert(position, thread);
+}
+
+/**
+ * @brief The calling thread. The host's main thread, which runs setup(), becomes one on first use.
+ */
+SimThread* self() {
+    if (!current) {
+        current = new SimThread("", NORMALPRIO);
+        insertByPriority(current);
+        created.push_back(current);
+        slice_start = Clock::now();
+    }
+    return current;
+}
+
+bool isReady(SimThread* thread) {
+    if (!thread->woken) {
+        return true;
+    }
+    if ((*thread->woken)() || thread->deadline <= now_ticks) {
+        thread->woken = nullptr;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief The highest priority ready thread, null if every thread is blocked.
+ *
+ * Of the threads with the same priority keep wins if it is ready, otherwise the one that has waited longest since it
+ * last ran. Blocked threads with a higher priority than the winner are made ready if their condition now holds.
+ */
+SimThread* pickNext(SimThread* keep) {
+    SimThread* best = nullptr;
+    for (SimThread* thread : threads) {
+        if (best && thread->prio < best->prio) {
+            break;
+        }
+        if (!isReady(thread)) {
+            continue;
+        }
+        if (!best || thread == keep || (best != keep && thread->last_run < best->last_run)) {
+            best = thread;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Moves the clock to the earliest deadline, or as far as the clock gate lets it, calling the tick hook for every
+ * tick on the way.
+ */
+void advanceTime() {
+    uint64_t next = NATIVE_INFINITE_DEADLINE;
+    for (SimThread* thread : threads) {
+        if (thread->woken && thread->deadline < next) {
+            next = thread->deadline;
+        }
+    }
+
+    Clock::time_point start = Clock::now();
+    current->cpu_ns += nanosecondsSince(slice_start, start);
+    if (clock_gate) {
+        next = std::min(next, clock_gate(now_ticks, next));
+        start = Clock::now();
+    }
+    if (next == NATIVE_INFINITE_DEADLINE) {
+        chSysHalt("every thread is blocked without a timeout");
+    }
+    while (now_ticks < next) {
+        now_ticks++;
+        if (tick_hook) {
+            tick_hook((systime_t)now_ticks);
+        }
+    }
+    slice_start = Clock::now();
+    tick_hook_ns += nanosecondsSince(start, slice_start);
+}
+
+void switchTo(SimThread* next) {
+    if (next == current) {
+        return;
+    }
+    Clock::time_point now = Clock::now();
+    current->cpu_ns += nanosecondsSince(slice_start, now);
+    slice_start = now;
+
+    next->last_run = ++switches;
+    next->runs++;
+    SimThread* previous = current;
+    current = next;
+    swapcontext(&previous->context, &next->context);
+}
+
+/**
+ * @brief Runs the thread that should run now, keep staying on if no thread of a higher priority is ready.
+ */
+void reschedule(SimThread* keep) {
+    SimThread* next;
+    while (!(next = pickNext(keep))) {
+        advanceTime();
+    }
+    switchTo(next);
+}
+
+void threadMain() {
+    current->function(current->arg);
+    // Returning from the thread function ends the thread, like chThdExit
+    current->woken = &never;
+    current->deadline = NATIVE_INFINITE_DEADLINE;
+    lock_depth = 0;
+    reschedule(nullptr);
+}
+
+}  // namespace
+
+void simSetTickHook(void (*hook)(systime_t now)) { tick_hook = hook; }
+
+void simSetClockGate(uint64_t (*gate)(uint64_t now, uint64_t deadline)) { clock_gate = gate; }
+
+uint64_t simTickHookCpuNs() { return tick_hook_ns; }
+
+size_t simThreadStats(SimThreadStats* stats, size_t max) {
+    // Charge the running thread for its current slice
+    Clock::time_point now = Clock::now();
+    self()->cpu_ns += nanosecondsSince(slice_start, now);
+    slice_start = now;
+
+    for (size_t i = 0; i < created.size() && i < max; i++) {
+        stats[i] = {created[i]->name, created[i]->prio, created[i]->cpu_ns, created[i]->runs};
+    }
+    return created.size();
+}
+
+uint64_t nativeTimeUs() { return now_ticks * 1000000 / CH_CFG_ST_FREQUENCY; }
+
+bool nativeSleepS(const std::function<bool()>& woken, uint64_t deadline) {
+    SimThread* me = self();
+    int depth = lock_depth;
+    lock_depth = 0;
+
+    // Another thread can run between this one being made ready and running, so check again before returning
+    bool result;
+    while (true) {
+        if (woken()) {
+            result = true;
+            break;
+        }
+        if (deadline <= now_ticks) {
+            result = false;
+            break;
+        }
+        me->woken = &woken;
+        me->deadline = deadline;
+        reschedule(nullptr);
+    }
+
+    lock_depth = depth;
+    return result;
+}
+
+/**
+ * @brief Runs the main thread. There is nothing to set up, threads are scheduled as soon as they are created.
+ */
+void chBegin(void (*mainThread)()) {
+    self()->name = "main";
+    mainThread();
+}
+
+void chSysLock() {
+    self();
+    lock_depth++;
+}
+
+void chSysUnlock() {
+    if (--lock_depth == 0) {
+        reschedule(current);
+    }
+}
+
+/**
+ * @brief Creates a thread, which runs straight away if its priority is higher than the caller's, like on ChibiOS.
+ */
+thread_t* chThdCreateStatic(void* wsp, size_t size, tprio_t prio, tfunc_t pf, void* arg) {
+    (void)wsp;
+    (void)size;
+    self();
+
+    SimThread* thread = new SimThread("", prio);
+    thread->function = pf;
+    thread->arg = arg;
+    thread->stack.reset(new char[thread_stack_size]);
+    getcontext(&thread->context);
+    thread->context.uc_stack.ss_sp = thread->stack.get();
+    thread->context.uc_stack.ss_size = thread_stack_size;
+    thread->context.uc_link = nullptr;
+    makecontext(&thread->context, threadMain, 0);
+
+    insertByPriority(thread);
+    created.push_back(thread);
+    if (lock_depth == 0) {
+        reschedule(current);
+    }
+    return thread;
+}
+
+thread_t* chThdGetSelfX() { return self(); }
+
+tprio_t chThdSetPriority(tprio_t newprio) {
+    SimThread* me = self();
+    tprio_t old = me->prio;
+    threads.erase(std::find(threads.begin(), threads.end(), me));
+    me->prio = newprio;
+    insertByPriority(me);
+    if (lock_depth == 0) {
+        reschedule(me);
+    }
+    return old;
+}
+
+void chThdYield() {
+    SimThread* me = self();
+    int depth = lock_depth;
+    lock_depth = 0;
+    me->last_run = ++switches;
+    reschedule(nullptr);
+    lock_depth = depth;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file SimKernel.h
+ *
+ * @brief Port of the native ChibiOS shim that runs every thread on one host thread, on a simulated clock.
+ *
+ * Threads are scheduled the way ChibiOS schedules them: the highest priority ready thread runs until it blocks, or
+ * until releasing the kernel lock has made a higher priority thread ready. Threads of equal priority take turns when
+ * one of them blocks or yields. Simulated time only moves on when every thread is blocked, and then jumps to the next
+ * deadline, so a run takes as long as the host needs to execute the threads and never depends on the host's timing.
+ *
+ * Each thread is a ucontext on a stack of its own, the working area given to chThdCreateStatic is not used.
+ */
+
+#pragma once
+
+#include <ChRt.h>
+
+#include <cstddef>
+#include <cstdint>
+
+struct SimThreadStats {
+    const char* name;
+    tprio_t prio;
+    // Host CPU time spent running the thread
+    uint64_t cpu_ns;
+    // Times the thread was switched to
+    uint32_t runs;
+};
+
+/**
+ * @brief Sets the function called for every tick of simulated time, before the threads due at that tick wake.
+ *
+ * It stands in for CH_CFG_SYSTEM_TICK_HOOK. It runs on the stack of whichever thread blocked last and must not call
+ * into the kernel.
+ */
+void simSetTickHook(void (*hook)(systime_t now));
+
+/**
+ * @brief Sets the function that decides how far the clock moves on when every thread is blocked.
+ *
+ * It is given the current tick and the earliest deadline, NATIVE_INFINITE_DEADLINE if no thread has one, and returns
+ * the tick to move the clock to, which is capped at the deadline. Returning the current tick holds the clock and calls
+ * the gate again. It may block the host for as long as it needs to, that time is not counted anywhere. Without a gate
+ * the clock jumps straight to the deadline. It runs like the tick hook and must not call into the kernel either.
+ */
+void simSetClockGate(uint64_t (*gate)(uint64_t now, uint64_t deadline));
+
+/**
+ * @brief Host CPU time spent in the tick hook.
+ */
+uint64_t simTickHookCpuNs();
+
+/**
+ * @brief Copies the statistics of up to max threads, in the order they were created.
+ *
+ * @return the number of threads
+ */
+size_t simThreadStats(SimThreadStats* stats, size_t max);
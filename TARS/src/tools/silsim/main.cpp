@@ -0,0 +1,478 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Software in the loop simulator, which flies the flight software against RocketModel on a simulated clock.
+ *
+ * Each flight runs the real setup() and thread bodies, from the sensor thread through dataLogger, the Kalman filter,
+ * the FSMs and the apogee predictor to the controller, scheduled by SimKernel. The tick hook steps the model every
+ * millisecond with the flap extension the servo was last commanded to, and writes the sensor readings with noise
+ * drawn from the flight's seed, so a flight always comes out the same.
+ *
+ * Every flight runs in a forked child so that it starts from freshly initialized globals, up to --jobs at a time.
+ * Each flight's summary is printed as one JSON line in flight order: apogee and apogee error, the time of every state
+ * change of each of the four FSMs and of the active state that gates control, relative to ignition, and the host CPU
+ * time each thread took. A last line sums up the batch.
+ * The SD card of flight n is written to <sd>/flight_n and removed afterwards unless --keep-sd is given.
+ *
+ *     pio run -e silsim && .pio/build/silsim/program --flights 1000 --jobs 8 --sd /dev/shm/silsim_sd > flights.jsonl
+ *
+ * The environment predicts apogee from the table of ENABLE_APOGEE_TABLE, which takes a flight from about 110 to 80 ms
+ * of host CPU. Most of what is left is the dataLogger writing the card, hence a card on tmpfs for large batches.
+ */
+
+#include <fcntl.h>
+#include <ftw.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "NativeSensors.h"
+#include "mcu_main/finite-state-machines/rocketFSM.h"
+#include "mcu_main/gnc/ActiveControl.h"
+#include "tools/silsim/RocketModel.h"
+#include "tools/silsim/SimKernel.h"
+
+void setup();
+
+struct Options {
+    int flights = 1;
+    uint32_t seed = 1;
+    int jobs = 1;
+    // Pad time before ignition, the flight software needs about 5 s to calibrate
+    float ignition = 6;
+    // Flight time kept after apogee, long enough for the FSMs to pass APOGEE and DROGUE
+    float after_apogee = 10;
+    // Scale of the flight to flight dispersion of the model, 0 flies the nominal rocket every time
+    float dispersion = 1;
+    const char* sd = "silsim_sd";
+    bool keep_sd = false;
+    // Print the flight software's serial output, only useful for a single flight
+    bool verbose = false;
+};
+
+// One standard deviation of the dispersions and sensor noise
+static constexpr float thrust_sigma = 0.03f;
+static constexpr float drag_sigma = 0.05f;
+static constexpr float high_g_noise = 0.02f;
+static constexpr float low_g_noise = 0.003f;
+static constexpr float gyro_noise = 0.1f;
+static constexpr float pressure_noise = 2.0f;
+// Ticks between new sensor readings, faster than the sensor thread reads them like the sensors' own output data rates
+static constexpr systime_t sensor_period = 2;
+// Hundredths of a millibar BarometerSensor adds to the MS5611 reading
+static constexpr float barometer_offset = 2603;
+// The MS5611 sits in the avionics bay, its temperature does not follow the air outside
+static constexpr int32_t barometer_temperature = 2000;
+
+// Longest flight, in case the flight software never sees the rocket land
+static constexpr float max_flight_time = 600;
+
+struct Transition {
+    FSM_State state;
+    systime_t time;
+};
+
+// The active state, then the FSMs in fsmCollection order
+static constexpr size_t tracked_fsms = 5;
+static const char* const fsm_names[tracked_fsms] = {"active", "TimerFSM", "ModularFSM", "HistoryBufferFSM",
+                                                    "KalmanFSM"};
+
+// The flight the child process is flying
+struct Flight {
+    int number;
+    uint32_t seed;
+    int summary_fd;
+    Options options;
+    RocketModel model;
+    std::mt19937 rng;
+    std::normal_distribution<float> noise;
+    systime_t ignition;
+    FSM_State states[tracked_fsms];
+    std::vector<Transition> transitions[tracked_fsms];
+    std::chrono::steady_clock::time_point start;
+};
+
+static Flight* flight = nullptr;
+
+static const char* stateName(FSM_State state) {
+    switch (state) {
+        case FSM_State::STATE_UNKNOWN:
+            return "UNKNOWN";
+        case FSM_State::STATE_INIT:
+            return "INIT";
+        case FSM_State::STATE_IDLE:
+            return "IDLE";
+        case FSM_State::STATE_LAUNCH_DETECT:
+            return "LAUNCH_DETECT";
+        case FSM_State::STATE_BOOST:
+            return "BOOST";
+        case FSM_State::STATE_BURNOUT_DETECT:
+            return "BURNOUT_DETECT";
+        case FSM_State::STATE_COAST_PREGNC:
+            return "COAST_PREGNC";
+        case FSM_State::STATE_COAST_GNC:
+            return "COAST_GNC";
+        case FSM_State::STATE_APOGEE_DETECT:
+            return "APOGEE_DETECT";
+        case FSM_State::STATE_APOGEE:
+            return "APOGEE";
+        case FSM_State::STATE_SEPARATION:
+            return "SEPARATION";
+        case FSM_State::STATE_DROGUE_DETECT:
+            return "DROGUE_DETECT";
+        case FSM_State::STATE_DROGUE:
+            return "DROGUE";
+        case FSM_State::STATE_MAIN_DETECT:
+            return "MAIN_DETECT";
+        case FSM_State::STATE_MAIN:
+            return "MAIN";
+        case FSM_State::STATE_LANDED_DETECT:
+            return "LANDED_DETECT";
+        case FSM_State::STATE_LANDED:
+            return "LANDED";
+        case FSM_State::STATE_ABORT:
+            return "ABORT";
+    }
+    return "?";
+}
+
+static RocketParameters disperse(const Options& options, std::mt19937& rng) {
+    std::normal_distribution<float> normal(0, 1);
+    RocketParameters parameters;
+    parameters.thrust *= 1 + options.dispersion * thrust_sigma * normal(rng);
+    parameters.drag_coefficient *= 1 + options.dispersion * drag_sigma * normal(rng);
+    return parameters;
+}
+
+static void writeSensors(const RocketModel& model) {
+    std::mt19937& rng = flight->rng;
+    std::normal_distribution<float>& noise = flight->noise;
+    float specific_force = (float)model.specificForce();
+
+    native_sensors.high_g[0] = high_g_noise * noise(rng);
+    native_sensors.high_g[1] = high_g_noise * noise(rng);
+    native_sensors.high_g[2] = specific_force + high_g_noise * noise(rng);
+    native_sensors.low_g[0] = low_g_noise * noise(rng);
+    native_sensors.low_g[1] = low_g_noise * noise(rng);
+    native_sensors.low_g[2] = specific_force + low_g_noise * noise(rng);
+    for (float& rate : native_sensors.gyro) {
+        rate = gyro_noise * noise(rng);
+    }
+
+    native_sensors.pressure = (uint32_t)std::lround(model.pressure() - barometer_offset + pressure_noise * noise(rng));
+    native_sensors.temperature = barometer_temperature;
+}
+
+/**
+ * @brief Sends the flight's summary to the parent process and ends the child.
+ */
+static void finishFlight() {
+    const RocketModel& model = flight->model;
+    auto seconds = [](systime_t ticks) { return (double)ticks / CH_CFG_ST_FREQUENCY; };
+
+    std::string line;
+    char buffer[256];
+    float target = activeController.apogee_des_agl;
+    std::snprintf(buffer, sizeof(buffer),
+                  R"({"type": "silsim_flight", "value": {"flight":%d,"seed":%u,"thrust_n":%.1f,"cd":%.4f,)",
+                  flight->number, flight->seed, model.parameters().thrust, model.parameters().drag_coefficient);
+    line += buffer;
+    std::snprintf(buffer, sizeof(buffer),
+                  R"("apogee_m":%.2f,"target_m":%.2f,"apogee_error_m":%.2f,"apogee_time_s":%.3f,"transitions":)",
+                  model.apogee(), target, model.apogee() - target, model.apogeeTime());
+    line += buffer;
+    for (size_t f = 0; f < tracked_fsms; f++) {
+        std::snprintf(buffer, sizeof(buffer), R"(%s"%s":[)", f ? "]," : "{", fsm_names[f]);
+        line += buffer;
+        for (size_t i = 0; i < flight->transitions[f].size(); i++) {
+            const Transition& transition = flight->transitions[f][i];
+            std::snprintf(buffer, sizeof(buffer), R"(%s{"state":"%s","t_s":%.3f})", i ? "," : "",
+                          stateName(transition.state), seconds(transition.time) - seconds(flight->ignition));
+            line += buffer;
+        }
+    }
+
+    SimThreadStats stats[32];
+    size_t count = std::min(simThreadStats(stats, 32), (size_t)32);
+    line += R"(]},"cpu_us":{)";
+    uint64_t total_ns = simTickHookCpuNs();
+    for (size_t i = 0; i < count; i++) {
+        std::snprintf(buffer, sizeof(buffer), R"("%s":%.1f,)", stats[i].name, stats[i].cpu_ns / 1e3);
+        line += buffer;
+        total_ns += stats[i].cpu_ns;
+    }
+    std::snprintf(buffer, sizeof(buffer), R"("physics":%.1f,"total":%.1f},"runs":{)", simTickHookCpuNs() / 1e3,
+                  total_ns / 1e3);
+    line += buffer;
+    for (size_t i = 0; i < count; i++) {
+        std::snprintf(buffer, sizeof(buffer), R"(%s"%s":%u)", i ? "," : "", stats[i].name, stats[i].runs);
+        line += buffer;
+    }
+    double host_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - flight->start).count();
+    std::snprintf(buffer, sizeof(buffer), R"(},"host_ms":%.2f}})", host_ms);
+    line += buffer;
+    line += '\n';
+
+    if (write(flight->summary_fd, line.data(), line.size()) != (ssize_t)line.size()) {
+        std::perror("silsim: summary");
+    }
+    std::fflush(nullptr);
+    _exit(0);
+}
+
+static void currentStates(FSM_State states[tracked_fsms]) {
+    rocketStateData<4> collection = fsmCollection.getStates();
+    states[0] = getActiveFSMState();
+    for (size_t i = 1; i < tracked_fsms; i++) {
+        states[i] = collection.rocketStates[i - 1];
+    }
+}
+
+static void recordTransitions(systime_t now) {
+    FSM_State states[tracked_fsms];
+    currentStates(states);
+    for (size_t f = 0; f < tracked_fsms; f++) {
+        if (states[f] != flight->states[f]) {
+            flight->states[f] = states[f];
+            flight->transitions[f].push_back({states[f], now});
+        }
+    }
+}
+
+/**
+ * @brief Steps the model by one tick and hands the flight software the new sensor readings.
+ */
+static void tick(systime_t now) {
+    RocketModel& model = flight->model;
+    if (now == flight->ignition) {
+        model.ignite();
+    }
+    model.step(1.0 / CH_CFG_ST_FREQUENCY, servoAngleToExtension(activeController.controller_servo_.read()));
+    if (now % sensor_period == 0) {
+        writeSensors(model);
+    }
+
+    recordTransitions(now);
+
+    if (model.landed() || (model.pastApogee() && model.time() >= model.apogeeTime() + flight->options.after_apogee) ||
+        model.time() >= max_flight_time) {
+        finishFlight();
+    }
+}
+
+/**
+ * @brief Flies one flight in the child process, never returns.
+ */
+static void flyFlight(const Options& options, int number, int summary_fd) {
+    std::string card = std::string(options.sd) + "/flight_" + std::to_string(number);
+    setenv("TARS_SD_DIR", card.c_str(), 1);
+
+    if (!options.verbose) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, STDOUT_FILENO);
+        close(null);
+    }
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+
+    uint32_t seed = options.seed + number;
+    std::mt19937 rng(seed);
+    RocketParameters parameters = disperse(options, rng);
+    flight = new Flight{number,
+                        seed,
+                        summary_fd,
+                        options,
+                        RocketModel(parameters),
+                        rng,
+                        std::normal_distribution<float>(0, 1),
+                        (systime_t)std::lround(options.ignition * CH_CFG_ST_FREQUENCY),
+                        {},
+                        {},
+                        std::chrono::steady_clock::now()};
+    currentStates(flight->states);
+    for (size_t f = 0; f < tracked_fsms; f++) {
+        flight->transitions[f].push_back({flight->states[f], 0});
+    }
+
+    writeSensors(flight->model);
+    simSetTickHook(tick);
+    setup();
+    _exit(1);
+}
+
+static int removeEntry(const char* path, const struct stat* info, int flag, struct FTW* ftw) {
+    (void)info;
+    (void)flag;
+    (void)ftw;
+    return remove(path);
+}
+
+static double readNumber(const std::string& line, const char* key) {
+    size_t position = line.find(key);
+    return position == std::string::npos ? NAN : std::strtod(line.c_str() + position + std::strlen(key), nullptr);
+}
+
+static void printSummary(const Options& options, const std::vector<std::string>& results, double wall_s) {
+    int failed = 0;
+    int counted = 0;
+    double sum = 0;
+    double sum_squares = 0;
+    double min = INFINITY;
+    double max = -INFINITY;
+    for (const std::string& result : results) {
+        double error = readNumber(result, R"("apogee_error_m":)");
+        if (std::isnan(error)) {
+            failed++;
+            continue;
+        }
+        counted++;
+        sum += error;
+        sum_squares += error * error;
+        min = std::min(min, error);
+        max = std::max(max, error);
+    }
+
+    rusage children;
+    getrusage(RUSAGE_CHILDREN, &children);
+    double cpu_s = children.ru_utime.tv_sec + children.ru_utime.tv_usec / 1e6 + children.ru_stime.tv_sec +
+                   children.ru_stime.tv_usec / 1e6;
+
+    double mean = counted ? sum / counted : NAN;
+    double deviation = counted ? std::sqrt(std::max(0.0, sum_squares / counted - mean * mean)) : NAN;
+    std::printf(
+        R"({"type": "silsim_summary", "value": {"flights":%d,"failed":%d,"jobs":%d,"wall_s":%.3f,"flights_per_s":%.1f,)"
+        R"("cpu_ms_per_flight":%.2f,"apogee_error_m":{"mean":%.2f,"std":%.2f,"min":%.2f,"max":%.2f}}})"
+        "\n",
+        options.flights, failed, options.jobs, wall_s, options.flights / wall_s, cpu_s * 1e3 / options.flights, mean,
+        deviation, min, max);
+}
+
+static void usage() {
+    std::fprintf(stderr,
+                 "usage: silsim [--flights n] [--seed s] [--jobs n] [--ignition s] [--after-apogee s]\n"
+                 "              [--dispersion scale] [--sd dir] [--keep-sd] [--verbose]\n");
+    std::exit(2);
+}
+
+static Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        bool has_value = i + 1 < argc;
+        if (option == "--keep-sd") {
+            options.keep_sd = true;
+        } else if (option == "--verbose") {
+            options.verbose = true;
+        } else if (!has_value) {
+            usage();
+        } else if (option == "--flights") {
+            options.flights = std::atoi(argv[++i]);
+        } else if (option == "--seed") {
+            options.seed = std::strtoul(argv[++i], nullptr, 0);
+        } else if (option == "--jobs") {
+            options.jobs = std::atoi(argv[++i]);
+        } else if (option == "--ignition") {
+            options.ignition = std::atof(argv[++i]);
+        } else if (option == "--after-apogee") {
+            options.after_apogee = std::atof(argv[++i]);
+        } else if (option == "--dispersion") {
+            options.dispersion = std::atof(argv[++i]);
+        } else if (option == "--sd") {
+            options.sd = argv[++i];
+        } else {
+            usage();
+        }
+    }
+    if (options.flights < 1 || options.jobs < 1) {
+        usage();
+    }
+    return options;
+}
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+    mkdir(options.sd, 0755);
+
+    struct Running {
+        int flight;
+        int fd;
+    };
+    std::map<pid_t, Running> running;
+    std::vector<std::string> results(options.flights);
+    int next_flight = 0;
+    int next_printed = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    while (next_printed < options.flights) {
+        while (next_flight < options.flights && (int)running.size() < options.jobs) {
+            int fds[2];
+            if (pipe(fds) != 0) {
+                std::perror("silsim: pipe");
+                return 1;
+            }
+            std::fflush(stdout);
+            pid_t pid = fork();
+            if (pid < 0) {
+                std::perror("silsim: fork");
+                return 1;
+            }
+            if (pid == 0) {
+                close(fds[0]);
+                flyFlight(options, next_flight, fds[1]);
+            }
+            close(fds[1]);
+            running[pid] = {next_flight++, fds[0]};
+        }
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        auto child = running.find(pid);
+        if (child == running.end()) {
+            continue;
+        }
+        Running done = child->second;
+        running.erase(child);
+
+        // The summary is one short line, so the child never blocks on a full pipe
+        std::string& result = results[done.flight];
+        char buffer[4096];
+        ssize_t length;
+        while ((length = read(done.fd, buffer, sizeof(buffer))) > 0) {
+            result.append(buffer, length);
+        }
+        close(done.fd);
+        if (result.empty()) {
+            std::snprintf(buffer, sizeof(buffer),
+                          R"({"type": "silsim_flight", "value": {"flight":%d,"seed":%u,"error":"exit status %d"}})"
+                          "\n",
+                          done.flight, options.seed + done.flight, status);
+            result = buffer;
+        }
+        if (!options.keep_sd) {
+            std::string card = std::string(options.sd) + "/flight_" + std::to_string(done.flight);
+            nftw(card.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+        }
+
+        while (next_printed < options.flights && !results[next_printed].empty()) {
+            std::fputs(results[next_printed++].c_str(), stdout);
+        }
+    }
+
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printSummary(options, results, wall_s);
+    if (!options.keep_sd) {
+        rmdir(options.sd);
+    }
+    return 0;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file BNO08xEmulator.cpp
+ *
+ * @brief SHTP transport and SH-2 reports of the emulated BNO08x.
+ */
+
+#include "tools/spi_bench/BNO08xEmulator.h"
+
+#include <cmath>
+
+// SHTP channels
+enum ShtpChannel : uint8_t {
+    CHANNEL_COMMAND = 0,
+    CHANNEL_EXECUTABLE = 1,
+    CHANNEL_CONTROL = 2,
+    CHANNEL_REPORTS = 3,
+    CHANNEL_GYRO_RV = 5,
+};
+
+// SH-2 report and command IDs
+enum Sh2Id : uint8_t {
+    ACCELEROMETER = 0x01,
+    GYROSCOPE_CALIBRATED = 0x02,
+    MAGNETIC_FIELD_CALIBRATED = 0x03,
+    ROTATION_VECTOR = 0x05,
+    GAME_ROTATION_VECTOR = 0x08,
+    ARVR_STABILIZED_RV = 0x28,
+    ARVR_STABILIZED_GRV = 0x29,
+    GYRO_INTEGRATED_RV = 0x2A,
+    PRODUCT_ID_RESPONSE = 0xF8,
+    PRODUCT_ID_REQUEST = 0xF9,
+    TIMEBASE_REFERENCE = 0xFB,
+    GET_FEATURE_RESPONSE = 0xFC,
+    SET_FEATURE = 0xFD,
+};
+
+static constexpr size_t queue_packets = 16;
+static constexpr double degrees_to_radians = M_PI / 180;
+
+static void putInt16(std::vector<uint8_t>& out, double value, int q_point) {
+    long fixed = std::lround(value * (1 << q_point));
+    int16_t clipped = (int16_t)(fixed > 32767 ? 32767 : fixed < -32768 ? -32768 : fixed);
+    out.push_back((uint8_t)(clipped & 0xFF));
+    out.push_back((uint8_t)((uint16_t)clipped >> 8));
+}
+
+static uint32_t getUint32(const uint8_t* bytes) {
+    return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+BNO08xEmulator::BNO08xEmulator(uint8_t int_pin) : ChipEmulator(int_pin, true) { reset(); }
+
+void BNO08xEmulator::reset() {
+    reports_.clear();
+    queue_.clear();
+    // Reset Complete
+    queue(CHANNEL_EXECUTABLE, {0x01});
+}
+
+void BNO08xEmulator::select() {
+    ChipEmulator::select();
+    sending_ = !queue_.empty();
+    host_packet_.clear();
+    setReady(false);
+}
+
+uint8_t BNO08xEmulator::transfer(uint8_t data) {
+    host_packet_.push_back(data);
+    uint32_t index = position_++;
+    return sending_ && index < queue_.front().size() ? queue_.front()[index] : 0;
+}
+
+void BNO08xEmulator::deselect() {
+    if (sending_ && position_ >= queue_.front().size()) {
+        queue_.pop_front();
+    }
+    sending_ = false;
+    handleHostPacket();
+    setReady(!queue_.empty());
+}
+
+void BNO08xEmulator::handleHostPacket() {
+    if (host_packet_.size() < 4) {
+        return;
+    }
+    size_t length = (host_packet_[0] | host_packet_[1] << 8) & 0x7FFF;
+    // A read shifts in zeros, and a packet cut short is lost
+    if (length < 4 || length > host_packet_.size()) {
+        return;
+    }
+    uint8_t channel = host_packet_[2];
+    const uint8_t* payload = host_packet_.data() + 4;
+    size_t size = length - 4;
+
+    if (channel == CHANNEL_EXECUTABLE && size >= 1 && payload[0] == 0x01) {
+        reset();
+    } else if (channel == CHANNEL_CONTROL && size >= 17 && payload[0] == SET_FEATURE) {
+        setFeature(payload);
+    } else if (channel == CHANNEL_CONTROL && size >= 2 && payload[0] == PRODUCT_ID_REQUEST) {
+        // Reset cause, version 3.2, part number 10004563, build 0
+        queue(CHANNEL_CONTROL, {PRODUCT_ID_RESPONSE, 0x01, 3, 2, 0x53, 0xA7, 0x98, 0x00, 0, 0, 0, 0, 0, 0, 0, 0});
+    } else {
+        unknown_commands++;
+    }
+}
+
+void BNO08xEmulator::setFeature(const uint8_t* command) {
+    uint8_t id = command[1];
+    uint32_t interval_us = getUint32(command + 5);
+    switch (id) {
+        case ACCELEROMETER:
+        case GYROSCOPE_CALIBRATED:
+        case MAGNETIC_FIELD_CALIBRATED:
+        case ROTATION_VECTOR:
+        case GAME_ROTATION_VECTOR:
+        case ARVR_STABILIZED_RV:
+        case ARVR_STABILIZED_GRV:
+        case GYRO_INTEGRATED_RV:
+            break;
+        default:
+            unknown_commands++;
+            return;
+    }
+
+    Report* report = nullptr;
+    for (Report& enabled : reports_) {
+        if (enabled.id == id) {
+            report = &enabled;
+        }
+    }
+    if (!report) {
+        reports_.push_back({id, 0, 0, SampleClock()});
+        report = &reports_.back();
+    }
+    report->interval_us = interval_us;
+
+    std::vector<uint8_t> response(command, command + 17);
+    response[0] = GET_FEATURE_RESPONSE;
+    queue(CHANNEL_CONTROL, response);
+}
+
+void BNO08xEmulator::queue(uint8_t channel, const std::vector<uint8_t>& payload) {
+    if (queue_.size() >= queue_packets) {
+        // The packet being shifted out stays
+        queue_.erase(queue_.begin() + (sending_ ? 1 : 0));
+        overruns++;
+    }
+    size_t length = payload.size() + 4;
+    std::vector<uint8_t> packet = {(uint8_t)(length & 0xFF), (uint8_t)(length >> 8), channel,
+                                   channel_sequence_[channel]++};
+    packet.insert(packet.end(), payload.begin(), payload.end());
+    queue_.push_back(packet);
+}
+
+void BNO08xEmulator::update(uint32_t now_us) {
+    size_t queued = queue_.size();
+    for (Report& report : reports_) {
+        double rate = report.interval_us > 0 ? 1e6 / report.interval_us : 0;
+        for (uint32_t due = report.clock.due(now_us, rate); due > 0; due--) {
+            if (report.id == GYRO_INTEGRATED_RV) {
+                queue(CHANNEL_GYRO_RV, sensorReport(report));
+            } else {
+                // The reading is as of now, so the timebase reference is 0 in 100 us units
+                std::vector<uint8_t> payload = {TIMEBASE_REFERENCE, 0, 0, 0, 0};
+                std::vector<uint8_t> body = sensorReport(report);
+                payload.insert(payload.end(), body.begin(), body.end());
+                queue(CHANNEL_REPORTS, payload);
+            }
+        }
+    }
+    if (queue_.size() != queued && !sending_) {
+        setReady(true);
+    }
+}
+
+std::vector<uint8_t> BNO08xEmulator::sensorReport(Report& report) {
+    const float* q = native_sensors.orientation;
+    std::vector<uint8_t> out;
+    if (report.id == GYRO_INTEGRATED_RV) {
+        // No header, the quaternion in Q14 and the angular velocity in Q10 rad/s
+        for (int i = 0; i < 4; i++) putInt16(out, q[i], 14);
+        for (int i = 0; i < 3; i++) putInt16(out, native_sensors.gyro[i] * degrees_to_radians, 10);
+        return out;
+    }
+
+    // Report ID, sequence number, status with full accuracy and delay
+    out = {report.id, report.sequence++, 0x03, 0x00};
+    switch (report.id) {
+        case ACCELEROMETER:
+            for (int i = 0; i < 3; i++) putInt16(out, native_sensors.low_g[i] * 9.80665, 8);
+            break;
+        case GYROSCOPE_CALIBRATED:
+            for (int i = 0; i < 3; i++) putInt16(out, native_sensors.gyro[i] * degrees_to_radians, 9);
+            break;
+        case MAGNETIC_FIELD_CALIBRATED:
+            // Gauss to uT
+            for (int i = 0; i < 3; i++) putInt16(out, native_sensors.mag[i] * 100, 4);
+            break;
+        case ROTATION_VECTOR:
+        case ARVR_STABILIZED_RV:
+            for (int i = 0; i < 4; i++) putInt16(out, q[i], 14);
+            // Heading accuracy in Q12 rad
+            putInt16(out, 0.05, 12);
+            break;
+        default:
+            for (int i = 0; i < 4; i++) putInt16(out, q[i], 14);
+            break;
+    }
+    return out;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file BNO08xEmulator.h
+ *
+ * @brief BNO08x IMU on the SPI bus, speaking SHTP and reporting native_sensors through the SH-2 sensor reports.
+ *
+ * Every transaction shifts out the oldest queued SHTP packet from its header on while shifting in the host's. A packet
+ * is only taken off the queue once a transaction has shifted all of it out, so reading the header first and then the
+ * whole packet, the way the SH-2 host drivers do, reads it twice. H_INTN is held low while a packet is queued and the
+ * chip is not selected.
+ *
+ * The host can send Set Feature and Product ID Request on the control channel and a reset on the executable channel.
+ * The chip answers with Get Feature Response, Product ID Response and Reset Complete. Enabled reports come at their
+ * report interval: the rotation vectors, including the ARVR stabilized ones, and the calibrated accelerometer,
+ * gyroscope and magnetometer on the input channel behind a timebase reference, and the gyro integrated rotation vector
+ * on its own channel. The queue holds 16 packets and drops the oldest.
+ */
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "tools/spi_bench/ChipEmulator.h"
+
+class BNO08xEmulator : public ChipEmulator {
+   public:
+    explicit BNO08xEmulator(uint8_t int_pin = EMULATOR_NO_PIN);
+
+    void select() override;
+    void deselect() override;
+    uint8_t transfer(uint8_t data) override;
+    void update(uint32_t now_us) override;
+
+   private:
+    struct Report {
+        uint8_t id;
+        uint32_t interval_us;
+        uint8_t sequence;
+        SampleClock clock;
+    };
+
+    void reset();
+    void handleHostPacket();
+    void setFeature(const uint8_t* command);
+    void queue(uint8_t channel, const std::vector<uint8_t>& payload);
+    std::vector<uint8_t> sensorReport(Report& report);
+
+    std::vector<Report> reports_;
+    std::deque<std::vector<uint8_t>> queue_;
+    // Whether the packet being shifted out is the front of the queue, and what the host shifted in meanwhile
+    bool sending_ = false;
+    std::vector<uint8_t> host_packet_;
+    uint8_t channel_sequence_[6] = {};
+};
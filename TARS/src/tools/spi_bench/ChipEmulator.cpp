@@ -0,0 +1,23 @@
+/**
+ * @file ChipEmulator.cpp
+ *
+ * @brief Register access shared by the emulated chips that have a register map.
+ */
+
+#include "tools/spi_bench/ChipEmulator.h"
+
+uint8_t RegisterChipEmulator::transfer(uint8_t data) {
+    if (position_++ == 0) {
+        decodeAddress(data, address_, read_, increment_);
+        return 0;
+    }
+    uint8_t address = address_;
+    if (increment_) {
+        address_ = nextAddress(address_);
+    }
+    if (read_) {
+        return readRegister(address);
+    }
+    writeRegister(address, data);
+    return 0;
+}
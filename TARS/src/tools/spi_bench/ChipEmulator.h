@@ -0,0 +1,124 @@
+/**
+ * @file ChipEmulator.h
+ *
+ * @brief Base of the sensor emulations tools/spi_bench attaches to the native SPI buses.
+ *
+ * A chip samples native_sensors at its output data rate, whatever time the clock jumps by, and drives its data ready
+ * line like the real one. update() brings the chip up to the current time. It runs whenever the chip is selected and
+ * should also run every tick, so that the data ready line changes when a sample is taken rather than when the chip is
+ * next talked to.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <NativeSensors.h>
+#include <SPI.h>
+
+#include <cstdint>
+
+// A chip without its data ready line connected
+#define EMULATOR_NO_PIN 0xFF
+
+/**
+ * @brief Counts the samples a sensor of a chip takes at its output data rate as the clock moves on.
+ */
+class SampleClock {
+   public:
+    /**
+     * @brief The number of samples taken at rate_hz up to now_us. After a stop, rate 0, the first sample is taken a
+     * period after the rate is set again.
+     */
+    uint32_t due(uint32_t now_us, double rate_hz) {
+        if (rate_hz <= 0) {
+            running_ = false;
+            return 0;
+        }
+        if (!running_) {
+            running_ = true;
+            next_us_ = now_us + 1e6 / rate_hz;
+            return 0;
+        }
+        uint32_t count = 0;
+        while (next_us_ <= now_us) {
+            next_us_ += 1e6 / rate_hz;
+            count++;
+        }
+        return count;
+    }
+
+   private:
+    bool running_ = false;
+    double next_us_ = 0;
+};
+
+class ChipEmulator : public SPIDevice {
+   public:
+    virtual ~ChipEmulator() = default;
+
+    void select() override {
+        update(micros());
+        position_ = 0;
+    }
+
+    virtual void update(uint32_t now_us) = 0;
+
+    // Samples lost to a full FIFO or output queue, and commands the emulation does not know
+    uint32_t overruns = 0;
+    uint32_t unknown_commands = 0;
+
+   protected:
+    /**
+     * @param ready_pin pin of the data ready line, EMULATOR_NO_PIN for none
+     * @param active_low whether the line is low while data is ready
+     */
+    ChipEmulator(uint8_t ready_pin, bool active_low) : ready_pin_(ready_pin), active_low_(active_low) {
+        setReady(false);
+    }
+
+    void setReady(bool ready) {
+        if (ready_pin_ != EMULATOR_NO_PIN) {
+            digitalWrite(ready_pin_, ready != active_low_ ? HIGH : LOW);
+        }
+    }
+
+    // Byte of the current transaction, counted from 0 when the chip is selected
+    uint32_t position_ = 0;
+
+   private:
+    uint8_t ready_pin_;
+    bool active_low_;
+};
+
+/**
+ * @brief A chip whose SPI commands are a register address followed by the data read from or written to it.
+ */
+class RegisterChipEmulator : public ChipEmulator {
+   public:
+    uint8_t transfer(uint8_t data) override;
+
+   protected:
+    RegisterChipEmulator(uint8_t ready_pin, bool active_low) : ChipEmulator(ready_pin, active_low) {}
+
+    // Splits the first byte of a transaction into the register address, direction and whether the address increments
+    virtual void decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) = 0;
+    // The address read or written after address in a transaction that increments
+    virtual uint8_t nextAddress(uint8_t address) { return (address + 1) & 0x7F; }
+    virtual uint8_t readRegister(uint8_t address) { return registers_[address]; }
+    virtual void writeRegister(uint8_t address, uint8_t value) { registers_[address] = value; }
+
+    static int16_t saturate(double counts) {
+        return (int16_t)(counts > 32767 ? 32767 : counts < -32768 ? -32768 : std::lround(counts));
+    }
+    void setWord(uint8_t address, int16_t value) {
+        registers_[address] = (uint8_t)(value & 0xFF);
+        registers_[address + 1] = (uint8_t)((uint16_t)value >> 8);
+    }
+
+    uint8_t registers_[128] = {};
+
+   private:
+    uint8_t address_ = 0;
+    bool read_ = false;
+    bool increment_ = false;
+};
@@ -0,0 +1,164 @@
+/**
+ * @file KX134Emulator.cpp
+ *
+ * @brief Register map, sampling and buffer of the emulated KX134.
+ */
+
+#include "tools/spi_bench/KX134Emulator.h"
+
+#include <cmath>
+
+// Registers of the KX134 technical reference manual
+enum KX134Register : uint8_t {
+    XOUT_L = 0x08,
+    COTR = 0x12,
+    WHO_AM_I = 0x13,
+    INS2 = 0x17,
+    INT_REL = 0x1A,
+    CNTL1 = 0x1B,
+    CNTL2 = 0x1C,
+    ODCNTL = 0x21,
+    INC1 = 0x22,
+    INC4 = 0x25,
+    BUF_CNTL1 = 0x5E,
+    BUF_CNTL2 = 0x5F,
+    BUF_STATUS_1 = 0x60,
+    BUF_STATUS_2 = 0x61,
+    BUF_CLEAR = 0x62,
+    BUF_READ = 0x63,
+};
+
+KX134Emulator::KX134Emulator(uint8_t int1_pin) : RegisterChipEmulator(int1_pin, false) {
+    registers_[0x00] = 'K';
+    registers_[0x01] = 0x46;
+    registers_[COTR] = 0x55;
+    registers_[WHO_AM_I] = 0x46;
+    registers_[CNTL2] = 0x3F;
+    registers_[ODCNTL] = 0x06;
+    registers_[INC1] = 0x10;
+}
+
+void KX134Emulator::decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) {
+    address = data & 0x7F;
+    read = data & 0x80;
+    increment = true;
+}
+
+uint8_t KX134Emulator::nextAddress(uint8_t address) { return address == BUF_READ ? address : (address + 1) & 0x7F; }
+
+uint8_t KX134Emulator::readRegister(uint8_t address) {
+    switch (address) {
+        case INT_REL: {
+            // Reading releases the latched interrupts
+            registers_[INS2] = 0;
+            updateInterrupt();
+            return 0;
+        }
+        case BUF_STATUS_1:
+            return (uint8_t)(buffer_.size() & 0xFF);
+        case BUF_STATUS_2:
+            return (uint8_t)((buffer_.size() >> 8) & 0x03);
+        case BUF_READ: {
+            if (buffer_.empty()) {
+                return 0;
+            }
+            uint8_t value = buffer_.front();
+            buffer_.pop_front();
+            updateInterrupt();
+            return value;
+        }
+        default:
+            return registers_[address];
+    }
+}
+
+void KX134Emulator::writeRegister(uint8_t address, uint8_t value) {
+    switch (address) {
+        case CNTL2:
+            // The command test flips COTR and clears itself
+            if (value & 0x40) {
+                registers_[COTR] = 0xAA;
+            }
+            registers_[CNTL2] = value & ~0x40;
+            break;
+        case BUF_CLEAR:
+            buffer_.clear();
+            updateInterrupt();
+            break;
+        case BUF_CNTL2:
+            // Changing the resolution drops what is buffered
+            if ((value ^ registers_[BUF_CNTL2]) & 0x40) {
+                buffer_.clear();
+            }
+            registers_[BUF_CNTL2] = value;
+            updateInterrupt();
+            break;
+        case WHO_AM_I:
+        case COTR:
+        case INS2:
+        case BUF_STATUS_1:
+        case BUF_STATUS_2:
+            break;
+        default:
+            registers_[address] = value;
+            break;
+    }
+}
+
+size_t KX134Emulator::bufferCapacity() const { return registers_[BUF_CNTL2] & 0x40 ? 86 * 6 : 171 * 3; }
+
+void KX134Emulator::update(uint32_t now_us) {
+    bool operating = registers_[CNTL1] & 0x80;
+    double rate = operating ? 0.78125 * std::pow(2.0, registers_[ODCNTL] & 0x0F) : 0;
+    uint32_t due = clock_.due(now_us, rate);
+    for (uint32_t i = 0; i < due; i++) {
+        takeSample();
+    }
+}
+
+void KX134Emulator::takeSample() {
+    // 8, 16, 32 or 64 g over the 16 bits
+    double counts_per_g = 32768.0 / (8 << ((registers_[CNTL1] >> 3) & 0x03));
+    for (int axis = 0; axis < 3; axis++) {
+        setWord(XOUT_L + 2 * axis, saturate(native_sensors.high_g[axis] * counts_per_g));
+    }
+    // CNTL1.DRDYE reports new samples in INS2.DRDY
+    if (registers_[CNTL1] & 0x20) {
+        registers_[INS2] |= 0x10;
+    }
+
+    if (registers_[BUF_CNTL2] & 0x80) {
+        bool wide = registers_[BUF_CNTL2] & 0x40;
+        size_t size = wide ? 6 : 3;
+        if (buffer_.size() + size > bufferCapacity()) {
+            overruns++;
+            // FIFO mode keeps the oldest samples, stream and trigger mode the newest
+            if ((registers_[BUF_CNTL2] & 0x03) == 0) {
+                updateInterrupt();
+                return;
+            }
+            buffer_.erase(buffer_.begin(), buffer_.begin() + size);
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            if (wide) {
+                buffer_.push_back(registers_[XOUT_L + 2 * axis]);
+            }
+            buffer_.push_back(registers_[XOUT_L + 2 * axis + 1]);
+        }
+    }
+    updateInterrupt();
+}
+
+void KX134Emulator::updateInterrupt() {
+    bool wide = registers_[BUF_CNTL2] & 0x40;
+    size_t samples = buffer_.size() / (wide ? 6 : 3);
+    uint8_t threshold = registers_[BUF_CNTL1];
+    uint8_t routed = registers_[INC4];
+    bool active = ((routed & 0x10) && (registers_[INS2] & 0x10)) ||
+                  ((routed & 0x20) && threshold > 0 && samples >= threshold) ||
+                  ((routed & 0x40) && buffer_.size() + (wide ? 6 : 3) > bufferCapacity());
+    // INC1.IEN1 enables the pin, INC1.IEA1 makes it active high
+    bool enabled = registers_[INC1] & 0x20;
+    bool active_high = registers_[INC1] & 0x10;
+    setReady(enabled && (active == active_high));
+}
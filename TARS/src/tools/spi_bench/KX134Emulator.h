@@ -0,0 +1,37 @@
+/**
+ * @file KX134Emulator.h
+ *
+ * @brief KX134 accelerometer on the SPI bus, measuring native_sensors.high_g.
+ *
+ * Models the output registers, the data ready flag and its INT1 routing, the sample buffer in FIFO and stream mode at
+ * 8 or 16 bits, and the command test. Samples are taken at the rate set in ODCNTL while CNTL1.PC1 is set, scaled by
+ * the range in CNTL1.GSEL and clipped to 16 bits. Registers auto-increment in a transaction, except BUF_READ, which
+ * shifts out the buffer byte by byte.
+ */
+
+#pragma once
+
+#include <deque>
+
+#include "tools/spi_bench/ChipEmulator.h"
+
+class KX134Emulator : public RegisterChipEmulator {
+   public:
+    explicit KX134Emulator(uint8_t int1_pin = EMULATOR_NO_PIN);
+
+    void update(uint32_t now_us) override;
+
+   protected:
+    void decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) override;
+    uint8_t nextAddress(uint8_t address) override;
+    uint8_t readRegister(uint8_t address) override;
+    void writeRegister(uint8_t address, uint8_t value) override;
+
+   private:
+    void takeSample();
+    void updateInterrupt();
+    size_t bufferCapacity() const;
+
+    SampleClock clock_;
+    std::deque<uint8_t> buffer_;
+};
@@ -0,0 +1,91 @@
+/**
+ * @file LIS3MDLEmulator.cpp
+ *
+ * @brief Register map and sampling of the emulated LIS3MDL.
+ */
+
+#include "tools/spi_bench/LIS3MDLEmulator.h"
+
+// Registers of the LIS3MDL data sheet
+enum LIS3MDLRegister : uint8_t {
+    WHO_AM_I = 0x0F,
+    CTRL_REG1 = 0x20,
+    CTRL_REG2 = 0x21,
+    CTRL_REG3 = 0x22,
+    STATUS_REG = 0x27,
+    OUT_X_L = 0x28,
+    OUT_Z_H = 0x2D,
+    TEMP_OUT_L = 0x2E,
+    TEMP_OUT_H = 0x2F,
+};
+
+LIS3MDLEmulator::LIS3MDLEmulator(uint8_t drdy_pin) : RegisterChipEmulator(drdy_pin, false) {
+    registers_[WHO_AM_I] = 0x3D;
+    registers_[CTRL_REG1] = 0x10;
+    registers_[CTRL_REG3] = 0x03;
+}
+
+void LIS3MDLEmulator::decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) {
+    address = data & 0x3F;
+    read = data & 0x80;
+    increment = data & 0x40;
+}
+
+uint8_t LIS3MDLEmulator::readRegister(uint8_t address) {
+    if (address >= OUT_X_L && address <= OUT_Z_H) {
+        // Reading the data clears the data ready and overrun flags
+        registers_[STATUS_REG] = 0;
+        setReady(false);
+    }
+    return registers_[address];
+}
+
+void LIS3MDLEmulator::writeRegister(uint8_t address, uint8_t value) {
+    if (address == WHO_AM_I || (address >= STATUS_REG && address <= TEMP_OUT_H)) {
+        return;
+    }
+    registers_[address] = value;
+}
+
+double LIS3MDLEmulator::outputDataRate() const {
+    uint8_t mode = registers_[CTRL_REG3] & 0x03;
+    if (mode >= 2) {
+        return 0;
+    }
+    uint8_t control = registers_[CTRL_REG1];
+    if (control & 0x02) {
+        // FAST_ODR, set by the X and Y operating mode
+        static const double fast_rates[4] = {1000, 560, 300, 155};
+        return fast_rates[(control >> 5) & 0x03];
+    }
+    static const double rates[8] = {0.625, 1.25, 2.5, 5, 10, 20, 40, 80};
+    return rates[(control >> 2) & 0x07];
+}
+
+void LIS3MDLEmulator::update(uint32_t now_us) {
+    for (uint32_t due = clock_.due(now_us, outputDataRate()); due > 0; due--) {
+        takeSample();
+        // Single conversion mode goes back to power down after one sample
+        if ((registers_[CTRL_REG3] & 0x03) == 1) {
+            registers_[CTRL_REG3] |= 0x03;
+            break;
+        }
+    }
+}
+
+void LIS3MDLEmulator::takeSample() {
+    // 4, 8, 12 and 16 gauss in the order of the FS codes
+    static const double counts_per_gauss[4] = {6842, 3421, 2281, 1711};
+    double scale = counts_per_gauss[(registers_[CTRL_REG2] >> 5) & 0x03];
+    for (int axis = 0; axis < 3; axis++) {
+        setWord(OUT_X_L + 2 * axis, saturate(native_sensors.mag[axis] * scale));
+    }
+    setWord(TEMP_OUT_L, saturate((native_sensors.temperature / 100.0 - 25) * 8));
+    // ZYXDA, and ZYXOR if the last sample was not read
+    bool unread = registers_[STATUS_REG] & 0x08;
+    if (unread) {
+        overruns++;
+    }
+    registers_[STATUS_REG] = 0x0F | (unread ? 0xF0 : 0);
+    setReady(true);
+}
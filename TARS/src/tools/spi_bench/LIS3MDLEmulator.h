@@ -0,0 +1,31 @@
+/**
+ * @file LIS3MDLEmulator.h
+ *
+ * @brief LIS3MDL magnetometer on the SPI bus, measuring native_sensors.mag.
+ *
+ * Models the output and temperature registers, the status register with its overrun flag, continuous and single
+ * conversion mode and the DRDY line. Samples are taken at the rate of CTRL_REG1, FAST_ODR included, scaled by the
+ * full scale in CTRL_REG2 and clipped to 16 bits. The address auto-increments when the MS bit of the first byte is set.
+ */
+
+#pragma once
+
+#include "tools/spi_bench/ChipEmulator.h"
+
+class LIS3MDLEmulator : public RegisterChipEmulator {
+   public:
+    explicit LIS3MDLEmulator(uint8_t drdy_pin = EMULATOR_NO_PIN);
+
+    void update(uint32_t now_us) override;
+
+   protected:
+    void decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) override;
+    uint8_t readRegister(uint8_t address) override;
+    void writeRegister(uint8_t address, uint8_t value) override;
+
+   private:
+    double outputDataRate() const;
+    void takeSample();
+
+    SampleClock clock_;
+};
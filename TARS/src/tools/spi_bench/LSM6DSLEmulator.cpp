@@ -0,0 +1,199 @@
+/**
+ * @file LSM6DSLEmulator.cpp
+ *
+ * @brief Register map, sampling and FIFO of the emulated LSM6DSL.
+ */
+
+#include "tools/spi_bench/LSM6DSLEmulator.h"
+
+// Registers of the LSM6DSL data sheet
+enum LSM6DSLRegister : uint8_t {
+    FIFO_CTRL1 = 0x06,
+    FIFO_CTRL2 = 0x07,
+    FIFO_CTRL3 = 0x08,
+    FIFO_CTRL5 = 0x0A,
+    INT1_CTRL = 0x0D,
+    WHO_AM_I = 0x0F,
+    CTRL1_XL = 0x10,
+    CTRL2_G = 0x11,
+    CTRL3_C = 0x12,
+    STATUS_REG = 0x1E,
+    OUT_TEMP_L = 0x20,
+    OUTX_L_G = 0x22,
+    OUTZ_H_G = 0x27,
+    OUTX_L_XL = 0x28,
+    OUTZ_H_XL = 0x2D,
+    FIFO_STATUS1 = 0x3A,
+    FIFO_STATUS2 = 0x3B,
+    FIFO_STATUS3 = 0x3C,
+    FIFO_STATUS4 = 0x3D,
+    FIFO_DATA_OUT_L = 0x3E,
+    FIFO_DATA_OUT_H = 0x3F,
+};
+
+static constexpr size_t fifo_words = 2048;
+
+// Output data rates in Hz of the ODR codes of CTRL1_XL, CTRL2_G and FIFO_CTRL5
+static double outputDataRate(uint8_t code) {
+    static const double rates[11] = {0, 12.5, 26, 52, 104, 208, 416, 833, 1666, 3332, 6664};
+    return code < 11 ? rates[code] : 0;
+}
+
+LSM6DSLEmulator::LSM6DSLEmulator(uint8_t int1_pin) : RegisterChipEmulator(int1_pin, false) { reset(); }
+
+void LSM6DSLEmulator::reset() {
+    for (uint8_t& value : registers_) {
+        value = 0;
+    }
+    registers_[WHO_AM_I] = 0x6A;
+    registers_[CTRL3_C] = 0x04;
+    fifo_.clear();
+    pattern_ = 0;
+    overrun_ = false;
+}
+
+void LSM6DSLEmulator::decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) {
+    address = data & 0x7F;
+    read = data & 0x80;
+    increment = registers_[CTRL3_C] & 0x04;
+}
+
+uint8_t LSM6DSLEmulator::nextAddress(uint8_t address) {
+    return address == FIFO_DATA_OUT_H ? FIFO_DATA_OUT_L : (address + 1) & 0x7F;
+}
+
+uint8_t LSM6DSLEmulator::readRegister(uint8_t address) {
+    if (address >= OUTX_L_G && address <= OUTZ_H_G) {
+        registers_[STATUS_REG] &= ~0x02;
+        updateInterrupt();
+    } else if (address >= OUTX_L_XL && address <= OUTZ_H_XL) {
+        registers_[STATUS_REG] &= ~0x01;
+        updateInterrupt();
+    }
+
+    uint8_t set_size = (registers_[FIFO_CTRL3] & 0x38 ? 3 : 0) + (registers_[FIFO_CTRL3] & 0x07 ? 3 : 0);
+    uint16_t threshold = registers_[FIFO_CTRL1] | (registers_[FIFO_CTRL2] & 0x07) << 8;
+    switch (address) {
+        case FIFO_STATUS1:
+            return (uint8_t)(fifo_.size() & 0xFF);
+        case FIFO_STATUS2:
+            return (uint8_t)(((fifo_.size() >> 8) & 0x07) | (fifo_.empty() ? 0x10 : 0) |
+                             (fifo_.size() + set_size > fifo_words ? 0x20 : 0) | (overrun_ ? 0x40 : 0) |
+                             (threshold > 0 && fifo_.size() >= threshold ? 0x80 : 0));
+        case FIFO_STATUS3:
+            return (uint8_t)(pattern_ & 0xFF);
+        case FIFO_STATUS4:
+            return (uint8_t)(pattern_ >> 8);
+        case FIFO_DATA_OUT_L:
+            return fifo_.empty() ? 0 : (uint8_t)(fifo_.front() & 0xFF);
+        case FIFO_DATA_OUT_H: {
+            // Reading the high byte moves the FIFO on to its next word
+            if (fifo_.empty()) {
+                return 0;
+            }
+            uint8_t value = (uint8_t)(fifo_.front() >> 8);
+            fifo_.pop_front();
+            pattern_ = set_size > 0 ? (pattern_ + 1) % set_size : 0;
+            overrun_ = false;
+            updateInterrupt();
+            return value;
+        }
+        default:
+            return registers_[address];
+    }
+}
+
+void LSM6DSLEmulator::writeRegister(uint8_t address, uint8_t value) {
+    if (address == WHO_AM_I || address == STATUS_REG || (address >= OUT_TEMP_L && address <= OUTZ_H_XL) ||
+        (address >= FIFO_STATUS1 && address <= FIFO_DATA_OUT_H)) {
+        return;
+    }
+    if (address == CTRL3_C && (value & 0x01)) {
+        reset();
+        return;
+    }
+    registers_[address] = value;
+    if (address == FIFO_CTRL5 && (value & 0x07) == 0) {
+        // Bypass mode empties the FIFO
+        fifo_.clear();
+        pattern_ = 0;
+        overrun_ = false;
+    }
+    updateInterrupt();
+}
+
+void LSM6DSLEmulator::update(uint32_t now_us) {
+    for (uint32_t due = gyro_clock_.due(now_us, outputDataRate(registers_[CTRL2_G] >> 4)); due > 0; due--) {
+        takeGyroSample();
+    }
+    for (uint32_t due = accel_clock_.due(now_us, outputDataRate(registers_[CTRL1_XL] >> 4)); due > 0; due--) {
+        takeAccelSample();
+    }
+    uint8_t mode = registers_[FIFO_CTRL5] & 0x07;
+    double fifo_rate = mode == 1 || mode == 6 ? outputDataRate((registers_[FIFO_CTRL5] >> 3) & 0x0F) : 0;
+    for (uint32_t due = fifo_clock_.due(now_us, fifo_rate); due > 0; due--) {
+        takeFifoSample();
+    }
+}
+
+void LSM6DSLEmulator::takeAccelSample() {
+    // 2, 16, 4 and 8 g in the order of the FS_XL codes
+    static const double mg_per_count[4] = {0.061, 0.488, 0.122, 0.244};
+    double counts_per_g = 1000 / mg_per_count[(registers_[CTRL1_XL] >> 2) & 0x03];
+    for (int axis = 0; axis < 3; axis++) {
+        setWord(OUTX_L_XL + 2 * axis, saturate(native_sensors.low_g[axis] * counts_per_g));
+    }
+    setWord(OUT_TEMP_L, saturate((native_sensors.temperature / 100.0 - 25) * 256));
+    registers_[STATUS_REG] |= 0x05;
+    updateInterrupt();
+}
+
+void LSM6DSLEmulator::takeGyroSample() {
+    // 245, 500, 1000 and 2000 deg/s in the order of the FS_G codes, and FS_125
+    static const double mdps_per_count[4] = {8.75, 17.5, 35, 70};
+    uint8_t control = registers_[CTRL2_G];
+    double counts_per_dps = 1000 / (control & 0x02 ? 4.375 : mdps_per_count[(control >> 2) & 0x03]);
+    for (int axis = 0; axis < 3; axis++) {
+        setWord(OUTX_L_G + 2 * axis, saturate(native_sensors.gyro[axis] * counts_per_dps));
+    }
+    registers_[STATUS_REG] |= 0x02;
+    updateInterrupt();
+}
+
+void LSM6DSLEmulator::takeFifoSample() {
+    bool gyro = registers_[FIFO_CTRL3] & 0x38;
+    bool accel = registers_[FIFO_CTRL3] & 0x07;
+    size_t set_size = (gyro ? 3 : 0) + (accel ? 3 : 0);
+    if (set_size == 0) {
+        return;
+    }
+    if (fifo_.size() + set_size > fifo_words) {
+        overrun_ = true;
+        overruns++;
+        // FIFO mode stops when full, continuous mode drops the oldest data set
+        if ((registers_[FIFO_CTRL5] & 0x07) == 1) {
+            updateInterrupt();
+            return;
+        }
+        fifo_.erase(fifo_.begin(), fifo_.begin() + set_size);
+    }
+    auto word = [this](uint8_t address) { return (uint16_t)(registers_[address] | registers_[address + 1] << 8); };
+    for (int axis = 0; gyro && axis < 3; axis++) {
+        fifo_.push_back(word(OUTX_L_G + 2 * axis));
+    }
+    for (int axis = 0; accel && axis < 3; axis++) {
+        fifo_.push_back(word(OUTX_L_XL + 2 * axis));
+    }
+    updateInterrupt();
+}
+
+void LSM6DSLEmulator::updateInterrupt() {
+    uint8_t routed = registers_[INT1_CTRL];
+    uint16_t threshold = registers_[FIFO_CTRL1] | (registers_[FIFO_CTRL2] & 0x07) << 8;
+    bool active = ((routed & 0x01) && (registers_[STATUS_REG] & 0x01)) ||
+                  ((routed & 0x02) && (registers_[STATUS_REG] & 0x02)) ||
+                  ((routed & 0x08) && threshold > 0 && fifo_.size() >= threshold) ||
+                  ((routed & 0x10) && overrun_) || ((routed & 0x20) && fifo_.size() + 6 > fifo_words);
+    // CTRL3_C.H_LACTIVE makes the line active low
+    setReady(active != (bool)(registers_[CTRL3_C] & 0x20));
+}
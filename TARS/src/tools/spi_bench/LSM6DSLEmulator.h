@@ -0,0 +1,47 @@
+/**
+ * @file LSM6DSLEmulator.h
+ *
+ * @brief LSM6DSL accelerometer and gyroscope on the SPI bus, measuring native_sensors.low_g and native_sensors.gyro.
+ *
+ * Models the output registers, the data ready flags and their INT1 routing, the FIFO in FIFO and continuous mode and
+ * the software reset. Each sensor samples at its own rate from CTRL1_XL and CTRL2_G, scaled by its full scale and
+ * clipped to 16 bits. The FIFO stores a gyroscope then an accelerometer word triple, of the sensors given a decimation
+ * in FIFO_CTRL3, at the FIFO rate of FIFO_CTRL5. Decimating a sensor by more than 1 is taken as not decimating it.
+ * Addresses auto-increment while CTRL3_C.IF_INC is set, and reading on
+ * from FIFO_DATA_OUT_H goes back to FIFO_DATA_OUT_L, so one transaction can drain the FIFO.
+ */
+
+#pragma once
+
+#include <deque>
+
+#include "tools/spi_bench/ChipEmulator.h"
+
+class LSM6DSLEmulator : public RegisterChipEmulator {
+   public:
+    explicit LSM6DSLEmulator(uint8_t int1_pin = EMULATOR_NO_PIN);
+
+    void update(uint32_t now_us) override;
+
+   protected:
+    void decodeAddress(uint8_t data, uint8_t& address, bool& read, bool& increment) override;
+    uint8_t nextAddress(uint8_t address) override;
+    uint8_t readRegister(uint8_t address) override;
+    void writeRegister(uint8_t address, uint8_t value) override;
+
+   private:
+    void reset();
+    void takeAccelSample();
+    void takeGyroSample();
+    void takeFifoSample();
+    void updateInterrupt();
+
+    // Unread FIFO words, and where the next one read is in the gyroscope and accelerometer pattern
+    std::deque<uint16_t> fifo_;
+    uint16_t pattern_ = 0;
+    bool overrun_ = false;
+
+    SampleClock accel_clock_;
+    SampleClock gyro_clock_;
+    SampleClock fifo_clock_;
+};
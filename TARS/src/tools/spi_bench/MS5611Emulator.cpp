@@ -0,0 +1,130 @@
+/**
+ * @file MS5611Emulator.cpp
+ *
+ * @brief Commands, conversions and calibration of the emulated MS5611.
+ */
+
+#include "tools/spi_bench/MS5611Emulator.h"
+
+// Conversion times in us for the oversampling ratios 256 to 4096
+static const uint32_t conversion_us[5] = {600, 1170, 2280, 4540, 9040};
+
+/**
+ * @brief CRC-4 over the PROM, as in the application note AN520.
+ */
+static uint16_t promCrc(const uint16_t prom[8]) {
+    uint16_t remainder = 0;
+    for (int count = 0; count < 16; count++) {
+        uint16_t word = count / 2 == 7 ? prom[7] & 0xFF00 : prom[count / 2];
+        remainder ^= count % 2 == 1 ? word & 0x00FF : word >> 8;
+        for (int bit = 8; bit > 0; bit--) {
+            remainder = remainder & 0x8000 ? (uint16_t)((remainder << 1) ^ 0x3000) : (uint16_t)(remainder << 1);
+        }
+    }
+    return (remainder >> 12) & 0x000F;
+}
+
+MS5611Emulator::MS5611Emulator() : ChipEmulator(EMULATOR_NO_PIN, false) {
+    // The example calibration of the data sheet
+    const uint16_t calibration[8] = {0, 40127, 36924, 23317, 23282, 33464, 28312, 0};
+    for (int i = 0; i < 8; i++) {
+        prom_[i] = calibration[i];
+    }
+    prom_[7] |= promCrc(prom_);
+}
+
+uint8_t MS5611Emulator::transfer(uint8_t data) {
+    if (position_++ == 0) {
+        command(data);
+        return 0;
+    }
+    // The response is shifted out MSB first after the command byte
+    if (command_ == 0x00 && position_ <= 4) {
+        return (uint8_t)(output_ >> (8 * (4 - position_)));
+    }
+    if (command_ >= 0xA0 && command_ <= 0xAE && position_ <= 3) {
+        return (uint8_t)(output_ >> (8 * (3 - position_)));
+    }
+    return 0;
+}
+
+void MS5611Emulator::command(uint8_t data) {
+    command_ = data;
+    uint32_t now_us = micros();
+    if (data == 0x1E) {
+        conversion_valid_ = false;
+    } else if ((data & 0xF0) == 0x40 || (data & 0xF0) == 0x50) {
+        uint8_t ratio = (data & 0x0F) / 2;
+        if ((data & 0x01) || ratio > 4) {
+            unknown_commands++;
+            return;
+        }
+        uint32_t raw_temperature = rawTemperature();
+        conversion_ = (data & 0xF0) == 0x40 ? rawPressure(raw_temperature) : raw_temperature;
+        conversion_done_us_ = now_us + conversion_us[ratio];
+        conversion_valid_ = true;
+    } else if (data == 0x00) {
+        bool done = conversion_valid_ && (int32_t)(now_us - conversion_done_us_) >= 0;
+        output_ = done ? conversion_ : 0;
+        conversion_valid_ = false;
+    } else if (data >= 0xA0 && data <= 0xAE && !(data & 0x01)) {
+        output_ = prom_[(data - 0xA0) / 2];
+    } else {
+        unknown_commands++;
+    }
+}
+
+void MS5611Emulator::compensate(uint32_t d1, uint32_t d2, int64_t& pressure, int64_t& temperature) const {
+    int64_t dt = (int64_t)d2 - ((int64_t)prom_[5] << 8);
+    int64_t temp = 2000 + dt * prom_[6] / (1 << 23);
+    int64_t off = ((int64_t)prom_[2] << 16) + (int64_t)prom_[4] * dt / (1 << 7);
+    int64_t sens = ((int64_t)prom_[1] << 15) + (int64_t)prom_[3] * dt / (1 << 8);
+    if (temp < 2000) {
+        int64_t t2 = dt * dt / (1LL << 31);
+        int64_t off2 = 5 * (temp - 2000) * (temp - 2000) / 2;
+        int64_t sens2 = 5 * (temp - 2000) * (temp - 2000) / 4;
+        if (temp < -1500) {
+            off2 += 7 * (temp + 1500) * (temp + 1500);
+            sens2 += 11 * (temp + 1500) * (temp + 1500) / 2;
+        }
+        temp -= t2;
+        off -= off2;
+        sens -= sens2;
+    }
+    temperature = temp;
+    pressure = ((int64_t)d1 * sens / (1 << 21) - off) / (1 << 15);
+}
+
+uint32_t MS5611Emulator::rawTemperature() const {
+    uint32_t low = 0;
+    uint32_t high = (1 << 24) - 1;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        int64_t pressure;
+        int64_t temperature;
+        compensate(0, middle, pressure, temperature);
+        if (temperature < native_sensors.temperature) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+uint32_t MS5611Emulator::rawPressure(uint32_t raw_temperature) const {
+    uint32_t low = 0;
+    uint32_t high = (1 << 24) - 1;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        int64_t pressure;
+        int64_t temperature;
+        compensate(middle, raw_temperature, pressure, temperature);
+        if (pressure < (int64_t)native_sensors.pressure) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
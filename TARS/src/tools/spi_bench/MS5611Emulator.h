@@ -0,0 +1,42 @@
+/**
+ * @file MS5611Emulator.h
+ *
+ * @brief MS5611 barometer on the SPI bus, measuring native_sensors.pressure and native_sensors.temperature.
+ *
+ * Takes the reset, conversion, ADC read and PROM read commands. A conversion takes the maximum time of the data sheet
+ * for its oversampling ratio, and reading the ADC before it is done reads 0, as does reading it a second time. The
+ * PROM holds the data sheet's example calibration, with its CRC, and the raw values are worked back from it by
+ * bisecting the data sheet's compensation, second order part included, so a driver doing that math reads the
+ * pressure and temperature back to within a count.
+ */
+
+#pragma once
+
+#include "tools/spi_bench/ChipEmulator.h"
+
+class MS5611Emulator : public ChipEmulator {
+   public:
+    MS5611Emulator();
+
+    uint8_t transfer(uint8_t data) override;
+    void update(uint32_t now_us) override { (void)now_us; }
+
+    uint16_t prom(uint8_t word) const { return prom_[word & 7]; }
+
+   private:
+    void command(uint8_t data);
+    // Raw pressure D1 and raw temperature D2 the chip converts to for the current readings
+    uint32_t rawPressure(uint32_t raw_temperature) const;
+    uint32_t rawTemperature() const;
+    // Pressure in hundredths of a mbar and temperature in hundredths of a degree the data sheet compensates D1 and D2 to
+    void compensate(uint32_t d1, uint32_t d2, int64_t& pressure, int64_t& temperature) const;
+
+    uint16_t prom_[8];
+    uint8_t command_ = 0;
+    // The ADC result and when it is ready, conversion_valid_ is cleared by reading it
+    uint32_t conversion_ = 0;
+    uint32_t conversion_done_us_ = 0;
+    bool conversion_valid_ = false;
+    // The result being shifted out
+    uint32_t output_ = 0;
+};
@@ -0,0 +1,485 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Counts the SPI traffic of each way of reading the sensors, against register level emulations of the chips.
+ *
+ * The chips are emulated on the native SPI bus at their chip selects on the board, on the simulated clock of
+ * tools/silsim/SimKernel.cpp, and measure native_sensors. Those hold a steady reading, or follow a file of HILSIM sensor
+ * frames from tools/sensor_synth given with --script. Each access pattern reads the chip every --period ms, like the
+ * sensor thread, until it has --reads readings, and prints:
+ *
+ *     {"type": "spi_bench", "value": {"chip": "kx134", "pattern": "driver", "reads": 1000, "simulated_s": 6.000,
+ *      "transactions_per_read": 3.00, "calls_per_read": 11.00, "bytes_per_read": 11.00, "max_error": 0.00039, ...}}
+ *
+ * Patterns that wait for data ready or drain a FIFO count the samples they got as reads, so simulated_s shows how often
+ * the chip has new data. A transaction is one assertion of the chip select and a call one call into SPIClass.
+ * max_error is the largest difference between a reading and native_sensors at the time it was read, in mbar, g, g,
+ * gauss and quaternion units for the MS5611, KX134, LSM6DSL, LIS3MDL and BNO08x.
+ *
+ * The MS5611 and KX134 are read through their drivers in lib/. The LSM6DSL, LIS3MDL and BNO08x drivers come from the
+ * PlatformIO registry and are not built for the host, so their driver patterns repeat the transfers the drivers make:
+ * byte by byte transfers for the SparkFun LSM6DS3 driver, buffer transfers for the Adafruit ones.
+ *
+ *     pio run -e spi_bench && .pio/build/spi_bench/program
+ *     pio run -e spi_bench && .pio/build/spi_bench/program --chip lsm6dsl --script synth/run_0.hilsim
+ *
+ * Options:
+ *     --reads <n>     readings per pattern (1000)
+ *     --period <ms>   time between reads, that of the sensor thread (6)
+ *     --chip <name>   only the patterns of one chip: ms5611, kx134, lsm6dsl, lis3mdl or bno08x
+ *     --script <path> HILSIM sensor frames for native_sensors to follow, by their simulated time
+ */
+
+#include <MS5611.h>
+#include <SparkFun_Qwiic_KX13X.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "mcu_main/hilsim/HILSIMProtocol.h"
+#include "mcu_main/pins.h"
+#include "tools/silsim/SimKernel.h"
+#include "tools/spi_bench/BNO08xEmulator.h"
+#include "tools/spi_bench/KX134Emulator.h"
+#include "tools/spi_bench/LIS3MDLEmulator.h"
+#include "tools/spi_bench/LSM6DSLEmulator.h"
+#include "tools/spi_bench/MS5611Emulator.h"
+
+// Data ready lines the board leaves unconnected, on spare pins so the patterns can poll them
+static constexpr uint8_t kx134_int1 = 50;
+static constexpr uint8_t lsm6dsl_int1 = 51;
+static constexpr uint8_t lis3mdl_drdy = 52;
+
+// SH-2 report OrientationSensor enables
+static constexpr uint8_t arvr_stabilized_rv = 0x28;
+
+static MS5611Emulator ms5611_chip;
+static KX134Emulator kx134_chip(kx134_int1);
+static LSM6DSLEmulator lsm6dsl_chip(lsm6dsl_int1);
+static LIS3MDLEmulator lis3mdl_chip(lis3mdl_drdy);
+static BNO08xEmulator bno08x_chip(BNO086_INT);
+static ChipEmulator* const chips[] = {&ms5611_chip, &kx134_chip, &lsm6dsl_chip, &lis3mdl_chip, &bno08x_chip};
+
+static MS5611 ms5611(MS5611_CS);
+static QwiicKX134 kx134;
+
+struct Options {
+    uint32_t reads = 1000;
+    uint32_t period_ms = 6;
+    const char* chip = nullptr;
+    const char* script = nullptr;
+};
+
+// Script frames and the next one due
+static std::vector<HILSIMPacket> script_packets;
+static std::vector<uint32_t> script_times_us;
+static size_t script_next = 0;
+
+/**
+ * @brief Reads a file of HILSIM sensor frames, timed by their simulated time.
+ */
+static bool readScript(const char* path) {
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    HILSIMFrameReader reader;
+    uint8_t buffer[65536];
+    size_t length;
+    while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        for (size_t i = 0; i < length; i++) {
+            if (reader.push(buffer[i]) && reader.header().type == HILSIMFrameType::Sensor &&
+                reader.bodySize() == sizeof(HILSIMPacket)) {
+                HILSIMPacket packet;
+                std::memcpy(&packet, reader.body(), sizeof(packet));
+                script_packets.push_back(packet);
+                script_times_us.push_back(reader.header().sim_time_us);
+            }
+        }
+    }
+    std::fclose(file);
+    return !script_packets.empty();
+}
+
+static void setReadings(const HILSIMPacket& packet) {
+    native_sensors.high_g[0] = packet.imu_high_ax;
+    native_sensors.high_g[1] = packet.imu_high_ay;
+    native_sensors.high_g[2] = packet.imu_high_az;
+    native_sensors.low_g[0] = packet.imu_low_ax;
+    native_sensors.low_g[1] = packet.imu_low_ay;
+    native_sensors.low_g[2] = packet.imu_low_az;
+    native_sensors.gyro[0] = packet.imu_low_gx;
+    native_sensors.gyro[1] = packet.imu_low_gy;
+    native_sensors.gyro[2] = packet.imu_low_gz;
+    native_sensors.mag[0] = packet.mag_x;
+    native_sensors.mag[1] = packet.mag_y;
+    native_sensors.mag[2] = packet.mag_z;
+    native_sensors.pressure = (uint32_t)std::lround(packet.barometer_pressure * 100);
+    native_sensors.temperature = (int32_t)std::lround(packet.barometer_temperature * 100);
+    // Roll, pitch and yaw to a quaternion
+    double cr = std::cos(packet.ornt_roll / 2), sr = std::sin(packet.ornt_roll / 2);
+    double cp = std::cos(packet.ornt_pitch / 2), sp = std::sin(packet.ornt_pitch / 2);
+    double cy = std::cos(packet.ornt_yaw / 2), sy = std::sin(packet.ornt_yaw / 2);
+    native_sensors.orientation[0] = (float)(sr * cp * cy - cr * sp * sy);
+    native_sensors.orientation[1] = (float)(cr * sp * cy + sr * cp * sy);
+    native_sensors.orientation[2] = (float)(cr * cp * sy - sr * sp * cy);
+    native_sensors.orientation[3] = (float)(cr * cp * cy + sr * sp * sy);
+}
+
+/**
+ * @brief Moves native_sensors on to the script and every chip up to the tick, so data ready lines change on time.
+ */
+static void tick(systime_t now) {
+    uint32_t now_us = (uint32_t)(now * (1000000 / CH_CFG_ST_FREQUENCY));
+    while (script_next < script_packets.size() && script_times_us[script_next] <= now_us) {
+        setReadings(script_packets[script_next++]);
+    }
+    for (ChipEmulator* chip : chips) {
+        chip->update(now_us);
+    }
+}
+
+/**
+ * @brief One transaction of a register chip: the address byte and then count bytes in or out of data.
+ *
+ * @param bytewise one transfer call per byte, like the SparkFun drivers, instead of one for the buffer
+ */
+static void transaction(uint8_t cs, uint8_t address, uint8_t* data, size_t count, bool bytewise) {
+    SPI.beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+    digitalWrite(cs, LOW);
+    SPI.transfer(address);
+    if (bytewise) {
+        for (size_t i = 0; i < count; i++) {
+            data[i] = SPI.transfer(data[i]);
+        }
+    } else {
+        SPI.transfer(data, count);
+    }
+    digitalWrite(cs, HIGH);
+    SPI.endTransaction();
+}
+
+static void writeRegister(uint8_t cs, uint8_t address, uint8_t value) { transaction(cs, address, &value, 1, true); }
+
+static int16_t word(const uint8_t* bytes) { return (int16_t)(bytes[0] | bytes[1] << 8); }
+
+static float axisError(const float* read, const float* truth) {
+    float error = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        error = std::max(error, std::fabs(read[axis] - truth[axis]));
+    }
+    return error;
+}
+
+/**
+ * @brief Runs one access pattern and prints what it cost.
+ *
+ * @param read reads the chip once, returning the number of readings it got and the largest error among them
+ */
+template <typename Read>
+static void runPattern(const Options& options, const char* chip_name, ChipEmulator& chip, const char* pattern,
+                       Read read) {
+    if (options.chip && std::strcmp(options.chip, chip_name)) {
+        return;
+    }
+    // Long enough for the first sample after the chip was configured
+    chThdSleepMilliseconds(100);
+    SPI.resetTraffic();
+    uint32_t overruns = chip.overruns;
+    uint32_t unknown = chip.unknown_commands;
+
+    uint32_t reads = 0;
+    float max_error = 0;
+    uint64_t start_us = nativeTimeUs();
+    while (reads < options.reads) {
+        float error = 0;
+        reads += read(error);
+        max_error = std::max(max_error, error);
+        chThdSleepMilliseconds(options.period_ms);
+    }
+    double elapsed_s = (nativeTimeUs() - start_us) / 1e6;
+
+    const SPITraffic& traffic = chip.traffic;
+    std::printf(
+        "{\"type\": \"spi_bench\", \"value\": {\"chip\": \"%s\", \"pattern\": \"%s\", \"reads\": %u, "
+        "\"simulated_s\": %.3f, \"transactions_per_read\": %.2f, \"calls_per_read\": %.2f, \"bytes_per_read\": %.2f, "
+        "\"max_error\": %.5f, \"overruns\": %u, \"unknown_commands\": %u}}\n",
+        chip_name, pattern, reads, elapsed_s, (double)traffic.selects / reads, (double)traffic.calls / reads,
+        (double)traffic.bytes / reads, max_error, chip.overruns - overruns, chip.unknown_commands - unknown);
+}
+
+static void benchMS5611(const Options& options) {
+    ms5611.init();
+    runPattern(options, "ms5611", ms5611_chip, "driver", [](float& error) {
+        ms5611.read(12);
+        error = std::fabs(ms5611.getPressure() - (float)native_sensors.pressure) / 100;
+        return 1;
+    });
+}
+
+static void benchKX134(const Options& options) {
+    // As HighGSensor::init sets it up
+    kx134.beginSPI(KX134_CS);
+    kx134.initialize(DEFAULT_SETTINGS);
+    kx134.setRange(3);
+    const float counts_per_g = 512;
+
+    runPattern(options, "kx134", kx134_chip, "driver", [](float& error) {
+        outputData data = kx134.getAccelData();
+        float read[3] = {data.xData, data.yData, data.zData};
+        error = axisError(read, native_sensors.high_g);
+        return 1;
+    });
+
+    auto burst = [counts_per_g](float& error) {
+        uint8_t bytes[6];
+        kx134.readMultipleRegisters(KX13X_XOUT_L, bytes, 6);
+        float read[3] = {word(bytes) / counts_per_g, word(bytes + 2) / counts_per_g, word(bytes + 4) / counts_per_g};
+        error = axisError(read, native_sensors.high_g);
+        return 1;
+    };
+    runPattern(options, "kx134", kx134_chip, "burst", burst);
+
+    // Only reads when the latched data ready interrupt says there is a new sample, and releases it
+    kx134.accelControl(false);
+    kx134.writeRegister(KX13X_CNTL1, 0xDF, 1, 5);
+    kx134.accelControl(true);
+    kx134.setInterruptPin(true, 1);
+    kx134.routeHardwareInterrupt(HI_DATA_READY);
+    runPattern(options, "kx134", kx134_chip, "data_ready", [burst](float& error) {
+        if (digitalRead(kx134_int1) != HIGH) {
+            return 0;
+        }
+        uint8_t release;
+        int reads = burst(error);
+        kx134.readRegister(&release, KX13X_INT_REL);
+        return reads;
+    });
+    kx134.routeHardwareInterrupt(0);
+
+    // Drains the buffer of 16 bit samples every read
+    kx134.setBufferOperation(BUFFER_MODE_STREAM, BUFFER_16BIT_SAMPLES);
+    kx134.enableBuffer(true, false);
+    runPattern(options, "kx134", kx134_chip, "buffer", [counts_per_g](float& error) {
+        uint8_t status[2];
+        kx134.readMultipleRegisters(KX13X_BUF_STATUS_1, status, 2);
+        uint16_t level = (status[0] | (status[1] & 0x03) << 8) / 6 * 6;
+        if (level == 0) {
+            return 0;
+        }
+        uint8_t bytes[86 * 6];
+        kx134.readMultipleRegisters(KX13X_BUF_READ, bytes, level);
+        for (uint16_t i = 0; i < level; i += 6) {
+            const uint8_t* sample = bytes + i;
+            float read[3] = {word(sample) / counts_per_g, word(sample + 2) / counts_per_g,
+                             word(sample + 4) / counts_per_g};
+            error = std::max(error, axisError(read, native_sensors.high_g));
+        }
+        return level / 6;
+    });
+    kx134.enableBuffer(false, false);
+}
+
+static void benchLSM6DSL(const Options& options) {
+    // The SparkFun driver's defaults: 16 g and 2000 deg/s, both at 416 Hz
+    const float g_per_count = 0.488f / 1000;
+    const float dps_per_count = 70.0f / 1000;
+    writeRegister(LSM6DSLTR, 0x10, 0x64);
+    writeRegister(LSM6DSLTR, 0x11, 0x6C);
+
+    auto check = [=](const uint8_t* gyro, const uint8_t* accel) {
+        float read_accel[3];
+        float read_gyro[3];
+        for (int axis = 0; axis < 3; axis++) {
+            read_accel[axis] = word(accel + 2 * axis) * g_per_count;
+            read_gyro[axis] = word(gyro + 2 * axis) * dps_per_count;
+        }
+        (void)read_gyro;
+        return axisError(read_accel, native_sensors.low_g);
+    };
+
+    // readFloatAccelX and the rest each read their own register pair
+    runPattern(options, "lsm6dsl", lsm6dsl_chip, "driver", [check](float& error) {
+        uint8_t data[12] = {};
+        for (int i = 0; i < 6; i++) {
+            uint8_t address = i < 3 ? 0x28 + 2 * i : 0x22 + 2 * (i - 3);
+            uint8_t* out = i < 3 ? data + 6 + 2 * i : data + 2 * (i - 3);
+            transaction(LSM6DSLTR, address | 0x80, out, 2, true);
+        }
+        error = check(data, data + 6);
+        return 1;
+    });
+
+    // Gyroscope and accelerometer outputs are next to each other
+    runPattern(options, "lsm6dsl", lsm6dsl_chip, "burst", [check](float& error) {
+        uint8_t data[12] = {};
+        transaction(LSM6DSLTR, 0x22 | 0x80, data, 12, false);
+        error = check(data, data + 6);
+        return 1;
+    });
+
+    // Continuous mode FIFO at the sensors' rate, drained every read
+    writeRegister(LSM6DSLTR, 0x08, 0x09);
+    writeRegister(LSM6DSLTR, 0x0A, 0x06 << 3 | 0x06);
+    runPattern(options, "lsm6dsl", lsm6dsl_chip, "fifo", [check](float& error) {
+        uint8_t status[4] = {};
+        transaction(LSM6DSLTR, 0x3A | 0x80, status, 4, false);
+        uint16_t words = status[0] | (status[1] & 0x07) << 8;
+        // Whole gyroscope and accelerometer sets, from the start of the pattern
+        uint16_t skip = (6 - (status[2] | status[3] << 8)) % 6;
+        words = words < skip ? 0 : skip + (words - skip) / 6 * 6;
+        if (words == 0) {
+            return 0;
+        }
+        std::vector<uint8_t> data(2 * words);
+        transaction(LSM6DSLTR, 0x3E | 0x80, data.data(), data.size(), false);
+        int sets = 0;
+        for (size_t set = 2 * skip; set + 12 <= data.size(); set += 12) {
+            error = std::max(error, check(&data[set], &data[set + 6]));
+            sets++;
+        }
+        return sets;
+    });
+    writeRegister(LSM6DSLTR, 0x0A, 0x00);
+}
+
+static void benchLIS3MDL(const Options& options) {
+    // As MagnetometerSensor::init sets it up after the Adafruit driver's defaults: medium performance, 80 Hz,
+    // 4 gauss, continuous
+    const float gauss_per_count = 1 / 6842.0f;
+    writeRegister(LIS3MDL_CS, 0x20, 0x3C);
+    writeRegister(LIS3MDL_CS, 0x21, 0x00);
+    writeRegister(LIS3MDL_CS, 0x22, 0x00);
+    writeRegister(LIS3MDL_CS, 0x23, 0x04);
+
+    auto read = [gauss_per_count](float& error) {
+        uint8_t data[6] = {};
+        transaction(LIS3MDL_CS, 0x28 | 0xC0, data, 6, false);
+        float read[3] = {word(data) * gauss_per_count, word(data + 2) * gauss_per_count,
+                         word(data + 4) * gauss_per_count};
+        error = axisError(read, native_sensors.mag);
+        return 1;
+    };
+    runPattern(options, "lis3mdl", lis3mdl_chip, "driver", read);
+    runPattern(options, "lis3mdl", lis3mdl_chip, "data_ready", [read](float& error) {
+        return digitalRead(lis3mdl_drdy) == HIGH ? read(error) : 0;
+    });
+}
+
+/**
+ * @brief Reads the SHTP packets the BNO08x has queued, returning the rotation vectors among them.
+ *
+ * @param single reads each packet in one transaction, instead of its header first like the SH-2 host drivers
+ */
+static int readBNO08x(float& error, bool single) {
+    int reads = 0;
+    while (digitalRead(BNO086_INT) == LOW) {
+        uint8_t packet[64] = {};
+        SPI.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+        digitalWrite(BNO086_CS, LOW);
+        SPI.transfer(packet, 4);
+        size_t length = std::min<size_t>((packet[0] | packet[1] << 8) & 0x7FFF, sizeof(packet));
+        if (!single) {
+            digitalWrite(BNO086_CS, HIGH);
+            SPI.endTransaction();
+            SPI.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+            digitalWrite(BNO086_CS, LOW);
+            std::memset(packet, 0, sizeof(packet));
+            SPI.transfer(packet, length);
+        } else if (length > 4) {
+            SPI.transfer(packet + 4, length - 4);
+        }
+        digitalWrite(BNO086_CS, HIGH);
+        SPI.endTransaction();
+
+        // Timebase reference then the ARVR stabilized rotation vector on the input channel
+        if (packet[2] == 3 && length >= 4 + 5 + 14 && packet[9] == arvr_stabilized_rv) {
+            const uint8_t* report = packet + 9;
+            for (int i = 0; i < 4; i++) {
+                float value = word(report + 4 + 2 * i) / 16384.0f;
+                error = std::max(error, std::fabs(value - native_sensors.orientation[i]));
+            }
+            reads++;
+        }
+    }
+    return reads;
+}
+
+static void benchBNO08x(const Options& options) {
+    // Reset Complete, then Set Feature for the report OrientationSensor asks for
+    float error = 0;
+    readBNO08x(error, false);
+    uint8_t set_feature[21] = {21, 0, 2, 0, 0xFD, arvr_stabilized_rv, 0, 0, 0};
+    uint32_t interval_us = 5000;
+    std::memcpy(set_feature + 9, &interval_us, sizeof(interval_us));
+    SPI.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+    digitalWrite(BNO086_CS, LOW);
+    SPI.transfer(set_feature, sizeof(set_feature));
+    digitalWrite(BNO086_CS, HIGH);
+    SPI.endTransaction();
+
+    runPattern(options, "bno08x", bno08x_chip, "driver", [](float& error) { return readBNO08x(error, false); });
+    runPattern(options, "bno08x", bno08x_chip, "single", [](float& error) { return readBNO08x(error, true); });
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--reads") && has_value) {
+            options.reads = (uint32_t)std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--period") && has_value) {
+            options.period_ms = (uint32_t)std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--chip") && has_value) {
+            options.chip = argv[++i];
+        } else if (!std::strcmp(argv[i], "--script") && has_value) {
+            options.script = argv[++i];
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--reads n] [--period ms] [--chip ms5611|kx134|lsm6dsl|lis3mdl|bno08x] "
+                         "[--script frames.hilsim]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+    if (options.script && !readScript(options.script)) {
+        std::fprintf(stderr, "%s has no sensor frames\n", options.script);
+        return 1;
+    }
+
+    // A steady reading off every axis, unless the script says otherwise
+    const float high_g[3] = {0.5f, -0.25f, 3.1f};
+    const float low_g[3] = {0.1f, -0.2f, 1.05f};
+    const float gyro[3] = {10.0f, -20.0f, 5.0f};
+    const float mag[3] = {0.376f, 0.116f, -0.53f};
+    for (int axis = 0; axis < 3; axis++) {
+        native_sensors.high_g[axis] = high_g[axis];
+        native_sensors.low_g[axis] = low_g[axis];
+        native_sensors.gyro[axis] = gyro[axis];
+        native_sensors.mag[axis] = mag[axis];
+    }
+    native_sensors.pressure = 99050;
+    native_sensors.temperature = 3300;
+    const float orientation[4] = {0.1f, 0.2f, 0.3f, 0.927362f};
+    std::copy(orientation, orientation + 4, native_sensors.orientation);
+
+    const uint8_t chip_selects[] = {MS5611_CS, KX134_CS, LSM6DSLTR, LIS3MDL_CS, BNO086_CS};
+    for (size_t i = 0; i < sizeof(chip_selects); i++) {
+        digitalWrite(chip_selects[i], HIGH);
+        SPI.attach(chip_selects[i], chips[i]);
+    }
+    simSetTickHook(tick);
+
+    benchMS5611(options);
+    benchKX134(options);
+    benchLSM6DSL(options);
+    benchLIS3MDL(options);
+    benchBNO08x(options);
+    return 0;
+}
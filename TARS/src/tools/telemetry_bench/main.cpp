@@ -0,0 +1,352 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Round trips and throughput of the telemetry codec in common/TelemetryCodec.h.
+ *
+ * Checks that random frames and event messages decode to their fields within half a resolution step, out of range
+ * values to the ends of their fields, and that short, other version or other type frames are refused. Then fills frames
+ * with synthetic datapoints buffered every 30 ms on the pad, in boost and in coast, and prints how many of them fit in
+ * a frame of TELEMETRY_MAX_FRAME_SIZE bytes, against the 4 of the raw struct the codec replaced, and how long a frame
+ * takes to encode and decode:
+ *
+ *     {"type": "telemetry_bench", "value": {"phase": "boost", "datapoints_per_frame": 10.6, "times_raw": 2.66,
+ *      "bytes_per_frame": 187.0, "status_bits": 620, "bits_per_datapoint": 82.4, "encode_us": 3.91, ...}}
+ *
+ *     pio run -e telemetry_bench && .pio/build/telemetry_bench/program
+ *
+ * Exits with 1 if a check fails.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#include "common/TelemetryCodec.h"
+
+static constexpr int frames = 20000;
+// The raw TelemetryPacket held this many datapoints
+static constexpr int raw_datapoints = 4;
+
+static std::mt19937 rng(1);
+static int failures = 0;
+
+static double uniform(double low, double high) { return std::uniform_real_distribution<double>(low, high)(rng); }
+static double normal(double sigma) { return std::normal_distribution<double>(0, sigma)(rng); }
+
+static void fail(const char* what, const char* field, double sent, double received) {
+    if (failures++ < 10) {
+        std::fprintf(stderr, "%s: %s sent %.9g received %.9g\n", what, field, sent, received);
+    }
+}
+
+// Largest error a value of the type can come back with: half a step, and the rounding of storing it on either side
+template <typename T>
+static double tolerance(double value, double resolution) {
+    double stored = std::is_floating_point<T>::value ? std::fabs(std::nextafter((T)value, (T)INFINITY) - (T)value) : 0;
+    return resolution / 2 + 2 * stored + 1e-12;
+}
+
+// Integer fields can span their whole type, so the nearest the type gets to a value
+template <typename T>
+static T nearest(double value) {
+    if (std::is_integral<T>::value) {
+        value = std::max<double>(std::numeric_limits<T>::min(), std::min<double>(std::numeric_limits<T>::max(), value));
+    }
+    return (T)value;
+}
+
+#define RANDOM_FIELD(type, name, min, max, resolution) record.name = (type)uniform(min, (max)-resolution);
+#define CHECK_FIELD(type, name, min, max, resolution)                                                \
+    if (std::fabs((double)decoded.name - (double)sent.name) > tolerance<type>(sent.name, resolution)) { \
+        fail(what, #name, sent.name, decoded.name);                                                     \
+    }
+// Sends values past both ends, expecting the ends back
+#define HIGH_FIELD(type, name, min, max, resolution) record.name = nearest<type>((max) + 10 * (resolution));
+#define CHECK_HIGH_FIELD(type, name, min, max, resolution)                                 \
+    {                                                                                      \
+        double top = (max) - (resolution);                                                 \
+        if (std::fabs((double)decoded.name - top) > tolerance<type>(top, resolution)) {    \
+            fail(what, #name, top, decoded.name);                                          \
+        }                                                                                  \
+    }
+#define LOW_FIELD(type, name, min, max, resolution) record.name = nearest<type>((min) - 10 * (resolution));
+#define CHECK_LOW_FIELD(type, name, min, max, resolution)                                 \
+    if (std::fabs((double)decoded.name - (min)) > tolerance<type>(min, resolution)) { \
+        fail(what, #name, min, decoded.name);                                         \
+    }
+
+static void checkStatus(const char* what, const TelemetryStatus& sent, const TelemetryStatus& decoded) {
+    TELEMETRY_STATUS_FIELDS(CHECK_FIELD)
+}
+
+static void checkDatapoint(const char* what, const TelemetryDatapoint& sent, const TelemetryDatapoint& decoded) {
+    TELEMETRY_DATAPOINT_FIELDS(CHECK_FIELD)
+}
+
+static void checkEvent(const char* what, const TelemetryEvent& sent, const TelemetryEvent& decoded) {
+    TELEMETRY_EVENT_FIELDS(CHECK_FIELD)
+}
+
+static bool roundTrip(const TelemetryFrame& frame, TelemetryFrame& decoded, size_t& size) {
+    uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+    size = encodeTelemetryFrame(frame, buffer, sizeof(buffer));
+    return size > 0 && decodeTelemetryFrame(buffer, size, decoded);
+}
+
+static void checkRandomFrames() {
+    static TelemetryFrame frame;
+    static TelemetryFrame decoded;
+    for (int n = 0; n < 2000; n++) {
+        {
+            TelemetryStatus& record = frame.status;
+            TELEMETRY_STATUS_FIELDS(RANDOM_FIELD)
+        }
+        // Anywhere in range, so few fit
+        frame.datapoint_count = (uint8_t)(n % (TELEMETRY_MAX_DATAPOINTS + 1));
+        for (int i = 0; i < frame.datapoint_count; i++) {
+            TelemetryDatapoint& record = frame.datapoints[i];
+            TELEMETRY_DATAPOINT_FIELDS(RANDOM_FIELD)
+        }
+        size_t size;
+        if (!roundTrip(frame, decoded, size)) {
+            fail("random frame", "frame", size, 0);
+            continue;
+        }
+        checkStatus("random frame", frame.status, decoded.status);
+        // The newest that fit
+        int skipped = frame.datapoint_count - decoded.datapoint_count;
+        if (skipped < 0 || (frame.datapoint_count > 0 && decoded.datapoint_count == 0)) {
+            fail("random frame", "datapoint_count", frame.datapoint_count, decoded.datapoint_count);
+            continue;
+        }
+        for (int i = 0; i < decoded.datapoint_count; i++) {
+            checkDatapoint("random frame", frame.datapoints[skipped + i], decoded.datapoints[i]);
+        }
+    }
+}
+
+static void checkRandomEvents() {
+    static TelemetryEventMessage message;
+    static TelemetryEventMessage decoded;
+    for (int n = 0; n < 2000; n++) {
+        {
+            TelemetryEventMessage& record = message;
+            TELEMETRY_EVENT_MESSAGE_FIELDS(RANDOM_FIELD)
+        }
+        message.event_count = (uint8_t)(n % (TELEMETRY_MAX_EVENTS + 1));
+        for (int i = 0; i < message.event_count; i++) {
+            TelemetryEvent& record = message.events[i];
+            TELEMETRY_EVENT_FIELDS(RANDOM_FIELD)
+        }
+        // Every event fits the shortest frame of the slowest profile
+        uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+        size_t size = encodeTelemetryEvents(message, buffer, link_profiles[LINK_FALLBACK_PROFILE].max_frame);
+        if (!decodeTelemetryEvents(buffer, size, decoded) || decoded.event_count != message.event_count) {
+            fail("random events", "event_count", message.event_count, decoded.event_count);
+            continue;
+        }
+        {
+            const TelemetryEventMessage& sent = message;
+            const char* what = "random events";
+            TELEMETRY_EVENT_MESSAGE_FIELDS(CHECK_FIELD)
+        }
+        for (int i = 0; i < decoded.event_count; i++) {
+            checkEvent("random events", message.events[i], decoded.events[i]);
+        }
+        static TelemetryFrame frame;
+        if (decodeTelemetryFrame(buffer, size, frame)) {
+            fail("random events", "type", TELEMETRY_MESSAGE_EVENTS, TELEMETRY_MESSAGE_FRAME);
+        }
+    }
+}
+
+static void checkClamping() {
+    static TelemetryFrame frame;
+    static TelemetryFrame decoded;
+    size_t size;
+    frame.datapoint_count = 2;
+    {
+        const char* what = "high values";
+        TelemetryStatus& record = frame.status;
+        TELEMETRY_STATUS_FIELDS(HIGH_FIELD)
+        for (int i = 0; i < 2; i++) {
+            TelemetryDatapoint& record = frame.datapoints[i];
+            TELEMETRY_DATAPOINT_FIELDS(HIGH_FIELD)
+        }
+        if (!roundTrip(frame, decoded, size)) {
+            fail(what, "frame", size, 0);
+        } else {
+            const TelemetryStatus& decoded_status = decoded.status;
+            {
+                const TelemetryStatus& decoded = decoded_status;
+                TELEMETRY_STATUS_FIELDS(CHECK_HIGH_FIELD)
+            }
+            const TelemetryDatapoint& decoded_datapoint = decoded.datapoints[1];
+            {
+                const TelemetryDatapoint& decoded = decoded_datapoint;
+                TELEMETRY_DATAPOINT_FIELDS(CHECK_HIGH_FIELD)
+            }
+        }
+    }
+    {
+        const char* what = "low values";
+        TelemetryStatus& record = frame.status;
+        TELEMETRY_STATUS_FIELDS(LOW_FIELD)
+        for (int i = 0; i < 2; i++) {
+            TelemetryDatapoint& record = frame.datapoints[i];
+            TELEMETRY_DATAPOINT_FIELDS(LOW_FIELD)
+        }
+        // Only floats can be NaN, which is sent as min
+        frame.status.gps_lat = NAN;
+        frame.datapoints[1].highG_az = NAN;
+        if (!roundTrip(frame, decoded, size)) {
+            fail(what, "frame", size, 0);
+        } else {
+            const TelemetryStatus& decoded_status = decoded.status;
+            {
+                const TelemetryStatus& decoded = decoded_status;
+                TELEMETRY_STATUS_FIELDS(CHECK_LOW_FIELD)
+            }
+            const TelemetryDatapoint& decoded_datapoint = decoded.datapoints[1];
+            {
+                const TelemetryDatapoint& decoded = decoded_datapoint;
+                TELEMETRY_DATAPOINT_FIELDS(CHECK_LOW_FIELD)
+            }
+        }
+    }
+}
+
+/**
+ * @brief A frame cut short, of another version or with a difference running a field out of its range is refused.
+ */
+static void checkRefused(const TelemetryFrame& frame) {
+    static TelemetryFrame decoded;
+    uint8_t buffer[TELEMETRY_MAX_FRAME_SIZE];
+    size_t size = encodeTelemetryFrame(frame, buffer, sizeof(buffer));
+    for (size_t cut = 0; cut < size; cut++) {
+        // The last byte may only hold padding
+        if (decodeTelemetryFrame(buffer, cut, decoded) && cut + 1 < size) {
+            fail("cut frame", "size", (double)cut, (double)size);
+        }
+    }
+    buffer[1] ^= 0x0F;
+    if (decodeTelemetryFrame(buffer, size, decoded)) {
+        fail("other version", "version", TELEMETRY_CODEC_VERSION, buffer[1] & 0x0F);
+    }
+    buffer[1] ^= 0x0F;
+    buffer[0] = TELEMETRY_MESSAGE_EVENTS;
+    if (decodeTelemetryFrame(buffer, size, decoded)) {
+        fail("other type", "type", TELEMETRY_MESSAGE_FRAME, buffer[0]);
+    }
+}
+
+/**
+ * @brief Datapoints buffered every 30 ms in a phase of flight.
+ *
+ * @param accel_noise vibration on the high g axes in g
+ * @param climb_mbar_s pressure change per second
+ */
+static void fillPhase(TelemetryFrame& frame, uint32_t& time_ms, double az, double accel_noise, double& pressure,
+                      double climb_mbar_s, double rate_rad_s, double flap_mm) {
+    static double roll = 0.1, pitch = 0.05, yaw = -0.3;
+    frame.datapoint_count = TELEMETRY_MAX_DATAPOINTS;
+    for (int i = 0; i < TELEMETRY_MAX_DATAPOINTS; i++) {
+        time_ms += 30;
+        pressure += climb_mbar_s * 0.03;
+        roll += rate_rad_s * 0.03 + normal(0.002);
+        pitch += normal(0.002);
+        yaw += normal(0.002);
+        TelemetryDatapoint& data = frame.datapoints[i];
+        data.timestamp = time_ms;
+        data.barometer_pressure = (float)(pressure + normal(0.05));
+        data.highG_ax = (float)normal(accel_noise);
+        data.highG_ay = (float)normal(accel_noise);
+        data.highG_az = (float)(az + normal(accel_noise));
+        data.bno_roll = (float)std::remainder(roll, 2 * M_PI);
+        data.bno_pitch = (float)pitch;
+        data.bno_yaw = (float)yaw;
+        data.flap_extension = (float)flap_mm;
+    }
+    frame.status.gps_lat = 32.94f;
+    frame.status.gps_long = -106.91f;
+    frame.status.gnc_state_x = (float)(1013 - pressure) * 8.3f;
+}
+
+static void benchPhase(const char* phase, double az, double accel_noise, double climb_mbar_s, double rate_rad_s,
+                       double flap_mm) {
+    static TelemetryFrame frame;
+    static TelemetryFrame decoded;
+    static uint8_t encoded[frames][TELEMETRY_MAX_FRAME_SIZE];
+    static size_t sizes[frames];
+    static TelemetryFrame inputs[16];
+    uint32_t time_ms = 0;
+    double pressure = 870;
+    for (TelemetryFrame& input : inputs) {
+        fillPhase(input, time_ms, az, accel_noise, pressure, climb_mbar_s, rate_rad_s, flap_mm);
+    }
+    checkRefused(inputs[0]);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < frames; n++) {
+        sizes[n] = encodeTelemetryFrame(inputs[n % 16], encoded[n], TELEMETRY_MAX_FRAME_SIZE);
+    }
+    double encode_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t datapoints = 0;
+    uint64_t bytes = 0;
+    start = std::chrono::steady_clock::now();
+    for (int n = 0; n < frames; n++) {
+        if (!decodeTelemetryFrame(encoded[n], sizes[n], decoded)) {
+            fail(phase, "frame", (double)sizes[n], 0);
+        }
+        datapoints += decoded.datapoint_count;
+        bytes += sizes[n];
+    }
+    double decode_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    // Check one of each input outside the timing
+    for (int n = 0; n < 16; n++) {
+        decodeTelemetryFrame(encoded[n], sizes[n], decoded);
+        const TelemetryFrame& input = inputs[n];
+        int skipped = input.datapoint_count - decoded.datapoint_count;
+        size_t oldest;
+        encodeTelemetryFrame(input, encoded[n], TELEMETRY_MAX_FRAME_SIZE, &oldest);
+        if (oldest != (size_t)skipped) {
+            fail(phase, "oldest", (double)skipped, (double)oldest);
+        }
+        checkStatus(phase, input.status, decoded.status);
+        for (int i = 0; i < decoded.datapoint_count; i++) {
+            checkDatapoint(phase, input.datapoints[skipped + i], decoded.datapoints[i]);
+        }
+    }
+
+    double per_frame = (double)datapoints / frames;
+    double status_bits = telemetry_codec::statusBits();
+    std::printf(
+        "{\"type\": \"telemetry_bench\", \"value\": {\"phase\": \"%s\", \"datapoints_per_frame\": %.1f, "
+        "\"times_raw\": %.2f, \"bytes_per_frame\": %.1f, \"status_bits\": %.0f, \"bits_per_datapoint\": %.1f, "
+        "\"encode_us\": %.2f, \"decode_us\": %.2f}}\n",
+        phase, per_frame, per_frame / raw_datapoints, (double)bytes / frames, status_bits,
+        ((double)bytes * 8 / frames - status_bits) / per_frame, encode_us / frames, decode_us / frames);
+}
+
+int main() {
+    checkRandomFrames();
+    checkRandomEvents();
+    checkClamping();
+
+    benchPhase("pad", 1, 0.01, 0, 0, 0);
+    benchPhase("boost", 9, 1.5, -40, 1.5, 0);
+    benchPhase("coast", -1, 0.2, -15, 0.5, 12);
+
+    if (failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
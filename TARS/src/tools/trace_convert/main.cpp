@@ -0,0 +1,193 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Converts an execution trace from Trace.h into Chrome/Perfetto trace JSON.
+ *
+ * Takes either the trace file from the SD card or a capture of the serial dump, the trace starts at the header magic
+ * so anything printed before it is skipped. The JSON opens in chrome://tracing or ui.perfetto.dev and shows:
+ *
+ *  - "threads": when each thread was running
+ *  - "markers": the TRACE_EVENT markers and mutex waits of each thread
+ *  - "interrupts": the time spent in each interrupt handler
+ *
+ *     pio run -e trace_convert && .pio/build/trace_convert/program trace.trace trace.json
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "mcu_main/TraceFormat.h"
+
+enum Process { threads_pid = 1, markers_pid = 2, interrupts_pid = 3 };
+
+static FILE* out;
+static bool first_event = true;
+
+static void beginEvent() {
+    std::fprintf(out, first_event ? "\n" : ",\n");
+    first_event = false;
+}
+
+static void metadata(const char* kind, int pid, int tid, const char* name) {
+    beginEvent();
+    std::fprintf(out, R"({"name": "%s", "ph": "M", "pid": %d, "tid": %d, "args": {"name": "%s"}})", kind, pid, tid,
+                 name);
+}
+
+static void slice(const char* name, int pid, int tid, double start_us, double end_us) {
+    beginEvent();
+    std::fprintf(out, R"({"name": "%s", "ph": "X", "pid": %d, "tid": %d, "ts": %.3f, "dur": %.3f})", name, pid, tid,
+                 start_us, end_us - start_us);
+}
+
+static void instant(const char* name, int pid, int tid, double time_us, const char* scope) {
+    beginEvent();
+    std::fprintf(out, R"({"name": "%s", "ph": "i", "s": "%s", "pid": %d, "tid": %d, "ts": %.3f})", name, scope, pid,
+                 tid, time_us);
+}
+
+static const char* markerName(uint16_t marker) {
+    return marker < trace_marker_count ? trace_marker_names[marker] : "unknown marker";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s trace [trace.json]\n", argv[0]);
+        return 1;
+    }
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t start = 0;
+    while (start + sizeof(TraceHeader) <= bytes.size() && std::memcmp(&bytes[start], trace_magic, 4) != 0) {
+        start++;
+    }
+    if (start + sizeof(TraceHeader) > bytes.size()) {
+        std::fprintf(stderr, "%s does not contain a trace\n", argv[1]);
+        return 1;
+    }
+    TraceHeader header;
+    std::memcpy(&header, &bytes[start], sizeof(header));
+    size_t event_count = (bytes.size() - start - sizeof(header)) / sizeof(TraceEvent);
+    std::vector<TraceEvent> events(event_count);
+    if (event_count > 0) {
+        std::memcpy(events.data(), &bytes[start + sizeof(header)], event_count * sizeof(TraceEvent));
+    }
+
+    out = argc > 2 ? std::fopen(argv[2], "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 1;
+    }
+    std::fprintf(out, R"({"displayTimeUnit": "ns", "traceEvents": [)");
+
+    metadata("process_name", threads_pid, 0, "threads");
+    metadata("process_name", markers_pid, 0, "markers");
+    metadata("process_name", interrupts_pid, 0, "interrupts");
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        char name[TRACE_NAME_LENGTH + 1] = {};
+        std::memcpy(name, header.thread_names[i], TRACE_NAME_LENGTH);
+        if (name[0]) {
+            metadata("thread_name", threads_pid, i, name);
+            metadata("thread_name", markers_pid, i, name);
+        }
+    }
+    metadata("thread_name", threads_pid, trace_no_thread, "other");
+
+    // The cycle counter wraps every few seconds, consecutive events are always much closer than that
+    uint64_t cycles = 0;
+    uint32_t last = events.empty() ? 0 : events[0].cycles;
+    double us_per_cycle = 1e6 / header.cpu_hz;
+
+    std::map<int, double> running;
+    std::map<std::pair<int, int>, double> marks;
+    std::map<int, double> mutex_waits;
+    std::map<int, double> interrupts;
+    size_t dropped = 0;
+
+    auto run = [&](int thread, double now) {
+        if (!running.count(thread)) running[thread] = now;
+    };
+    auto stop = [&](int thread, double now) {
+        auto it = running.find(thread);
+        if (it != running.end()) {
+            slice("running", threads_pid, thread, it->second, now);
+            running.erase(it);
+        }
+    };
+
+    for (const TraceEvent& event : events) {
+        cycles += (uint32_t)(event.cycles - last);
+        last = event.cycles;
+        double now = cycles * us_per_cycle;
+        int thread = event.thread;
+        char name[32];
+
+        switch (event.type) {
+            case TraceType::Switch:
+                stop(event.arg, now);
+                run(thread, now);
+                break;
+            case TraceType::Run:
+                run(thread, now);
+                break;
+            case TraceType::Wait:
+                stop(thread, now);
+                break;
+            case TraceType::IsrEnter:
+                interrupts[event.arg] = now;
+                break;
+            case TraceType::IsrExit:
+                if (interrupts.count(event.arg)) {
+                    std::snprintf(name, sizeof(name), "IRQ %u", event.arg);
+                    slice(name, interrupts_pid, event.arg, interrupts[event.arg], now);
+                    interrupts.erase(event.arg);
+                }
+                break;
+            case TraceType::MutexWait:
+                mutex_waits[thread] = now;
+                break;
+            case TraceType::MutexAcquired:
+                if (mutex_waits.count(thread)) {
+                    std::snprintf(name, sizeof(name), "mutex ...%05x", (unsigned)event.arg << 2);
+                    slice(name, markers_pid, thread, mutex_waits[thread], now);
+                    mutex_waits.erase(thread);
+                }
+                break;
+            case TraceType::MarkBegin:
+                marks[{thread, event.arg}] = now;
+                break;
+            case TraceType::MarkEnd:
+                if (marks.count({thread, event.arg})) {
+                    slice(markerName(event.arg), markers_pid, thread, marks[{thread, event.arg}], now);
+                    marks.erase({thread, event.arg});
+                }
+                break;
+            case TraceType::Instant:
+                instant(markerName(event.arg), markers_pid, thread, now, "t");
+                break;
+            case TraceType::Dropped:
+                std::snprintf(name, sizeof(name), "dropped %u events", event.arg);
+                instant(name, threads_pid, 0, now, "g");
+                dropped += event.arg;
+                break;
+        }
+    }
+
+    std::fprintf(out, "\n]}\n");
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    std::fprintf(stderr, "%zu events over %.3f s, %zu dropped\n", events.size(), cycles * us_per_cycle / 1e6,
+                 dropped);
+    return 0;
+}
@@ -14,12 +14,14 @@
 #include <RH_RF95.h>
 #include <SPI.h>
 
-#include <array>
 #include <limits>
 #include <numeric>
 #include <queue>
 
 #include "SerialParser.h"
+#include "common/CommandProtocol.h"
+#include "common/TelemetryCodec.h"
+#include "common/TelemetryFec.h"
 
 /* Pins for feather*/
 // // Ensure to change depending on wiring
@@ -44,68 +46,29 @@
 #define MAX_CMD_LEN 10
 
 typedef uint32_t systime_t;
+
+// The driver, with the SNR of the last packet, which RadioHead does not keep
+class GroundRadio : public RH_RF95 {
+   public:
+    using RH_RF95::RH_RF95;
+
+    // In quarter dB
+    int8_t lastSnr() { return (int8_t)spiRead(RH_RF95_REG_19_PKT_SNR_VALUE); }
+};
+
 // Singleton instance of the radio driver
-RH_RF95 rf95(RFM95_CS, RFM95_INT);
+GroundRadio rf95(RFM95_CS, RFM95_INT);
+// Follows the modem profile TARS picks, and measures the link for it
+LinkFollower link;
+// Puts the frames back together from packets sent with ENABLE_TELEMETRY_FEC
+TelemetryFecDecoder fec;
 // For reading from
 char incomingCmd[MAX_CMD_LEN];
 char curByte;
 short charIdx = 0;
 short readySend = 0;
-int command_ID = 0;
 short cmd_number = 0;
 
-template <typename T>
-float convert_range(T val, float range) {
-    size_t numeric_range = (int64_t)std::numeric_limits<T>::max() - (int64_t)std::numeric_limits<T>::min() + 1;
-    return val * range / (float)numeric_range;
-}
-
-struct TelemetryDataLite {
-    systime_t timestamp;  //[0, 2^32]
-
-    uint16_t barometer_pressure;  //[0, 4096]
-    int16_t highG_ax;             //[128, -128]
-    int16_t highG_ay;             //[128, -128]
-    int16_t highG_az;             //[128, -128]
-    int16_t bno_roll;             //[-4,4]
-    int16_t bno_pitch;            //[-4,4]
-    int16_t bno_yaw;              //[-4,4]
-
-    float flap_extension;
-};
-
-struct TelemetryPacket {
-    TelemetryDataLite datapoints[4];
-    float gps_lat;
-    float gps_long;
-    float gps_alt;
-    float yaw;
-    float pitch;
-    float roll;
-    float gnc_state_x;
-    float gnc_state_vx;
-    float gnc_state_ax;
-    float gnc_state_y;
-    float gnc_state_vy;
-    float gnc_state_ay;
-    float gnc_state_z;
-    float gnc_state_vz;
-    float gnc_state_az;
-    float gnc_state_apo;
-    int16_t mag_x;            //[-4, 4]
-    int16_t mag_y;            //[-4, 4]
-    int16_t mag_z;            //[-4, 4]
-    int16_t gyro_x;           //[-4096, 4096]
-    int16_t gyro_y;           //[-4096, 4096]
-    int16_t gyro_z;           //[-4096, 4096]
-    int16_t response_ID;      //[0, 2^16]
-    int8_t rssi;              //[-128, 128]
-    int8_t datapoint_count;   //[0,4]
-    uint8_t voltage_battery;  //[0, 16]
-    uint8_t FSM_State;        //[0,256]
-    int16_t barometer_temp;   //[-128, 128]
-};
-
 struct FullTelemetryData {
     systime_t timestamp;  //[0, 2^32]
 
@@ -125,6 +88,7 @@ struct FullTelemetryData {
     float gnc_state_vx;
     float gnc_state_ax;
     float gnc_state_apo;
+    float gnc_state_apo_var;
     float mag_x;            //[-4, 4]
     float mag_y;            //[-4, 4]
     float mag_z;            //[-4, 4]
@@ -140,40 +104,28 @@ struct FullTelemetryData {
     int64_t print_time;
 };
 
-enum class CommandType { SET_FREQ, SET_CALLSIGN, ABORT, TEST_FLAP, EMPTY };
-// Commands transmitted from ground station to rocket
-struct telemetry_command {
-    CommandType command;
-    int id;
-    union {
-        char callsign[8];
-        float freq;
-        bool do_abort;
-    };
-    std::array<char, 6> verify = {{'A', 'Y', 'B', 'E', 'R', 'K'}};
-};
-
-struct TelemetryCommandQueueElement {
-    telemetry_command command;
-    int retry_count;
-};
-
-std::queue<TelemetryCommandQueueElement> cmd_queue;
+// The commands sent to TARS and not yet acknowledged
+CommandSender commands;
 std::queue<FullTelemetryData> print_queue;
 
 constexpr const char* json_command_success = R"({"type": "command_success"})";
 constexpr const char* json_command_parse_error = R"({"type": "command_error", "error": "serial parse error"})";
-constexpr const char* json_buffer_full_error = R"({"type": "command_error", "error": "command buffer not empty"})";
+constexpr const char* json_buffer_full_error = R"({"type": "command_error", "error": "command buffer full"})";
 
 constexpr const char* json_init_failure = R"({"type": "init_error", "error": "failed to initilize LORA"})";
 constexpr const char* json_init_success = R"({"type": "init_success"})";
 constexpr const char* json_set_frequency_failure = R"({"type": "freq_error", "error": "set_frequency failed"})";
 constexpr const char* json_receive_failure = R"({"type": "receive_error", "error": "recv failed"})";
-constexpr const char* json_send_failure = R"({"type": "send_error", "error": "command_retries_exceded"})";
-constexpr int max_command_retries = 5;
 
 float current_freq = RF95_FREQ;
 
+// Id of the next event expected, sent back for TARS to stop repeating the ones before, once any has come
+uint8_t event_ack = 0;
+bool have_events = false;
+// Whether the last frame came in coded packets, which the decoder gives out later than the event messages between them
+bool coded_frames = false;
+constexpr const char* event_kind_names[] = {"state_change", "abort", "error"};
+
 void printFloat(float f, int precision = 5) {
     if (isinf(f) || isnan(f)) {
         Serial.print(-1);
@@ -182,42 +134,44 @@ void printFloat(float f, int precision = 5) {
     }
 }
 
-void EnqueuePacket(const TelemetryPacket& packet, float frequency) {
-    if (packet.datapoint_count == 0) return;
+void EnqueuePacket(const TelemetryFrame& frame, float frequency) {
+    if (frame.datapoint_count == 0) return;
 
-    int64_t start_timestamp = packet.datapoints[0].timestamp;
+    const TelemetryStatus& status = frame.status;
+    int64_t start_timestamp = frame.datapoints[0].timestamp;
     int64_t start_printing = millis();
 
-    for (int i = 0; i < packet.datapoint_count && i < 4; i++) {
+    for (int i = 0; i < frame.datapoint_count; i++) {
         FullTelemetryData item;
-        TelemetryDataLite data = packet.datapoints[i];
-        item.barometer_pressure = convert_range(data.barometer_pressure, 4096);
-        item.barometer_temp = convert_range(packet.barometer_temp, 256);
-        item.highG_ax = convert_range(data.highG_ax, 256);
-        item.highG_ay = convert_range(data.highG_ay, 256);
-        item.highG_az = convert_range(data.highG_az, 256);
-        item.gyro_x = convert_range(packet.gyro_x, 8192);
-        item.gyro_y = convert_range(packet.gyro_y, 8192);
-        item.gyro_z = convert_range(packet.gyro_z, 8192);
-        item.bno_roll = convert_range(data.bno_roll, 8);
-        item.bno_pitch = convert_range(data.bno_pitch, 8);
-        item.bno_yaw = convert_range(data.bno_yaw, 8);
-        item.mag_x = convert_range(packet.mag_x, 8);
-        item.mag_y = convert_range(packet.mag_y, 8);
-        item.mag_z = convert_range(packet.mag_z, 8);
+        const TelemetryDatapoint& data = frame.datapoints[i];
+        item.barometer_pressure = data.barometer_pressure;
+        item.barometer_temp = status.barometer_temp;
+        item.highG_ax = data.highG_ax;
+        item.highG_ay = data.highG_ay;
+        item.highG_az = data.highG_az;
+        item.gyro_x = status.gyro_x;
+        item.gyro_y = status.gyro_y;
+        item.gyro_z = status.gyro_z;
+        item.bno_roll = data.bno_roll;
+        item.bno_pitch = data.bno_pitch;
+        item.bno_yaw = data.bno_yaw;
+        item.mag_x = status.mag_x;
+        item.mag_y = status.mag_y;
+        item.mag_z = status.mag_z;
         item.flap_extension = data.flap_extension;
-        item.gps_alt = packet.gps_alt;
-        item.gps_lat = packet.gps_lat;
-        item.gps_long = packet.gps_long;
+        item.gps_alt = status.gps_alt;
+        item.gps_lat = status.gps_lat;
+        item.gps_long = status.gps_long;
         item.freq = frequency;
-        item.FSM_State = packet.FSM_State;
-        item.gnc_state_ax = packet.gnc_state_ax;
-        item.gnc_state_vx = packet.gnc_state_vx;
-        item.gnc_state_x = packet.gnc_state_x;
-        item.gnc_state_apo = packet.gnc_state_apo;
-        item.response_ID = packet.response_ID;
-        item.rssi = packet.rssi;
-        item.voltage_battery = convert_range(packet.voltage_battery, 16);
+        item.FSM_State = status.FSM_State;
+        item.gnc_state_ax = status.gnc_state_ax;
+        item.gnc_state_vx = status.gnc_state_vx;
+        item.gnc_state_x = status.gnc_state_x;
+        item.gnc_state_apo = status.gnc_state_apo;
+        item.gnc_state_apo_var = status.gnc_state_apo_var;
+        item.response_ID = status.response_ID;
+        item.rssi = status.rssi;
+        item.voltage_battery = status.voltage_battery;
         item.print_time = start_printing - start_timestamp + data.timestamp;
         print_queue.emplace(item);
     }
@@ -273,6 +227,7 @@ void printPacketJson(FullTelemetryData const& packet) {
     printJSONField("STE_VEL", packet.gnc_state_vx);
     printJSONField("STE_ACC", packet.gnc_state_ax);
     printJSONField("STE_APO", packet.gnc_state_apo);
+    printJSONField("STE_APO_VAR", packet.gnc_state_apo_var);
     printJSONField("BNO_YAW", packet.bno_yaw);
     printJSONField("BNO_PITCH", packet.bno_pitch);
     printJSONField("BNO_ROLL", packet.bno_roll);
@@ -281,6 +236,33 @@ void printPacketJson(FullTelemetryData const& packet) {
     Serial.println("}}");
 }
 
+// The range and mean of the high rate channels over the frame, printed as it arrives, with the last values of the
+// newest datapoint
+void printSummaryJson(const TelemetryFrame& frame) {
+    const TelemetryStatus& status = frame.status;
+    Serial.print(R"({"type": "summary", "value": {)");
+    if (frame.datapoint_count > 0) {
+        const TelemetryDatapoint& last = frame.datapoints[frame.datapoint_count - 1];
+        printJSONField("KX_IMU_ax_last", last.highG_ax);
+        printJSONField("KX_IMU_ay_last", last.highG_ay);
+        printJSONField("KX_IMU_az_last", last.highG_az);
+        printJSONField("flap_extension_last", last.flap_extension);
+    }
+    printJSONField("KX_IMU_ax_min", status.highG_ax_min);
+    printJSONField("KX_IMU_ax_max", status.highG_ax_max);
+    printJSONField("KX_IMU_ax_mean", status.highG_ax_mean);
+    printJSONField("KX_IMU_ay_min", status.highG_ay_min);
+    printJSONField("KX_IMU_ay_max", status.highG_ay_max);
+    printJSONField("KX_IMU_ay_mean", status.highG_ay_mean);
+    printJSONField("KX_IMU_az_min", status.highG_az_min);
+    printJSONField("KX_IMU_az_max", status.highG_az_max);
+    printJSONField("KX_IMU_az_mean", status.highG_az_mean);
+    printJSONField("flap_extension_min", status.flap_extension_min);
+    printJSONField("flap_extension_max", status.flap_extension_max);
+    printJSONField("flap_extension_mean", status.flap_extension_mean, false);
+    Serial.println("}}");
+}
+
 void PrintDequeue() {
     if (print_queue.empty()) return;
 
@@ -293,31 +275,33 @@ void PrintDequeue() {
 void SerialError() { Serial.println(json_command_parse_error); }
 
 void set_freq_local_bug_fix(float freq) {
-    telemetry_command t;
-    t.command = CommandType::EMPTY;
-    rf95.send((uint8_t*)&t, sizeof(t));
+    CommandUplink uplink;
+    uplink.link = link.report();
+    uplink.event_ack = event_ack;
+    uplink.base = commands.base();
+    rf95.send((uint8_t*)&uplink, commandUplinkSize(0));
     rf95.waitPacketSent();
     rf95.setFrequency(freq);
     current_freq = freq;
 }
 
 void SerialInput(const char* key, const char* value) {
-    /* If queue is not empty, do not accept new command*/
-    if (!cmd_queue.empty()) {
+    /* If the window is full, do not accept new command*/
+    if (commands.full()) {
         Serial.println(json_buffer_full_error);
         return;
     }
 
     telemetry_command command{};
     if (strcmp(key, "ABORT") == 0) {
-        command.command = CommandType::ABORT;
+        command.command = ABORT;
         command.do_abort = true;
     } else if (strcmp(key, "FREQ") == 0) {
-        command.command = CommandType::SET_FREQ;
+        command.command = SET_FREQ;
         float v = atof(value);
         command.freq = min(max(v, 390), 445);
     } else if (strcmp(key, "CALLSIGN") == 0) {
-        command.command = CommandType::SET_CALLSIGN;
+        command.command = SET_CALLSIGN;
         memset(command.callsign, ' ', sizeof(command.callsign));
         memcpy(command.callsign, value, min(strlen(value), sizeof(command.callsign)));
     } else if (strcmp(key, "FLOC") == 0) {
@@ -330,25 +314,161 @@ void SerialInput(const char* key, const char* value) {
         Serial.println("}");
         return;
     } else if (strcmp(key, "FLAP") == 0) {
-        command.command = CommandType::TEST_FLAP;
+        command.command = TEST_FLAPS;
     } else {
         SerialError();
         return;
     }
     Serial.println(json_command_success);
-    command_ID++;
-    command.id = command_ID;
-    cmd_queue.push({command, 0});
+    commands.push(command);
 }
 
 void process_command_queue() {
-    if (cmd_queue.empty()) return;
-
-    TelemetryCommandQueueElement cmd = cmd_queue.front();
-    rf95.send((uint8_t*)&cmd.command, sizeof(cmd.command));
+    // Answers even with nothing queued, so that TARS gets the link report
+    CommandUplink uplink;
+    uplink.link = link.report();
+    uplink.event_ack = event_ack;
+    commands.fill(uplink, [](const telemetry_command& command) {
+        Serial.print(R"({"type": "send_error", "error": "command_retries_exceded", "id":)");
+        Serial.print(command.id);
+        Serial.println("}");
+    });
+    rf95.send((uint8_t*)&uplink, commandUplinkSize(uplink.count));
     rf95.waitPacketSent();
 }
 
+// Takes the command_ack and command_sack of a frame or event message
+void acknowledge_commands(uint16_t ack, uint8_t sack) {
+    commands.sync(ack);
+    commands.acknowledge(ack, sack, [](const telemetry_command& command) {
+        if (command.command == SET_FREQ) {
+            set_freq_local_bug_fix(command.freq);
+            Serial.print(R"({"type": "freq_success", "frequency":)");
+            Serial.print(command.freq);
+            Serial.println("}");
+        }
+    });
+}
+
+void apply_link_profile() {
+    const LoRaProfile& profile = link_profiles[link.profile()];
+    // Coded packets carry whether they have a CRC in their LoRa header, so this only sets it for the commands
+    LoRaModemRegisters registers = loraModemRegisters(profile.modulation);
+    RH_RF95::ModemConfig config = {registers.reg_1d, registers.reg_1e, registers.reg_26};
+    rf95.setModemRegisters(&config);
+    fec.reset(profile.max_frame);
+    Serial.print(R"({"type": "link_profile", "profile":)");
+    Serial.print(link.profile());
+    Serial.println("}");
+}
+
+/**
+ * @brief Takes a frame received whole or decoded from coded packets.
+ *
+ * @param sequence RadioHead header id of the frame's first packet
+ * @param countdown its link_countdown, less the packets it took to come out of the decoder
+ * @param answer whether to answer in the window TARS listens in after it, which the blink and the printing would use
+ * up most of, so it is sent before them
+ */
+void handle_frame(const TelemetryFrame& frame, uint8_t sequence, int16_t rssi, int8_t snr, uint8_t countdown,
+                  bool answer) {
+    link.onFrame(sequence, rssi, snr, frame.status.link_next, countdown, millis());
+    acknowledge_commands(frame.status.command_ack, frame.status.command_sack);
+    if (answer) {
+        process_command_queue();
+    }
+    digitalWrite(LED_BUILTIN, HIGH);
+    delay(50);
+    digitalWrite(LED_BUILTIN, LOW);
+    EnqueuePacket(frame, current_freq);
+    printSummaryJson(frame);
+}
+
+/**
+ * @brief Takes an event message, printing the events that did not come in an earlier repeat of it.
+ *
+ * @param answer whether to answer in the window TARS listens in after it, sent before the printing like handle_frame
+ */
+void handle_events(const TelemetryEventMessage& message, uint8_t sequence, int16_t rssi, int8_t snr, bool answer) {
+    // Acknowledged before printing, so that the answer carries the new event_ack
+    uint8_t printed_ack = event_ack;
+    bool printed_any = have_events;
+    for (int i = 0; i < message.event_count; i++) {
+        const TelemetryEvent& event = message.events[i];
+        if (have_events && (uint8_t)(event.id - event_ack) >= 128) {
+            continue;
+        }
+        event_ack = event.id + 1;
+        have_events = true;
+    }
+    // Coded frames carry the link fields as well, and come out of the decoder with older sequences than this one
+    if (coded_frames) {
+        link.onPacket(millis());
+    } else {
+        link.onFrame(sequence, rssi, snr, message.link_next, message.link_countdown, millis());
+    }
+    acknowledge_commands(message.command_ack, message.command_sack);
+    if (answer) {
+        process_command_queue();
+    }
+
+    for (int i = 0; i < message.event_count; i++) {
+        const TelemetryEvent& event = message.events[i];
+        if (printed_any && (uint8_t)(event.id - printed_ack) >= 128) {
+            continue;
+        }
+        printed_ack = event.id + 1;
+        printed_any = true;
+        Serial.print(R"({"type": "event", "id":)");
+        Serial.print(event.id);
+        Serial.print(R"(, "kind": ")");
+        bool known = event.kind < sizeof(event_kind_names) / sizeof(event_kind_names[0]);
+        Serial.print(known ? event_kind_names[event.kind] : "unknown");
+        Serial.print(R"(", "value":)");
+        Serial.print(event.value);
+        Serial.print(R"(, "timestamp":)");
+        Serial.print(event.timestamp);
+        Serial.println("}");
+    }
+}
+
+/**
+ * @brief Takes a packet sent with ENABLE_TELEMETRY_FEC, which carries shares of several frames and completes the
+ * oldest, and prints how many bytes the decoder corrected in it.
+ */
+void receive_coded_packet(const uint8_t* buf, uint8_t len, bool listening) {
+    uint8_t sequence = rf95.headerId();
+    int16_t rssi = rf95.lastRssi();
+    int8_t snr = rf95.lastSnr();
+    coded_frames = true;
+    // Answers before decoding, which takes a while after a gap, for the reply to make the window. TARS runs each
+    // command once, so those it acknowledged in a frame still in the interleaver are only sent again.
+    if (listening) {
+        process_command_queue();
+    }
+    link.onPacket(millis());
+
+    // Too big for the stack
+    static TelemetryFrame frame;
+    fec.push(sequence, buf, len, [&](const uint8_t* data, size_t size, const FecResult& result) {
+        if (result.corrected != 0) {
+            Serial.print(R"({"type": "fec", "corrected":)");
+            Serial.print(result.corrected);
+            Serial.print(R"(, "erased":)");
+            Serial.print(result.erased);
+            Serial.println("}");
+        }
+        if (result.corrected < 0 || !decodeTelemetryFrame(data, size, frame)) {
+            return;
+        }
+        uint8_t countdown = frame.status.link_countdown;
+        if (countdown > 0) {
+            countdown = countdown > result.latency ? countdown - result.latency : 1;
+        }
+        handle_frame(frame, sequence - result.latency, rssi, snr, countdown, false);
+    });
+}
+
 SerialParser serial_parser(SerialInput, SerialError);
 
 void setup() {
@@ -376,8 +496,10 @@ void setup() {
     Serial.print(RF95_FREQ);
     Serial.println("}");
 
-    // Defaults after init are 434.0MHz, 13dBm, Bw = 125 kHz, Cr = 4/5, Sf =
-    // 128chips/symbol, CRC on
+    // TARS starts on the fallback profile, as the link does here
+    apply_link_profile();
+    // TARS only broadcasts, and the header of a coded packet has no CRC to keep a corrupted address from dropping it
+    rf95.setPromiscuous(true);
 
     // The default transmitter power is 13dBm, using PA_BOOST.
     // If you are using RFM95/96/97/98 modules which uses the PA_BOOST
@@ -424,41 +546,30 @@ void loop() {
     if (rf95.available()) {
         // Should be a message for us now
         uint8_t buf[RH_RF95_MAX_MESSAGE_LEN];
-        // telemetry_data data{};
-        TelemetryPacket packet;
+        // Too big for the stack
+        static TelemetryFrame frame;
+        static TelemetryEventMessage events;
         uint8_t len = sizeof(buf);
 
-        if (rf95.recv(buf, &len) && len == sizeof(packet)) {
-            digitalWrite(LED_BUILTIN, HIGH);
-            delay(50);
-            digitalWrite(LED_BUILTIN, LOW);
-            memcpy(&packet, buf, sizeof(packet));
-            EnqueuePacket(packet, current_freq);
-
-            if (!cmd_queue.empty()) {
-                auto& cmd = cmd_queue.front();
-                if (cmd.command.id == packet.response_ID) {
-                    if (cmd.command.command == CommandType::SET_FREQ) {
-                        set_freq_local_bug_fix(cmd.command.freq);
-                        Serial.print(R"({"type": "freq_success", "frequency":)");
-                        Serial.print(cmd.command.freq);
-                        Serial.println("}");
-                    }
-                    cmd_queue.pop();
-                } else {
-                    cmd.retry_count++;
-                    if (cmd.retry_count >= max_command_retries) {
-                        cmd_queue.pop();
-                        Serial.println(json_send_failure);
-                    }
-                }
-            }
-
-            process_command_queue();
-
+        bool received = rf95.recv(buf, &len);
+        if (received && (rf95.headerFlags() & TELEMETRY_FLAG_FEC)) {
+            receive_coded_packet(buf, len, rf95.headerFlags() & TELEMETRY_FLAG_LISTENING);
+        } else if (received && decodeTelemetryFrame(buf, len, frame)) {
+            // TARS only listens after frames flagged for it
+            coded_frames = false;
+            handle_frame(frame, rf95.headerId(), rf95.lastRssi(), rf95.lastSnr(), frame.status.link_countdown,
+                         rf95.headerFlags() & TELEMETRY_FLAG_LISTENING);
+        } else if (received && decodeTelemetryEvents(buf, len, events)) {
+            // Sent whole even with ENABLE_TELEMETRY_FEC, and always listened after for the acknowledgement
+            handle_events(events, rf95.headerId(), rf95.lastRssi(), rf95.lastSnr(),
+                          rf95.headerFlags() & TELEMETRY_FLAG_LISTENING);
         } else {
             Serial.println(json_receive_failure);
         }
     }
+    // Switches once done with the frame that ends an announcement, or falls back when TARS has gone quiet
+    if (link.update(millis())) {
+        apply_link_profile();
+    }
     serial_parser.read();
 }
\ No newline at end of file